@@ -0,0 +1,78 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#include "anim.h"
+
+#include <stdint.h>
+#include "platform.h"
+
+#include "uart.h"
+#include "cycles.h"
+#include "events.h"
+#include "perf.h"
+
+const uint8_t *anim_frame(pmodoled_t *disp, const uint8_t *frame)
+{
+    unsigned count = *frame++;
+    for (unsigned w=0; w<count; ++w) {
+        unsigned first = frame[0] >> 4;
+        unsigned last = frame[0] & 15;
+        unsigned lo = frame[1];
+        unsigned end = frame[2];
+        frame += 3;
+        pmodoled_window(disp, first, last, lo, end);
+        unsigned left = (last - first + 1) * (end - lo);
+        while (left) {
+            unsigned token = *frame++;
+            unsigned n = (token & 0x7f) + 1;
+            if (token & 0x80) {
+                spi_fill(*frame++, n);
+            } else {
+                spi_write(frame, n);
+                frame += n;
+            }
+            left -= n;
+        }
+    }
+    return frame;
+}
+
+void anim_play(pmodoled_t *disp, const struct anim *anim)
+{
+    const uint8_t *frame = anim->data;
+    /* Frame after the first, where playback continues after the loop frame */
+    const uint8_t *second = 0;
+    unsigned i = 0;
+    uint64_t next = get_timer_value();
+    char c;
+    while (!uart_getc(&c)) {
+        PERF_START(t);
+        const uint8_t *end = anim_frame(disp, frame);
+        PERF_FRAME(rdcycle() - t);
+#ifdef HOST
+        pmodoled_host_frame();
+#endif
+        if (!second) {
+            second = end;
+        }
+        if (++i == anim->frames) {
+            frame = anim->loop;
+            i = 0;
+        } else if (i == 1) {
+            frame = second;
+        } else {
+            frame = end;
+        }
+        if (anim->frame_ticks) {
+            next += anim->frame_ticks;
+            uint64_t now = get_timer_value();
+            if (now < next) {
+                event_sleep(next - now);
+            } else {
+                next = now; /* fell behind, don't try to catch up */
+            }
+        }
+    }
+    /* Display memory no longer matches the framebuffer */
+    pmodoled_invalidate(disp);
+}
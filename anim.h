@@ -0,0 +1,46 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#ifndef H_ANIM
+#define H_ANIM
+/* Playback of pre-rendered animations from flash.
+ *
+ * Animations are compressed on the host by tools/anim2c.py. Every frame is
+ * coded as the change from the frame before it, as it stands in display
+ * memory, so playback only sends what changes and keeps no frame in RAM:
+ *
+ *   frame:  count window[count]
+ *   window: pages lo end tokens
+ *
+ * pages holds the first page in the high nibble and the last page in the
+ * low nibble, and lo and end are the column range [lo, end). The tokens
+ * are the new contents of the window, page by page, run-length coded as in
+ * stream.h. Runs go to the display with spi_fill() and literal bytes with
+ * spi_write() straight from flash.
+ *
+ * After the last frame comes a frame that changes the last frame back to the
+ * first, for looping.
+ */
+#include <stdint.h>
+#include "display.h"
+
+struct anim {
+    uint16_t frames;
+    /** Time per frame in 32768 Hz ticks, 0 for as fast as the display can
+     * be sent to */
+    uint16_t frame_ticks;
+    const uint8_t *data;
+    /** Frame from the last frame back to the first */
+    const uint8_t *loop;
+};
+
+/** Send one coded frame to disp. Returns pointer to the next frame. */
+const uint8_t *anim_frame(pmodoled_t *disp, const uint8_t *frame);
+/** Play animation on disp, looping, until a character is received on the UART.
+ * The display must be cleared before. */
+void anim_play(pmodoled_t *disp, const struct anim *anim);
+
+/** Mandelbrot zoom, see the Makefile */
+extern const struct anim anim_zoom;
+
+#endif
@@ -0,0 +1,2421 @@
+// Generated by tools/anim2c.py from a 240 frame mandelbrot zoom, do not edit
+#include "anim.h"
+
+static const uint8_t anim_zoom_data[38530] = {
+    0x01, 0x03, 0x00, 0x80, 0xa6, 0xff, 0x05, 0x9f, 0xc7, 0xf1, 0xf8, 0xfc, 0xfe, 0x82, 0xff, 0x82,
+    0x7f, 0x30, 0xff, 0xbf, 0x3f, 0x5f, 0x5f, 0x4f, 0x67, 0x67, 0x63, 0x73, 0x71, 0xb0, 0x98, 0x48,
+    0xc8, 0x1c, 0x4c, 0x0a, 0x0a, 0x01, 0x0d, 0x05, 0x08, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x09,
+    0x0a, 0x05, 0x03, 0x0b, 0x1a, 0x1e, 0x14, 0xb0, 0x89, 0x73, 0x8f, 0x3f, 0xff, 0xfe, 0xfc, 0xf8,
+    0xf0, 0xe0, 0x80, 0x92, 0x00, 0x02, 0x03, 0x0f, 0x3f, 0xab, 0xff, 0x1a, 0x6c, 0xa7, 0xc3, 0x83,
+    0x01, 0x61, 0x70, 0x08, 0x2c, 0xec, 0xde, 0xa7, 0x2f, 0x14, 0x0e, 0x04, 0x02, 0x01, 0x01, 0x02,
+    0x00, 0x00, 0x01, 0x01, 0x07, 0x02, 0x03, 0x94, 0x00, 0x08, 0x40, 0x40, 0x50, 0x10, 0xf1, 0xff,
+    0x00, 0x00, 0x07, 0x84, 0xff, 0x01, 0xfe, 0xf0, 0x93, 0x00, 0x00, 0x01, 0xaa, 0xff, 0x1d, 0xe6,
+    0x1c, 0x78, 0xf8, 0xf0, 0xf0, 0xf1, 0xe3, 0xe2, 0xe6, 0xee, 0xce, 0xde, 0xc3, 0xad, 0x85, 0x42,
+    0x58, 0x58, 0xe8, 0xf0, 0xe0, 0xd0, 0xd8, 0x98, 0x2e, 0x18, 0x00, 0x40, 0x40, 0x94, 0x00, 0x05,
+    0x29, 0xd9, 0x3f, 0x80, 0xe0, 0xfc, 0x83, 0xff, 0x02, 0x3f, 0x0f, 0x01, 0x92, 0x00, 0x01, 0x80,
+    0xf8, 0xac, 0xff, 0x0a, 0xfc, 0xf1, 0xe3, 0x87, 0x0f, 0x0f, 0x1f, 0x3f, 0x3f, 0x7f, 0x7f, 0x84,
+    0xff, 0x29, 0xfe, 0xfe, 0xfc, 0xf8, 0xf8, 0xf1, 0xf1, 0xe1, 0xc3, 0xc2, 0x85, 0x85, 0x08, 0x0a,
+    0x19, 0x34, 0x76, 0xe8, 0xc8, 0x20, 0xc0, 0xa0, 0x40, 0xe0, 0x60, 0x48, 0x36, 0x18, 0x8b, 0x8d,
+    0xc5, 0xe5, 0xe3, 0x72, 0x7c, 0x3e, 0x1f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x91, 0x00, 0x04, 0x80,
+    0xc0, 0xe0, 0xf8, 0xfe, 0x86, 0xff, 0x01, 0x03, 0x25, 0x7c, 0x07, 0xff, 0x7f, 0x8f, 0xe3, 0xf1,
+    0xf8, 0xfc, 0xfe, 0x82, 0xff, 0x82, 0x7f, 0x30, 0xbf, 0xbf, 0x7f, 0x5f, 0x4f, 0x6f, 0x67, 0x67,
+    0x63, 0x71, 0x31, 0xb0, 0x98, 0x48, 0xe8, 0x1c, 0x40, 0x02, 0x0a, 0x0d, 0x0d, 0x07, 0x02, 0x0c,
+    0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x07, 0x03, 0x07, 0x13, 0x0a, 0x0a, 0x14, 0x64, 0x71, 0x73,
+    0xc7, 0x1f, 0x7f, 0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xc0, 0x92, 0x00, 0x18, 0x01, 0x03, 0x0f, 0x7f,
+    0xff, 0xaf, 0xae, 0xe7, 0x83, 0xc1, 0x01, 0x61, 0x70, 0x08, 0xec, 0xae, 0xbe, 0x87, 0xa3, 0x14,
+    0x07, 0x04, 0x01, 0x00, 0x01, 0x82, 0x00, 0x04, 0x01, 0x01, 0x02, 0x00, 0x03, 0x97, 0x00, 0x05,
+    0x07, 0xe7, 0xff, 0x00, 0x00, 0x03, 0x85, 0xff, 0x00, 0xfc, 0x94, 0x00, 0x1f, 0x0f, 0xff, 0xce,
+    0x3c, 0xf8, 0xf8, 0xf0, 0xf0, 0xf1, 0xe3, 0xe6, 0xe6, 0xef, 0xce, 0xdf, 0xc7, 0x9f, 0x85, 0x44,
+    0x58, 0x58, 0xe8, 0xf0, 0xc0, 0xd0, 0xd8, 0x98, 0x2e, 0x18, 0x00, 0x00, 0x40, 0x93, 0x00, 0x06,
+    0xf0, 0xa5, 0xcc, 0x7f, 0x00, 0xc0, 0xf8, 0x83, 0xff, 0x02, 0x7f, 0x1f, 0x03, 0x93, 0x00, 0x01,
+    0xc0, 0xfe, 0x82, 0xff, 0x09, 0xfc, 0xf1, 0xc3, 0x87, 0x0f, 0x1f, 0x1f, 0x3f, 0x7f, 0x7f, 0x85,
+    0xff, 0x29, 0xfe, 0xfe, 0xfc, 0xf8, 0xf8, 0xf1, 0xe1, 0xe1, 0xc3, 0xc2, 0x85, 0x84, 0x0a, 0x08,
+    0x18, 0x34, 0x74, 0xe8, 0xc0, 0x20, 0x10, 0x20, 0x40, 0x60, 0xf2, 0x58, 0x36, 0x18, 0x1a, 0x8d,
+    0x8d, 0xc6, 0xe6, 0x72, 0x79, 0x3e, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x92, 0x00, 0x03, 0x80,
+    0xc0, 0xf0, 0xfc, 0x82, 0xff, 0x01, 0x03, 0x25, 0x7c, 0x09, 0xff, 0x3f, 0xcf, 0xe3, 0xf8, 0xfc,
+    0xfe, 0xfe, 0xff, 0xff, 0x83, 0x7f, 0x17, 0xbf, 0xbf, 0xdf, 0x5f, 0x4f, 0x6f, 0x67, 0x63, 0x73,
+    0x71, 0xb1, 0xb0, 0x98, 0x48, 0xe4, 0x1c, 0x10, 0x02, 0x0b, 0x0d, 0x05, 0x06, 0x06, 0x02, 0x85,
+    0x00, 0x13, 0x06, 0x0a, 0x05, 0x0b, 0x1b, 0x0a, 0x12, 0x6c, 0x40, 0xb9, 0xe7, 0x0f, 0x3f, 0xff,
+    0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0x80, 0x92, 0x00, 0x1d, 0x01, 0x07, 0x1f, 0xff, 0x1b, 0xa7, 0xa3,
+    0xc3, 0xa1, 0x01, 0x70, 0x00, 0x08, 0xcc, 0xce, 0x1e, 0xa7, 0x83, 0x04, 0x16, 0x04, 0x03, 0x00,
+    0x02, 0x03, 0x01, 0x02, 0x01, 0x01, 0x02, 0x97, 0x00, 0x08, 0x40, 0x20, 0xa8, 0x0b, 0xfc, 0x00,
+    0x00, 0x01, 0x9f, 0x84, 0xff, 0x00, 0xfe, 0x95, 0x00, 0x1e, 0xff, 0xde, 0x3c, 0xf8, 0xf8, 0xf0,
+    0xf0, 0xe1, 0xe2, 0xe6, 0xe6, 0xcf, 0xde, 0xda, 0xe7, 0x85, 0x94, 0x40, 0x50, 0x58, 0xe8, 0xe0,
+    0xc8, 0xd0, 0xd8, 0xb8, 0x2e, 0x18, 0x20, 0x40, 0x80, 0x94, 0x00, 0x05, 0xc0, 0x9a, 0xf7, 0x00,
+    0x80, 0xf0, 0x83, 0xff, 0x02, 0x7f, 0x3f, 0x0f, 0x93, 0x00, 0x0e, 0x80, 0xf0, 0xff, 0xff, 0xfe,
+    0xf8, 0xe1, 0xc3, 0x87, 0x0f, 0x1f, 0x3f, 0x3f, 0x7f, 0x7f, 0x85, 0xff, 0x2a, 0xfe, 0xfc, 0xfc,
+    0xf8, 0xf9, 0xf1, 0xe1, 0xe3, 0xc3, 0xc2, 0x85, 0x84, 0x08, 0x0a, 0x10, 0x37, 0x76, 0xea, 0xc8,
+    0x22, 0x00, 0x60, 0x00, 0x50, 0xe0, 0x0e, 0x3e, 0x1c, 0x18, 0x8b, 0x8e, 0xc6, 0xe4, 0xf1, 0x79,
+    0x7c, 0x3f, 0x1f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x92, 0x00, 0x05, 0x80, 0xe0, 0xf0, 0xfc, 0xff,
+    0xff, 0x01, 0x03, 0x25, 0x7d, 0x06, 0xff, 0x9f, 0xc7, 0xf1, 0xf8, 0xfc, 0xfe, 0x82, 0xff, 0x82,
+    0x7f, 0x18, 0xbf, 0x3f, 0xbf, 0x5f, 0x5f, 0x6f, 0x6f, 0x67, 0x63, 0x73, 0xf1, 0xb0, 0xb8, 0x98,
+    0x48, 0xa4, 0x1c, 0x52, 0x06, 0x0d, 0x05, 0x05, 0x02, 0x07, 0x02, 0x86, 0x00, 0x12, 0x02, 0x05,
+    0x0b, 0x13, 0x0a, 0x12, 0x28, 0xdc, 0x89, 0x73, 0x8f, 0x1f, 0xff, 0xff, 0xfe, 0xfc, 0xf8, 0xe0,
+    0xc0, 0x93, 0x00, 0x1f, 0x03, 0x0f, 0x3f, 0xff, 0x6d, 0xa7, 0x83, 0x83, 0xa1, 0x21, 0x30, 0x08,
+    0x68, 0xcc, 0x9e, 0x1f, 0xbf, 0x11, 0x04, 0x10, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x01, 0x00,
+    0x03, 0x02, 0x00, 0x02, 0x96, 0x00, 0x07, 0x20, 0xe8, 0x08, 0xf8, 0xff, 0x00, 0x00, 0x07, 0x85,
+    0xff, 0x00, 0xf8, 0x94, 0x00, 0x1f, 0x03, 0xf6, 0x9c, 0x78, 0xf8, 0xf0, 0xf0, 0xf1, 0xe1, 0xe2,
+    0xe6, 0xee, 0xcf, 0xdc, 0xda, 0xa7, 0xa7, 0x9e, 0x44, 0x50, 0x58, 0xc8, 0xc0, 0xc8, 0xd0, 0xd8,
+    0xb8, 0x2e, 0x18, 0x00, 0x00, 0x80, 0x94, 0x00, 0x06, 0x44, 0x24, 0xe3, 0x1f, 0x80, 0xe0, 0xfc,
+    0x83, 0xff, 0x02, 0x3f, 0x1f, 0x01, 0x93, 0x00, 0x0d, 0xc0, 0xfc, 0xff, 0xff, 0xfc, 0xf8, 0xe3,
+    0xc7, 0x0f, 0x0f, 0x1f, 0x3f, 0x3f, 0x7f, 0x85, 0xff, 0x2b, 0xfe, 0xfe, 0xfc, 0xfc, 0xf8, 0xf1,
+    0xf1, 0xe1, 0xc3, 0xc2, 0x82, 0x85, 0x04, 0x08, 0x0a, 0x12, 0x37, 0x74, 0xea, 0xc8, 0x3a, 0x10,
+    0x00, 0x80, 0x20, 0xd2, 0x00, 0x68, 0x34, 0x1b, 0x1a, 0x8a, 0xcf, 0xc6, 0xe0, 0x73, 0x7c, 0x3e,
+    0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x92, 0x00, 0x06, 0x80, 0xc0, 0xe0, 0xf8, 0xfe, 0xff, 0xff,
+    0x01, 0x03, 0x25, 0x7d, 0x08, 0xff, 0x9f, 0xe3, 0xf1, 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0x83, 0x7f,
+    0x19, 0xbf, 0x3f, 0xff, 0x5f, 0xdf, 0x6f, 0x67, 0xe7, 0xf3, 0xf1, 0xf1, 0xb0, 0x98, 0x98, 0x48,
+    0xa4, 0x1c, 0x0e, 0x06, 0x01, 0x0d, 0x05, 0x02, 0x07, 0x02, 0x04, 0x84, 0x00, 0x14, 0x07, 0x07,
+    0x01, 0x05, 0x13, 0x03, 0x02, 0x46, 0x28, 0x91, 0x73, 0xc7, 0x1f, 0x7f, 0xff, 0xfe, 0xfc, 0xf8,
+    0xf0, 0xe0, 0x80, 0x92, 0x00, 0x13, 0x01, 0x03, 0x1f, 0xff, 0x6e, 0xe7, 0x83, 0x81, 0xc1, 0x20,
+    0x30, 0x48, 0x2c, 0x8c, 0x9e, 0xd7, 0x07, 0x11, 0x0e, 0x18, 0x82, 0x01, 0x82, 0x00, 0x04, 0x01,
+    0x00, 0x02, 0x00, 0x04, 0x97, 0x00, 0x07, 0x40, 0x70, 0x12, 0xf1, 0xff, 0x00, 0x00, 0x03, 0x85,
+    0xff, 0x00, 0xfc, 0x95, 0x00, 0x1e, 0xe6, 0x3c, 0x78, 0xf8, 0xf0, 0xf0, 0xf1, 0xe1, 0xe2, 0xe6,
+    0xee, 0xcf, 0xdc, 0xd2, 0xa5, 0xa1, 0x54, 0x40, 0x50, 0xd8, 0xc0, 0xc0, 0xc8, 0xd0, 0x98, 0xb8,
+    0x2e, 0x58, 0x60, 0x00, 0x80, 0x93, 0x00, 0x07, 0x40, 0x20, 0x2b, 0xc9, 0x7f, 0x00, 0xc0, 0xf8,
+    0x83, 0xff, 0x02, 0x7f, 0x1f, 0x07, 0x94, 0x00, 0x0c, 0xe0, 0xff, 0xff, 0xfc, 0xf1, 0xc3, 0x87,
+    0x0f, 0x1f, 0x1f, 0x3f, 0x7f, 0x7f, 0x85, 0xff, 0x2c, 0xfe, 0xfe, 0xfc, 0xfc, 0xf8, 0xf1, 0xf1,
+    0xe1, 0xc3, 0xc2, 0x82, 0x87, 0x00, 0x08, 0x08, 0x12, 0x36, 0x74, 0xe8, 0xc8, 0x22, 0xc0, 0x40,
+    0x00, 0x80, 0x50, 0xa8, 0x6a, 0x36, 0x1a, 0x18, 0x8a, 0x8a, 0xc4, 0xe4, 0xf3, 0x79, 0x7e, 0x3f,
+    0x1f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x92, 0x00, 0x05, 0x80, 0xc0, 0xf0, 0xfc, 0xff, 0xff, 0x01,
+    0x03, 0x24, 0x7e, 0x06, 0xff, 0x7f, 0xcf, 0xe3, 0xf8, 0xfc, 0xfe, 0x82, 0xff, 0x82, 0x7f, 0x1a,
+    0x3f, 0xbf, 0x3f, 0xdf, 0x9f, 0x8f, 0xef, 0xe7, 0xe7, 0xf3, 0xf1, 0xb1, 0xb8, 0x98, 0x98, 0x4c,
+    0xe4, 0x18, 0x1e, 0x00, 0x0d, 0x01, 0x08, 0x02, 0x07, 0x03, 0x04, 0x84, 0x00, 0x14, 0x04, 0x05,
+    0x06, 0x01, 0x09, 0x03, 0x02, 0x46, 0xc4, 0xc4, 0xb9, 0xe7, 0x0f, 0x3f, 0xff, 0xff, 0xfe, 0xfc,
+    0xf8, 0xe0, 0xc0, 0x93, 0x00, 0x15, 0x01, 0x07, 0x3f, 0xff, 0x97, 0xe7, 0xe3, 0xc3, 0xe1, 0xa1,
+    0x30, 0x60, 0x28, 0x0c, 0x8e, 0xbe, 0xc7, 0xa7, 0x15, 0x0e, 0x04, 0x05, 0x82, 0x01, 0x07, 0x03,
+    0x01, 0x01, 0x00, 0x02, 0x00, 0x05, 0x02, 0x97, 0x00, 0x06, 0x40, 0x10, 0xe7, 0xff, 0x00, 0x00,
+    0x01, 0x85, 0xff, 0x01, 0xfe, 0xf0, 0x94, 0x00, 0x20, 0x01, 0xff, 0xce, 0x3c, 0xf8, 0xf8, 0xf0,
+    0xf0, 0xe1, 0xe3, 0xe2, 0xe6, 0xce, 0xcf, 0xdd, 0xd2, 0xa4, 0xb0, 0x40, 0x40, 0x50, 0xd8, 0xd0,
+    0xc0, 0xc8, 0xd0, 0x98, 0xb8, 0x2e, 0x58, 0xe0, 0x00, 0xc0, 0x94, 0x00, 0x06, 0xc0, 0xd5, 0x9c,
+    0xff, 0x00, 0xc0, 0xf0, 0x84, 0xff, 0x01, 0x3f, 0x0f, 0x94, 0x00, 0x0d, 0x80, 0xf0, 0xff, 0xff,
+    0xfe, 0xf8, 0xf1, 0xc3, 0x87, 0x0f, 0x1f, 0x3f, 0x3f, 0x7f, 0x86, 0xff, 0x2c, 0xfe, 0xfe, 0xfc,
+    0xf8, 0xf9, 0xf1, 0xe1, 0xe1, 0xc3, 0xc2, 0x86, 0x87, 0x00, 0x08, 0x18, 0x16, 0x37, 0x64, 0xea,
+    0xc0, 0x20, 0xe0, 0x60, 0x80, 0x80, 0x40, 0x2e, 0x58, 0x30, 0x34, 0x19, 0x1b, 0x8a, 0xc8, 0xe7,
+    0xf0, 0x79, 0x7c, 0x3f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x93, 0x00, 0x05, 0xc0, 0xe0, 0xf8,
+    0xfe, 0xff, 0xff, 0x01, 0x03, 0x24, 0x7f, 0x08, 0xff, 0x3f, 0xc7, 0xf1, 0xf8, 0xfc, 0xfe, 0xff,
+    0xff, 0x83, 0x7f, 0x12, 0xbf, 0xbf, 0x3f, 0x1f, 0x1f, 0xaf, 0xef, 0xe7, 0xf3, 0x73, 0xf1, 0xb0,
+    0xb8, 0x98, 0x58, 0x4c, 0xe4, 0x3a, 0x3e, 0x82, 0x01, 0x04, 0x08, 0x06, 0x03, 0x02, 0x04, 0x86,
+    0x00, 0x12, 0x06, 0x01, 0x05, 0x1b, 0x0b, 0x06, 0x86, 0x64, 0x19, 0xf3, 0x0f, 0x1f, 0xff, 0xff,
+    0xfe, 0xfc, 0xf8, 0xf0, 0xc0, 0x94, 0x00, 0x19, 0x03, 0x0f, 0x7f, 0xff, 0x2d, 0xe7, 0xc3, 0x81,
+    0xe1, 0x21, 0x70, 0x68, 0x28, 0x4c, 0x8e, 0xfe, 0x87, 0xa3, 0x14, 0x0e, 0x14, 0x07, 0x01, 0x00,
+    0x03, 0x02, 0x82, 0x01, 0x03, 0x00, 0x00, 0x05, 0x02, 0x96, 0x00, 0x04, 0x40, 0x20, 0xea, 0x0c,
+    0xfc, 0x82, 0x00, 0x00, 0x07, 0x85, 0xff, 0x00, 0xfc, 0x95, 0x00, 0x04, 0x07, 0xfb, 0x9c, 0x7c,
+    0xf8, 0x82, 0xf0, 0x18, 0xe1, 0xe3, 0xe6, 0xe6, 0xce, 0xde, 0xde, 0xb2, 0x8c, 0xa1, 0x58, 0x40,
+    0x50, 0xc8, 0xc8, 0xc0, 0xc0, 0xd0, 0xb8, 0xa8, 0x2e, 0x5c, 0xe0, 0x00, 0xc0, 0x95, 0x00, 0x06,
+    0x44, 0xa6, 0xe3, 0x00, 0x80, 0xe0, 0xfe, 0x83, 0xff, 0x02, 0x7f, 0x1f, 0x03, 0x94, 0x00, 0x0d,
+    0xc0, 0xfe, 0xff, 0xff, 0xfe, 0xf8, 0xe3, 0xc7, 0x0f, 0x0f, 0x1f, 0x3f, 0x7f, 0x7f, 0x86, 0xff,
+    0x2c, 0xfe, 0xfc, 0xfc, 0xf8, 0xf9, 0xf1, 0xe1, 0xe3, 0xc3, 0xc2, 0x84, 0x07, 0x09, 0x0c, 0x14,
+    0x14, 0x37, 0x6c, 0xe8, 0xc0, 0x30, 0x60, 0xc0, 0x80, 0x40, 0xf0, 0xc8, 0x54, 0x68, 0x34, 0x18,
+    0x1b, 0x8a, 0x88, 0xc4, 0xe4, 0xf3, 0x7c, 0x7e, 0x3f, 0x1f, 0x0f, 0x0f, 0x07, 0x03, 0x93, 0x00,
+    0x06, 0x80, 0xc0, 0xf0, 0xf8, 0xfe, 0xff, 0xff, 0x01, 0x03, 0x24, 0x7f, 0x07, 0xff, 0x9f, 0xe7,
+    0xf1, 0xf8, 0xfc, 0xfe, 0xff, 0x83, 0x7f, 0x1b, 0x3f, 0xbf, 0xbf, 0x5f, 0x9f, 0x1f, 0xaf, 0xa7,
+    0xe7, 0x73, 0x73, 0xf1, 0xb8, 0xb8, 0x98, 0x4c, 0x0c, 0x84, 0x3a, 0x32, 0x21, 0x01, 0x04, 0x02,
+    0x02, 0x05, 0x06, 0x07, 0x84, 0x00, 0x15, 0x04, 0x05, 0x07, 0x02, 0x01, 0x1d, 0x07, 0x07, 0x0e,
+    0xa8, 0x44, 0x73, 0xc7, 0x1f, 0x7f, 0xff, 0xff, 0xfe, 0xfc, 0xf0, 0xe0, 0x80, 0x93, 0x00, 0x20,
+    0x01, 0x03, 0x1f, 0xff, 0x2e, 0xe7, 0xc3, 0x81, 0xa1, 0x00, 0x70, 0x28, 0x4c, 0x8c, 0x9e, 0xf7,
+    0xef, 0xa3, 0x14, 0x1e, 0x18, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x05,
+    0x02, 0x96, 0x00, 0x08, 0x40, 0x00, 0xf0, 0x08, 0xf8, 0xff, 0x00, 0x00, 0x03, 0x85, 0xff, 0x00,
+    0xfe, 0x96, 0x00, 0x03, 0xf6, 0x1c, 0x78, 0xf8, 0x82, 0xf0, 0x18, 0xe1, 0xe2, 0xe6, 0xe6, 0xcf,
+    0xde, 0xdf, 0xa6, 0x8d, 0xe4, 0x58, 0x40, 0xd0, 0xc8, 0xd8, 0xc0, 0xc0, 0xd0, 0xb8, 0xa8, 0x22,
+    0x5c, 0xe0, 0x00, 0xc0, 0x94, 0x00, 0x07, 0x80, 0x40, 0x09, 0xd1, 0x3f, 0x00, 0xc0, 0xf8, 0x83,
+    0xff, 0x02, 0x7f, 0x3f, 0x07, 0x95, 0x00, 0x0c, 0xe0, 0xff, 0xff, 0xfc, 0xf1, 0xe3, 0x87, 0x0f,
+    0x1f, 0x3f, 0x3f, 0x7f, 0x7f, 0x86, 0xff, 0x2d, 0xfe, 0xfc, 0xfc, 0xf8, 0xf1, 0xf1, 0xe1, 0xe3,
+    0xc3, 0x82, 0x84, 0x07, 0x08, 0x0c, 0x14, 0x14, 0x34, 0x6c, 0xec, 0xd0, 0x18, 0x40, 0xa0, 0xc0,
+    0x80, 0xe0, 0xc0, 0x84, 0x68, 0x34, 0x38, 0x19, 0x0a, 0x89, 0xc2, 0xe6, 0xf2, 0xf9, 0x7e, 0x3f,
+    0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x93, 0x00, 0x05, 0x80, 0xc0, 0xf0, 0xfc, 0xff, 0xff, 0x01,
+    0x03, 0x23, 0x80, 0x08, 0xff, 0x7f, 0xcf, 0xe3, 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0x83, 0x7f, 0x1b,
+    0x3f, 0xbf, 0x3f, 0x5f, 0x5f, 0x2f, 0xaf, 0xa7, 0xf7, 0x73, 0x71, 0xb1, 0xb8, 0xb8, 0x98, 0x4c,
+    0x04, 0xc4, 0x2a, 0x32, 0x01, 0x01, 0x04, 0x0e, 0x02, 0x01, 0x02, 0x07, 0x85, 0x00, 0x14, 0x03,
+    0x01, 0x02, 0x0d, 0x05, 0x0d, 0x0d, 0x42, 0x8a, 0xcc, 0xb9, 0xe3, 0x0f, 0x3f, 0xff, 0xff, 0xfe,
+    0xfc, 0xf8, 0xf0, 0xc0, 0x94, 0x00, 0x21, 0x01, 0x07, 0x3f, 0xff, 0x7f, 0x66, 0xe3, 0x83, 0x81,
+    0x81, 0x20, 0x60, 0x28, 0x0c, 0x8e, 0xfe, 0x97, 0xb7, 0x03, 0x1c, 0x07, 0x0b, 0x06, 0x01, 0x00,
+    0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x03, 0x07, 0x02, 0x97, 0x00, 0x04, 0x40, 0xe0, 0x02, 0xf2,
+    0xff, 0x82, 0x00, 0x86, 0xff, 0x00, 0xf8, 0x95, 0x00, 0x22, 0x01, 0xff, 0xce, 0x3c, 0xf8, 0xf8,
+    0xf0, 0xf0, 0xe1, 0xe1, 0xe2, 0xe6, 0xce, 0xcf, 0xdc, 0xda, 0xa7, 0xaf, 0x4e, 0x58, 0x40, 0xd0,
+    0xc8, 0xc8, 0xc0, 0xc0, 0xd8, 0xb8, 0xa8, 0x22, 0x5c, 0xe0, 0x00, 0x00, 0x80, 0x93, 0x00, 0x07,
+    0x40, 0xa0, 0x15, 0xd9, 0xff, 0x00, 0x80, 0xf0, 0x84, 0xff, 0x02, 0x7f, 0x1f, 0x01, 0x94, 0x00,
+    0x01, 0x80, 0xf8, 0x82, 0xff, 0x08, 0xf8, 0xf1, 0xc3, 0x87, 0x0f, 0x1f, 0x3f, 0x3f, 0x7f, 0x86,
+    0xff, 0x2e, 0xfe, 0xfe, 0xfc, 0xfc, 0xf9, 0xf1, 0xf1, 0xe1, 0xc3, 0xc3, 0x82, 0x84, 0x07, 0x0c,
+    0x0d, 0x14, 0x12, 0x34, 0x68, 0xec, 0xc0, 0x84, 0x40, 0x80, 0x40, 0x80, 0x80, 0xc0, 0xa8, 0x68,
+    0x30, 0x34, 0x18, 0x19, 0x88, 0x8c, 0xc2, 0xe1, 0xf9, 0x7c, 0x7f, 0x3f, 0x1f, 0x0f, 0x0f, 0x07,
+    0x01, 0x94, 0x00, 0x05, 0x80, 0xe0, 0xf8, 0xfe, 0xff, 0xff, 0x01, 0x03, 0x23, 0x80, 0x07, 0xff,
+    0x3f, 0xc7, 0xf1, 0xf8, 0xfc, 0xfe, 0xff, 0x83, 0x7f, 0x1c, 0x3f, 0xbf, 0xbf, 0x7f, 0xdf, 0x5f,
+    0x2f, 0xaf, 0xa7, 0xb3, 0xf3, 0x71, 0xb9, 0xb8, 0x98, 0xd8, 0x4c, 0x84, 0x06, 0x2e, 0x14, 0x05,
+    0x03, 0x02, 0x06, 0x02, 0x01, 0x06, 0x03, 0x85, 0x00, 0x15, 0x04, 0x01, 0x02, 0x05, 0x01, 0x0d,
+    0x05, 0x01, 0x76, 0xf8, 0x19, 0xf3, 0x07, 0x1f, 0x7f, 0xff, 0xff, 0xfe, 0xfc, 0xf0, 0xe0, 0x80,
+    0x94, 0x00, 0x20, 0x03, 0x0f, 0x7f, 0x3b, 0xe7, 0xc3, 0x81, 0xa1, 0xa0, 0x30, 0x20, 0x08, 0x0c,
+    0x8e, 0xfe, 0x37, 0xdf, 0x05, 0x1e, 0x13, 0x03, 0x05, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00,
+    0x01, 0x03, 0x03, 0x02, 0x99, 0x00, 0x02, 0x90, 0x66, 0xfe, 0x82, 0x00, 0x00, 0x07, 0x85, 0xff,
+    0x00, 0xfe, 0x96, 0x00, 0x03, 0xfd, 0x9e, 0x7c, 0xf8, 0x82, 0xf0, 0x19, 0xe1, 0xe3, 0xe2, 0xe6,
+    0xce, 0xcf, 0xdc, 0x9a, 0xa7, 0xbf, 0x47, 0x58, 0x40, 0xd0, 0xc8, 0xc8, 0xc0, 0xc0, 0xf0, 0xb8,
+    0x28, 0x22, 0x48, 0x80, 0x00, 0x40, 0x94, 0x00, 0x08, 0x40, 0xe0, 0xc2, 0xba, 0xe7, 0x00, 0x80,
+    0xe0, 0xfe, 0x83, 0xff, 0x02, 0x7f, 0x1f, 0x07, 0x95, 0x00, 0x0c, 0xc0, 0xff, 0xff, 0xfe, 0xf8,
+    0xe1, 0xc7, 0x0f, 0x1f, 0x1f, 0x3f, 0x7f, 0x7f, 0x86, 0xff, 0x2f, 0xfe, 0xfe, 0xfc, 0xf8, 0xf9,
+    0xf1, 0xf1, 0xe3, 0xc3, 0xc3, 0x86, 0x84, 0x07, 0x0d, 0x09, 0x10, 0x32, 0x20, 0x68, 0xec, 0xc0,
+    0x94, 0x40, 0x20, 0x40, 0x80, 0x20, 0x60, 0x00, 0xdc, 0x68, 0x34, 0x1a, 0x18, 0x08, 0x8e, 0xc4,
+    0xe4, 0xf3, 0xf8, 0x7e, 0x3f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x93, 0x00, 0x05, 0x80, 0xc0,
+    0xf0, 0xf8, 0xfe, 0xff, 0x03, 0x00, 0x24, 0x80, 0x06, 0x9f, 0xe7, 0xf1, 0xfc, 0xfe, 0xff, 0xff,
+    0x83, 0x7f, 0x1c, 0x3f, 0xbf, 0xbf, 0x5f, 0x1f, 0x4f, 0x2f, 0xa7, 0xb7, 0x33, 0x33, 0x31, 0xb8,
+    0xb8, 0x98, 0xdc, 0x4c, 0xa4, 0x72, 0x2e, 0x39, 0x0b, 0x02, 0x02, 0x0e, 0x02, 0x01, 0x02, 0x02,
+    0x85, 0x00, 0x15, 0x03, 0x01, 0x05, 0x02, 0x09, 0x0d, 0x05, 0x09, 0x10, 0x26, 0x4c, 0x79, 0xc7,
+    0x0f, 0x7f, 0xff, 0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xc0, 0x95, 0x00, 0x01, 0x03, 0x1f, 0x11, 0x23,
+    0x6a, 0x1a, 0x2c, 0xe7, 0xc3, 0xc1, 0xa1, 0xa0, 0x70, 0x08, 0x28, 0x0c, 0x8e, 0xf7, 0x67, 0x0f,
+    0x0d, 0x1e, 0x0a, 0x06, 0x04, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x82, 0x03, 0x97,
+    0x00, 0x08, 0x40, 0x00, 0xe0, 0x09, 0xfc, 0xff, 0x00, 0x00, 0x01, 0x86, 0xff, 0x00, 0xf0, 0x23,
+    0x23, 0x80, 0x03, 0xf7, 0x9c, 0x78, 0xf8, 0x82, 0xf0, 0x1a, 0xe1, 0xe3, 0xe6, 0xc6, 0xce, 0xdf,
+    0xdd, 0xba, 0xa5, 0xb5, 0x46, 0x58, 0xc0, 0xc0, 0xc8, 0xc0, 0xd0, 0xc8, 0xf0, 0xb8, 0x28, 0x22,
+    0x48, 0x80, 0x00, 0x00, 0x80, 0x93, 0x00, 0x08, 0x40, 0x40, 0xe2, 0x20, 0xc3, 0x3f, 0x00, 0xc0,
+    0xf8, 0x84, 0xff, 0x01, 0x3f, 0x0f, 0x96, 0x00, 0x0a, 0xff, 0xff, 0xfc, 0xf1, 0xe3, 0x87, 0x0f,
+    0x1f, 0x3f, 0x3f, 0x7f, 0x87, 0xff, 0x16, 0xfe, 0xfe, 0xfc, 0xf8, 0xf9, 0xf1, 0xe1, 0xe3, 0xc3,
+    0xc3, 0x86, 0x04, 0x03, 0x09, 0x00, 0x10, 0x32, 0x22, 0x68, 0xec, 0xc0, 0xa4, 0x40, 0x82, 0x00,
+    0x15, 0x40, 0x00, 0x44, 0xd4, 0x6c, 0x30, 0x36, 0x18, 0x18, 0x8e, 0xc8, 0xe7, 0xf3, 0xf9, 0x7c,
+    0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x94, 0x00, 0x04, 0x80, 0xc0, 0xf0, 0xfc, 0xff, 0x03,
+    0x00, 0x23, 0x80, 0x06, 0x7f, 0xcf, 0xe3, 0xf8, 0xfc, 0xfe, 0xff, 0x83, 0x7f, 0x1d, 0x3f, 0x3f,
+    0xbf, 0xbf, 0x5f, 0x5f, 0x6f, 0x2f, 0xa7, 0xb7, 0x33, 0xb1, 0x39, 0xb8, 0xb8, 0xd8, 0xdc, 0x4c,
+    0xa4, 0x52, 0x2e, 0x33, 0x03, 0x02, 0x00, 0x02, 0x05, 0x03, 0x02, 0x02, 0x85, 0x00, 0x0e, 0x02,
+    0x02, 0x05, 0x02, 0x04, 0x09, 0x01, 0x09, 0x37, 0x32, 0xc4, 0xb9, 0xe3, 0x0f, 0x3f, 0x82, 0xff,
+    0x04, 0xfe, 0xfc, 0xf0, 0xe0, 0x80, 0x94, 0x00, 0x01, 0x01, 0x07, 0x12, 0x23, 0x6a, 0x13, 0x66,
+    0xe3, 0x83, 0x81, 0xa0, 0x60, 0x60, 0x08, 0x0c, 0x4c, 0xde, 0xd7, 0xef, 0x83, 0x0c, 0x1e, 0x0a,
+    0x06, 0x06, 0x00, 0x82, 0x01, 0x03, 0x00, 0x01, 0x00, 0x01, 0x82, 0x03, 0x98, 0x00, 0x04, 0x60,
+    0x70, 0x0a, 0xf9, 0xff, 0x82, 0x00, 0x86, 0xff, 0x22, 0xfc, 0xee, 0x3c, 0xf8, 0xf8, 0xf0, 0xf0,
+    0xe0, 0xe1, 0xe3, 0xe6, 0xc6, 0xce, 0xdf, 0xdc, 0xb2, 0x85, 0x63, 0x46, 0x70, 0xc0, 0xc0, 0xc8,
+    0xc8, 0xd0, 0xe8, 0xb8, 0xb0, 0x28, 0x22, 0x40, 0x80, 0x00, 0x00, 0x80, 0x95, 0x00, 0x06, 0x60,
+    0x2b, 0xc1, 0x7f, 0x00, 0x80, 0xf0, 0x84, 0xff, 0x02, 0x7f, 0x1f, 0x03, 0x33, 0x27, 0x80, 0x06,
+    0xc3, 0x87, 0x0f, 0x1f, 0x3f, 0x7f, 0x7f, 0x87, 0xff, 0x30, 0xfe, 0xfc, 0xfc, 0xf9, 0xf9, 0xf1,
+    0xe1, 0xe3, 0xc3, 0x83, 0x86, 0x04, 0x0b, 0x0f, 0x10, 0x10, 0x30, 0x62, 0x68, 0xd8, 0xd0, 0x8c,
+    0x40, 0x20, 0x80, 0x00, 0x00, 0x20, 0x70, 0xb0, 0x6c, 0x70, 0x34, 0x12, 0x1a, 0x0e, 0x8e, 0xc0,
+    0xe0, 0xf1, 0xfc, 0x7e, 0x3f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x94, 0x00, 0x03, 0x80, 0xe0,
+    0xf8, 0xfe, 0x03, 0x00, 0x23, 0x80, 0x06, 0x3f, 0xc7, 0xf1, 0xf8, 0xfc, 0xfe, 0xff, 0x83, 0x7f,
+    0x1d, 0x3f, 0xbf, 0xbf, 0xdf, 0x1f, 0x9f, 0xaf, 0x2f, 0xb7, 0xb3, 0x33, 0x31, 0x39, 0x38, 0xb8,
+    0xdc, 0x4c, 0x4c, 0xa6, 0x12, 0x0e, 0x1d, 0x11, 0x00, 0x04, 0x04, 0x05, 0x03, 0x02, 0x02, 0x87,
+    0x00, 0x02, 0x03, 0x02, 0x02, 0x82, 0x01, 0x0e, 0x27, 0x06, 0x2a, 0x9c, 0xf3, 0x07, 0x1f, 0x7f,
+    0xff, 0xff, 0xfe, 0xfc, 0xf8, 0xe0, 0xc0, 0x95, 0x00, 0x00, 0x03, 0x12, 0x22, 0x6a, 0x14, 0x7f,
+    0x67, 0xc3, 0x81, 0xa1, 0xe0, 0x30, 0x40, 0x48, 0x2c, 0x4e, 0xf6, 0xb7, 0xef, 0x93, 0x0c, 0x0e,
+    0x0c, 0x06, 0x00, 0x00, 0x82, 0x01, 0x06, 0x00, 0x00, 0x01, 0x01, 0x03, 0x07, 0x01, 0x98, 0x00,
+    0x04, 0x40, 0xe0, 0x18, 0xf7, 0xff, 0x82, 0x00, 0x00, 0x07, 0x85, 0xff, 0x04, 0xfe, 0xfd, 0xce,
+    0x7c, 0xf8, 0x82, 0xf0, 0x1b, 0xe1, 0xe1, 0xe2, 0xe6, 0xce, 0xce, 0xde, 0x9e, 0xb2, 0x8c, 0x61,
+    0x24, 0x30, 0xc0, 0xc0, 0xd0, 0xe8, 0xf0, 0xe8, 0xb8, 0xa0, 0x28, 0x22, 0x40, 0x80, 0x00, 0x00,
+    0x80, 0x94, 0x00, 0x08, 0x40, 0x80, 0x60, 0x8c, 0xff, 0x00, 0x80, 0xe0, 0xfc, 0x84, 0xff, 0x01,
+    0x3f, 0x0f, 0x33, 0x24, 0x80, 0x08, 0xfe, 0xf8, 0xe1, 0xc7, 0x0f, 0x1f, 0x1f, 0x3f, 0x7f, 0x87,
+    0xff, 0x31, 0xfe, 0xfe, 0xfc, 0xfc, 0xf9, 0xf1, 0xf1, 0xe3, 0xc3, 0xc3, 0x86, 0x86, 0x04, 0x0b,
+    0x0d, 0x14, 0x10, 0x34, 0x60, 0x6e, 0xdc, 0xd0, 0x90, 0x40, 0x40, 0xc0, 0x00, 0x00, 0xc0, 0xc4,
+    0x04, 0xfc, 0x68, 0x32, 0x36, 0x10, 0x1e, 0x8a, 0xc8, 0xe7, 0xf3, 0xf8, 0x7e, 0x7f, 0x3f, 0x1f,
+    0x0f, 0x07, 0x03, 0x01, 0x95, 0x00, 0x02, 0xc0, 0xe0, 0xf8, 0x03, 0x00, 0x23, 0x80, 0x05, 0x9f,
+    0xe3, 0xf0, 0xfc, 0xfe, 0xff, 0x83, 0x7f, 0x1f, 0x3f, 0x3f, 0xbf, 0xbf, 0x5f, 0x1f, 0x2f, 0x2f,
+    0x27, 0x37, 0x33, 0x33, 0x39, 0xb8, 0x38, 0xd8, 0xdc, 0x4c, 0x4c, 0xa6, 0x12, 0x0d, 0x0f, 0x10,
+    0x00, 0x02, 0x04, 0x01, 0x01, 0x00, 0x03, 0x02, 0x84, 0x00, 0x0f, 0x02, 0x03, 0x02, 0x01, 0x00,
+    0x06, 0x05, 0x05, 0x23, 0x67, 0x3e, 0x8c, 0x79, 0x83, 0x0f, 0x3f, 0x82, 0xff, 0x04, 0xfe, 0xfc,
+    0xf0, 0xe0, 0x80, 0x95, 0x00, 0x12, 0x22, 0x6b, 0x17, 0x6d, 0xe7, 0xc3, 0x81, 0x60, 0xc0, 0x70,
+    0x00, 0x48, 0x6c, 0xce, 0xf7, 0x97, 0xf7, 0x9b, 0x0c, 0x0f, 0x0c, 0x06, 0x02, 0x00, 0x00, 0x01,
+    0x01, 0x82, 0x00, 0x03, 0x01, 0x03, 0x06, 0x01, 0x98, 0x00, 0x08, 0x20, 0x80, 0x98, 0x04, 0xfc,
+    0xff, 0x00, 0x00, 0x01, 0x86, 0xff, 0x04, 0xf8, 0xf3, 0x9c, 0x78, 0xf8, 0x82, 0xf0, 0x1b, 0xe1,
+    0xe1, 0xe2, 0xc6, 0xce, 0xcf, 0xde, 0x9e, 0xa6, 0x8c, 0x40, 0x32, 0xb0, 0xf0, 0xe0, 0xf0, 0xe0,
+    0xf0, 0xe0, 0xa8, 0xa0, 0x28, 0x40, 0x40, 0x80, 0x00, 0x00, 0x80, 0x94, 0x00, 0x08, 0x40, 0xc0,
+    0xe2, 0x02, 0xe3, 0x1f, 0x00, 0xc0, 0xf8, 0x84, 0xff, 0x02, 0x7f, 0x1f, 0x03, 0x33, 0x24, 0x80,
+    0x08, 0xfc, 0xf1, 0xe3, 0x87, 0x0f, 0x1f, 0x3f, 0x7f, 0x7f, 0x87, 0xff, 0x31, 0xfe, 0xfe, 0xfc,
+    0xf8, 0xf9, 0xf1, 0xf1, 0xe3, 0xc3, 0xc3, 0x86, 0x06, 0x04, 0x0b, 0x09, 0x10, 0x14, 0x20, 0x6a,
+    0xee, 0xd8, 0xd4, 0x90, 0x08, 0xe0, 0x80, 0x00, 0x00, 0xa0, 0xa0, 0x18, 0xd0, 0x6c, 0x76, 0x36,
+    0x14, 0x16, 0x8a, 0x89, 0xc3, 0xe3, 0xf9, 0xfc, 0x7f, 0x3f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x95,
+    0x00, 0x02, 0x80, 0xc0, 0xf0, 0x02, 0x02, 0x22, 0x6b, 0x06, 0x7f, 0xcf, 0xe3, 0xf8, 0xfc, 0xfe,
+    0xff, 0x82, 0x7f, 0x82, 0x3f, 0x1d, 0xbf, 0x9f, 0x5f, 0x1f, 0x2f, 0x0f, 0xa7, 0x37, 0x33, 0xb1,
+    0x39, 0xb8, 0x78, 0xdc, 0xdc, 0x4c, 0x46, 0x26, 0x12, 0x0d, 0x0f, 0x10, 0x00, 0x00, 0x04, 0x03,
+    0x03, 0x02, 0x03, 0x02, 0x85, 0x00, 0x0e, 0x02, 0x00, 0x01, 0x02, 0x06, 0x06, 0x02, 0x23, 0x05,
+    0x78, 0x46, 0xb8, 0xe3, 0x07, 0x1f, 0x82, 0xff, 0x16, 0xfe, 0xfc, 0xf8, 0xe0, 0xc0, 0x00, 0x66,
+    0xe3, 0x81, 0xc1, 0x60, 0xc0, 0x60, 0x08, 0x6c, 0x4c, 0xd6, 0xf7, 0x9f, 0xd7, 0x0d, 0x0e, 0x03,
+    0x84, 0x00, 0x08, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x04, 0x03, 0x9a, 0x00, 0x03, 0xe2,
+    0x0f, 0xf8, 0xff, 0x82, 0x00, 0x00, 0x9f, 0x85, 0xff, 0x23, 0xfe, 0xe6, 0x3c, 0xf8, 0xf8, 0xf0,
+    0xf0, 0xe0, 0xe1, 0xe3, 0xe2, 0xc6, 0xce, 0xdf, 0xdc, 0xbb, 0xa6, 0x8c, 0x05, 0x08, 0xb0, 0xf0,
+    0xe8, 0xf8, 0xe0, 0xf0, 0xe0, 0xa8, 0xa0, 0x2c, 0x40, 0x40, 0x80, 0x80, 0x00, 0x80, 0x95, 0x00,
+    0x07, 0x20, 0xe8, 0x01, 0xd1, 0x7f, 0x00, 0x80, 0xf0, 0x85, 0xff, 0x01, 0x3f, 0x07, 0x33, 0x26,
+    0x80, 0x06, 0xc3, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0x7f, 0x87, 0xff, 0x32, 0xfe, 0xfe, 0xfc, 0xf9,
+    0xf9, 0xf1, 0xe1, 0xe3, 0xc3, 0xc3, 0x86, 0x06, 0x04, 0x0b, 0x0d, 0x14, 0x14, 0x20, 0x6e, 0xee,
+    0xd8, 0xd4, 0xa4, 0x28, 0xc0, 0x00, 0x80, 0x80, 0x00, 0x84, 0x60, 0xd4, 0x6c, 0x60, 0x30, 0x34,
+    0x16, 0x14, 0x8c, 0xc3, 0xe4, 0xf1, 0xfc, 0x7e, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x95,
+    0x00, 0x01, 0x80, 0xe0, 0x02, 0x02, 0x21, 0x6c, 0x06, 0xff, 0x3f, 0xc7, 0xf1, 0xf8, 0xfe, 0xff,
+    0x83, 0x7f, 0x20, 0x3f, 0x3f, 0xbf, 0xbf, 0xdf, 0x5f, 0x6f, 0xcf, 0x0f, 0xd7, 0x73, 0x73, 0xf9,
+    0x79, 0xf8, 0x78, 0x5c, 0x5c, 0x4c, 0x26, 0x26, 0x12, 0x0d, 0x0b, 0x12, 0x02, 0x02, 0x03, 0x07,
+    0x01, 0x00, 0x03, 0x02, 0x87, 0x00, 0x02, 0x01, 0x01, 0x04, 0x82, 0x02, 0x07, 0x23, 0x01, 0x66,
+    0xdc, 0xf1, 0x07, 0x1f, 0x7f, 0x82, 0xff, 0x1c, 0xfe, 0xfc, 0xf0, 0xc0, 0x00, 0x00, 0xf7, 0x67,
+    0x93, 0x91, 0xe1, 0x60, 0x90, 0x00, 0x08, 0x2c, 0x46, 0xf6, 0x97, 0x4f, 0xfb, 0x05, 0x0e, 0x03,
+    0x0e, 0x03, 0x00, 0x00, 0x01, 0x84, 0x00, 0x02, 0x01, 0x01, 0x04, 0x9a, 0x00, 0x04, 0x60, 0x70,
+    0x0b, 0xf3, 0xff, 0x82, 0x00, 0x00, 0x03, 0x86, 0xff, 0x04, 0xf8, 0xfe, 0xce, 0x3c, 0xf8, 0x82,
+    0xf0, 0x19, 0xe0, 0xe1, 0xe3, 0xc6, 0xc6, 0xce, 0xdf, 0x9c, 0xba, 0xa5, 0x6f, 0x04, 0x08, 0xb0,
+    0xa0, 0xf0, 0xe8, 0xe0, 0xf0, 0xa8, 0xa8, 0xa0, 0x2c, 0x40, 0x08, 0xc0, 0x82, 0x80, 0x95, 0x00,
+    0x08, 0x40, 0x00, 0x6b, 0x8c, 0xff, 0x00, 0x80, 0xe0, 0xfc, 0x84, 0xff, 0x02, 0x7f, 0x0f, 0x01,
+    0x33, 0x23, 0x80, 0x08, 0xfe, 0xf8, 0xe1, 0x87, 0x0f, 0x1f, 0x3f, 0x3f, 0x7f, 0x87, 0xff, 0x33,
+    0xfe, 0xfe, 0xfc, 0xfc, 0xf9, 0xf9, 0xf1, 0xe3, 0xe3, 0xc3, 0x83, 0x86, 0x04, 0x0c, 0x0b, 0x03,
+    0x10, 0x18, 0x2c, 0x6c, 0xe8, 0xd8, 0xf0, 0xa0, 0x44, 0x80, 0x00, 0x80, 0x00, 0x00, 0xc0, 0x04,
+    0xb4, 0xf4, 0x6c, 0x32, 0x34, 0x14, 0x16, 0x82, 0xce, 0xe6, 0xf3, 0xf8, 0xfe, 0x7f, 0x3f, 0x3f,
+    0x1f, 0x0f, 0x07, 0x03, 0x96, 0x00, 0x00, 0xc0, 0x02, 0x02, 0x21, 0x6c, 0x06, 0xff, 0x9f, 0xe3,
+    0xf8, 0xfc, 0xfe, 0xff, 0x82, 0x7f, 0x82, 0x3f, 0x0c, 0xbf, 0x9f, 0xdf, 0x1f, 0xef, 0x0f, 0x07,
+    0xd7, 0xd3, 0xf3, 0x79, 0xf8, 0xf8, 0x82, 0x5c, 0x0e, 0x4e, 0x26, 0x02, 0x33, 0x1d, 0x1c, 0x11,
+    0x01, 0x03, 0x03, 0x05, 0x01, 0x00, 0x01, 0x03, 0x85, 0x00, 0x03, 0x03, 0x01, 0x02, 0x01, 0x83,
+    0x02, 0x07, 0x00, 0x71, 0x6c, 0x0c, 0x79, 0x83, 0x0f, 0x3f, 0x82, 0xff, 0x0a, 0xfe, 0xfc, 0xf8,
+    0xe0, 0x80, 0x00, 0x6d, 0x67, 0x93, 0x91, 0x60, 0x82, 0x00, 0x0f, 0x08, 0x0c, 0x06, 0xf7, 0xd7,
+    0x0f, 0x0b, 0x05, 0x0e, 0x0f, 0x03, 0x03, 0x00, 0x00, 0x01, 0x01, 0x84, 0x00, 0x01, 0x01, 0x04,
+    0x9b, 0x00, 0x07, 0x60, 0x97, 0x05, 0xfe, 0xff, 0x00, 0x00, 0x01, 0x86, 0xff, 0x23, 0xfe, 0xfb,
+    0x9c, 0x7c, 0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0xe1, 0xe3, 0xc6, 0xce, 0xce, 0xdf, 0x9d, 0xba, 0x85,
+    0x7f, 0x0d, 0x0c, 0xb0, 0xa0, 0xf8, 0xe8, 0xd0, 0xf0, 0xb0, 0xa8, 0x20, 0x2c, 0x50, 0x08, 0x40,
+    0x20, 0x80, 0x97, 0x00, 0x07, 0xc0, 0x61, 0x0a, 0xe7, 0x1f, 0x00, 0xc0, 0xf8, 0x84, 0xff, 0x02,
+    0x7f, 0x1f, 0x07, 0x33, 0x23, 0x80, 0x08, 0xfc, 0xf1, 0xc3, 0x87, 0x0f, 0x1f, 0x3f, 0x7f, 0x7f,
+    0x87, 0xff, 0x34, 0xfe, 0xfe, 0xfc, 0xfc, 0xf9, 0xf1, 0xf1, 0xe3, 0xc3, 0xc3, 0x87, 0x86, 0x04,
+    0x0c, 0x0b, 0x13, 0x1a, 0x28, 0x2c, 0x6c, 0xc8, 0xd8, 0xb8, 0xc0, 0xc8, 0xc0, 0x00, 0x80, 0x00,
+    0x80, 0x00, 0xc8, 0x28, 0xd4, 0x68, 0x66, 0x30, 0x34, 0x14, 0x10, 0x8e, 0xc3, 0xe3, 0xf9, 0xfc,
+    0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x95, 0x00, 0x00, 0x80, 0x02, 0x02, 0x21, 0x6d,
+    0x05, 0x7f, 0xcf, 0xf3, 0xf8, 0xfc, 0xfe, 0x83, 0x7f, 0x82, 0x3f, 0x1e, 0xbf, 0x9f, 0xdf, 0x1f,
+    0x4f, 0x0f, 0x17, 0xd7, 0x53, 0xf9, 0x79, 0xb8, 0xf8, 0xdc, 0x5c, 0x4c, 0x4e, 0xa6, 0x02, 0x61,
+    0x45, 0x1a, 0x01, 0x01, 0x00, 0x03, 0x01, 0x00, 0x01, 0x00, 0x01, 0x86, 0x00, 0x0e, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x02, 0x02, 0x00, 0x52, 0x3b, 0x46, 0x3c, 0xe1, 0x07, 0x1f, 0x83, 0xff, 0x1c,
+    0xfe, 0xfc, 0xf0, 0xc0, 0x00, 0x00, 0x66, 0xf3, 0x91, 0x91, 0x60, 0xf0, 0x00, 0x08, 0x68, 0x64,
+    0x06, 0xf7, 0x97, 0xff, 0x63, 0x04, 0x0a, 0x0b, 0x0b, 0x03, 0x00, 0x00, 0x01, 0x83, 0x00, 0x02,
+    0x01, 0x00, 0x02, 0x9b, 0x00, 0x05, 0x60, 0x00, 0xf0, 0x04, 0xfc, 0xff, 0x82, 0x00, 0x00, 0x0f,
+    0x86, 0xff, 0x23, 0xf0, 0xe6, 0x3c, 0xf8, 0xf8, 0xf0, 0xf0, 0xe0, 0xe1, 0xe1, 0xe2, 0xc6, 0xce,
+    0xce, 0xdf, 0x9d, 0xb2, 0x85, 0x2d, 0x0d, 0x8c, 0xb0, 0xa0, 0xf8, 0xe0, 0xd0, 0xf0, 0xb0, 0xa8,
+    0x20, 0x24, 0x50, 0x00, 0x60, 0x20, 0x80, 0x97, 0x00, 0x07, 0xa0, 0xc0, 0x22, 0xc3, 0x7f, 0x00,
+    0x80, 0xf0, 0x85, 0xff, 0x02, 0x3f, 0x0f, 0x00, 0x33, 0x26, 0x80, 0x04, 0x07, 0x0f, 0x1f, 0x3f,
+    0x7f, 0x88, 0xff, 0x19, 0xfe, 0xfe, 0xfc, 0xf9, 0xf9, 0xf1, 0xf1, 0xe3, 0xc3, 0xc3, 0x87, 0x06,
+    0x04, 0x08, 0x0a, 0x15, 0x18, 0x28, 0x20, 0x6c, 0xc8, 0xd0, 0xb8, 0xc0, 0xe8, 0x80, 0x82, 0x00,
+    0x17, 0x80, 0x00, 0xc0, 0x48, 0xd0, 0xe0, 0x68, 0x30, 0x34, 0x14, 0x10, 0x81, 0xcd, 0xe6, 0xf3,
+    0xf8, 0xfe, 0x7f, 0x3f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x96, 0x00, 0x01, 0x03, 0x20, 0x6d, 0x06,
+    0xff, 0x3f, 0xc7, 0xf1, 0xfc, 0xfe, 0xff, 0x82, 0x7f, 0x82, 0x3f, 0x19, 0xbf, 0x9f, 0xdf, 0xdf,
+    0x2f, 0x0f, 0x07, 0x97, 0x53, 0x53, 0xd9, 0xb9, 0xf8, 0xdc, 0xdc, 0x5c, 0x4e, 0x6e, 0xa6, 0x03,
+    0x41, 0x55, 0x0f, 0x05, 0x00, 0x03, 0x82, 0x00, 0x02, 0x01, 0x00, 0x01, 0x85, 0x00, 0x10, 0x01,
+    0x00, 0x01, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x18, 0x5a, 0x26, 0x1c, 0xf1, 0x03, 0x0f, 0x7f,
+    0x82, 0xff, 0x1a, 0xfe, 0xfc, 0xf8, 0xe0, 0x80, 0x00, 0xb7, 0x67, 0x93, 0x91, 0xf0, 0x60, 0x90,
+    0x20, 0x08, 0x6c, 0x66, 0x96, 0xf7, 0x9f, 0xd7, 0x97, 0x00, 0x03, 0x08, 0x07, 0x03, 0x82, 0x00,
+    0x00, 0x01, 0x86, 0x00, 0x00, 0x01, 0x99, 0x00, 0x05, 0x20, 0x40, 0x61, 0x09, 0xf8, 0xff, 0x82,
+    0x00, 0x00, 0x03, 0x86, 0xff, 0x04, 0xfc, 0xfe, 0xce, 0x3c, 0xf8, 0x82, 0xf0, 0x1b, 0xe0, 0xe1,
+    0xe3, 0xc2, 0xc6, 0xce, 0xdf, 0x9e, 0xbe, 0xb2, 0x4d, 0x55, 0x0c, 0x80, 0xa0, 0xa0, 0xf8, 0xd0,
+    0xf0, 0xf0, 0xb0, 0xa8, 0x20, 0x24, 0x50, 0x00, 0x60, 0xa0, 0x99, 0x00, 0x07, 0xa0, 0x49, 0x99,
+    0xff, 0x00, 0x00, 0xe0, 0xfc, 0x84, 0xff, 0x0d, 0x7f, 0x1f, 0x03, 0xff, 0xff, 0xfe, 0xf8, 0xe3,
+    0x87, 0x0f, 0x1f, 0x3f, 0x7f, 0x7f, 0x88, 0xff, 0x19, 0xfe, 0xfc, 0xfc, 0xf9, 0xf9, 0xf1, 0xe3,
+    0xe3, 0xc3, 0xc7, 0x87, 0x06, 0x0c, 0x08, 0x0a, 0x1f, 0x1b, 0x20, 0x20, 0x60, 0xc8, 0xd0, 0xb8,
+    0xc0, 0x88, 0x80, 0x82, 0x00, 0x18, 0x80, 0xc0, 0x88, 0x10, 0xbc, 0xd0, 0x68, 0x60, 0x32, 0x34,
+    0x12, 0x14, 0x8d, 0xc6, 0xf3, 0xf8, 0xfc, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x82,
+    0x00, 0x01, 0x03, 0x20, 0x6e, 0x05, 0xff, 0x9f, 0xe3, 0xf8, 0xfc, 0xfe, 0x82, 0x7f, 0x83, 0x3f,
+    0x1f, 0x9f, 0x9f, 0xdf, 0x5f, 0x2f, 0x2f, 0x57, 0x97, 0xd3, 0x5b, 0xd9, 0x18, 0x5c, 0x5c, 0xdc,
+    0xdc, 0x4e, 0xe6, 0xa6, 0x13, 0x79, 0x07, 0x1e, 0x02, 0x01, 0x01, 0x00, 0x02, 0x01, 0x01, 0x00,
+    0x01, 0x86, 0x00, 0x82, 0x01, 0x0c, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x23, 0x61, 0x8e, 0x78,
+    0x03, 0x07, 0x3f, 0x83, 0xff, 0x19, 0xfe, 0xfc, 0xf0, 0xc0, 0x00, 0x00, 0x6d, 0x73, 0xb1, 0x91,
+    0x70, 0x50, 0xa0, 0x20, 0x08, 0x04, 0x26, 0xb7, 0xf7, 0xdf, 0xb3, 0x95, 0x02, 0x03, 0x04, 0x01,
+    0x83, 0x00, 0x00, 0x01, 0x83, 0x00, 0x03, 0x01, 0x00, 0x02, 0x01, 0x9a, 0x00, 0x05, 0x60, 0xf0,
+    0x05, 0x61, 0xfe, 0xff, 0x82, 0x00, 0x87, 0xff, 0x23, 0x60, 0xfb, 0x9e, 0x7c, 0xf8, 0xf0, 0xf0,
+    0xe0, 0xe0, 0xe1, 0xe3, 0xc6, 0xc6, 0xce, 0xdf, 0x9c, 0xbe, 0xa6, 0x4c, 0x11, 0x0e, 0x98, 0xa0,
+    0xb0, 0xb8, 0xc0, 0xf0, 0xb0, 0xb0, 0xa8, 0x20, 0x64, 0x50, 0x88, 0x60, 0xa0, 0x99, 0x00, 0x07,
+    0x20, 0x40, 0x0a, 0xe7, 0x0f, 0x00, 0xc0, 0xf0, 0x85, 0xff, 0x0c, 0x3f, 0x0f, 0x00, 0xff, 0xff,
+    0xfc, 0xf1, 0xc3, 0x87, 0x0f, 0x1f, 0x3f, 0x7f, 0x88, 0xff, 0x36, 0xfe, 0xfe, 0xfc, 0xfd, 0xf9,
+    0xf9, 0xf1, 0xe3, 0xe3, 0xc3, 0x87, 0x87, 0x06, 0x0c, 0x08, 0x0a, 0x1f, 0x1c, 0x20, 0x6c, 0x44,
+    0xc0, 0xd0, 0xb8, 0xc0, 0xc8, 0x08, 0x80, 0x80, 0x00, 0x80, 0x40, 0x00, 0x10, 0xa8, 0xdc, 0xe0,
+    0x6c, 0x72, 0x30, 0x32, 0x12, 0x8c, 0xc8, 0xe7, 0xf1, 0xfc, 0xff, 0x7f, 0x7f, 0x3f, 0x1f, 0x0f,
+    0x07, 0x01, 0x83, 0x00, 0x01, 0x03, 0x20, 0x6e, 0x05, 0x7f, 0xcf, 0xf1, 0xf8, 0xfe, 0xff, 0x82,
+    0x7f, 0x83, 0x3f, 0x1b, 0x9f, 0xdf, 0xdf, 0x6f, 0x0f, 0x0f, 0x37, 0x97, 0x53, 0x59, 0xd9, 0x98,
+    0x1c, 0x1c, 0x5c, 0xde, 0xee, 0xe6, 0xa7, 0x53, 0x09, 0x06, 0x0f, 0x0d, 0x00, 0x02, 0x00, 0x02,
+    0x8a, 0x00, 0x10, 0x01, 0x00, 0x01, 0x00, 0x03, 0x07, 0x02, 0x03, 0x10, 0x5a, 0x5e, 0x26, 0x3c,
+    0xf1, 0x07, 0x1f, 0x7f, 0x82, 0xff, 0x1d, 0xfe, 0xfc, 0xf8, 0xe0, 0x80, 0x00, 0x66, 0x73, 0xb1,
+    0x90, 0x50, 0x10, 0x40, 0x28, 0x08, 0x64, 0x26, 0xf7, 0xb7, 0x2f, 0xf3, 0x11, 0x02, 0x07, 0x0e,
+    0x01, 0x03, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x03, 0x01, 0x9a, 0x00, 0x05, 0x40, 0x00, 0x9d,
+    0x06, 0xfc, 0xff, 0x82, 0x00, 0x00, 0x07, 0x86, 0xff, 0x24, 0xfc, 0xe6, 0x3c, 0xf8, 0xf8, 0xf0,
+    0xf0, 0xe0, 0xe0, 0xe1, 0xc3, 0xc6, 0xce, 0xce, 0x9f, 0x9c, 0xbb, 0xa4, 0x4c, 0x13, 0xa2, 0x98,
+    0xa0, 0xb0, 0xb0, 0xd8, 0xd0, 0xb0, 0xb0, 0xa8, 0x20, 0x64, 0x50, 0x88, 0xe0, 0xa0, 0x80, 0x98,
+    0x00, 0x08, 0xa0, 0xab, 0x42, 0xc3, 0x7f, 0x00, 0x80, 0xe0, 0xfe, 0x84, 0xff, 0x0c, 0x7f, 0x1f,
+    0x03, 0xff, 0xff, 0xfc, 0xe1, 0xc3, 0x0f, 0x1f, 0x3f, 0x3f, 0x7f, 0x88, 0xff, 0x1b, 0xfe, 0xfe,
+    0xfc, 0xfd, 0xf9, 0xf1, 0xf3, 0xe3, 0xc3, 0xc3, 0x87, 0x86, 0x06, 0x0c, 0x08, 0x1e, 0x13, 0x00,
+    0x28, 0x68, 0x44, 0xd4, 0xd8, 0xb8, 0x40, 0xe8, 0x00, 0x80, 0x82, 0x00, 0x18, 0x80, 0x08, 0xb8,
+    0x28, 0xd8, 0xe8, 0x68, 0x60, 0x30, 0x30, 0x18, 0x15, 0x8f, 0xc6, 0xf3, 0xf8, 0xfe, 0xff, 0x7f,
+    0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x82, 0x00, 0x01, 0x03, 0x1f, 0x6e, 0x05, 0xff, 0x3f, 0xe7,
+    0xf1, 0xfc, 0xfe, 0x82, 0x7f, 0x83, 0x3f, 0x18, 0x9f, 0x9f, 0xdf, 0xdf, 0x2f, 0x8f, 0x37, 0x37,
+    0x93, 0x5b, 0x59, 0x19, 0x5c, 0x1c, 0x9c, 0x5c, 0xce, 0xee, 0xa6, 0xa3, 0xd3, 0x09, 0x06, 0x09,
+    0x0c, 0x83, 0x01, 0x02, 0x03, 0x00, 0x01, 0x8c, 0x00, 0x00, 0x03, 0x82, 0x01, 0x07, 0x00, 0x14,
+    0x01, 0x9e, 0xf8, 0x03, 0x0f, 0x3f, 0x83, 0xff, 0x1a, 0xfe, 0xfc, 0xf0, 0xc0, 0x00, 0xb7, 0x67,
+    0xd3, 0x91, 0x30, 0x50, 0xa0, 0x40, 0x08, 0x24, 0x64, 0x36, 0xf7, 0xbf, 0x7f, 0xdf, 0x01, 0x0a,
+    0x07, 0x06, 0x02, 0x03, 0x87, 0x00, 0x03, 0x01, 0x00, 0x03, 0x01, 0x9a, 0x00, 0x05, 0x60, 0x00,
+    0x7c, 0x09, 0xf8, 0xff, 0x82, 0x00, 0x00, 0x01, 0x88, 0xff, 0x02, 0xce, 0x3c, 0xf8, 0x82, 0xf0,
+    0x1c, 0xe0, 0xe1, 0xe1, 0xc2, 0xc6, 0xce, 0xce, 0x9f, 0xbd, 0xba, 0x45, 0x0f, 0x64, 0xb0, 0x88,
+    0xa0, 0xb0, 0xb0, 0x90, 0x90, 0xb0, 0xb0, 0xa8, 0x20, 0x64, 0x50, 0x88, 0x80, 0x20, 0x9a, 0x00,
+    0x07, 0x8a, 0x61, 0x81, 0xff, 0x00, 0x00, 0xc0, 0xf8, 0x85, 0xff, 0x0c, 0x3f, 0x0f, 0xff, 0xff,
+    0xfe, 0xf8, 0xe3, 0x87, 0x0f, 0x1f, 0x3f, 0x7f, 0x7f, 0x88, 0xff, 0x37, 0xfe, 0xfe, 0xfc, 0xf9,
+    0xf9, 0xf1, 0xf3, 0xe3, 0xc3, 0xc7, 0x87, 0x06, 0x06, 0x0c, 0x09, 0x16, 0x11, 0x2b, 0x28, 0x64,
+    0x40, 0xd4, 0xd8, 0xb0, 0x40, 0xa8, 0x98, 0x80, 0x80, 0x00, 0x00, 0x80, 0x40, 0x30, 0x40, 0xb8,
+    0xd0, 0xe0, 0x6e, 0x60, 0x3c, 0x3c, 0x11, 0x82, 0xc8, 0xe3, 0xf9, 0xfc, 0xff, 0x7f, 0x7f, 0x3f,
+    0x1f, 0x0f, 0x07, 0x01, 0x82, 0x00, 0x01, 0x03, 0x1f, 0x6f, 0x07, 0xff, 0x9f, 0xe3, 0xf8, 0xfc,
+    0xff, 0x7f, 0x7f, 0x83, 0x3f, 0x1e, 0x1f, 0x9f, 0x9f, 0xdf, 0xcf, 0x2f, 0xaf, 0xd7, 0x37, 0x13,
+    0xdb, 0xd9, 0x18, 0x1c, 0x1c, 0x9c, 0x5e, 0x6e, 0xee, 0xa7, 0xa3, 0xd3, 0x09, 0x06, 0x01, 0x0c,
+    0x00, 0x00, 0x01, 0x03, 0x03, 0x82, 0x00, 0x00, 0x01, 0x86, 0x00, 0x01, 0x01, 0x01, 0x82, 0x00,
+    0x0a, 0x01, 0x03, 0x01, 0x02, 0x20, 0x55, 0x2e, 0x3c, 0x81, 0x07, 0x1f, 0x84, 0xff, 0x17, 0xfc,
+    0xf8, 0xe0, 0x80, 0x00, 0x4d, 0x73, 0xb1, 0x91, 0x50, 0x70, 0xd0, 0x60, 0x08, 0x44, 0x46, 0x16,
+    0xf7, 0xdf, 0x73, 0x03, 0x10, 0x0a, 0x07, 0x82, 0x02, 0x86, 0x00, 0x04, 0x01, 0x01, 0x03, 0x03,
+    0x01, 0x9a, 0x00, 0x06, 0x20, 0x60, 0xe0, 0x0d, 0x73, 0xfe, 0xff, 0x82, 0x00, 0x87, 0xff, 0x25,
+    0xfc, 0xfb, 0x9e, 0x7c, 0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0xe1, 0xc3, 0xc2, 0xc6, 0xce, 0x9e, 0x9f,
+    0xbd, 0xb2, 0x45, 0x1f, 0x04, 0x84, 0x80, 0xa0, 0xb0, 0xb0, 0xa0, 0x80, 0xb0, 0xa0, 0x38, 0x20,
+    0x74, 0x54, 0xa8, 0x20, 0x00, 0x80, 0x98, 0x00, 0x08, 0x80, 0x00, 0x6e, 0x1c, 0xe7, 0x1f, 0x00,
+    0x80, 0xf0, 0x85, 0xff, 0x0c, 0x7f, 0x1f, 0x03, 0xff, 0xff, 0xfc, 0xf1, 0xc3, 0x87, 0x0f, 0x1f,
+    0x3f, 0x7f, 0x88, 0xff, 0x1b, 0xfe, 0xfe, 0xfc, 0xfd, 0xf9, 0xf9, 0xf1, 0xe3, 0xe3, 0xc3, 0x87,
+    0x87, 0x06, 0x0e, 0x0c, 0x09, 0x16, 0x19, 0x23, 0x20, 0x40, 0xc8, 0xd4, 0x90, 0xb8, 0x68, 0xe0,
+    0x18, 0x84, 0x00, 0x18, 0x80, 0x10, 0x18, 0xa8, 0xd8, 0xe8, 0x6c, 0x6c, 0x2c, 0x2c, 0x1c, 0x17,
+    0xca, 0xe7, 0xf1, 0xf8, 0xfe, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x82, 0x00, 0x01,
+    0x03, 0x1f, 0x6f, 0x04, 0x7f, 0xcf, 0xf1, 0xfc, 0xfe, 0x82, 0x7f, 0x83, 0x3f, 0x19, 0x1f, 0x9f,
+    0xdf, 0xcf, 0xef, 0x2f, 0xf7, 0x57, 0x23, 0x0b, 0x59, 0x59, 0x9c, 0x1c, 0x1c, 0x9c, 0x7e, 0x6e,
+    0xee, 0xa7, 0xb3, 0xd1, 0x19, 0x26, 0x00, 0x0c, 0x82, 0x00, 0x03, 0x01, 0x01, 0x00, 0x01, 0x89,
+    0x00, 0x0f, 0x01, 0x00, 0x00, 0x02, 0x00, 0x01, 0x03, 0x01, 0x16, 0x1e, 0xa7, 0x1c, 0xf1, 0x03,
+    0x0f, 0x7f, 0x83, 0xff, 0x19, 0xfe, 0xfc, 0xf0, 0xc0, 0x00, 0x46, 0x73, 0xb1, 0x90, 0x50, 0x20,
+    0x90, 0x68, 0x08, 0x64, 0x06, 0x97, 0xd7, 0x9f, 0xd3, 0x99, 0x0a, 0x07, 0x03, 0x01, 0x01, 0x88,
+    0x00, 0x03, 0x01, 0x03, 0x03, 0x01, 0x9b, 0x00, 0x05, 0x20, 0xb0, 0x95, 0x06, 0xfc, 0xff, 0x82,
+    0x00, 0x00, 0x03, 0x87, 0xff, 0x24, 0xe6, 0x3c, 0xf8, 0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0xe1, 0xc3,
+    0xc6, 0xc6, 0xce, 0x9f, 0x9e, 0xbe, 0x30, 0x45, 0x7f, 0xbc, 0x88, 0x80, 0xa0, 0xb0, 0x80, 0xa0,
+    0x90, 0xa0, 0xa0, 0x38, 0x68, 0x74, 0x54, 0xa8, 0x20, 0x00, 0x80, 0x99, 0x00, 0x08, 0x80, 0x8b,
+    0x52, 0xc3, 0xff, 0x00, 0x00, 0xe0, 0xfe, 0x85, 0xff, 0x0b, 0x3f, 0x07, 0xff, 0xff, 0xf8, 0xe1,
+    0xc7, 0x0f, 0x1f, 0x3f, 0x7f, 0x7f, 0x88, 0xff, 0x1c, 0xfe, 0xfe, 0xfc, 0xfd, 0xf9, 0xf9, 0xf3,
+    0xe3, 0xe3, 0xc3, 0x87, 0x87, 0x06, 0x0c, 0x0c, 0x09, 0x16, 0x19, 0x2b, 0x28, 0x40, 0xd8, 0xd8,
+    0x90, 0xb8, 0x68, 0xc0, 0xc8, 0x80, 0x84, 0x00, 0x17, 0x80, 0xf0, 0x20, 0xd0, 0xd0, 0xe0, 0x6c,
+    0x68, 0x28, 0x24, 0x1c, 0x81, 0xc6, 0xe3, 0xf8, 0xfc, 0xff, 0x7f, 0x7f, 0x3f, 0x1f, 0x0f, 0x07,
+    0x01, 0x82, 0x00, 0x01, 0x03, 0x1e, 0x70, 0x07, 0xff, 0xbf, 0xe7, 0xf8, 0xfc, 0xfe, 0x7f, 0x7f,
+    0x83, 0x3f, 0x21, 0x1f, 0x9f, 0x9f, 0xdf, 0xcf, 0x6f, 0x0f, 0x37, 0x27, 0x23, 0x2b, 0x19, 0x99,
+    0xbc, 0x3c, 0x3c, 0xbe, 0x6e, 0x6e, 0xe7, 0xa7, 0x13, 0x91, 0x18, 0x0e, 0x00, 0x07, 0x00, 0x01,
+    0x01, 0x02, 0x01, 0x00, 0x01, 0x8a, 0x00, 0x0e, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x03, 0x30,
+    0x3d, 0x21, 0x9e, 0xf8, 0x01, 0x07, 0x1f, 0x84, 0xff, 0x1a, 0xfc, 0xf8, 0xe0, 0x80, 0x00, 0xb7,
+    0x77, 0x71, 0xb1, 0x10, 0x60, 0x20, 0xd0, 0x28, 0x24, 0x04, 0x16, 0x97, 0xff, 0x8f, 0xf3, 0x89,
+    0x0a, 0x07, 0x09, 0x01, 0x01, 0x88, 0x00, 0x83, 0x01, 0x9c, 0x00, 0x04, 0x80, 0xfd, 0x05, 0xf8,
+    0xff, 0x83, 0x00, 0x87, 0xff, 0x06, 0xfc, 0xff, 0xce, 0x3c, 0xf8, 0xf0, 0xf0, 0x82, 0xe0, 0x1a,
+    0xe1, 0xc3, 0xc6, 0xce, 0xce, 0x9f, 0x9c, 0xbe, 0x24, 0x4d, 0x2d, 0x8f, 0x98, 0x80, 0xa0, 0xb0,
+    0x80, 0x80, 0x90, 0xa0, 0xa0, 0x38, 0x78, 0x54, 0x54, 0xa8, 0x20, 0x9a, 0x00, 0x09, 0x80, 0x80,
+    0x82, 0x41, 0x91, 0xff, 0x00, 0x00, 0xc0, 0xf8, 0x85, 0xff, 0x0c, 0x7f, 0x1f, 0x01, 0xff, 0xff,
+    0xfe, 0xf8, 0xe3, 0x87, 0x0f, 0x1f, 0x3f, 0x7f, 0x89, 0xff, 0x1b, 0xfe, 0xfe, 0xfc, 0xfd, 0xf9,
+    0xf1, 0xf3, 0xe3, 0xc3, 0xc7, 0x87, 0x87, 0x0e, 0x0c, 0x0c, 0x19, 0x16, 0x19, 0x23, 0x39, 0x50,
+    0xd8, 0xdc, 0x90, 0xa0, 0x70, 0xc0, 0x90, 0x85, 0x00, 0x18, 0x88, 0x20, 0x60, 0xa8, 0xd0, 0xe4,
+    0x6c, 0x68, 0x2c, 0x24, 0x18, 0x97, 0xc8, 0xe7, 0xf1, 0xfc, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f,
+    0x07, 0x03, 0x01, 0x82, 0x00, 0x01, 0x03, 0x1e, 0x70, 0x04, 0xff, 0x8f, 0xf3, 0xf8, 0xfe, 0x82,
+    0x7f, 0x82, 0x3f, 0x1e, 0x1f, 0x1f, 0x9f, 0x9f, 0xcf, 0xef, 0x2f, 0x07, 0x47, 0x47, 0x8b, 0x6b,
+    0x29, 0xbc, 0xfc, 0xbc, 0x3e, 0x3e, 0x2e, 0x6e, 0xa7, 0xa7, 0x13, 0x81, 0x10, 0x0e, 0x00, 0x01,
+    0x00, 0x01, 0x01, 0x90, 0x00, 0x00, 0x01, 0x82, 0x00, 0x09, 0x01, 0x10, 0x00, 0xb2, 0x8f, 0x3c,
+    0xc1, 0x03, 0x0f, 0x7f, 0x83, 0xff, 0x1a, 0xfe, 0xfc, 0xf0, 0xc0, 0x00, 0x4c, 0x73, 0xb1, 0xb0,
+    0x00, 0x60, 0x80, 0x50, 0x28, 0x04, 0x66, 0x36, 0x97, 0xff, 0x9b, 0xb7, 0x91, 0x0a, 0x07, 0x0b,
+    0x07, 0x02, 0x88, 0x00, 0x82, 0x01, 0x9c, 0x00, 0x06, 0x20, 0x40, 0xf8, 0x0c, 0xf3, 0xff, 0xff,
+    0x82, 0x00, 0x00, 0x0f, 0x87, 0xff, 0x22, 0xfb, 0x9e, 0x7c, 0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0xe1,
+    0xc1, 0xc2, 0xc6, 0xce, 0x8e, 0x9f, 0xbc, 0xba, 0x64, 0x0c, 0x41, 0x8f, 0x9c, 0x90, 0xb0, 0xb0,
+    0x80, 0xa0, 0x90, 0x80, 0xb0, 0x38, 0x78, 0x54, 0x5c, 0xa8, 0x9b, 0x00, 0x09, 0x80, 0x00, 0x40,
+    0x2a, 0x0c, 0xe7, 0x3f, 0x00, 0x80, 0xe0, 0x86, 0xff, 0x0b, 0x3f, 0x07, 0xff, 0xff, 0xfc, 0xf1,
+    0xc3, 0x07, 0x1f, 0x3f, 0x3f, 0x7f, 0x88, 0xff, 0x1e, 0xfe, 0xfe, 0xfc, 0xfd, 0xf9, 0xf9, 0xf3,
+    0xf3, 0xe3, 0xc3, 0xc7, 0x87, 0x07, 0x0e, 0x0c, 0x08, 0x19, 0x16, 0x21, 0x31, 0x71, 0x50, 0xd0,
+    0x9c, 0x90, 0xa0, 0x78, 0x80, 0x50, 0x00, 0x80, 0x82, 0x00, 0x19, 0x80, 0x00, 0xa0, 0x50, 0xa8,
+    0xd0, 0xc4, 0xe0, 0x6c, 0x68, 0x24, 0x2c, 0x10, 0x8e, 0xc7, 0xf3, 0xf8, 0xfe, 0xff, 0xff, 0x7f,
+    0x3f, 0x1f, 0x0f, 0x07, 0x01, 0x82, 0x00, 0x01, 0x03, 0x1e, 0x71, 0x06, 0x7f, 0xc7, 0xf1, 0xfc,
+    0xfe, 0x7f, 0x7f, 0x83, 0x3f, 0x1b, 0x1f, 0x1f, 0x9f, 0xdf, 0xcf, 0xef, 0x2f, 0x97, 0x57, 0x43,
+    0x8b, 0x69, 0x69, 0xbc, 0x7c, 0x9c, 0x3e, 0xee, 0x2e, 0x2f, 0xa7, 0xb3, 0x13, 0x81, 0x00, 0x02,
+    0x04, 0x0a, 0x82, 0x00, 0x00, 0x01, 0x90, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x01, 0x11, 0x30, 0x3d,
+    0x07, 0x1e, 0xf8, 0x03, 0x0f, 0x3f, 0x84, 0xff, 0x1a, 0xfe, 0xf8, 0xe0, 0x80, 0x00, 0x47, 0x73,
+    0xb1, 0x20, 0x40, 0x50, 0x90, 0x78, 0x00, 0x24, 0x66, 0x17, 0xf7, 0x9f, 0x7b, 0x8f, 0x90, 0x0e,
+    0x07, 0x0c, 0x03, 0x03, 0x88, 0x00, 0x01, 0x01, 0x01, 0x9d, 0x00, 0x06, 0x20, 0x20, 0xe0, 0x81,
+    0x06, 0xfc, 0xff, 0x82, 0x00, 0x00, 0x01, 0x87, 0xff, 0x1a, 0xfc, 0xe6, 0x3c, 0xf8, 0xf8, 0xf0,
+    0xf0, 0xe0, 0xe0, 0xe1, 0xc3, 0xc6, 0xc6, 0xce, 0x9e, 0x9f, 0xbc, 0x3b, 0x44, 0x0c, 0x81, 0xe8,
+    0x88, 0x90, 0xa0, 0xb0, 0x90, 0x82, 0x80, 0x07, 0xb0, 0x78, 0x78, 0x54, 0x5c, 0xb8, 0x00, 0x40,
+    0x9a, 0x00, 0x09, 0x80, 0x00, 0xa1, 0x46, 0x83, 0xff, 0x00, 0x00, 0xc0, 0xfc, 0x85, 0xff, 0x0b,
+    0x7f, 0x1f, 0x01, 0xff, 0xff, 0xf8, 0xe1, 0x87, 0x0f, 0x1f, 0x3f, 0x7f, 0x89, 0xff, 0x1c, 0xfe,
+    0xfe, 0xfc, 0xfd, 0xf9, 0xf9, 0xf3, 0xe3, 0xe3, 0xc7, 0x87, 0x87, 0x07, 0x0e, 0x0c, 0x08, 0x19,
+    0x16, 0x20, 0x31, 0x51, 0x50, 0xc0, 0x98, 0xb4, 0xa0, 0x70, 0x80, 0x10, 0x84, 0x00, 0x1a, 0x80,
+    0x80, 0x50, 0x90, 0xa0, 0x80, 0xd0, 0xc0, 0x68, 0x68, 0x28, 0x38, 0x0a, 0x93, 0xce, 0xe3, 0xf0,
+    0xfc, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x82, 0x00, 0x01, 0x03, 0x1d, 0x71,
+    0x04, 0xff, 0x9f, 0xe3, 0xf8, 0xfc, 0x82, 0x7f, 0x82, 0x3f, 0x1d, 0x1f, 0x1f, 0x9f, 0x9f, 0xcf,
+    0xcf, 0xef, 0x27, 0x97, 0x57, 0x2b, 0x0b, 0x69, 0x6d, 0xec, 0xbc, 0x1e, 0x0e, 0xee, 0x2e, 0xaf,
+    0xa7, 0xb3, 0x53, 0x09, 0x0c, 0x0a, 0x04, 0x00, 0x04, 0x94, 0x00, 0x0b, 0x03, 0x00, 0x01, 0x00,
+    0x28, 0x88, 0x10, 0x6f, 0xfc, 0x01, 0x07, 0x1f, 0x84, 0xff, 0x1b, 0xfe, 0xfc, 0xf0, 0xc0, 0x00,
+    0x8f, 0x73, 0x71, 0x90, 0x20, 0x60, 0x40, 0x90, 0x78, 0x24, 0x64, 0x06, 0x37, 0xdf, 0xeb, 0x73,
+    0x11, 0x92, 0x07, 0x07, 0x06, 0x03, 0x02, 0x89, 0x00, 0x02, 0x01, 0x00, 0x01, 0x9b, 0x00, 0x06,
+    0x20, 0x00, 0x10, 0xf4, 0x04, 0xf8, 0xff, 0x83, 0x00, 0x88, 0xff, 0x05, 0xfe, 0xce, 0x7c, 0xf8,
+    0xf0, 0xf0, 0x82, 0xe0, 0x1c, 0xc1, 0xc3, 0xc6, 0xc6, 0x8e, 0x9e, 0x9f, 0xbd, 0x38, 0x45, 0x0e,
+    0xa4, 0x68, 0x00, 0xa0, 0xb0, 0xb0, 0x90, 0xa0, 0x80, 0x80, 0x20, 0x78, 0x78, 0x54, 0xdc, 0xb8,
+    0x00, 0x40, 0x9b, 0x00, 0x08, 0xc0, 0x88, 0x01, 0x91, 0xff, 0x00, 0x00, 0x80, 0xf0, 0x86, 0xff,
+    0x0b, 0x3f, 0x07, 0xff, 0xff, 0xfe, 0xf0, 0xc3, 0x87, 0x0f, 0x1f, 0x3f, 0x7f, 0x89, 0xff, 0x1d,
+    0xfe, 0xfe, 0xfc, 0xfd, 0xf9, 0xf1, 0xf3, 0xe3, 0xe3, 0xc7, 0x87, 0x87, 0x0e, 0x0e, 0x0c, 0x18,
+    0x19, 0x16, 0x20, 0x35, 0x41, 0x40, 0xc8, 0x88, 0xa0, 0x20, 0x70, 0x80, 0x10, 0x50, 0x85, 0x00,
+    0x18, 0x40, 0x40, 0x78, 0xa0, 0xd0, 0xc8, 0xc0, 0x68, 0x68, 0x38, 0x31, 0x19, 0x88, 0xc7, 0xf1,
+    0xf8, 0xfe, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x01, 0x82, 0x00, 0x01, 0x03, 0x1d, 0x72,
+    0x06, 0xff, 0xcf, 0xf1, 0xfc, 0xfe, 0x7f, 0x7f, 0x82, 0x3f, 0x82, 0x1f, 0x1a, 0x9f, 0xcf, 0xcf,
+    0xef, 0x6f, 0x17, 0x87, 0x23, 0x4b, 0x89, 0x2d, 0x6c, 0xec, 0x8c, 0x0e, 0x0e, 0x6e, 0x2f, 0xa7,
+    0xa7, 0xb3, 0x51, 0x89, 0x24, 0x23, 0x04, 0x04, 0x94, 0x00, 0x01, 0x01, 0x01, 0x82, 0x00, 0x08,
+    0x01, 0x89, 0xb3, 0xc7, 0x3e, 0xe0, 0x03, 0x0f, 0x3f, 0x84, 0xff, 0x1a, 0xfe, 0xf8, 0xe0, 0x80,
+    0x00, 0x46, 0x53, 0x71, 0x10, 0x00, 0x60, 0x50, 0xf0, 0x58, 0x04, 0x46, 0x17, 0x97, 0xdf, 0x8b,
+    0xd7, 0x01, 0x0e, 0x0f, 0x05, 0x0a, 0x01, 0x8a, 0x00, 0x01, 0x01, 0x02, 0x9d, 0x00, 0x06, 0x20,
+    0x50, 0x70, 0x09, 0x73, 0xff, 0xff, 0x82, 0x00, 0x00, 0x03, 0x87, 0xff, 0x25, 0xfc, 0xfb, 0x9e,
+    0x7c, 0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0xe1, 0xc1, 0xc3, 0xc6, 0xce, 0x8e, 0x9f, 0xbe, 0x3f, 0x70,
+    0x45, 0x5f, 0x85, 0x6c, 0x0c, 0xb0, 0xb0, 0x80, 0x90, 0xa0, 0x80, 0x80, 0x60, 0x78, 0x78, 0x54,
+    0xdc, 0xb8, 0x80, 0x9b, 0x00, 0x0a, 0x80, 0x00, 0x40, 0x8b, 0x4c, 0xc7, 0x7f, 0x00, 0x00, 0xe0,
+    0xfe, 0x85, 0xff, 0x0b, 0x7f, 0x1f, 0x01, 0xff, 0xff, 0xfc, 0xf1, 0xc3, 0x0f, 0x1f, 0x3f, 0x7f,
+    0x89, 0xff, 0x82, 0xfe, 0x1a, 0xfd, 0xf9, 0xf9, 0xf3, 0xf3, 0xe3, 0xc3, 0xc7, 0x87, 0x07, 0x0e,
+    0x0e, 0x0c, 0x18, 0x11, 0x16, 0x20, 0x25, 0x41, 0x40, 0x80, 0x80, 0xa0, 0x20, 0x70, 0x80, 0x50,
+    0x86, 0x00, 0x19, 0x10, 0xe0, 0x50, 0xb0, 0xc0, 0xd0, 0xc4, 0xe4, 0x60, 0x74, 0x20, 0x02, 0x94,
+    0xcf, 0xe3, 0xf8, 0xfc, 0xff, 0xff, 0x7f, 0x7f, 0x3f, 0x1f, 0x07, 0x03, 0x01, 0x82, 0x00, 0x01,
+    0x03, 0x1d, 0x72, 0x05, 0x3f, 0xe7, 0xf8, 0xfc, 0x7f, 0x7f, 0x83, 0x3f, 0x0f, 0x1f, 0x1f, 0x9f,
+    0x9f, 0xcf, 0xcf, 0xef, 0x67, 0x17, 0xf7, 0x2b, 0x2b, 0x49, 0x6d, 0x2c, 0xec, 0x82, 0x4e, 0x0a,
+    0xef, 0x6f, 0xa7, 0x37, 0x33, 0x51, 0x28, 0x04, 0x03, 0x05, 0x0c, 0x83, 0x00, 0x00, 0x01, 0x8f,
+    0x00, 0x0d, 0x01, 0x00, 0x01, 0x00, 0x01, 0x09, 0x12, 0x2c, 0x13, 0x1e, 0xf8, 0x01, 0x07, 0x1f,
+    0x84, 0xff, 0x1a, 0xfe, 0xfc, 0xf0, 0xe0, 0x00, 0x77, 0x51, 0x11, 0x00, 0x00, 0x50, 0x80, 0x78,
+    0x50, 0x04, 0x46, 0x17, 0xb7, 0xfb, 0xdb, 0xd3, 0x99, 0x06, 0x0f, 0x01, 0x0f, 0x02, 0x89, 0x00,
+    0x02, 0x01, 0x00, 0x02, 0x9e, 0x00, 0x05, 0x20, 0xe0, 0x89, 0x02, 0xfe, 0xff, 0x83, 0x00, 0x88,
+    0xff, 0x25, 0xe6, 0x3c, 0xf8, 0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0xc1, 0xc3, 0xc2, 0xc6, 0x8e, 0x9e,
+    0x9f, 0xbc, 0x3e, 0x74, 0x4d, 0xdf, 0x54, 0x44, 0x0c, 0x10, 0xb0, 0x80, 0xa0, 0x80, 0x80, 0xd0,
+    0x60, 0x70, 0x78, 0x5c, 0x9c, 0xb8, 0x00, 0x40, 0x9b, 0x00, 0x09, 0x80, 0x00, 0xa1, 0x12, 0xa3,
+    0xff, 0x00, 0x00, 0xc0, 0xf8, 0x86, 0xff, 0x0a, 0x3f, 0x07, 0xff, 0xfe, 0xf8, 0xe3, 0x87, 0x0f,
+    0x1f, 0x3f, 0x7f, 0x89, 0xff, 0x1e, 0xfe, 0xfe, 0xfc, 0xfd, 0xf9, 0xf9, 0xf3, 0xe3, 0xe3, 0xc7,
+    0xc7, 0x87, 0x07, 0x0e, 0x0e, 0x0c, 0x18, 0x11, 0x37, 0x31, 0x71, 0x40, 0xd0, 0x90, 0x88, 0xa8,
+    0x30, 0x60, 0x80, 0x50, 0x50, 0x86, 0x00, 0x18, 0x10, 0xd0, 0x70, 0xb0, 0xd8, 0xd0, 0xc0, 0x40,
+    0x7c, 0x34, 0x29, 0x13, 0x8e, 0xe7, 0xf1, 0xfc, 0xfe, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x0f, 0x07,
+    0x01, 0x82, 0x00, 0x01, 0x03, 0x1c, 0x73, 0x06, 0xff, 0x9f, 0xf3, 0xf8, 0xfe, 0x7f, 0x7f, 0x82,
+    0x3f, 0x82, 0x1f, 0x1b, 0x9f, 0x8f, 0xcf, 0xef, 0xef, 0x37, 0x97, 0xb3, 0xeb, 0xa9, 0x0d, 0x2c,
+    0x2c, 0x6e, 0x8e, 0x0e, 0x0e, 0xef, 0x2f, 0xf7, 0x33, 0x53, 0x51, 0xa8, 0x0c, 0x03, 0x01, 0x07,
+    0x83, 0x00, 0x00, 0x01, 0x90, 0x00, 0x00, 0x01, 0x83, 0x00, 0x08, 0x0e, 0x0d, 0x00, 0x0f, 0xfc,
+    0x00, 0x03, 0x0f, 0x7f, 0x84, 0xff, 0x12, 0xfe, 0xf8, 0xf0, 0x80, 0x00, 0x8b, 0x53, 0x51, 0x10,
+    0x20, 0x60, 0x30, 0xd0, 0x78, 0x34, 0x04, 0x16, 0x17, 0xbb, 0x82, 0xcb, 0x05, 0x97, 0x06, 0x07,
+    0x07, 0x05, 0x01, 0x89, 0x00, 0x02, 0x01, 0x00, 0x02, 0x9d, 0x00, 0x06, 0x20, 0x20, 0x10, 0xf0,
+    0x06, 0xf8, 0xff, 0x83, 0x00, 0x00, 0x07, 0x87, 0xff, 0x06, 0xfc, 0xfd, 0x9e, 0x7c, 0xf8, 0xf0,
+    0xf0, 0x82, 0xe0, 0x1d, 0xc1, 0xc3, 0xc6, 0xc6, 0x8e, 0x9e, 0x9f, 0xbc, 0x3a, 0x64, 0x0d, 0xfd,
+    0x2c, 0x04, 0x40, 0x10, 0xb0, 0x80, 0x80, 0xc0, 0xc0, 0xd0, 0x60, 0x70, 0x78, 0x5c, 0x9c, 0x38,
+    0x00, 0x40, 0x9c, 0x00, 0x08, 0x80, 0xc8, 0x41, 0x51, 0xff, 0x00, 0x00, 0x80, 0xe0, 0x86, 0xff,
+    0x0c, 0x7f, 0x1f, 0x01, 0xff, 0xff, 0xfc, 0xf1, 0xc3, 0x07, 0x1f, 0x3f, 0x7f, 0x7f, 0x89, 0xff,
+    0x1e, 0xfe, 0xfe, 0xfc, 0xfd, 0xf9, 0xf9, 0xf3, 0xe3, 0xe3, 0xc7, 0x87, 0x87, 0x0f, 0x0e, 0x0c,
+    0x1c, 0x18, 0x11, 0x37, 0x38, 0x4d, 0x54, 0xd0, 0x88, 0xa0, 0xa8, 0x20, 0x70, 0x80, 0xd0, 0xb0,
+    0x85, 0x00, 0x11, 0x10, 0x60, 0x80, 0x58, 0xb0, 0x80, 0xd8, 0xd0, 0xc0, 0x58, 0x60, 0x2a, 0x09,
+    0x88, 0xc7, 0xe3, 0xf8, 0xfe, 0x82, 0xff, 0x05, 0x7f, 0x3f, 0x1f, 0x0f, 0x03, 0x01, 0x82, 0x00,
+    0x01, 0x03, 0x1c, 0x73, 0x05, 0x7f, 0xc7, 0xf1, 0xfc, 0x7e, 0x7f, 0x82, 0x3f, 0x83, 0x1f, 0x1c,
+    0x8f, 0xcf, 0xcf, 0xef, 0xe7, 0x37, 0x87, 0x8b, 0x83, 0xf1, 0x45, 0x2c, 0x2c, 0x8e, 0xae, 0x0e,
+    0x0f, 0x2f, 0x37, 0x77, 0x73, 0x53, 0x59, 0xa8, 0x4c, 0x03, 0x00, 0x06, 0x05, 0x95, 0x00, 0x00,
+    0x01, 0x83, 0x00, 0x07, 0x12, 0xa9, 0x97, 0x1e, 0xf0, 0x01, 0x07, 0x1f, 0x85, 0xff, 0x19, 0xfc,
+    0xf8, 0xe0, 0x00, 0x76, 0x73, 0x71, 0x20, 0x00, 0x70, 0x50, 0xf8, 0x70, 0x34, 0x06, 0x17, 0x27,
+    0xab, 0x8b, 0x47, 0x9d, 0x0e, 0x07, 0x05, 0x05, 0x03, 0x8b, 0x00, 0x01, 0x01, 0x02, 0x9d, 0x00,
+    0x07, 0x20, 0x00, 0x40, 0xf0, 0x00, 0x73, 0xff, 0xff, 0x82, 0x00, 0x00, 0x01, 0x88, 0xff, 0x26,
+    0xf3, 0x1c, 0xf8, 0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0xc0, 0xc1, 0xc3, 0xc6, 0x8e, 0x8e, 0x9e, 0x9f,
+    0x3c, 0x79, 0x44, 0x0c, 0xa9, 0x59, 0x08, 0x48, 0x40, 0xe0, 0xd0, 0xc0, 0xc0, 0xe0, 0x50, 0x60,
+    0x70, 0x58, 0x5c, 0x8c, 0x18, 0x00, 0x40, 0x9c, 0x00, 0x09, 0x80, 0x00, 0xdb, 0x4c, 0xc7, 0xff,
+    0x00, 0x00, 0xc0, 0xfc, 0x86, 0xff, 0x0a, 0x3f, 0x07, 0xff, 0xff, 0xf8, 0xe1, 0x87, 0x0f, 0x1f,
+    0x3f, 0x7f, 0x89, 0xff, 0x82, 0xfe, 0x1c, 0xfd, 0xf9, 0xf9, 0xf3, 0xf3, 0xe3, 0xc7, 0xc7, 0x87,
+    0x87, 0x0f, 0x0e, 0x0c, 0x1c, 0x18, 0x10, 0x27, 0x28, 0x40, 0x54, 0x90, 0x90, 0xa8, 0x38, 0x20,
+    0x40, 0x90, 0x80, 0x50, 0x87, 0x00, 0x0f, 0x30, 0x40, 0xa0, 0xa0, 0xc0, 0xd8, 0xd8, 0x58, 0x50,
+    0x32, 0x33, 0x14, 0x8f, 0xe7, 0xf0, 0xfc, 0x82, 0xff, 0x05, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03,
+    0x82, 0x00, 0x01, 0x03, 0x1c, 0x74, 0x05, 0xbf, 0xe3, 0xf8, 0xfe, 0x7f, 0x7f, 0x82, 0x3f, 0x82,
+    0x1f, 0x0d, 0x9f, 0x8f, 0xcf, 0xcf, 0xe7, 0xf7, 0x17, 0x83, 0x3b, 0x93, 0xb5, 0x04, 0x2c, 0x2e,
+    0x82, 0x0e, 0x0b, 0x4f, 0x1f, 0x37, 0x77, 0xf3, 0x51, 0xc9, 0xe8, 0x44, 0x17, 0x00, 0x06, 0x97,
+    0x00, 0x0c, 0x01, 0x00, 0x00, 0x08, 0x00, 0x2e, 0x11, 0x2f, 0xfc, 0x00, 0x03, 0x0f, 0x7f, 0x84,
+    0xff, 0x1a, 0xfe, 0xfc, 0xf0, 0xc0, 0x00, 0x73, 0x71, 0x30, 0x20, 0x20, 0x50, 0x00, 0x58, 0x70,
+    0x54, 0x06, 0x37, 0xa3, 0xab, 0x8b, 0x47, 0x91, 0x02, 0x07, 0x05, 0x0e, 0x05, 0x8b, 0x00, 0x01,
+    0x01, 0x01, 0x9e, 0x00, 0x06, 0x20, 0x20, 0x60, 0x8a, 0x02, 0xfe, 0xff, 0x83, 0x00, 0x88, 0xff,
+    0x05, 0xfc, 0xce, 0x3c, 0xf8, 0xf0, 0xf0, 0x82, 0xe0, 0x1e, 0xc1, 0xc1, 0xc3, 0xc6, 0x8e, 0x8e,
+    0x9e, 0xbf, 0x3d, 0x79, 0x44, 0x8e, 0x01, 0x19, 0x38, 0x60, 0x40, 0xc0, 0xd0, 0xd0, 0xc0, 0xf0,
+    0x40, 0x60, 0x70, 0x50, 0x5c, 0x8c, 0x18, 0x00, 0x40, 0x9d, 0x00, 0x08, 0x40, 0xc1, 0x72, 0xa3,
+    0xff, 0x00, 0x00, 0x80, 0xf0, 0x86, 0xff, 0x0b, 0x7f, 0x1f, 0x01, 0xff, 0xfe, 0xf8, 0xc3, 0x87,
+    0x0f, 0x3f, 0x3f, 0x7f, 0x89, 0xff, 0x16, 0xfe, 0xfe, 0xfc, 0xfd, 0xf9, 0xf9, 0xf3, 0xf3, 0xe3,
+    0xc7, 0xc7, 0x87, 0x0f, 0x0f, 0x0e, 0x0c, 0x1c, 0x18, 0x30, 0x26, 0x28, 0x48, 0x60, 0x82, 0xb0,
+    0x05, 0x38, 0x78, 0x40, 0xf0, 0x10, 0xb0, 0x86, 0x00, 0x11, 0x30, 0xe0, 0xd0, 0x40, 0xa0, 0x80,
+    0xdc, 0xd8, 0xd0, 0x50, 0x51, 0x20, 0x0b, 0x8c, 0xc7, 0xf1, 0xf8, 0xfe, 0x82, 0xff, 0x05, 0x7f,
+    0x3f, 0x1f, 0x0f, 0x03, 0x01, 0x82, 0x00, 0x01, 0x03, 0x1b, 0x74, 0x05, 0xff, 0xcf, 0xf1, 0xfc,
+    0x7e, 0x7f, 0x82, 0x3f, 0x83, 0x1f, 0x1d, 0x8f, 0xcf, 0xcf, 0xef, 0xe7, 0x77, 0x17, 0xcb, 0x13,
+    0x81, 0xb5, 0x14, 0x34, 0x5e, 0x5e, 0x7e, 0x3f, 0x5f, 0x57, 0x37, 0x77, 0xd3, 0xd1, 0xc9, 0xe0,
+    0x00, 0x17, 0x00, 0x00, 0x01, 0x95, 0x00, 0x0d, 0x01, 0x01, 0x00, 0x00, 0x08, 0x0e, 0x9c, 0xd8,
+    0xf7, 0xbe, 0x00, 0x01, 0x07, 0x3f, 0x85, 0xff, 0x1b, 0xfe, 0xf8, 0xe0, 0x00, 0xad, 0x53, 0x51,
+    0x00, 0x20, 0x60, 0x50, 0xc0, 0x78, 0x54, 0x76, 0x16, 0x03, 0x8b, 0xcb, 0xdb, 0x43, 0x03, 0x82,
+    0x05, 0x03, 0x04, 0x00, 0x01, 0x8a, 0x00, 0x01, 0x01, 0x01, 0x9f, 0x00, 0x06, 0x20, 0x00, 0x70,
+    0x04, 0xf8, 0xff, 0xfe, 0x82, 0x00, 0x00, 0x01, 0x88, 0xff, 0x05, 0xfd, 0x9e, 0x7c, 0xf8, 0xf0,
+    0xf0, 0x82, 0xe0, 0x1e, 0xc1, 0xc3, 0xc2, 0x86, 0x8e, 0x9e, 0x9f, 0x3c, 0x3f, 0x70, 0x45, 0x9e,
+    0xe7, 0x38, 0x34, 0x60, 0x40, 0x40, 0xd0, 0xd0, 0xe0, 0xe0, 0x40, 0x60, 0x70, 0x50, 0xdc, 0x8c,
+    0x18, 0x00, 0x40, 0x9d, 0x00, 0x09, 0x80, 0x48, 0x89, 0x31, 0xef, 0x07, 0x00, 0x00, 0xe0, 0xfc,
+    0x86, 0xff, 0x0a, 0x3f, 0x07, 0xff, 0xff, 0xfc, 0xf1, 0xc3, 0x0f, 0x1f, 0x3f, 0x7f, 0x89, 0xff,
+    0x82, 0xfe, 0x1d, 0xfd, 0xfd, 0xf9, 0xfb, 0xf3, 0xe3, 0xe3, 0xc7, 0x87, 0x87, 0x0f, 0x0e, 0x0e,
+    0x1c, 0x18, 0x19, 0x30, 0x24, 0x78, 0x65, 0xe0, 0xa0, 0xb0, 0xb0, 0x30, 0x60, 0x40, 0xe0, 0x00,
+    0x20, 0x86, 0x00, 0x11, 0x10, 0x50, 0x90, 0x50, 0xa0, 0xa0, 0xc8, 0xd8, 0xd8, 0xd0, 0x48, 0x03,
+    0x29, 0x10, 0x8f, 0xe3, 0xf0, 0xfc, 0x82, 0xff, 0x05, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x82,
+    0x00, 0x01, 0x03, 0x1b, 0x75, 0x07, 0x7f, 0xe7, 0xf8, 0xfc, 0x7f, 0x7f, 0x3f, 0x3f, 0x83, 0x1f,
+    0x1e, 0x0f, 0x8f, 0xcf, 0xcf, 0xe7, 0xe7, 0x77, 0x83, 0xcb, 0x3b, 0xc5, 0x35, 0x74, 0x16, 0x56,
+    0x5e, 0x5f, 0x3f, 0x7f, 0x17, 0x37, 0x73, 0xd3, 0xd9, 0x88, 0xc4, 0x00, 0x11, 0x00, 0x05, 0x02,
+    0x9a, 0x00, 0x08, 0x10, 0x04, 0x99, 0x83, 0x0f, 0xf8, 0x00, 0x03, 0x0f, 0x85, 0xff, 0x1a, 0xfe,
+    0xfc, 0xf0, 0xc0, 0x00, 0x57, 0x51, 0x70, 0x20, 0x00, 0x70, 0x50, 0xd8, 0x50, 0x54, 0x76, 0x37,
+    0x03, 0xab, 0xdb, 0x8f, 0xd9, 0x9b, 0x01, 0x0d, 0x03, 0x01, 0x8c, 0x00, 0x01, 0x01, 0x01, 0xa0,
+    0x00, 0x05, 0x50, 0xf8, 0x02, 0x72, 0xff, 0xff, 0x83, 0x00, 0x88, 0xff, 0x05, 0xfc, 0xf7, 0x3c,
+    0xf8, 0xf8, 0xf0, 0x82, 0xe0, 0x1f, 0xc0, 0xc1, 0xc3, 0xc6, 0x86, 0x8e, 0x9e, 0x9f, 0x3c, 0x7a,
+    0x74, 0x0d, 0x9f, 0xc4, 0x18, 0x64, 0x60, 0x40, 0x40, 0xf0, 0xd0, 0xe0, 0x60, 0x40, 0x70, 0x70,
+    0x50, 0xdc, 0x8c, 0x18, 0x80, 0x40, 0x9d, 0x00, 0x09, 0x40, 0x00, 0xc2, 0x6a, 0x87, 0xff, 0x00,
+    0x00, 0x80, 0xf0, 0x86, 0xff, 0x0b, 0x7f, 0x1f, 0x01, 0xff, 0xff, 0xf8, 0xe3, 0x87, 0x0f, 0x1f,
+    0x3f, 0x7f, 0x89, 0xff, 0x21, 0xfe, 0xfe, 0xfc, 0xfd, 0xfd, 0xf9, 0xf3, 0xf3, 0xe3, 0xe7, 0xc7,
+    0x87, 0x87, 0x0f, 0x0e, 0x0e, 0x1c, 0x18, 0x19, 0x32, 0x24, 0x58, 0x75, 0xa2, 0x80, 0x80, 0x30,
+    0x38, 0x60, 0x40, 0xf0, 0x00, 0x30, 0x80, 0x86, 0x00, 0x05, 0xe0, 0xa0, 0xd0, 0x40, 0xb0, 0x80,
+    0x82, 0xd0, 0x08, 0x48, 0x62, 0x21, 0x0c, 0x8e, 0xc7, 0xf0, 0xf8, 0xfe, 0x82, 0xff, 0x05, 0x7f,
+    0x3f, 0x1f, 0x0f, 0x03, 0x01, 0x82, 0x00, 0x01, 0x03, 0x1a, 0x75, 0x05, 0xff, 0x9f, 0xf3, 0xfc,
+    0x7e, 0x7f, 0x82, 0x3f, 0x82, 0x1f, 0x1f, 0x0f, 0x8f, 0x8f, 0xcf, 0xe7, 0xe7, 0xf7, 0x37, 0x8b,
+    0xf3, 0x09, 0xe5, 0xb4, 0x34, 0x16, 0x16, 0x7e, 0x0f, 0x0f, 0x37, 0x17, 0x17, 0x53, 0x53, 0xd9,
+    0x88, 0xc4, 0x0e, 0x15, 0x02, 0x05, 0x02, 0x9a, 0x00, 0x09, 0x0c, 0x08, 0x9f, 0x58, 0x37, 0xfe,
+    0x00, 0x01, 0x07, 0x3f, 0x85, 0xff, 0x06, 0xfe, 0xf8, 0xe0, 0x00, 0x8f, 0x73, 0x71, 0x82, 0x00,
+    0x11, 0x50, 0x40, 0xd8, 0x50, 0x54, 0x56, 0x03, 0x03, 0x8b, 0xdb, 0x07, 0xd9, 0xdc, 0x01, 0x8d,
+    0x07, 0x01, 0x01, 0x8b, 0x00, 0x01, 0x01, 0x01, 0x9f, 0x00, 0x82, 0x20, 0x03, 0x8c, 0x03, 0xfc,
+    0xff, 0x83, 0x00, 0x00, 0x03, 0x89, 0xff, 0x04, 0xce, 0x7c, 0xf8, 0xf0, 0xf0, 0x82, 0xe0, 0x1f,
+    0xc1, 0xc1, 0xc3, 0x86, 0x8e, 0x8e, 0x9e, 0x3f, 0x3c, 0x79, 0x64, 0x8d, 0x7f, 0x84, 0x3c, 0x68,
+    0x60, 0x40, 0x40, 0xf0, 0x80, 0x80, 0x60, 0x40, 0x40, 0x50, 0x50, 0xdc, 0x8c, 0x18, 0x80, 0x40,
+    0x9d, 0x00, 0x05, 0x80, 0x80, 0x89, 0xd6, 0x61, 0xff, 0x82, 0x00, 0x01, 0xe0, 0xfe, 0x86, 0xff,
+    0x0a, 0x3f, 0x07, 0xff, 0xff, 0xfe, 0xf1, 0xc3, 0x0f, 0x1f, 0x3f, 0x7f, 0x8a, 0xff, 0x20, 0xfe,
+    0xfe, 0xfc, 0xfd, 0xf9, 0xf9, 0xf3, 0xf3, 0xe3, 0xc7, 0xc7, 0x87, 0x0f, 0x0f, 0x0e, 0x1e, 0x1c,
+    0x18, 0x31, 0x33, 0x25, 0x5a, 0x75, 0xa2, 0x80, 0xb0, 0x00, 0x18, 0x48, 0x40, 0xe0, 0x10, 0x60,
+    0x87, 0x00, 0x11, 0xe0, 0x00, 0xe0, 0x40, 0xa0, 0xb0, 0x80, 0xd0, 0xd0, 0xc8, 0x69, 0x00, 0x2f,
+    0x18, 0xcf, 0xe3, 0xf8, 0xfc, 0x83, 0xff, 0x04, 0x7f, 0x3f, 0x0f, 0x07, 0x03, 0x82, 0x00, 0x01,
+    0x03, 0x1a, 0x76, 0x07, 0xff, 0xc7, 0xf9, 0xfc, 0x7f, 0x7f, 0x3f, 0x3f, 0x82, 0x1f, 0x1f, 0x0f,
+    0x0f, 0x8f, 0xcf, 0xcf, 0xe7, 0xe7, 0xf7, 0x13, 0x8b, 0xf3, 0xfd, 0x05, 0xb4, 0x36, 0x76, 0x36,
+    0x77, 0x17, 0x27, 0x37, 0x17, 0x17, 0x13, 0x59, 0xd9, 0xa8, 0xc4, 0x0a, 0x05, 0x02, 0x01, 0x9c,
+    0x00, 0x08, 0x1c, 0x96, 0xc8, 0xc7, 0x9f, 0xf0, 0x00, 0x03, 0x1f, 0x86, 0xff, 0x1c, 0xfc, 0xf0,
+    0xc0, 0x00, 0x76, 0x53, 0x70, 0x00, 0x00, 0x10, 0x50, 0x58, 0x50, 0x54, 0x76, 0x52, 0x03, 0x0b,
+    0x8b, 0xcb, 0x07, 0x89, 0x54, 0x01, 0x01, 0x04, 0x04, 0x01, 0x01, 0x8b, 0x00, 0x00, 0x01, 0xa0,
+    0x00, 0x06, 0x30, 0x08, 0x70, 0x04, 0xf9, 0xff, 0xff, 0x83, 0x00, 0x88, 0xff, 0x28, 0xfe, 0xfb,
+    0x1e, 0x7c, 0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0xc0, 0xc1, 0xc3, 0xc3, 0x86, 0x8e, 0x9e, 0x9e, 0x3f,
+    0x3c, 0x79, 0x44, 0x8d, 0x7d, 0xd8, 0x04, 0x6c, 0x60, 0x40, 0x40, 0x70, 0xc0, 0x00, 0x60, 0x40,
+    0x40, 0x50, 0x50, 0xdc, 0xac, 0x18, 0x80, 0x9f, 0x00, 0x09, 0x40, 0x08, 0x89, 0x5c, 0xcf, 0x7f,
+    0x00, 0x00, 0xc0, 0xf8, 0x86, 0xff, 0x0b, 0x7f, 0x1f, 0x03, 0xff, 0xff, 0xfc, 0xe1, 0x87, 0x0f,
+    0x1f, 0x3f, 0x7f, 0x89, 0xff, 0x82, 0xfe, 0x1f, 0xfd, 0xfd, 0xf9, 0xfb, 0xf3, 0xe3, 0xe7, 0xc7,
+    0xc7, 0x87, 0x0f, 0x0f, 0x0e, 0x1e, 0x1c, 0x18, 0x31, 0x33, 0x24, 0x5a, 0x45, 0x88, 0xa0, 0x10,
+    0x10, 0x00, 0x40, 0xe0, 0xe0, 0x00, 0xa0, 0xa0, 0x86, 0x00, 0x12, 0x80, 0xc0, 0xa0, 0x60, 0x00,
+    0xa8, 0x80, 0x88, 0xd0, 0xc8, 0x70, 0x51, 0x33, 0x10, 0x8f, 0xc7, 0xf0, 0xf8, 0xfe, 0x82, 0xff,
+    0x05, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x01, 0x82, 0x00, 0x01, 0x03, 0x1a, 0x76, 0x06, 0xbf, 0xe3,
+    0xf8, 0x7e, 0x7f, 0x3f, 0x3f, 0x83, 0x1f, 0x20, 0x0f, 0x0f, 0x8f, 0xcf, 0xe7, 0xe7, 0xf7, 0x73,
+    0x1b, 0xcb, 0x89, 0xc5, 0x64, 0xa6, 0x16, 0x76, 0x37, 0x07, 0x47, 0x27, 0x37, 0x37, 0x13, 0x13,
+    0x59, 0xd9, 0x28, 0x04, 0x1a, 0x11, 0x02, 0x01, 0x02, 0x9a, 0x00, 0x0a, 0x04, 0x00, 0x01, 0x15,
+    0x69, 0x0f, 0xfc, 0x00, 0x01, 0x07, 0x3f, 0x85, 0xff, 0x1c, 0xfe, 0xf8, 0xe0, 0x80, 0x73, 0x71,
+    0x78, 0x08, 0x00, 0x50, 0x50, 0xc8, 0x70, 0x74, 0x66, 0x63, 0x03, 0x8b, 0x9b, 0x8f, 0x11, 0x03,
+    0x84, 0x81, 0x03, 0x04, 0x00, 0x01, 0x01, 0xae, 0x00, 0x05, 0x50, 0xfc, 0x82, 0x02, 0xfe, 0xff,
+    0x83, 0x00, 0x00, 0x07, 0x88, 0xff, 0x04, 0xe6, 0x3c, 0xf8, 0xf0, 0xf0, 0x82, 0xe0, 0x10, 0xc0,
+    0xc1, 0xc3, 0x86, 0x86, 0x8e, 0x9e, 0x1f, 0x3d, 0x3f, 0x71, 0x44, 0x8e, 0x29, 0xf9, 0x04, 0x64,
+    0x82, 0x60, 0x0b, 0x50, 0x10, 0x00, 0x70, 0x40, 0x40, 0x50, 0xd0, 0xd8, 0xac, 0x18, 0x80, 0xa0,
+    0x00, 0x08, 0x40, 0x82, 0x0a, 0x83, 0xff, 0x00, 0x00, 0x80, 0xe0, 0x87, 0xff, 0x09, 0x3f, 0x0f,
+    0xff, 0xfe, 0xf8, 0xc3, 0x87, 0x1f, 0x3f, 0x7f, 0x8a, 0xff, 0x22, 0xfe, 0xfe, 0xfc, 0xfd, 0xf9,
+    0xf9, 0xf3, 0xf3, 0xe3, 0xe7, 0xc7, 0x87, 0x8f, 0x0f, 0x0f, 0x0e, 0x1c, 0x1c, 0x18, 0x31, 0x23,
+    0x65, 0x5a, 0xe4, 0x80, 0xa0, 0x20, 0x00, 0x48, 0x50, 0xe0, 0x80, 0x00, 0xa0, 0x60, 0x86, 0x00,
+    0x12, 0x20, 0xa0, 0xa0, 0xf0, 0x40, 0x88, 0xb8, 0x88, 0x80, 0xa0, 0xf0, 0x40, 0x41, 0x25, 0x1e,
+    0xcf, 0xe1, 0xf8, 0xfc, 0x83, 0xff, 0x04, 0x7f, 0x3f, 0x1f, 0x07, 0x03, 0x82, 0x00, 0x01, 0x03,
+    0x19, 0x77, 0x04, 0xff, 0xcf, 0xf1, 0xfc, 0x7f, 0x82, 0x3f, 0x82, 0x1f, 0x21, 0x0f, 0x0f, 0x8f,
+    0x8f, 0xc7, 0xe7, 0xe7, 0xf7, 0x73, 0x8b, 0xc3, 0x2d, 0xe5, 0x60, 0x06, 0x16, 0x36, 0x77, 0x47,
+    0x07, 0x27, 0x37, 0x37, 0x13, 0x1b, 0x59, 0x88, 0x2c, 0x14, 0x12, 0x09, 0x00, 0x03, 0x02, 0x9a,
+    0x00, 0x0a, 0x04, 0x04, 0x12, 0x06, 0x08, 0x17, 0xff, 0x00, 0x00, 0x03, 0x1f, 0x86, 0xff, 0x1a,
+    0xfc, 0xf8, 0xc0, 0x00, 0xad, 0x53, 0x51, 0x28, 0x28, 0x00, 0x70, 0x18, 0xf0, 0x74, 0x44, 0x62,
+    0x63, 0x03, 0xab, 0x9b, 0x9f, 0x99, 0x04, 0x05, 0x81, 0x03, 0x03, 0x8d, 0x00, 0x00, 0x01, 0xa1,
+    0x00, 0x06, 0x20, 0x60, 0x30, 0x8e, 0x02, 0xfc, 0xff, 0x84, 0x00, 0x88, 0xff, 0x29, 0xfe, 0xfd,
+    0x9e, 0x7c, 0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0xc1, 0xc3, 0x86, 0x8e, 0x8e, 0x9e, 0x3f,
+    0x3c, 0x7f, 0x70, 0xc5, 0x1e, 0xa1, 0x89, 0x08, 0x60, 0x40, 0x70, 0x60, 0x00, 0x70, 0x00, 0x70,
+    0x40, 0x50, 0x50, 0xd0, 0xd8, 0xac, 0x18, 0x80, 0xa0, 0x00, 0x04, 0xc0, 0x4a, 0x8a, 0x41, 0xff,
+    0x82, 0x00, 0x01, 0xc0, 0xf8, 0x87, 0xff, 0x0a, 0x1f, 0x03, 0xff, 0xff, 0xfc, 0xf1, 0xc3, 0x0f,
+    0x1f, 0x3f, 0x7f, 0x89, 0xff, 0x82, 0xfe, 0x20, 0xfc, 0xfd, 0xf9, 0xfb, 0xf3, 0xf3, 0xe7, 0xc7,
+    0xc7, 0x87, 0x8f, 0x0f, 0x0e, 0x1e, 0x1c, 0x1c, 0x38, 0x31, 0x22, 0x64, 0x5a, 0x84, 0xa0, 0x80,
+    0x00, 0x30, 0x50, 0x50, 0xe0, 0xa0, 0x00, 0x20, 0xa0, 0x87, 0x00, 0x11, 0x20, 0x00, 0xa0, 0x40,
+    0x20, 0xb0, 0xa8, 0x88, 0xa0, 0xb1, 0xe9, 0x62, 0x17, 0x10, 0x8f, 0xc3, 0xf0, 0xfc, 0x83, 0xff,
+    0x05, 0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x01, 0x82, 0x00, 0x01, 0x03, 0x19, 0x78, 0x06, 0x7f, 0xe7,
+    0xf8, 0x7e, 0x7f, 0x3f, 0x3f, 0x82, 0x1f, 0x82, 0x0f, 0x1e, 0x8f, 0xc7, 0xc7, 0xe7, 0xf7, 0xf3,
+    0x3b, 0x8b, 0xc1, 0x25, 0xc8, 0x62, 0x22, 0x16, 0x37, 0x77, 0x27, 0x07, 0x27, 0x67, 0x13, 0x7b,
+    0x1b, 0xd9, 0xa8, 0x2c, 0xd4, 0x02, 0x0b, 0x00, 0x03, 0x9d, 0x00, 0x09, 0x07, 0xce, 0xc4, 0xeb,
+    0x0f, 0xfc, 0x00, 0x01, 0x0f, 0x3f, 0x85, 0xff, 0x1d, 0xfe, 0xfc, 0xf0, 0x80, 0x00, 0x77, 0x71,
+    0x78, 0x08, 0x28, 0x10, 0x70, 0x48, 0xf0, 0x74, 0x46, 0x13, 0x23, 0x2b, 0xbb, 0xcf, 0x95, 0xd9,
+    0x8c, 0x05, 0x85, 0x03, 0x06, 0x01, 0x01, 0xaf, 0x00, 0x06, 0x30, 0x08, 0x7e, 0x04, 0xf9, 0xff,
+    0xff, 0x83, 0x00, 0x00, 0xcf, 0x88, 0xff, 0x05, 0x70, 0xf7, 0x3c, 0xf8, 0xf8, 0xf0, 0x82, 0xe0,
+    0x10, 0xc0, 0xc1, 0xc1, 0x83, 0x86, 0x8e, 0x9e, 0x1e, 0x3f, 0x3c, 0x78, 0x64, 0x8d, 0x1e, 0x05,
+    0x08, 0x14, 0x83, 0x60, 0x82, 0x00, 0x09, 0x70, 0x40, 0x50, 0xd0, 0xd0, 0x98, 0xac, 0x18, 0xc0,
+    0x40, 0xa0, 0x00, 0x08, 0x50, 0xd1, 0x1c, 0x87, 0xff, 0x00, 0x00, 0x80, 0xf0, 0x87, 0xff, 0x0a,
+    0x7f, 0x0f, 0x00, 0xff, 0xff, 0xf8, 0xe3, 0x87, 0x0f, 0x3f, 0x7f, 0x8a, 0xff, 0x82, 0xfe, 0x21,
+    0xfd, 0xfd, 0xf9, 0xfb, 0xf3, 0xe3, 0xe7, 0xc7, 0xc7, 0x8f, 0x0f, 0x0f, 0x0e, 0x1e, 0x1c, 0x18,
+    0x38, 0x31, 0x23, 0x4c, 0x78, 0x84, 0x88, 0x40, 0x40, 0x60, 0x50, 0x70, 0xc0, 0x80, 0x60, 0x20,
+    0x60, 0x20, 0x85, 0x00, 0x13, 0x20, 0x40, 0x60, 0x80, 0xc0, 0x40, 0x10, 0xb0, 0xa0, 0xa0, 0xb8,
+    0x80, 0x41, 0x47, 0x28, 0x1e, 0xc7, 0xe1, 0xf8, 0xfe, 0x83, 0xff, 0x05, 0x7f, 0x3f, 0x1f, 0x0f,
+    0x03, 0x01, 0x82, 0x00, 0x01, 0x03, 0x18, 0x78, 0x04, 0xff, 0x9f, 0xf1, 0xfc, 0x7f, 0x82, 0x3f,
+    0x82, 0x1f, 0x21, 0x0f, 0x0f, 0x8f, 0x87, 0xc7, 0xe7, 0xe7, 0xf3, 0xf3, 0x1b, 0x89, 0xed, 0x29,
+    0x90, 0x6a, 0x22, 0x32, 0x37, 0x27, 0x07, 0x17, 0x07, 0x4f, 0x1b, 0x3b, 0x79, 0xb9, 0xa8, 0x24,
+    0x50, 0x30, 0x0b, 0x00, 0x01, 0x9d, 0x00, 0x09, 0x06, 0x01, 0x14, 0x88, 0x17, 0xfe, 0x00, 0x00,
+    0x03, 0x1f, 0x86, 0xff, 0x1d, 0xfe, 0xf8, 0xe0, 0x00, 0x47, 0x73, 0x79, 0x68, 0x28, 0x28, 0x70,
+    0x18, 0xd0, 0x70, 0x64, 0x62, 0x53, 0x03, 0x0b, 0xbb, 0xef, 0x15, 0xc9, 0x88, 0x05, 0x87, 0x02,
+    0x00, 0x01, 0x01, 0xb0, 0x00, 0x05, 0x10, 0x70, 0x80, 0x02, 0xfe, 0xff, 0x83, 0x00, 0x00, 0x01,
+    0x8a, 0xff, 0x28, 0xce, 0x7c, 0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0xc1, 0xc3, 0x87, 0x86,
+    0x8e, 0x9e, 0x1e, 0x3f, 0x3c, 0x78, 0x64, 0x8d, 0x9f, 0x06, 0x6c, 0x14, 0x60, 0x40, 0x60, 0x60,
+    0x30, 0x40, 0x00, 0x70, 0x60, 0x50, 0xc0, 0xd0, 0x98, 0xa8, 0x40, 0xc0, 0xa1, 0x00, 0x04, 0x80,
+    0x51, 0x82, 0x63, 0xff, 0x82, 0x00, 0x01, 0xc0, 0xfc, 0x87, 0xff, 0x0a, 0x3f, 0x03, 0xff, 0xff,
+    0xfe, 0xf1, 0xc3, 0x0f, 0x1f, 0x3f, 0x7f, 0x89, 0xff, 0x82, 0xfe, 0x17, 0xfc, 0xfd, 0xf8, 0xf8,
+    0xf3, 0xf3, 0xe3, 0xe7, 0xc7, 0x87, 0x8f, 0x0f, 0x0f, 0x1e, 0x1e, 0x1c, 0x38, 0x39, 0x31, 0x62,
+    0x4c, 0x78, 0x8e, 0xc2, 0x82, 0x40, 0x07, 0x60, 0x70, 0xe0, 0xa0, 0x60, 0x20, 0x60, 0x20, 0x86,
+    0x00, 0x06, 0x20, 0x40, 0xa0, 0x80, 0x40, 0x20, 0x30, 0x82, 0xb0, 0x08, 0x81, 0xa0, 0x58, 0x15,
+    0x1c, 0x8f, 0xc3, 0xf0, 0xfc, 0x84, 0xff, 0x04, 0x7f, 0x3f, 0x0f, 0x07, 0x03, 0x82, 0x00, 0x01,
+    0x03, 0x18, 0x79, 0x06, 0x7f, 0xe7, 0xf8, 0x7e, 0x7f, 0x3f, 0x3f, 0x82, 0x1f, 0x82, 0x0f, 0x1f,
+    0x8f, 0xc7, 0xc7, 0xe7, 0xf7, 0xf3, 0x7b, 0x1b, 0xc1, 0xfd, 0xb4, 0x92, 0x2a, 0x0a, 0x3b, 0x1f,
+    0x0f, 0x4f, 0x0f, 0x1f, 0x0b, 0x3b, 0x1b, 0x79, 0x29, 0x2c, 0x24, 0x72, 0x24, 0x08, 0x00, 0x02,
+    0x9e, 0x00, 0x09, 0x0f, 0x4f, 0x8c, 0x7b, 0x9f, 0xf8, 0x00, 0x01, 0x0f, 0x7f, 0x86, 0xff, 0x1d,
+    0xfc, 0xf0, 0xc0, 0x00, 0x16, 0x51, 0x58, 0x48, 0x28, 0x18, 0x58, 0x58, 0xf0, 0x54, 0x64, 0x32,
+    0x53, 0x03, 0xab, 0x9b, 0xdd, 0x19, 0xdf, 0x01, 0x05, 0x83, 0x00, 0x05, 0x00, 0x01, 0x8c, 0x00,
+    0x00, 0x01, 0xa1, 0x00, 0x07, 0x20, 0x30, 0x24, 0xdc, 0x02, 0xfc, 0xff, 0xff, 0x83, 0x00, 0x89,
+    0xff, 0x2a, 0xf8, 0xfb, 0x1e, 0xfc, 0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0xc1, 0x83, 0x86,
+    0x8e, 0x8e, 0x1e, 0x3f, 0x3d, 0x7f, 0x79, 0xc4, 0x8d, 0xfd, 0x00, 0x6c, 0x3c, 0x40, 0x40, 0x60,
+    0x60, 0x10, 0x00, 0x00, 0x70, 0x60, 0x50, 0xc0, 0xd0, 0x98, 0xa0, 0x40, 0xc0, 0xa2, 0x00, 0x08,
+    0x52, 0x01, 0x30, 0xcf, 0xff, 0x00, 0x00, 0x80, 0xf0, 0x87, 0xff, 0x0a, 0x7f, 0x0f, 0x00, 0xff,
+    0xff, 0xf8, 0xe1, 0x87, 0x0f, 0x1f, 0x7f, 0x8a, 0xff, 0x82, 0xfe, 0x22, 0xfd, 0xfd, 0xf8, 0xfa,
+    0xf3, 0xf3, 0xe7, 0xc7, 0xc7, 0x8f, 0x8f, 0x0f, 0x0f, 0x1e, 0x1e, 0x1c, 0x38, 0x31, 0x31, 0x62,
+    0x4c, 0xfa, 0x8e, 0xc2, 0x40, 0x00, 0x00, 0x60, 0x60, 0xf0, 0x80, 0x40, 0x00, 0x40, 0x20, 0x86,
+    0x00, 0x07, 0x60, 0xa0, 0x60, 0xa0, 0x20, 0x40, 0x00, 0xb0, 0x82, 0xa0, 0x08, 0xa1, 0x32, 0x4b,
+    0x20, 0x1e, 0xc7, 0xe0, 0xf8, 0xfe, 0x83, 0xff, 0x05, 0x7f, 0x3f, 0x1f, 0x0f, 0x03, 0x01, 0x82,
+    0x00, 0x01, 0x03, 0x18, 0x79, 0x05, 0x9f, 0xf3, 0xfc, 0x7e, 0x3f, 0x3f, 0x82, 0x1f, 0x83, 0x0f,
+    0x0f, 0x87, 0xc7, 0xe7, 0xe7, 0xf3, 0xf3, 0x7b, 0x89, 0xc5, 0xc9, 0xec, 0x0a, 0x5a, 0x2b, 0x1b,
+    0x0b, 0x82, 0x0f, 0x0e, 0x1f, 0x2b, 0x3b, 0x1b, 0x79, 0x28, 0x2c, 0x44, 0x62, 0x25, 0x0a, 0x00,
+    0x02, 0x01, 0x01, 0x9b, 0x00, 0x0a, 0x06, 0x06, 0x02, 0xcc, 0x71, 0x07, 0xfe, 0x00, 0x00, 0x03,
+    0x1f, 0x86, 0xff, 0x1b, 0xfe, 0xfc, 0xe0, 0x00, 0x73, 0x59, 0x68, 0x08, 0x28, 0x38, 0x78, 0x50,
+    0xf0, 0x44, 0x62, 0x13, 0x73, 0x2b, 0xbb, 0xbf, 0x8d, 0x1b, 0x00, 0x8d, 0x87, 0x03, 0x05, 0x02,
+    0x8e, 0x00, 0x00, 0x01, 0xa2, 0x00, 0x06, 0x30, 0x40, 0x78, 0x05, 0x31, 0xff, 0xff, 0x83, 0x00,
+    0x00, 0x01, 0x89, 0xff, 0x2a, 0xe7, 0x3c, 0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0xc1, 0xc1,
+    0x83, 0x86, 0x8e, 0x8e, 0x1e, 0x3f, 0x3c, 0x7f, 0x71, 0xc4, 0x1e, 0xd9, 0x98, 0x5c, 0x20, 0x40,
+    0x60, 0x70, 0x20, 0x10, 0x40, 0x00, 0x70, 0x60, 0xd0, 0xc0, 0xd0, 0xa8, 0xa0, 0x40, 0x00, 0x80,
+    0xa1, 0x00, 0x04, 0x8a, 0x13, 0xd8, 0x83, 0xff, 0x82, 0x00, 0x01, 0xc0, 0xfc, 0x87, 0xff, 0x09,
+    0x3f, 0x07, 0xff, 0xfe, 0xf0, 0xc3, 0x0f, 0x1f, 0x3f, 0x7f, 0x89, 0xff, 0x82, 0xfe, 0x22, 0xfc,
+    0xfd, 0xfc, 0xf8, 0xfa, 0xf2, 0xe3, 0xe7, 0xc7, 0xc7, 0x8f, 0x0f, 0x0f, 0x1e, 0x1e, 0x1c, 0x1c,
+    0x38, 0x31, 0x71, 0x62, 0x4e, 0xf8, 0xce, 0x48, 0x00, 0x00, 0x20, 0x20, 0xe0, 0xa0, 0x80, 0x60,
+    0x00, 0x40, 0x87, 0x00, 0x82, 0x40, 0x10, 0xa0, 0x80, 0x40, 0x50, 0x18, 0xa0, 0xb0, 0xa0, 0xd0,
+    0xc3, 0x7b, 0x39, 0x1c, 0x8f, 0xc3, 0xf0, 0xfc, 0x84, 0xff, 0x04, 0x7f, 0x3f, 0x1f, 0x07, 0x03,
+    0x82, 0x00, 0x01, 0x03, 0x17, 0x7a, 0x08, 0xff, 0xcf, 0xf8, 0x7e, 0x7f, 0x3f, 0x3f, 0x1f, 0x1f,
+    0x83, 0x0f, 0x0e, 0x87, 0x87, 0xc7, 0xe7, 0xe3, 0xf3, 0xfb, 0x39, 0x89, 0xc5, 0x54, 0xe6, 0x82,
+    0x5a, 0x1b, 0x82, 0x2b, 0x10, 0x33, 0x03, 0x1b, 0x2b, 0x0b, 0x19, 0x39, 0x6c, 0x2c, 0xc4, 0x62,
+    0x05, 0x08, 0x01, 0x02, 0x01, 0x01, 0x9d, 0x00, 0x09, 0x08, 0x0e, 0x2c, 0x2b, 0xff, 0xe0, 0x00,
+    0x01, 0x0f, 0x7f, 0x86, 0xff, 0x1c, 0xfe, 0xf8, 0xc0, 0x00, 0x95, 0x71, 0x58, 0x68, 0x08, 0x08,
+    0x78, 0x08, 0xc0, 0x44, 0x44, 0x02, 0x13, 0x43, 0x2b, 0xbb, 0x8d, 0x85, 0x9b, 0x0a, 0x07, 0x07,
+    0x02, 0x07, 0x02, 0x8e, 0x00, 0x00, 0x01, 0xa1, 0x00, 0x08, 0x20, 0x10, 0x10, 0x70, 0x89, 0x02,
+    0xfe, 0xff, 0xff, 0x83, 0x00, 0x89, 0xff, 0x2c, 0xfc, 0xfd, 0x9e, 0x7c, 0xf8, 0xf0, 0xf0, 0xe0,
+    0xe0, 0xc0, 0xc0, 0xc1, 0x83, 0x83, 0x86, 0x8e, 0x1e, 0x1e, 0x3f, 0x7c, 0x78, 0xf4, 0x8d, 0x1e,
+    0x89, 0x99, 0xd4, 0x2c, 0x60, 0x40, 0x60, 0x20, 0x70, 0x40, 0x00, 0x70, 0xe0, 0xd0, 0xc0, 0xd0,
+    0xa8, 0x20, 0x40, 0x00, 0x80, 0xa2, 0x00, 0x08, 0x58, 0x06, 0x61, 0xff, 0x1f, 0x00, 0x00, 0x80,
+    0xf0, 0x87, 0xff, 0x0a, 0x7f, 0x1f, 0x01, 0xff, 0xff, 0xfc, 0xe1, 0x87, 0x0f, 0x1f, 0x7f, 0x8a,
+    0xff, 0x82, 0xfe, 0x23, 0xfc, 0xfd, 0xf8, 0xfa, 0xf2, 0xf2, 0xe7, 0xe7, 0xc7, 0x8f, 0x8f, 0x0f,
+    0x0f, 0x1e, 0x1e, 0x1c, 0x3c, 0x38, 0x31, 0x61, 0x62, 0x4e, 0xb8, 0xcc, 0x4c, 0x00, 0x40, 0x20,
+    0x20, 0xb0, 0xb0, 0xc0, 0x40, 0x20, 0x40, 0x40, 0x86, 0x00, 0x14, 0x40, 0x40, 0x00, 0x40, 0xc0,
+    0x00, 0x50, 0x08, 0x00, 0x20, 0xa0, 0xd0, 0x81, 0xb4, 0x47, 0x38, 0x1f, 0xc7, 0xe0, 0xf8, 0xfe,
+    0x84, 0xff, 0x04, 0x7f, 0x1f, 0x0f, 0x07, 0x01, 0x82, 0x00, 0x01, 0x03, 0x17, 0x7a, 0x05, 0x3f,
+    0xe3, 0xfc, 0x7e, 0x3f, 0x3f, 0x82, 0x1f, 0x82, 0x0f, 0x23, 0x07, 0x87, 0xc7, 0xc7, 0xe3, 0xf3,
+    0xf3, 0xfb, 0x39, 0x85, 0xe1, 0x12, 0xce, 0x42, 0x1b, 0x1b, 0x2b, 0x0b, 0x3b, 0x33, 0x03, 0x1b,
+    0x0b, 0x0b, 0x49, 0x29, 0x6c, 0xec, 0xd4, 0x62, 0x07, 0x00, 0x01, 0x00, 0x00, 0x01, 0x9b, 0x00,
+    0x0b, 0x02, 0x02, 0x0a, 0x4b, 0x44, 0xf1, 0x87, 0xfe, 0x00, 0x00, 0x03, 0x1f, 0x87, 0xff, 0x1b,
+    0xfc, 0xf0, 0x80, 0x53, 0x79, 0x78, 0x48, 0x08, 0x18, 0x58, 0x40, 0xe8, 0x64, 0x62, 0x32, 0x33,
+    0x63, 0x0b, 0x9b, 0xbd, 0x0d, 0xa9, 0xcd, 0x07, 0x03, 0x02, 0x06, 0x01, 0x8e, 0x00, 0x00, 0x01,
+    0xa2, 0x00, 0x07, 0x20, 0x30, 0x28, 0x7c, 0x03, 0xf8, 0xff, 0xff, 0x83, 0x00, 0x00, 0x01, 0x89,
+    0xff, 0x06, 0xf7, 0x3c, 0xf8, 0xf8, 0xf0, 0xe0, 0xe0, 0x82, 0xc0, 0x14, 0xc1, 0x83, 0x86, 0x86,
+    0x8e, 0x1e, 0x3e, 0x3f, 0x7c, 0x78, 0xe4, 0x8d, 0x1e, 0x87, 0x19, 0xd8, 0x04, 0x60, 0x40, 0x70,
+    0x10, 0x82, 0x00, 0x07, 0xe0, 0xc0, 0xf0, 0xc0, 0xd0, 0xa8, 0x20, 0x50, 0xa3, 0x00, 0x05, 0x80,
+    0x88, 0x51, 0xfc, 0x87, 0xff, 0x82, 0x00, 0x01, 0xe0, 0xfe, 0x87, 0xff, 0x09, 0x3f, 0x07, 0xff,
+    0xff, 0xf8, 0xc3, 0x07, 0x1f, 0x3f, 0x7f, 0x89, 0xff, 0x82, 0xfe, 0x23, 0xfc, 0xfd, 0xfc, 0xf8,
+    0xfa, 0xf2, 0xf2, 0xe7, 0xc7, 0xc7, 0x8f, 0x8f, 0x0f, 0x1f, 0x1e, 0x1e, 0x1c, 0x3c, 0x38, 0x31,
+    0x62, 0x61, 0xce, 0xb8, 0xac, 0x0c, 0x00, 0x00, 0x40, 0x00, 0x90, 0xa0, 0xc0, 0x40, 0x00, 0x40,
+    0x88, 0x00, 0x13, 0x80, 0x80, 0x40, 0xe0, 0xc0, 0x10, 0x50, 0x00, 0x20, 0x20, 0xd0, 0x90, 0x97,
+    0x33, 0x21, 0x1e, 0x8f, 0xc1, 0xf0, 0xfc, 0x84, 0xff, 0x04, 0x7f, 0x3f, 0x1f, 0x0f, 0x03, 0x82,
+    0x00, 0x01, 0x03, 0x16, 0x7b, 0x08, 0xff, 0xcf, 0xf9, 0x7e, 0x7f, 0x3f, 0x3f, 0x1f, 0x1f, 0x82,
+    0x0f, 0x22, 0x07, 0x87, 0x87, 0xc7, 0xe7, 0xe3, 0xf3, 0xfb, 0x79, 0x99, 0xc5, 0xe0, 0x96, 0x40,
+    0x61, 0x59, 0x0b, 0x1b, 0x1b, 0x3b, 0x2b, 0x1b, 0x13, 0x1b, 0x09, 0x49, 0x2c, 0x6c, 0xe4, 0xd6,
+    0x62, 0x05, 0x00, 0x01, 0x01, 0x9f, 0x00, 0x0a, 0x0a, 0x01, 0x0a, 0x84, 0x1b, 0xff, 0x00, 0x00,
+    0x01, 0x0f, 0x7f, 0x86, 0xff, 0x1d, 0xfe, 0xf8, 0xe0, 0x00, 0xeb, 0x73, 0x78, 0x68, 0x08, 0x08,
+    0x38, 0x40, 0x08, 0xc8, 0x64, 0x42, 0x33, 0x73, 0x6b, 0x9b, 0x9d, 0xcd, 0x7b, 0xde, 0x43, 0x07,
+    0x82, 0x01, 0x02, 0x01, 0xb2, 0x00, 0x07, 0x20, 0x00, 0x40, 0xf8, 0x86, 0x01, 0xfe, 0xff, 0x84,
+    0x00, 0x89, 0xff, 0x2c, 0xfe, 0xff, 0xce, 0x7c, 0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0xc1,
+    0x81, 0x83, 0x86, 0x8e, 0x0e, 0x1e, 0x3f, 0x3d, 0x7e, 0x78, 0xc4, 0x8d, 0x3f, 0x61, 0x5c, 0x94,
+    0x00, 0x40, 0x40, 0x70, 0x00, 0x00, 0x40, 0xa0, 0xe0, 0xc0, 0xf0, 0xc0, 0xf0, 0xa8, 0x20, 0x50,
+    0x60, 0xa3, 0x00, 0x04, 0x92, 0xca, 0x56, 0x43, 0xff, 0x82, 0x00, 0x01, 0x80, 0xf0, 0x88, 0xff,
+    0x09, 0x1f, 0x03, 0xff, 0xff, 0xfc, 0xf1, 0x87, 0x0f, 0x1f, 0x3f, 0x8a, 0xff, 0x82, 0xfe, 0x0c,
+    0xfc, 0xfd, 0xf8, 0xfa, 0xfa, 0xf2, 0xe6, 0xe6, 0xc7, 0xcf, 0x8f, 0x0f, 0x0f, 0x82, 0x1e, 0x15,
+    0x3c, 0x38, 0x39, 0x71, 0x62, 0x41, 0xcc, 0xb0, 0xbe, 0x4e, 0x40, 0x00, 0x60, 0xa0, 0x80, 0xa0,
+    0x80, 0x00, 0x80, 0x40, 0x80, 0x40, 0x86, 0x00, 0x14, 0x40, 0x40, 0x00, 0x60, 0x80, 0x40, 0x60,
+    0x48, 0x10, 0x00, 0x50, 0x61, 0x84, 0x82, 0x59, 0x38, 0x1f, 0xc7, 0xe0, 0xf8, 0xfe, 0x84, 0xff,
+    0x04, 0x7f, 0x3f, 0x0f, 0x07, 0x01, 0x82, 0x00, 0x01, 0x03, 0x16, 0x7c, 0x07, 0x7f, 0xe3, 0xfc,
+    0x7e, 0x3f, 0x3f, 0x1f, 0x1f, 0x83, 0x0f, 0x23, 0x07, 0x87, 0xc7, 0xc7, 0xe3, 0xf3, 0xf3, 0xf9,
+    0x79, 0x8d, 0xc4, 0xf6, 0x8c, 0x54, 0xa1, 0x19, 0x1b, 0x3b, 0x1b, 0x03, 0x03, 0x1b, 0x13, 0x3b,
+    0x09, 0x0d, 0x2c, 0x6c, 0xe4, 0xd2, 0x6a, 0x0f, 0x05, 0x00, 0x00, 0x01, 0x9e, 0x00, 0x0a, 0x02,
+    0x08, 0x43, 0xe0, 0x71, 0xcf, 0xfe, 0x00, 0x00, 0x03, 0x1f, 0x87, 0xff, 0x1c, 0xfc, 0xf0, 0xc0,
+    0x00, 0x17, 0x79, 0x78, 0x68, 0x08, 0x10, 0x70, 0x28, 0x58, 0x6c, 0x60, 0x02, 0x03, 0x53, 0x6b,
+    0xd9, 0xad, 0x85, 0x5b, 0x40, 0x89, 0x06, 0x82, 0x85, 0x04, 0xb4, 0x00, 0x07, 0x20, 0x50, 0x30,
+    0xc9, 0x02, 0xfc, 0xff, 0xff, 0x83, 0x00, 0x00, 0x01, 0x89, 0xff, 0x05, 0x78, 0xf3, 0x3e, 0xfc,
+    0xf8, 0xf0, 0x82, 0xe0, 0x23, 0xc0, 0xc0, 0x81, 0x83, 0x83, 0x86, 0x0e, 0x1e, 0x1e, 0x3f, 0x7c,
+    0x7f, 0xf1, 0xc4, 0x0d, 0xbf, 0x20, 0x0c, 0xbc, 0x80, 0xc0, 0xc0, 0xb0, 0x80, 0x80, 0xc0, 0xa0,
+    0x90, 0xc0, 0xf0, 0xe0, 0xf0, 0xa8, 0x20, 0x48, 0x20, 0xa4, 0x00, 0x04, 0x92, 0x8b, 0x90, 0x8f,
+    0xff, 0x82, 0x00, 0x01, 0xe0, 0xfe, 0x87, 0xff, 0x0a, 0x7f, 0x0f, 0x00, 0xff, 0xff, 0xf8, 0xe3,
+    0x87, 0x1f, 0x3f, 0x7f, 0x89, 0xff, 0x83, 0xfe, 0x0c, 0xfc, 0xfd, 0xf9, 0xfa, 0xf2, 0xf2, 0xe6,
+    0xe6, 0xc7, 0x8f, 0x8f, 0x0f, 0x1f, 0x82, 0x1e, 0x09, 0x3c, 0x38, 0x39, 0x71, 0x62, 0x45, 0xc8,
+    0xb0, 0x3a, 0x7e, 0x82, 0xc0, 0x08, 0xa0, 0xb0, 0xe0, 0x80, 0x00, 0xc0, 0x40, 0x80, 0x40, 0x88,
+    0x00, 0x12, 0xc0, 0x60, 0x80, 0xc0, 0x20, 0x70, 0x50, 0x40, 0x40, 0x70, 0x53, 0xac, 0x27, 0x61,
+    0x1e, 0x8f, 0xc1, 0xf0, 0xfc, 0x85, 0xff, 0x04, 0x3f, 0x1f, 0x0f, 0x03, 0x01, 0x82, 0x00, 0x01,
+    0x03, 0x16, 0x7c, 0x04, 0xcf, 0xf1, 0x7c, 0x7f, 0x3f, 0x82, 0x1f, 0x82, 0x0f, 0x23, 0x07, 0x07,
+    0x87, 0xc7, 0xe3, 0xe3, 0xf3, 0xf3, 0xf9, 0x3d, 0x8d, 0xc0, 0xfe, 0x88, 0xc9, 0xb1, 0x01, 0x09,
+    0x1b, 0x1b, 0x23, 0x2b, 0x0b, 0x13, 0x1d, 0x3d, 0x2d, 0x6c, 0x6c, 0xd6, 0x92, 0x09, 0x02, 0x01,
+    0x00, 0x01, 0xa0, 0x00, 0x0a, 0x07, 0x07, 0x2a, 0x70, 0x03, 0xff, 0x00, 0x00, 0x01, 0x0f, 0x7f,
+    0x87, 0xff, 0x1b, 0xfc, 0xf0, 0x00, 0x53, 0x78, 0x68, 0x68, 0x28, 0x10, 0x50, 0x10, 0xc8, 0x6c,
+    0x42, 0x13, 0x03, 0x5b, 0x59, 0xdd, 0xbd, 0xcf, 0x58, 0x1b, 0x08, 0x86, 0x02, 0x06, 0x06, 0xb5,
+    0x00, 0x06, 0x30, 0x08, 0x7d, 0x01, 0x31, 0xff, 0xff, 0x84, 0x00, 0x8a, 0xff, 0x06, 0xce, 0x7c,
+    0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0x82, 0xc0, 0x21, 0x81, 0x83, 0x87, 0x86, 0x0e, 0x1e, 0x3e, 0x3f,
+    0x7c, 0x79, 0xf4, 0x8c, 0x1e, 0xf9, 0x4a, 0x4c, 0xa4, 0xa0, 0xc0, 0xc0, 0xb0, 0xa0, 0xc0, 0x80,
+    0xa0, 0x90, 0xc0, 0xf0, 0xe0, 0xa0, 0xa8, 0x20, 0x48, 0x20, 0xa4, 0x00, 0x04, 0x9a, 0x99, 0x54,
+    0x03, 0xff, 0x82, 0x00, 0x01, 0x80, 0xf8, 0x88, 0xff, 0x09, 0x3f, 0x07, 0xff, 0xfe, 0xf1, 0xc3,
+    0x0f, 0x1f, 0x3f, 0x7f, 0x89, 0xff, 0x82, 0xfe, 0x0c, 0xfc, 0xfd, 0xfc, 0xf9, 0xfa, 0xf2, 0xf6,
+    0xe6, 0xc6, 0xc7, 0x8f, 0x8f, 0x0f, 0x82, 0x1e, 0x15, 0x3c, 0x3c, 0x38, 0x79, 0x71, 0x62, 0xc5,
+    0xca, 0xb0, 0x78, 0xa6, 0x80, 0xc0, 0x80, 0xc0, 0xe0, 0xc0, 0x80, 0x00, 0xc0, 0x00, 0xc0, 0x87,
+    0x00, 0x15, 0x40, 0x80, 0x80, 0x00, 0x00, 0x80, 0xc0, 0x30, 0x70, 0x40, 0x60, 0x70, 0x00, 0x0b,
+    0x96, 0x51, 0x3c, 0x1f, 0xc7, 0xe0, 0xf8, 0xfe, 0x84, 0xff, 0x04, 0x7f, 0x3f, 0x1f, 0x07, 0x03,
+    0x82, 0x00, 0x01, 0x03, 0x15, 0x7d, 0x07, 0x7f, 0xe7, 0xf8, 0x7e, 0x3f, 0x3f, 0x1f, 0x1f, 0x82,
+    0x0f, 0x21, 0x07, 0x07, 0x87, 0xc7, 0xc3, 0xe3, 0xf3, 0xf3, 0xf9, 0x79, 0x9d, 0xc4, 0xe2, 0x60,
+    0x78, 0xd5, 0x15, 0x15, 0x09, 0x19, 0x33, 0x37, 0x07, 0x1f, 0x07, 0x2d, 0x0d, 0x3c, 0x4c, 0x7c,
+    0xd6, 0x12, 0x29, 0x1a, 0xa2, 0x00, 0x0b, 0x02, 0x00, 0x00, 0x67, 0x80, 0x11, 0xef, 0xfc, 0x00,
+    0x00, 0x03, 0x1f, 0x87, 0xff, 0x1c, 0xfe, 0xf8, 0xe0, 0x00, 0x96, 0x79, 0x58, 0x78, 0x08, 0x10,
+    0x10, 0x48, 0x10, 0xdc, 0x68, 0x02, 0x33, 0x33, 0x49, 0x59, 0xdd, 0xad, 0xff, 0xbc, 0xc5, 0x00,
+    0x86, 0x03, 0x06, 0xb8, 0x00, 0x05, 0xf0, 0x86, 0x01, 0xfe, 0xff, 0xff, 0x83, 0x00, 0x00, 0x01,
+    0x89, 0xff, 0x05, 0xfc, 0xf9, 0x1e, 0xfc, 0xf8, 0xf0, 0x82, 0xe0, 0x23, 0xc0, 0xc0, 0x81, 0x81,
+    0x83, 0x86, 0x0e, 0x0e, 0x1e, 0x3e, 0x3f, 0x7c, 0x78, 0xe4, 0x8d, 0x1e, 0x19, 0x78, 0x84, 0xf8,
+    0xa0, 0xe0, 0xc0, 0xb0, 0xe0, 0xc0, 0x80, 0xa0, 0x80, 0xc0, 0xf0, 0xe0, 0xa0, 0xa8, 0x20, 0x58,
+    0xa4, 0x00, 0x06, 0x80, 0x00, 0xc1, 0x82, 0xa1, 0xdf, 0xff, 0x82, 0x00, 0x01, 0xe0, 0xfe, 0x87,
+    0xff, 0x0a, 0x7f, 0x1f, 0x01, 0xff, 0xff, 0xf8, 0xe1, 0x87, 0x1f, 0x3f, 0x7f, 0x89, 0xff, 0x83,
+    0xfe, 0x0c, 0xfc, 0xfd, 0xf8, 0xfb, 0xf2, 0xf2, 0xe6, 0xe6, 0xc6, 0xce, 0x8f, 0x0f, 0x1f, 0x82,
+    0x1e, 0x16, 0x3c, 0x3c, 0x39, 0x71, 0x71, 0x62, 0xc7, 0x88, 0xb0, 0x3a, 0xb6, 0xd0, 0x00, 0x40,
+    0xc0, 0xe0, 0xc0, 0x00, 0x00, 0x80, 0x00, 0x80, 0x40, 0x87, 0x00, 0x14, 0x80, 0x40, 0x80, 0x00,
+    0x40, 0xc0, 0x00, 0x60, 0x70, 0x60, 0x60, 0x02, 0xc0, 0xf8, 0xab, 0x71, 0x1e, 0x8f, 0xc0, 0xf0,
+    0xfc, 0x85, 0xff, 0x04, 0x7f, 0x3f, 0x0f, 0x07, 0x01, 0x82, 0x00, 0x01, 0x03, 0x15, 0x7d, 0x06,
+    0x9f, 0xf1, 0x7c, 0x7f, 0x3f, 0x1f, 0x1f, 0x82, 0x0f, 0x82, 0x07, 0x23, 0x87, 0xc3, 0xe3, 0xe3,
+    0xf3, 0xf1, 0xf9, 0x7d, 0x9c, 0xc4, 0xe2, 0x88, 0x73, 0xb1, 0xd5, 0x15, 0x1d, 0x1d, 0x37, 0x1f,
+    0x07, 0x1f, 0x05, 0x05, 0x0d, 0x3c, 0x1c, 0x14, 0x56, 0x12, 0x09, 0x0b, 0x00, 0x00, 0x01, 0x01,
+    0x9f, 0x00, 0x0b, 0x03, 0x06, 0x45, 0x6e, 0xf0, 0x83, 0xff, 0x00, 0x00, 0x01, 0x07, 0x7f, 0x87,
+    0xff, 0x1b, 0xfc, 0xf0, 0x80, 0x53, 0x78, 0x68, 0x78, 0x00, 0x00, 0x30, 0x20, 0x78, 0xfc, 0x6a,
+    0x33, 0x23, 0x51, 0x59, 0xd9, 0xed, 0xb5, 0x7b, 0xb4, 0xca, 0x00, 0x86, 0x01, 0x06, 0xb6, 0x00,
+    0x07, 0x20, 0x38, 0x30, 0x79, 0x02, 0x78, 0xff, 0xff, 0x84, 0x00, 0x8a, 0xff, 0x06, 0xe7, 0x3c,
+    0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0x82, 0xc0, 0x21, 0x81, 0x83, 0x83, 0x86, 0x0e, 0x1e, 0x1e, 0x3f,
+    0x7d, 0x7e, 0xf8, 0xe4, 0x8d, 0x1e, 0x45, 0x39, 0x14, 0xf4, 0x80, 0xe0, 0x80, 0x80, 0xf0, 0x00,
+    0xa0, 0xa0, 0x80, 0xe0, 0xf0, 0xe0, 0xa0, 0xa8, 0x20, 0x30, 0xa5, 0x00, 0x05, 0x80, 0x80, 0x39,
+    0x3c, 0x07, 0xff, 0x82, 0x00, 0x01, 0x80, 0xf8, 0x88, 0xff, 0x09, 0x3f, 0x07, 0xff, 0xfe, 0xf0,
+    0xc3, 0x0f, 0x1f, 0x3f, 0x7f, 0x89, 0xff, 0x82, 0xfe, 0x0c, 0xfc, 0xfd, 0xfd, 0xf8, 0xfb, 0xf2,
+    0xf2, 0xe6, 0xe6, 0xc6, 0x8e, 0x8f, 0x0f, 0x82, 0x1e, 0x17, 0x3e, 0x3c, 0x3c, 0x79, 0x71, 0x71,
+    0xe2, 0xc7, 0x8a, 0xf4, 0x78, 0x96, 0x90, 0x00, 0xc0, 0x00, 0x60, 0x40, 0x20, 0x80, 0xc0, 0x00,
+    0x00, 0x80, 0x87, 0x00, 0x15, 0xc0, 0x40, 0x80, 0x40, 0x00, 0x80, 0xc0, 0x30, 0x60, 0x40, 0x40,
+    0x02, 0x02, 0x09, 0x9e, 0x41, 0x3c, 0x1f, 0x83, 0xe0, 0xf8, 0xfe, 0x85, 0xff, 0x06, 0x3f, 0x1f,
+    0x0f, 0x03, 0x01, 0x00, 0x00, 0x01, 0x03, 0x14, 0x7e, 0x09, 0xff, 0xe7, 0xf8, 0x7e, 0x3f, 0x3f,
+    0x1f, 0x1f, 0x0f, 0x0f, 0x82, 0x07, 0x20, 0x87, 0x83, 0xc3, 0xe3, 0xf3, 0xf1, 0xf9, 0xf9, 0x3d,
+    0x8c, 0xc2, 0xf0, 0x01, 0xf7, 0x61, 0x0d, 0x15, 0x0d, 0x05, 0x05, 0x25, 0x01, 0x1d, 0x15, 0x05,
+    0x0d, 0x3c, 0x1c, 0x16, 0x56, 0x02, 0x31, 0x02, 0x82, 0x00, 0x00, 0x01, 0xa0, 0x00, 0x0a, 0x07,
+    0x21, 0x67, 0x92, 0x1d, 0xff, 0xf8, 0x00, 0x00, 0x03, 0x1f, 0x88, 0xff, 0x1d, 0xfc, 0xe0, 0x00,
+    0xb6, 0x79, 0x78, 0x78, 0x48, 0x20, 0x00, 0x78, 0x10, 0xcc, 0x78, 0x42, 0x33, 0x23, 0x49, 0x59,
+    0xfd, 0xfd, 0xcf, 0x4a, 0x8d, 0x4c, 0x00, 0x02, 0x87, 0x86, 0x02, 0xb6, 0x00, 0x04, 0x30, 0x48,
+    0xfc, 0x85, 0x01, 0x82, 0xff, 0x83, 0x00, 0x00, 0x01, 0x8a, 0xff, 0x2c, 0xfd, 0x9e, 0x7c, 0xf8,
+    0xf0, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0x80, 0x81, 0x83, 0x87, 0x06, 0x0e, 0x1e, 0x3e, 0x3f, 0x7c,
+    0x7e, 0xf1, 0xc4, 0x0d, 0x3f, 0x41, 0xdd, 0x38, 0xc0, 0xa0, 0xa0, 0x80, 0x80, 0xd0, 0x80, 0xa0,
+    0xa0, 0x80, 0xc0, 0xe0, 0xe0, 0xa0, 0xa8, 0x00, 0x30, 0xa5, 0x00, 0x06, 0x80, 0x00, 0x9a, 0x2e,
+    0xc3, 0xff, 0x7f, 0x82, 0x00, 0x01, 0xe0, 0xfe, 0x88, 0xff, 0x09, 0x1f, 0x03, 0xff, 0xff, 0xfc,
+    0xe1, 0x87, 0x0f, 0x3f, 0x7f, 0x89, 0xff, 0x83, 0xfe, 0x0b, 0xfc, 0xfd, 0xf8, 0xfa, 0xfb, 0xf2,
+    0xf6, 0xe6, 0xc6, 0xce, 0x8e, 0x8e, 0x83, 0x1e, 0x14, 0x3e, 0x3c, 0x3c, 0x79, 0x71, 0x61, 0xe2,
+    0xc5, 0x88, 0x74, 0x88, 0x06, 0x40, 0x80, 0x40, 0x00, 0x40, 0x00, 0x20, 0x80, 0x80, 0x8b, 0x00,
+    0x14, 0xc0, 0x00, 0x80, 0x80, 0x00, 0xc0, 0x00, 0x30, 0x40, 0x60, 0x00, 0xe0, 0x02, 0x6e, 0x93,
+    0x79, 0x3e, 0x8f, 0xc0, 0xf0, 0xfc, 0x85, 0xff, 0x04, 0x7f, 0x3f, 0x1f, 0x07, 0x03, 0x82, 0x00,
+    0x01, 0x03, 0x14, 0x7f, 0x06, 0x9f, 0xf1, 0x7c, 0x3f, 0x3f, 0x1f, 0x1f, 0x82, 0x0f, 0x82, 0x07,
+    0x21, 0x83, 0xc3, 0xe3, 0xe3, 0xf1, 0xf1, 0xf9, 0x7d, 0xbc, 0xc4, 0xe2, 0x76, 0x0b, 0xef, 0xe0,
+    0x2d, 0x15, 0x05, 0x05, 0x15, 0x29, 0x05, 0x09, 0x15, 0x05, 0x1c, 0x1c, 0x36, 0x56, 0x96, 0x23,
+    0x31, 0x02, 0x04, 0xa2, 0x00, 0x0c, 0x01, 0x00, 0x02, 0x61, 0xc2, 0x74, 0x83, 0xff, 0x00, 0x00,
+    0x01, 0x07, 0x7f, 0x87, 0xff, 0x07, 0xfe, 0xf8, 0xc0, 0x00, 0x03, 0x78, 0x58, 0x78, 0x82, 0x00,
+    0x12, 0x40, 0x00, 0xec, 0x7a, 0x02, 0x03, 0x11, 0x69, 0x49, 0xfd, 0xf5, 0xdf, 0x58, 0x02, 0x06,
+    0x84, 0x85, 0x87, 0x80, 0xb8, 0x00, 0x06, 0x08, 0x30, 0xcf, 0x03, 0xfc, 0xff, 0xff, 0x84, 0x00,
+    0x8a, 0xff, 0x07, 0x78, 0xe7, 0x3c, 0xf8, 0xf8, 0xf0, 0xe0, 0xe0, 0x82, 0xc0, 0x13, 0x81, 0x81,
+    0x83, 0x06, 0x0e, 0x0e, 0x1e, 0x3e, 0x3f, 0x7c, 0x79, 0xf5, 0x84, 0x1f, 0xbb, 0x80, 0x7c, 0x14,
+    0xc0, 0xa0, 0x82, 0x80, 0x0b, 0x10, 0x80, 0x40, 0xa0, 0xa0, 0xc0, 0xe0, 0xb0, 0xa0, 0xa0, 0x10,
+    0x30, 0xa7, 0x00, 0x04, 0x12, 0x07, 0xf8, 0x87, 0xff, 0x82, 0x00, 0x01, 0x80, 0xf8, 0x88, 0xff,
+    0x09, 0x7f, 0x0f, 0x00, 0xff, 0xfe, 0xf0, 0xc3, 0x0f, 0x1f, 0x3f, 0x8a, 0xff, 0x82, 0xfe, 0x0c,
+    0xfc, 0xfc, 0xfd, 0xf9, 0xfb, 0xf3, 0xf2, 0xe6, 0xe6, 0xc6, 0xce, 0x8e, 0x0e, 0x82, 0x1e, 0x19,
+    0x3e, 0x3c, 0x3c, 0x39, 0x79, 0x71, 0x63, 0xc2, 0xc5, 0x88, 0x70, 0x08, 0x04, 0x04, 0x80, 0x00,
+    0x40, 0x40, 0x20, 0x20, 0x80, 0x80, 0x40, 0x00, 0x00, 0x80, 0x86, 0x00, 0x16, 0x80, 0x80, 0x00,
+    0x80, 0xc0, 0x80, 0x00, 0xe0, 0x10, 0x00, 0x60, 0x80, 0xa2, 0xe0, 0xe1, 0x9e, 0x41, 0x3c, 0x1f,
+    0x83, 0xe0, 0xf8, 0xfe, 0x85, 0xff, 0x04, 0x7f, 0x3f, 0x0f, 0x07, 0x01, 0x82, 0x00, 0x01, 0x03,
+    0x13, 0x7f, 0x06, 0xff, 0xe7, 0xf8, 0x7e, 0x3f, 0x1f, 0x1f, 0x82, 0x0f, 0x82, 0x07, 0x22, 0x83,
+    0x83, 0xc3, 0xe3, 0xf3, 0xf1, 0xf9, 0xf9, 0x7c, 0x9c, 0xc6, 0xe2, 0x7f, 0xc7, 0xfc, 0xb0, 0x2c,
+    0x0d, 0x05, 0x15, 0x1d, 0x19, 0x01, 0x01, 0x1d, 0x15, 0x14, 0x36, 0x16, 0x16, 0x92, 0xab, 0x31,
+    0x03, 0x04, 0xa3, 0x00, 0x06, 0x01, 0x07, 0x01, 0x75, 0xe2, 0x0d, 0xff, 0x82, 0x00, 0x01, 0x03,
+    0x1f, 0x88, 0xff, 0x1d, 0xfc, 0xf0, 0x80, 0xb5, 0x69, 0x78, 0x78, 0x50, 0x00, 0x00, 0x38, 0x30,
+    0x7c, 0xf8, 0x5a, 0x33, 0x31, 0x09, 0x79, 0x6d, 0xfd, 0x97, 0xfa, 0xe5, 0x0c, 0x00, 0x04, 0x01,
+    0x82, 0x80, 0xb7, 0x00, 0x08, 0x10, 0x30, 0x40, 0x79, 0x02, 0x01, 0xff, 0xff, 0xfe, 0x83, 0x00,
+    0x00, 0x01, 0x8a, 0xff, 0x2f, 0xfe, 0x9e, 0x7c, 0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0x80,
+    0x81, 0x83, 0x83, 0x06, 0x0e, 0x1e, 0x1e, 0x3e, 0x7f, 0x7c, 0xf8, 0xe4, 0x8c, 0x1e, 0xf9, 0x0a,
+    0x9c, 0x54, 0xc0, 0xa0, 0xa0, 0x80, 0xe0, 0x20, 0xc0, 0x40, 0xa0, 0x80, 0xe0, 0xe0, 0xb0, 0xa0,
+    0x24, 0x50, 0x30, 0x00, 0x80, 0xa4, 0x00, 0x06, 0x80, 0x82, 0x33, 0xba, 0x43, 0xff, 0x01, 0x82,
+    0x00, 0x01, 0xe0, 0xfe, 0x88, 0xff, 0x09, 0x3f, 0x07, 0xff, 0xff, 0xfc, 0xe1, 0x87, 0x0f, 0x3f,
+    0x7f, 0x89, 0xff, 0x83, 0xfe, 0x0b, 0xfc, 0xfd, 0xf9, 0xf9, 0xfb, 0xf1, 0xf4, 0xe6, 0xe6, 0xce,
+    0x8e, 0x8e, 0x83, 0x1e, 0x17, 0x3e, 0x3c, 0x3c, 0x79, 0x79, 0x71, 0xe3, 0xc2, 0xc7, 0x89, 0x74,
+    0x0c, 0x44, 0x80, 0x00, 0x00, 0x80, 0x00, 0x20, 0xc0, 0x00, 0x80, 0x40, 0x80, 0x8a, 0x00, 0x14,
+    0x80, 0x00, 0xc0, 0x00, 0x80, 0x80, 0x90, 0x10, 0x00, 0x80, 0xa2, 0x62, 0xea, 0x76, 0x92, 0x79,
+    0x3e, 0x0f, 0xc0, 0xf0, 0xfc, 0x86, 0xff, 0x03, 0x3f, 0x1f, 0x0f, 0x03, 0x82, 0x00, 0x01, 0x03,
+    0x13, 0x80, 0x08, 0xbf, 0xf1, 0x7c, 0x3f, 0x3f, 0x1f, 0x1f, 0x0f, 0x0f, 0x83, 0x07, 0x21, 0x83,
+    0xc3, 0xc3, 0xe3, 0xf1, 0xf1, 0xf9, 0xfc, 0x7c, 0x8e, 0xc2, 0xe0, 0xe9, 0x70, 0x32, 0x90, 0x0c,
+    0x04, 0x1d, 0x0d, 0x19, 0x15, 0x01, 0x01, 0x0d, 0x04, 0x06, 0x06, 0x16, 0x76, 0xb2, 0xe9, 0x34,
+    0x07, 0xa4, 0x00, 0x07, 0x01, 0x00, 0x02, 0x05, 0x10, 0x34, 0xc7, 0xff, 0x82, 0x00, 0x01, 0x07,
+    0x3f, 0x88, 0xff, 0x03, 0xfc, 0xe0, 0x00, 0x23, 0x82, 0x78, 0x16, 0x50, 0x20, 0x20, 0x78, 0x08,
+    0xcc, 0x7a, 0x0a, 0x23, 0x31, 0x69, 0x71, 0xe5, 0xd5, 0x97, 0x62, 0xbc, 0xcc, 0x02, 0x81, 0x03,
+    0x82, 0x01, 0xb7, 0x00, 0x08, 0x10, 0x00, 0x40, 0x78, 0x84, 0x01, 0xfe, 0xff, 0xff, 0x84, 0x00,
+    0x8a, 0xff, 0x07, 0xfe, 0xf7, 0x3e, 0xf8, 0xf8, 0xf0, 0xe0, 0xe0, 0x82, 0xc0, 0x24, 0x80, 0x81,
+    0x83, 0x07, 0x0e, 0x0e, 0x1e, 0x3e, 0x3f, 0x7d, 0x7e, 0xf9, 0xe4, 0x0d, 0x1e, 0x19, 0xf8, 0x4c,
+    0x44, 0xc0, 0xc0, 0x80, 0x80, 0xe0, 0x20, 0x80, 0x40, 0xe0, 0x80, 0xa0, 0xe0, 0xb0, 0xa0, 0x24,
+    0x50, 0x30, 0x20, 0xa5, 0x00, 0x06, 0x80, 0x00, 0x09, 0x0a, 0xb1, 0x8f, 0xff, 0x82, 0x00, 0x01,
+    0x80, 0xf0, 0x89, 0xff, 0x08, 0x1f, 0x01, 0xff, 0xff, 0xf0, 0xc3, 0x0f, 0x1f, 0x3f, 0x89, 0xff,
+    0x83, 0xfe, 0x0c, 0xfc, 0xfc, 0xfd, 0xf8, 0xfa, 0xf0, 0xf1, 0xe4, 0xe4, 0xc6, 0xce, 0x8e, 0x8e,
+    0x82, 0x1e, 0x18, 0x3e, 0x3e, 0x3c, 0x3c, 0x79, 0x71, 0x71, 0xe3, 0xc2, 0x87, 0x9c, 0x70, 0x8c,
+    0x50, 0x28, 0x00, 0x40, 0x00, 0x40, 0x00, 0x80, 0x80, 0x00, 0x80, 0x80, 0x89, 0x00, 0x03, 0x80,
+    0x00, 0x80, 0xc0, 0x82, 0x00, 0x00, 0xe0, 0x82, 0x80, 0x0b, 0xa0, 0x40, 0x08, 0x89, 0x0e, 0x61,
+    0x3c, 0x1f, 0x83, 0xe0, 0xf8, 0xfe, 0x85, 0xff, 0x04, 0x7f, 0x3f, 0x1f, 0x07, 0x03, 0x82, 0x00,
+    0x01, 0x03, 0x12, 0x80, 0x08, 0xff, 0xe7, 0xf8, 0x7e, 0x3f, 0x1f, 0x1f, 0x0f, 0x0f, 0x83, 0x07,
+    0x23, 0x03, 0x83, 0xc3, 0xe3, 0xe1, 0xf1, 0xf9, 0xf9, 0x7c, 0xbc, 0xce, 0xe2, 0x71, 0x0a, 0x74,
+    0xc6, 0x30, 0x0c, 0x0c, 0x1c, 0x0d, 0x11, 0x11, 0x09, 0x01, 0x0d, 0x0e, 0x06, 0x06, 0x16, 0x76,
+    0x73, 0xe9, 0x34, 0x07, 0x02, 0xa5, 0x00, 0x05, 0x01, 0x23, 0x25, 0xbc, 0x85, 0xff, 0x82, 0x00,
+    0x01, 0x01, 0x0f, 0x88, 0xff, 0x1e, 0xfe, 0xf8, 0xc0, 0x5f, 0x69, 0x78, 0x58, 0x40, 0x00, 0x20,
+    0x38, 0x00, 0x64, 0xe8, 0x5a, 0x1b, 0x31, 0x39, 0x61, 0x61, 0xf5, 0xf5, 0xc6, 0x40, 0xc4, 0x40,
+    0x02, 0x83, 0x01, 0x81, 0x01, 0xb8, 0x00, 0x07, 0x30, 0x70, 0x30, 0x7d, 0x02, 0x30, 0xff, 0xff,
+    0x84, 0x00, 0x00, 0x01, 0x8b, 0xff, 0x2e, 0xce, 0x7c, 0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0,
+    0x80, 0x81, 0x81, 0x83, 0x06, 0x0e, 0x1e, 0x1e, 0x3e, 0x3f, 0x7c, 0xfc, 0xf1, 0xc4, 0x0d, 0x3e,
+    0x41, 0xbf, 0x84, 0x50, 0xc0, 0xc0, 0x80, 0xb0, 0xe0, 0xa0, 0x80, 0x40, 0xe0, 0x80, 0x80, 0xa0,
+    0xb0, 0xa8, 0x24, 0x50, 0x30, 0x20, 0xa6, 0x00, 0x05, 0x80, 0x10, 0x91, 0x14, 0x43, 0xff, 0x83,
+    0x00, 0x01, 0xe0, 0xfe, 0x88, 0xff, 0x09, 0x7f, 0x0f, 0xff, 0xff, 0xfc, 0xe1, 0x87, 0x0f, 0x3f,
+    0x7f, 0x89, 0xff, 0x82, 0xfe, 0x0c, 0xfc, 0xfc, 0xfd, 0xf9, 0xf8, 0xfb, 0xf0, 0xf5, 0xe4, 0xe4,
+    0xce, 0xce, 0x8e, 0x83, 0x1e, 0x0d, 0x3e, 0x3c, 0x3c, 0x7d, 0x79, 0x71, 0xf1, 0xe3, 0xc2, 0x87,
+    0x9c, 0x70, 0x88, 0x50, 0x83, 0x00, 0x07, 0x80, 0xe0, 0x80, 0x00, 0x00, 0x80, 0x00, 0x80, 0x8a,
+    0x00, 0x14, 0x80, 0x00, 0x00, 0x80, 0x00, 0x40, 0xe0, 0xa0, 0x80, 0xc0, 0xe0, 0xe2, 0x4e, 0x56,
+    0xa2, 0x79, 0x3e, 0x0f, 0xc0, 0xf0, 0xfc, 0x86, 0xff, 0x06, 0x7f, 0x3f, 0x0f, 0x07, 0x01, 0x00,
+    0x00, 0x03, 0x00, 0x12, 0x80, 0x05, 0xbf, 0xf1, 0x7c, 0x3f, 0x3f, 0x1f, 0x82, 0x0f, 0x82, 0x07,
+    0x23, 0x03, 0x83, 0xc3, 0xc3, 0xe1, 0xf1, 0xf1, 0xf9, 0xfc, 0x7c, 0xbe, 0xc6, 0xe1, 0x71, 0x0f,
+    0x66, 0x44, 0x7a, 0x02, 0x06, 0x0e, 0x0f, 0x03, 0x03, 0x0b, 0x03, 0x1a, 0x0e, 0x06, 0x06, 0x16,
+    0x72, 0x6b, 0xe9, 0x24, 0x01, 0xa6, 0x00, 0x06, 0x02, 0x00, 0x17, 0x00, 0x12, 0xe7, 0xff, 0x82,
+    0x00, 0x01, 0x07, 0x3f, 0x88, 0xff, 0x01, 0xfe, 0xf0, 0x11, 0x12, 0x75, 0x1a, 0x23, 0x78, 0x78,
+    0x5c, 0x44, 0x00, 0x20, 0x28, 0x48, 0xfc, 0xf8, 0x0a, 0x0b, 0x11, 0x39, 0x51, 0x65, 0xe5, 0xff,
+    0xe6, 0x65, 0x23, 0xc0, 0x03, 0x03, 0x81, 0x83, 0xba, 0x00, 0x07, 0x10, 0x08, 0x7a, 0x84, 0x01,
+    0xfe, 0xff, 0xff, 0x84, 0x00, 0x23, 0x12, 0x80, 0x06, 0xf3, 0x3e, 0xfc, 0xf8, 0xf0, 0xe0, 0xe0,
+    0x82, 0xc0, 0x24, 0x80, 0x81, 0x83, 0x03, 0x06, 0x0e, 0x1e, 0x1e, 0x3e, 0x7f, 0x7c, 0xf9, 0xf5,
+    0x8c, 0x1f, 0x3b, 0x43, 0x3d, 0x08, 0x50, 0xe0, 0x80, 0xc0, 0xf0, 0x20, 0x80, 0x80, 0x40, 0xe0,
+    0x80, 0xa0, 0xa0, 0xb0, 0xa8, 0x24, 0x50, 0xb0, 0xa7, 0x00, 0x06, 0x80, 0x02, 0x89, 0x22, 0x21,
+    0x8f, 0xff, 0x82, 0x00, 0x01, 0x80, 0xf0, 0x89, 0xff, 0x07, 0x3f, 0xff, 0xff, 0xf8, 0xc3, 0x0f,
+    0x1f, 0x3f, 0x89, 0xff, 0x83, 0xfe, 0x0c, 0xfc, 0xfc, 0xfd, 0xf9, 0xfa, 0xf0, 0xf1, 0xf5, 0xe4,
+    0xc4, 0xcc, 0x8e, 0x8e, 0x82, 0x1e, 0x15, 0x3e, 0x3e, 0x3c, 0x7d, 0x79, 0x79, 0x71, 0xe3, 0xe2,
+    0xc4, 0x87, 0x1d, 0x70, 0x08, 0x74, 0x00, 0x80, 0x00, 0x80, 0xc0, 0xc0, 0x80, 0x8d, 0x00, 0x82,
+    0x80, 0x00, 0x00, 0x82, 0x80, 0x10, 0x40, 0x40, 0xe0, 0xc0, 0xc0, 0xe0, 0x40, 0x92, 0x05, 0x72,
+    0xe0, 0x3c, 0x1f, 0x83, 0xe0, 0xf0, 0xfc, 0x86, 0xff, 0x05, 0x3f, 0x1f, 0x0f, 0x03, 0x00, 0x00,
+    0x03, 0x00, 0x12, 0x80, 0x07, 0xc7, 0xf8, 0x7e, 0x3f, 0x1f, 0x1f, 0x0f, 0x0f, 0x82, 0x07, 0x25,
+    0x03, 0x03, 0x83, 0xc3, 0xe1, 0xe1, 0xf1, 0xf9, 0xf8, 0xfc, 0x7c, 0x9e, 0xc2, 0x61, 0xfa, 0x4b,
+    0xa7, 0x34, 0x42, 0x0a, 0x06, 0x0e, 0x0a, 0x13, 0x17, 0x07, 0x0a, 0x1a, 0x06, 0x0e, 0x06, 0x36,
+    0x7b, 0x6b, 0x49, 0x24, 0x0d, 0x01, 0xa6, 0x00, 0x05, 0x03, 0x82, 0xb7, 0xf8, 0x81, 0xff, 0x82,
+    0x00, 0x01, 0x01, 0x0f, 0x89, 0xff, 0x00, 0xfc, 0x11, 0x11, 0x76, 0x1b, 0x9f, 0x39, 0x78, 0x5c,
+    0x44, 0x54, 0x20, 0x38, 0x78, 0x2c, 0xe8, 0x5a, 0x1b, 0x29, 0x19, 0x21, 0x51, 0xf5, 0xe5, 0x8e,
+    0x42, 0xfc, 0x0c, 0x40, 0x03, 0x83, 0x80, 0x81, 0xb9, 0x00, 0x08, 0x10, 0x20, 0x00, 0x30, 0x6e,
+    0x03, 0x78, 0xff, 0xff, 0x85, 0x00, 0x23, 0x12, 0x80, 0x2f, 0xcf, 0x7c, 0xf8, 0xf0, 0xf0, 0xe0,
+    0xe0, 0xc0, 0xc0, 0x80, 0x80, 0x81, 0x03, 0x07, 0x0e, 0x0e, 0x1e, 0x3e, 0x3e, 0x7d, 0x7c, 0xf8,
+    0xe4, 0x8c, 0x1f, 0xfb, 0x40, 0x1c, 0x14, 0x40, 0xc0, 0x80, 0xc0, 0xf0, 0x20, 0x00, 0xc0, 0x40,
+    0xe0, 0x80, 0xa0, 0xb0, 0xb0, 0xa8, 0x24, 0x50, 0xb0, 0x80, 0xa7, 0x00, 0x05, 0x80, 0x90, 0x19,
+    0x3c, 0x07, 0xff, 0x83, 0x00, 0x01, 0xc0, 0xfc, 0x88, 0xff, 0x07, 0x7f, 0xff, 0xfc, 0xe1, 0x87,
+    0x0f, 0x3f, 0x7f, 0x89, 0xff, 0x82, 0xfe, 0x82, 0xfc, 0x09, 0xf9, 0xf8, 0xfb, 0xf1, 0xf5, 0xe5,
+    0xe4, 0xcc, 0xcc, 0x8e, 0x83, 0x1e, 0x11, 0x3e, 0x3e, 0x3c, 0x7d, 0x79, 0x79, 0xf1, 0xe3, 0xe2,
+    0xc4, 0x83, 0x1d, 0x74, 0x08, 0x14, 0x20, 0x80, 0x00, 0x82, 0x80, 0x04, 0x00, 0x80, 0x00, 0x00,
+    0x80, 0x8d, 0x00, 0x13, 0x80, 0x00, 0x00, 0x80, 0x40, 0xc0, 0xe0, 0x80, 0xc0, 0x02, 0x86, 0x08,
+    0x0e, 0x82, 0x79, 0x3e, 0x0f, 0xc0, 0xe0, 0xf8, 0x86, 0xff, 0x05, 0x7f, 0x3f, 0x1f, 0x07, 0x03,
+    0x00, 0x03, 0x00, 0x11, 0x80, 0x07, 0x3f, 0xf1, 0x7c, 0x3f, 0x1f, 0x1f, 0x0f, 0x0f, 0x82, 0x07,
+    0x27, 0x03, 0x03, 0x83, 0xc3, 0xc1, 0xe1, 0xf1, 0xf1, 0xf8, 0xfc, 0x7c, 0xbe, 0xce, 0xe3, 0x71,
+    0x7f, 0x48, 0xa3, 0x1c, 0x0a, 0x02, 0x0e, 0x0a, 0x1a, 0x0e, 0x00, 0x00, 0x02, 0x02, 0x0e, 0x0e,
+    0x1e, 0x3f, 0x7b, 0x6b, 0x49, 0x14, 0x01, 0x01, 0x02, 0xa5, 0x00, 0x06, 0x01, 0xa0, 0x07, 0x89,
+    0x0a, 0xe7, 0xff, 0x82, 0x00, 0x01, 0x03, 0x1f, 0x88, 0xff, 0x00, 0xfe, 0x11, 0x11, 0x71, 0x1b,
+    0xa3, 0x78, 0x6c, 0x5c, 0x44, 0x14, 0x20, 0x28, 0x0c, 0x64, 0xd8, 0x4a, 0x19, 0x39, 0x39, 0x51,
+    0x55, 0xf5, 0xde, 0x86, 0x51, 0xe7, 0x8d, 0x01, 0x83, 0x01, 0x00, 0x80, 0xba, 0x00, 0x05, 0x10,
+    0x38, 0x40, 0xf8, 0x82, 0x01, 0x82, 0xff, 0x23, 0x11, 0x80, 0x06, 0xfb, 0x3e, 0xfc, 0xf8, 0xf0,
+    0xe0, 0xe0, 0x82, 0xc0, 0x26, 0x80, 0x81, 0x81, 0x03, 0x06, 0x0e, 0x1e, 0x1e, 0x3e, 0x7f, 0x7d,
+    0xfe, 0xf9, 0xe4, 0x0d, 0x1e, 0xb9, 0x49, 0xbc, 0x34, 0x50, 0x80, 0xa0, 0xc0, 0xe0, 0x00, 0xa0,
+    0xc0, 0x40, 0xc0, 0x80, 0xa0, 0xa0, 0xb0, 0xa8, 0x34, 0x54, 0xb0, 0x80, 0xa7, 0x00, 0x06, 0x80,
+    0x00, 0x1a, 0x0e, 0xa1, 0x9f, 0xff, 0x82, 0x00, 0x01, 0x80, 0xf0, 0x8b, 0xff, 0x04, 0xf8, 0xc3,
+    0x0f, 0x1f, 0x3f, 0x89, 0xff, 0x83, 0xfe, 0x0c, 0xfc, 0xfc, 0xfd, 0xf9, 0xfa, 0xf3, 0xf0, 0xf5,
+    0xe5, 0xe4, 0xcc, 0x8c, 0x8e, 0x82, 0x1e, 0x1a, 0x3e, 0x3e, 0x3c, 0x7d, 0x7d, 0x79, 0x79, 0xf1,
+    0xe3, 0xc2, 0xc4, 0x8b, 0x11, 0x70, 0x48, 0x14, 0x20, 0x08, 0x00, 0x80, 0x00, 0xc0, 0x00, 0xc0,
+    0x00, 0x00, 0x80, 0x8b, 0x00, 0x16, 0x80, 0x00, 0x80, 0x80, 0x00, 0x00, 0x40, 0x40, 0xe0, 0x80,
+    0xc0, 0x00, 0x80, 0x87, 0xf5, 0x72, 0xf1, 0x7c, 0x1f, 0x83, 0xc0, 0xf0, 0xfc, 0x86, 0xff, 0x04,
+    0x7f, 0x3f, 0x0f, 0x07, 0x01, 0x03, 0x00, 0x11, 0x80, 0x04, 0xc7, 0xf8, 0x7f, 0x3f, 0x1f, 0x82,
+    0x0f, 0x01, 0x07, 0x07, 0x82, 0x03, 0x25, 0x83, 0xc1, 0xe1, 0xe1, 0xf1, 0xf8, 0xf8, 0xfc, 0x7c,
+    0xbe, 0x46, 0x61, 0x70, 0x35, 0x22, 0xe5, 0x74, 0x06, 0x0a, 0x0a, 0x02, 0x02, 0x04, 0x02, 0x00,
+    0x06, 0x12, 0x02, 0x06, 0x1f, 0x2b, 0x6b, 0x69, 0x01, 0x18, 0x01, 0x00, 0x02, 0xa6, 0x00, 0x05,
+    0x03, 0x90, 0x21, 0x74, 0x81, 0xff, 0x82, 0x00, 0x02, 0x01, 0x07, 0x7f, 0x88, 0xff, 0x12, 0x10,
+    0x77, 0x1c, 0xcf, 0x39, 0x68, 0x6c, 0x44, 0x54, 0x14, 0x38, 0x28, 0x04, 0xd8, 0xca, 0x0a, 0x09,
+    0x39, 0x21, 0x51, 0x75, 0xf4, 0xce, 0xc6, 0x6d, 0xa4, 0x4d, 0x03, 0x83, 0x01, 0x03, 0x01, 0xbc,
+    0x00, 0x06, 0x08, 0x3c, 0xc4, 0x01, 0x7c, 0xff, 0xff, 0x85, 0x00, 0x31, 0xff, 0xcf, 0x7c, 0xf8,
+    0xf0, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0x80, 0x80, 0x81, 0x03, 0x07, 0x06, 0x0e, 0x1e, 0x3e, 0x3e,
+    0x7f, 0x7c, 0xf8, 0xf1, 0xc4, 0x0d, 0x3e, 0x1d, 0xfc, 0xd4, 0x30, 0x50, 0x80, 0x80, 0xc0, 0x60,
+    0x40, 0xe0, 0xc0, 0x40, 0xc0, 0x80, 0xa0, 0xa0, 0xb0, 0xb8, 0x34, 0x54, 0xb0, 0x80, 0xa9, 0x00,
+    0x04, 0x12, 0x19, 0xfc, 0x07, 0xff, 0x83, 0x00, 0x01, 0xc0, 0xfc, 0x33, 0x12, 0x80, 0x05, 0xfc,
+    0xe1, 0x87, 0x0f, 0x3f, 0x7f, 0x88, 0xff, 0x83, 0xfe, 0x82, 0xfc, 0x1f, 0xf9, 0xf9, 0xfa, 0xf2,
+    0xf6, 0xe5, 0xe5, 0xcc, 0xcc, 0x8c, 0x9c, 0x1e, 0x1e, 0x3e, 0x3e, 0x3f, 0x3d, 0x7d, 0x7d, 0x79,
+    0xf1, 0xf1, 0xe3, 0xc2, 0xc4, 0x8b, 0x11, 0x60, 0x40, 0x34, 0x00, 0x08, 0x82, 0x00, 0x02, 0x80,
+    0x00, 0xc0, 0x95, 0x00, 0x10, 0x20, 0x20, 0x80, 0x80, 0x00, 0xc4, 0x00, 0xe0, 0x2f, 0x83, 0x78,
+    0x3e, 0x0f, 0x80, 0xe0, 0xf8, 0xfe, 0x86, 0xff, 0x03, 0x7f, 0x1f, 0x0f, 0x03, 0x02, 0x02, 0x10,
+    0x78, 0x09, 0x3f, 0xf1, 0x7e, 0x3f, 0x1f, 0x1f, 0x0f, 0x0f, 0x07, 0x07, 0x82, 0x03, 0x26, 0x83,
+    0x81, 0xc1, 0xe1, 0xf1, 0xf0, 0xf8, 0xfc, 0x7c, 0xfe, 0x1e, 0x47, 0x61, 0xf8, 0x00, 0x33, 0x43,
+    0x44, 0x06, 0x0e, 0x0a, 0x02, 0x0e, 0x14, 0x04, 0x00, 0x06, 0x1a, 0x02, 0x07, 0x1b, 0x2b, 0x2b,
+    0x69, 0x14, 0x38, 0x01, 0x01, 0x02, 0xa6, 0x00, 0x06, 0x02, 0xa2, 0xb2, 0x81, 0x0a, 0xf7, 0xff,
+    0x82, 0x00, 0x1f, 0x03, 0x1f, 0xff, 0xab, 0x78, 0x7c, 0x5c, 0x44, 0x44, 0x24, 0x2c, 0x4c, 0x48,
+    0xd8, 0x5a, 0x09, 0x29, 0x21, 0x31, 0x55, 0x64, 0xee, 0xd6, 0xc2, 0x4c, 0x61, 0x40, 0x03, 0x81,
+    0x81, 0x83, 0x01, 0xbc, 0x00, 0x04, 0x30, 0x50, 0x7e, 0x82, 0x00, 0x82, 0xff, 0x84, 0x00, 0x09,
+    0xc7, 0xfb, 0x1e, 0xfc, 0xf8, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0x82, 0x80, 0x13, 0x81, 0x03, 0x07,
+    0x0e, 0x0e, 0x1e, 0x3e, 0x3e, 0x7d, 0xfc, 0xf9, 0xf5, 0x8c, 0x1f, 0x3b, 0x47, 0x3d, 0x00, 0x44,
+    0x40, 0x82, 0xc0, 0x82, 0x60, 0x0b, 0xc0, 0x40, 0xc0, 0xc0, 0xa0, 0xa0, 0xb0, 0x38, 0x74, 0x5c,
+    0xb0, 0x80, 0xa9, 0x00, 0x05, 0x02, 0xb2, 0x02, 0x81, 0x9f, 0xff, 0x83, 0x00, 0x01, 0xf0, 0xff,
+    0x33, 0x12, 0x80, 0x04, 0xf8, 0xc3, 0x0f, 0x1f, 0x7f, 0x89, 0xff, 0x83, 0xfe, 0x27, 0xfc, 0xfc,
+    0xfd, 0xf9, 0xf9, 0xfa, 0xf1, 0xf6, 0xe5, 0xe5, 0xcd, 0xcc, 0x8c, 0x1c, 0x1f, 0x1f, 0x3f, 0x3f,
+    0x3d, 0x7d, 0x7d, 0x79, 0x79, 0xf1, 0xf3, 0xe3, 0xc2, 0x84, 0x8b, 0x11, 0x60, 0xc0, 0x38, 0x00,
+    0x08, 0x00, 0x80, 0x00, 0x40, 0x40, 0x82, 0x00, 0x00, 0x80, 0x8e, 0x00, 0x14, 0x80, 0x00, 0x00,
+    0x80, 0xc0, 0x20, 0x40, 0x00, 0x00, 0xc4, 0x44, 0x57, 0x9d, 0x23, 0xf0, 0x7c, 0x1f, 0x03, 0xc0,
+    0xf0, 0xfc, 0x87, 0xff, 0x02, 0x3f, 0x1f, 0x07, 0x02, 0x02, 0x10, 0x78, 0x06, 0xe7, 0xf8, 0x3f,
+    0x3f, 0x1f, 0x0f, 0x0f, 0x82, 0x07, 0x82, 0x03, 0x16, 0x81, 0xc1, 0xe1, 0xe1, 0xf0, 0xf8, 0xf8,
+    0xfc, 0x7c, 0xbe, 0x5e, 0x63, 0x70, 0xf9, 0x80, 0x38, 0x40, 0x14, 0x06, 0x02, 0x06, 0x0e, 0x0c,
+    0x82, 0x00, 0x03, 0x04, 0x06, 0x03, 0x03, 0x82, 0x0b, 0x04, 0x09, 0x14, 0x1a, 0x0b, 0x01, 0xa8,
+    0x00, 0x05, 0x01, 0x20, 0x28, 0x79, 0xc1, 0xff, 0x83, 0x00, 0x1d, 0x07, 0x7f, 0x29, 0x6c, 0x6c,
+    0x54, 0x54, 0x14, 0x2c, 0x3c, 0x24, 0x48, 0xda, 0x0a, 0x01, 0x31, 0x21, 0x41, 0x44, 0xe4, 0xee,
+    0xa6, 0x6f, 0xcc, 0x06, 0x40, 0x03, 0x01, 0x82, 0x81, 0xbc, 0x00, 0x08, 0x10, 0x10, 0x00, 0x38,
+    0xc5, 0x01, 0xfc, 0xff, 0xff, 0x85, 0x00, 0x29, 0xcf, 0x7c, 0xf8, 0xf0, 0xf0, 0xe0, 0xe0, 0xc0,
+    0xc0, 0x80, 0x80, 0x81, 0x03, 0x03, 0x06, 0x0e, 0x1e, 0x1e, 0x3e, 0x7f, 0x7d, 0xfe, 0xf8, 0xe4,
+    0x8c, 0x1f, 0x7b, 0xc7, 0x5f, 0x8c, 0x70, 0x00, 0x80, 0xc0, 0xc0, 0x60, 0xa0, 0xc0, 0xc0, 0x60,
+    0xe0, 0xc0, 0x82, 0xa0, 0x03, 0x38, 0x74, 0x5c, 0xb0, 0xab, 0x00, 0x04, 0x03, 0x23, 0xbc, 0x07,
+    0xff, 0x83, 0x00, 0x01, 0xc0, 0xf8, 0x33, 0x11, 0x80, 0x05, 0xfc, 0xe1, 0x87, 0x0f, 0x3f, 0x7f,
+    0x88, 0xff, 0x83, 0xfe, 0x82, 0xfc, 0x0c, 0xf9, 0xf9, 0xfa, 0xf1, 0xf5, 0xe6, 0xe4, 0xcd, 0xcd,
+    0x8d, 0x9d, 0x1d, 0x1f, 0x82, 0x3f, 0x0f, 0x3d, 0x7d, 0x7d, 0x79, 0xf9, 0xf1, 0xf3, 0xe3, 0xc2,
+    0x84, 0x0f, 0x11, 0xe9, 0xc0, 0x3c, 0xa0, 0x82, 0x00, 0x01, 0x80, 0x80, 0x94, 0x00, 0x00, 0x80,
+    0x86, 0x00, 0x0c, 0x80, 0x02, 0x04, 0x50, 0x9f, 0x83, 0xf8, 0x3e, 0x0f, 0x80, 0xe0, 0xf8, 0xfe,
+    0x86, 0xff, 0x02, 0x7f, 0x3f, 0x0f, 0x02, 0x02, 0x0f, 0x79, 0x06, 0x3f, 0xf1, 0x7e, 0x3f, 0x1f,
+    0x1f, 0x0f, 0x82, 0x07, 0x82, 0x03, 0x27, 0x81, 0x81, 0xc1, 0xe1, 0xf0, 0xf0, 0xf8, 0xfc, 0x7c,
+    0x7e, 0x3e, 0x4f, 0x61, 0xf0, 0x3f, 0x83, 0x70, 0x18, 0x11, 0x06, 0x02, 0x0e, 0x0e, 0x0c, 0x0a,
+    0x04, 0x01, 0x0d, 0x07, 0x03, 0x13, 0x0b, 0x3b, 0x0b, 0x09, 0x14, 0x1a, 0x03, 0x01, 0x01, 0xa7,
+    0x00, 0x06, 0x01, 0x01, 0x99, 0x90, 0x06, 0xf7, 0xff, 0x82, 0x00, 0x20, 0x01, 0x0f, 0xff, 0xab,
+    0x68, 0x7c, 0x5c, 0x44, 0x54, 0x34, 0x3c, 0x04, 0x40, 0xf8, 0xca, 0x01, 0x11, 0x21, 0x31, 0x40,
+    0x44, 0xfe, 0xc6, 0x8e, 0x6d, 0xe7, 0x04, 0x02, 0x81, 0x01, 0x03, 0x83, 0x01, 0xbb, 0x00, 0x06,
+    0x10, 0x20, 0x28, 0x54, 0x7c, 0x02, 0x00, 0x82, 0xff, 0x84, 0x00, 0x09, 0x03, 0xfb, 0x1e, 0xfc,
+    0xf8, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0x82, 0x80, 0x1e, 0x01, 0x03, 0x07, 0x06, 0x0e, 0x1e, 0x3e,
+    0x3e, 0x7f, 0x7d, 0xfe, 0xf9, 0xc4, 0x0d, 0x1e, 0xf9, 0x48, 0x9c, 0x90, 0x70, 0x00, 0x80, 0xc0,
+    0xc0, 0x20, 0x60, 0x40, 0xc0, 0x40, 0xc0, 0xc0, 0x82, 0xa0, 0x03, 0x38, 0x54, 0x5c, 0xb0, 0xab,
+    0x00, 0x05, 0x20, 0x19, 0x0e, 0xc3, 0x9f, 0xff, 0x83, 0x00, 0x01, 0xe0, 0xff, 0x33, 0x11, 0x80,
+    0x04, 0xf8, 0xc3, 0x0f, 0x1f, 0x7f, 0x88, 0xff, 0x83, 0xfe, 0x82, 0xfc, 0x10, 0xfd, 0xf9, 0xf9,
+    0xfa, 0xf3, 0xf6, 0xe6, 0xe4, 0xcd, 0xcd, 0x8d, 0x9d, 0x1d, 0x1d, 0x3f, 0x3d, 0x3d, 0x82, 0x7d,
+    0x0c, 0x79, 0xf9, 0xf1, 0xe3, 0xe3, 0xc6, 0x84, 0x0e, 0x11, 0xe9, 0xc8, 0x38, 0x30, 0x82, 0x00,
+    0x83, 0x80, 0x96, 0x00, 0x00, 0xc0, 0x82, 0x00, 0x0c, 0xc0, 0x84, 0x50, 0xeb, 0xad, 0x63, 0xf0,
+    0x7c, 0x1f, 0x03, 0xc0, 0xf0, 0xfc, 0x87, 0xff, 0x01, 0x7f, 0x3f, 0x02, 0x02, 0x0f, 0x79, 0x08,
+    0xe7, 0x7c, 0x3f, 0x1f, 0x1f, 0x0f, 0x0f, 0x07, 0x07, 0x82, 0x03, 0x14, 0x01, 0x81, 0xc1, 0xe1,
+    0xe0, 0xf0, 0xf8, 0xf8, 0xfc, 0x7e, 0xbe, 0x1f, 0x47, 0x61, 0xf8, 0x3b, 0x20, 0x70, 0x7c, 0x01,
+    0x03, 0x82, 0x07, 0x0f, 0x09, 0x09, 0x05, 0x05, 0x0d, 0x07, 0x07, 0x13, 0x0b, 0x1b, 0x39, 0x5d,
+    0x14, 0x1a, 0x01, 0x01, 0xaa, 0x00, 0x04, 0x03, 0xc8, 0x3a, 0xc0, 0xff, 0x83, 0x00, 0x1e, 0x03,
+    0x3f, 0x29, 0x6c, 0x6c, 0x44, 0x54, 0x54, 0x3c, 0x2c, 0x08, 0x4c, 0xfa, 0x1a, 0x01, 0x01, 0x09,
+    0x10, 0x44, 0x64, 0xee, 0xc6, 0xc3, 0x6c, 0x00, 0x42, 0x00, 0x83, 0x01, 0x03, 0x83, 0xbc, 0x00,
+    0x82, 0x10, 0x06, 0x40, 0xf8, 0x86, 0x01, 0xfe, 0xff, 0xff, 0x85, 0x00, 0x05, 0xcf, 0x7c, 0xf8,
+    0xf0, 0xf0, 0xe0, 0x82, 0xc0, 0x29, 0x80, 0x80, 0x81, 0x01, 0x03, 0x07, 0x0e, 0x0e, 0x1e, 0x3e,
+    0x7e, 0x7d, 0xfc, 0xfb, 0xf5, 0xc4, 0x0d, 0x3e, 0xbd, 0x8c, 0x1c, 0x90, 0x40, 0x40, 0x80, 0xc0,
+    0x40, 0x00, 0xa0, 0x00, 0xc0, 0x40, 0xc0, 0xe0, 0xe0, 0x80, 0xa0, 0x78, 0x54, 0x5c, 0x90, 0x80,
+    0xab, 0x00, 0x04, 0x82, 0x07, 0xf8, 0x07, 0xff, 0x83, 0x00, 0x01, 0x80, 0xf8, 0x33, 0x10, 0x80,
+    0x05, 0xfc, 0xe1, 0x87, 0x1f, 0x3f, 0x7f, 0x88, 0xff, 0x83, 0xfe, 0x82, 0xfc, 0x0c, 0xf9, 0xf9,
+    0xfb, 0xf2, 0xf1, 0xe4, 0xe6, 0xc8, 0xcd, 0x8d, 0x9d, 0x1d, 0x1d, 0x83, 0x3d, 0x10, 0x7d, 0x7d,
+    0x79, 0xf9, 0xf9, 0xf3, 0xe3, 0xc3, 0xc6, 0x84, 0x0e, 0x12, 0xe0, 0xc8, 0x38, 0xb8, 0x10, 0x82,
+    0x00, 0x01, 0x80, 0xc0, 0x97, 0x00, 0x11, 0x80, 0xe0, 0xc0, 0x80, 0x80, 0x84, 0x84, 0x2d, 0x18,
+    0x9d, 0x82, 0xf9, 0x3e, 0x0f, 0x80, 0xe0, 0xf0, 0xfe, 0x87, 0xff, 0x00, 0x7f, 0x01, 0x03, 0x0e,
+    0x7a, 0x08, 0xbf, 0xf1, 0x7e, 0x3f, 0x1f, 0x0f, 0x0f, 0x07, 0x07, 0x82, 0x03, 0x27, 0x01, 0x81,
+    0x81, 0xc1, 0xe0, 0xf0, 0xf0, 0xf8, 0xfc, 0x7c, 0x7e, 0x3e, 0x5f, 0x63, 0x70, 0xf8, 0x50, 0x79,
+    0x52, 0x3e, 0x11, 0x05, 0x07, 0x07, 0x05, 0x01, 0x01, 0x04, 0x05, 0x0d, 0x07, 0x0f, 0x1f, 0x0b,
+    0x1b, 0x3d, 0x55, 0x74, 0x12, 0x02, 0xaa, 0x00, 0x06, 0x01, 0x00, 0x11, 0xd0, 0x86, 0xf3, 0xff,
+    0x82, 0x00, 0x1f, 0x01, 0x0f, 0xff, 0xbb, 0x68, 0x6c, 0x5c, 0x44, 0x54, 0x44, 0x3c, 0x28, 0x24,
+    0x4c, 0xea, 0x01, 0x11, 0x29, 0x29, 0x00, 0x44, 0xec, 0xee, 0xe6, 0xef, 0x6c, 0x64, 0x03, 0x00,
+    0x83, 0x00, 0x03, 0xc0, 0x00, 0x04, 0x28, 0x3c, 0x7c, 0x01, 0x00, 0x82, 0xff, 0x85, 0x00, 0x08,
+    0xfb, 0x1e, 0xfc, 0xf8, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0x82, 0x80, 0x27, 0x01, 0x03, 0x03, 0x06,
+    0x0e, 0x1e, 0x1e, 0x3e, 0x7e, 0x7d, 0xfc, 0xfb, 0xf5, 0x8c, 0x1f, 0x3a, 0x91, 0x38, 0xd0, 0x88,
+    0x00, 0x40, 0xc0, 0xc0, 0x40, 0x00, 0x80, 0x00, 0x80, 0x60, 0x00, 0xa0, 0xe0, 0x80, 0xa0, 0x78,
+    0x54, 0x5c, 0x90, 0x80, 0xab, 0x00, 0x05, 0x20, 0xb1, 0x3e, 0xc3, 0xbf, 0xff, 0x83, 0x00, 0x08,
+    0xe0, 0xfe, 0xff, 0xff, 0xf8, 0xc3, 0x0f, 0x1f, 0x7f, 0x88, 0xff, 0x83, 0xfe, 0x83, 0xfc, 0x0f,
+    0xf9, 0xf9, 0xfa, 0xf0, 0xf6, 0xe5, 0xe2, 0xc8, 0xc9, 0x8d, 0x9d, 0x1d, 0x1d, 0x3d, 0x3c, 0x3c,
+    0x82, 0x7d, 0x0d, 0xf9, 0xf9, 0xf1, 0xf3, 0xe3, 0xc2, 0xc6, 0x84, 0x0e, 0x18, 0xe0, 0xc0, 0x20,
+    0x30, 0x84, 0x00, 0x00, 0x80, 0x97, 0x00, 0x11, 0x80, 0x80, 0xc0, 0x00, 0x00, 0xc0, 0x04, 0x00,
+    0x23, 0x7c, 0x47, 0xf2, 0x7d, 0x3f, 0x03, 0x80, 0xe0, 0xf8, 0x82, 0xff, 0x02, 0x02, 0x0e, 0x7a,
+    0x05, 0xe7, 0x7c, 0x3f, 0x1f, 0x1f, 0x0f, 0x82, 0x07, 0x2c, 0x03, 0x03, 0x01, 0x01, 0x81, 0xc1,
+    0xe0, 0xe0, 0xf0, 0xf8, 0xf8, 0xfc, 0x7e, 0xfe, 0x3f, 0x4f, 0x61, 0xf0, 0xbc, 0x82, 0x3a, 0x79,
+    0x4e, 0x01, 0x01, 0x07, 0x0d, 0x05, 0x0f, 0x08, 0x02, 0x07, 0x01, 0x01, 0x0b, 0x0f, 0x07, 0x0d,
+    0x3d, 0x74, 0x64, 0x10, 0x04, 0x00, 0x01, 0xa8, 0x00, 0x06, 0x01, 0x09, 0x88, 0xd1, 0x39, 0xc0,
+    0xff, 0x83, 0x00, 0x0d, 0x03, 0x1f, 0x39, 0x6c, 0x7c, 0x44, 0x54, 0x44, 0x78, 0x28, 0x2c, 0x44,
+    0xee, 0x00, 0x82, 0x01, 0x0e, 0x28, 0x44, 0x44, 0xee, 0xc6, 0x83, 0x6d, 0xc6, 0xc6, 0x44, 0x00,
+    0x01, 0x83, 0x03, 0x01, 0xbe, 0x00, 0x08, 0x10, 0x10, 0x00, 0x7c, 0x83, 0x00, 0xfe, 0xff, 0xff,
+    0x85, 0x00, 0x05, 0xcf, 0x7c, 0xf8, 0xf0, 0xf0, 0xe0, 0x82, 0xc0, 0x2a, 0x80, 0x80, 0x00, 0x01,
+    0x03, 0x07, 0x0e, 0x0e, 0x1e, 0x3e, 0x3e, 0x7f, 0xfd, 0xfe, 0xf8, 0xe4, 0x0c, 0x1f, 0x7b, 0x83,
+    0x39, 0x34, 0xa4, 0x00, 0x00, 0xc0, 0x60, 0x40, 0xe0, 0x20, 0x80, 0x80, 0x20, 0x00, 0xe0, 0xe0,
+    0xc0, 0x60, 0x78, 0x5c, 0x4c, 0x90, 0x40, 0xab, 0x00, 0x05, 0x22, 0x23, 0x12, 0x78, 0x07, 0xff,
+    0x83, 0x00, 0x01, 0x80, 0xf0, 0x33, 0x0f, 0x80, 0x05, 0xfc, 0xe1, 0x87, 0x1f, 0x3f, 0x7f, 0x87,
+    0xff, 0x83, 0xfe, 0x83, 0xfc, 0x10, 0xf9, 0xf9, 0xfb, 0xf2, 0xf0, 0xe6, 0xe0, 0xe9, 0xc8, 0x89,
+    0x9d, 0x1d, 0x1d, 0x3d, 0x3d, 0x3c, 0x7c, 0x82, 0x7d, 0x0e, 0xf9, 0xf9, 0xf3, 0xf3, 0xe3, 0xc2,
+    0x86, 0x8c, 0x0e, 0x3e, 0xe0, 0xd0, 0x60, 0x70, 0x40, 0x85, 0x00, 0x00, 0x80, 0x95, 0x00, 0x12,
+    0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x04, 0x2d, 0x89, 0x2c, 0x83, 0xf8, 0x7e, 0x1f, 0x00,
+    0xc0, 0xf0, 0xfc, 0x87, 0xff, 0x01, 0x03, 0x0d, 0x7b, 0x08, 0xbf, 0xf9, 0x7e, 0x3f, 0x1f, 0x0f,
+    0x0f, 0x07, 0x07, 0x82, 0x03, 0x2a, 0x01, 0x81, 0x81, 0xc0, 0xe0, 0xf0, 0xf0, 0xf8, 0xfc, 0x7c,
+    0x7e, 0x3e, 0x5f, 0x47, 0x61, 0xf8, 0x3d, 0xa0, 0xb8, 0x28, 0x16, 0x03, 0x05, 0x05, 0x0d, 0x09,
+    0x04, 0x01, 0x02, 0x02, 0x01, 0x01, 0x03, 0x0f, 0x07, 0x0d, 0x15, 0x74, 0x62, 0x1c, 0x04, 0x01,
+    0x01, 0xa9, 0x00, 0x06, 0x01, 0x81, 0x4c, 0x6e, 0x87, 0xfb, 0xff, 0x83, 0x00, 0x1f, 0x07, 0x7f,
+    0xab, 0x3c, 0x7c, 0x64, 0x44, 0x44, 0x40, 0x78, 0x28, 0x64, 0x44, 0xfe, 0x01, 0x11, 0x09, 0x20,
+    0x00, 0x44, 0x5c, 0xee, 0xc6, 0x83, 0x6c, 0xeb, 0x00, 0x00, 0x82, 0x00, 0x03, 0x82, 0xc0, 0x00,
+    0x05, 0x18, 0x20, 0x38, 0x7c, 0x01, 0x00, 0x82, 0xff, 0x85, 0x00, 0x08, 0xfb, 0x3e, 0xfc, 0xf8,
+    0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0x82, 0x80, 0x28, 0x01, 0x01, 0x03, 0x07, 0x0e, 0x1e, 0x1e, 0x3e,
+    0x7e, 0x7f, 0xfc, 0xfb, 0xf0, 0xc4, 0x0c, 0x1f, 0x79, 0x80, 0x3b, 0x6c, 0xd8, 0x40, 0x40, 0xc0,
+    0x40, 0x00, 0xe0, 0x00, 0x80, 0x80, 0x20, 0x00, 0xe0, 0xe0, 0xc0, 0x60, 0x78, 0x5c, 0x4c, 0x10,
+    0x40, 0xad, 0x00, 0x04, 0x31, 0x3e, 0xc3, 0x9f, 0xff, 0x83, 0x00, 0x08, 0xc0, 0xfc, 0xff, 0xff,
+    0xf0, 0xc3, 0x0f, 0x1f, 0x7f, 0x88, 0xff, 0x83, 0xfe, 0x82, 0xfc, 0x0d, 0xf8, 0xf9, 0xf9, 0xf3,
+    0xf2, 0xf7, 0xe2, 0xe1, 0xc8, 0xc8, 0x99, 0x99, 0x1d, 0x1d, 0x82, 0x3d, 0x02, 0x7c, 0x7d, 0x7d,
+    0x82, 0xf9, 0x0c, 0xf3, 0xe3, 0xe3, 0xc6, 0x84, 0x8c, 0x0e, 0x3e, 0xe9, 0xd0, 0x68, 0x50, 0x50,
+    0x83, 0x00, 0x82, 0x80, 0x96, 0x00, 0x01, 0x80, 0x40, 0x83, 0x00, 0x0e, 0x84, 0x00, 0xb2, 0xdc,
+    0x44, 0xf2, 0xfd, 0x3f, 0x07, 0x80, 0xe0, 0xf8, 0xfe, 0xff, 0xff, 0x01, 0x03, 0x0c, 0x7c, 0x08,
+    0xff, 0xe7, 0x7c, 0x3f, 0x1f, 0x0f, 0x0f, 0x07, 0x07, 0x82, 0x03, 0x2b, 0x01, 0x01, 0x81, 0xc0,
+    0xe0, 0xe0, 0xf0, 0xf8, 0xf8, 0xfc, 0x7e, 0xfe, 0xbf, 0x5f, 0x63, 0xf0, 0xb8, 0x7f, 0x21, 0x5e,
+    0x18, 0x22, 0x03, 0x03, 0x05, 0x01, 0x03, 0x00, 0x00, 0x02, 0x06, 0x0f, 0x01, 0x05, 0x0d, 0x05,
+    0x05, 0x15, 0x74, 0x22, 0x0d, 0x00, 0x00, 0x01, 0xaa, 0x00, 0x05, 0x18, 0x11, 0x80, 0x3e, 0xc0,
+    0xff, 0x83, 0x00, 0x21, 0x01, 0x0f, 0xff, 0xef, 0x29, 0x6c, 0x6c, 0x44, 0x44, 0x50, 0x78, 0x78,
+    0x2c, 0x48, 0xf6, 0xa4, 0x01, 0x01, 0x38, 0x38, 0x04, 0x54, 0xde, 0xfe, 0xc7, 0xe7, 0x6e, 0x0c,
+    0xc6, 0x80, 0x82, 0x01, 0x01, 0x83, 0xbf, 0x00, 0x09, 0x10, 0x00, 0x18, 0x04, 0x7f, 0x82, 0x00,
+    0xfe, 0xff, 0xff, 0x85, 0x00, 0x09, 0xc7, 0xff, 0xcf, 0x7c, 0xf8, 0xf0, 0xf0, 0xe0, 0xc0, 0xc0,
+    0x82, 0x80, 0x29, 0x00, 0x01, 0x03, 0x07, 0x06, 0x0e, 0x1e, 0x3e, 0x3e, 0x7e, 0x7d, 0xfc, 0xfb,
+    0xf5, 0x8c, 0x1d, 0x3e, 0xfd, 0x48, 0x90, 0x30, 0x90, 0xc0, 0x00, 0x40, 0x40, 0x20, 0xa0, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0xc0, 0xe0, 0xc0, 0x60, 0x78, 0x5c, 0x0c, 0x30, 0x40, 0xac, 0x00, 0x05,
+    0x02, 0x03, 0x16, 0xb8, 0x07, 0xff, 0x84, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x04, 0xfc, 0xe1, 0x07,
+    0x1f, 0x3f, 0x88, 0xff, 0x83, 0xfe, 0x83, 0xfc, 0x23, 0xf9, 0xf9, 0xfb, 0xf2, 0xf0, 0xe7, 0xe1,
+    0xe8, 0xc8, 0xc8, 0x99, 0x19, 0x1d, 0x3d, 0x3d, 0x3c, 0x7d, 0x7c, 0x7d, 0x7d, 0xf9, 0xf9, 0xf3,
+    0xf3, 0xe3, 0xe3, 0xc6, 0x84, 0x08, 0x16, 0x3e, 0xe1, 0x90, 0xe8, 0x50, 0x10, 0x84, 0x00, 0x00,
+    0x80, 0x99, 0x00, 0x00, 0x40, 0x82, 0x00, 0x0c, 0x80, 0x80, 0x2f, 0xab, 0x2c, 0x80, 0xf9, 0x7e,
+    0x1f, 0x00, 0xc0, 0xf0, 0xfc, 0x82, 0xff, 0x01, 0x03, 0x0c, 0x7c, 0x07, 0x9f, 0xf8, 0x3f, 0x1f,
+    0x1f, 0x0f, 0x07, 0x07, 0x82, 0x03, 0x16, 0x01, 0x01, 0x81, 0x80, 0xc0, 0xe0, 0xf0, 0xf0, 0xf8,
+    0xfc, 0x7c, 0x7e, 0x3f, 0x3f, 0x4f, 0xe1, 0xb0, 0xbc, 0x1a, 0x35, 0x5d, 0x08, 0x3a, 0x82, 0x03,
+    0x06, 0x0f, 0x06, 0x08, 0x00, 0x03, 0x06, 0x0f, 0x82, 0x01, 0x06, 0x0d, 0x05, 0x14, 0x34, 0x0a,
+    0x0d, 0x01, 0xad, 0x00, 0x05, 0x18, 0x58, 0x4d, 0x83, 0xf9, 0xff, 0x83, 0x00, 0x20, 0x03, 0x3f,
+    0xab, 0x3c, 0x7c, 0x74, 0x54, 0x40, 0x40, 0x68, 0x68, 0x00, 0x66, 0xf6, 0x35, 0x11, 0x09, 0x00,
+    0x08, 0x44, 0x44, 0xfe, 0xf6, 0xc3, 0x65, 0xce, 0x41, 0x82, 0x01, 0x82, 0x00, 0x80, 0x80, 0xbf,
+    0x00, 0x82, 0x10, 0x04, 0x00, 0x38, 0x6e, 0x01, 0x00, 0x82, 0xff, 0x85, 0x00, 0x08, 0xf3, 0x3e,
+    0xfc, 0xf8, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0x82, 0x80, 0x29, 0x01, 0x01, 0x03, 0x07, 0x0e, 0x0e,
+    0x1e, 0x3e, 0x7e, 0x7f, 0xfd, 0xfe, 0xfa, 0xe5, 0x8c, 0x1f, 0x3a, 0x31, 0x0e, 0x10, 0x34, 0x80,
+    0x80, 0x00, 0x40, 0x60, 0x20, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0xc0, 0xe0, 0x40, 0x60, 0x58,
+    0x5c, 0x8c, 0x70, 0x40, 0xae, 0x00, 0x04, 0x61, 0x2c, 0xc3, 0x9f, 0xff, 0x83, 0x00, 0x08, 0x80,
+    0xf8, 0xff, 0xff, 0xf0, 0xc3, 0x0f, 0x3f, 0x7f, 0x87, 0xff, 0x83, 0xfe, 0x83, 0xfc, 0x0c, 0xf8,
+    0xf9, 0xf9, 0xf3, 0xf2, 0xf4, 0xe0, 0xe2, 0xca, 0xc8, 0x98, 0x99, 0x19, 0x82, 0x3d, 0x00, 0x3c,
+    0x82, 0x7c, 0x10, 0xfd, 0xf9, 0xfb, 0xf3, 0xf3, 0xe3, 0xc3, 0xc6, 0x84, 0x08, 0x16, 0x22, 0xe3,
+    0x90, 0x60, 0x10, 0x10, 0x83, 0x00, 0x00, 0x80, 0x99, 0x00, 0x02, 0x80, 0x40, 0x80, 0x82, 0x00,
+    0x0e, 0x0c, 0x24, 0x80, 0x5d, 0xc5, 0xe2, 0xfd, 0x3f, 0x07, 0x80, 0xc0, 0xf0, 0xfe, 0xff, 0xff,
+    0x01, 0x03, 0x0b, 0x7d, 0x07, 0xff, 0xf3, 0x7c, 0x3f, 0x1f, 0x0f, 0x0f, 0x07, 0x82, 0x03, 0x82,
+    0x01, 0x28, 0x80, 0xc0, 0xe0, 0xe0, 0xf0, 0xf8, 0xfc, 0x7c, 0x7e, 0xfe, 0xbf, 0xdf, 0xe7, 0xb1,
+    0xb8, 0xfc, 0xc2, 0x9e, 0x77, 0x28, 0x2a, 0x01, 0x01, 0x03, 0x0f, 0x06, 0x05, 0x00, 0x03, 0x02,
+    0x07, 0x03, 0x05, 0x01, 0x0d, 0x15, 0x34, 0x26, 0x0a, 0x0d, 0x01, 0xad, 0x00, 0x06, 0x40, 0x11,
+    0xa0, 0x3d, 0xe0, 0xff, 0xfc, 0x83, 0x00, 0x1f, 0x07, 0xff, 0xe5, 0x38, 0x6c, 0x6c, 0x44, 0x54,
+    0x40, 0x48, 0x78, 0x7c, 0x60, 0x76, 0xa4, 0x05, 0x01, 0x08, 0x28, 0x0c, 0x44, 0x4e, 0xee, 0xcf,
+    0x87, 0x6c, 0xca, 0xc2, 0x40, 0x83, 0x03, 0x80, 0xc2, 0x00, 0x07, 0x10, 0x00, 0x3c, 0x04, 0xfd,
+    0x82, 0x00, 0xfe, 0x82, 0xff, 0x85, 0x00, 0x08, 0xff, 0xcf, 0x7c, 0xf8, 0xf0, 0xf0, 0xe0, 0xc0,
+    0xc0, 0x82, 0x80, 0x1a, 0x00, 0x01, 0x03, 0x03, 0x06, 0x0e, 0x1e, 0x1e, 0x3e, 0x7e, 0x7d, 0xfd,
+    0xf8, 0xf0, 0xe4, 0x0c, 0x1f, 0x7b, 0x83, 0x38, 0x94, 0x2c, 0x80, 0xc0, 0x40, 0x40, 0x20, 0x82,
+    0x80, 0x0c, 0x00, 0x80, 0x00, 0x40, 0x40, 0xe0, 0x40, 0x60, 0x58, 0x5c, 0x8c, 0x50, 0x40, 0xae,
+    0x00, 0x05, 0x03, 0x1e, 0xb8, 0x07, 0xff, 0x3f, 0x83, 0x00, 0x00, 0xe0, 0x82, 0xff, 0x04, 0xfc,
+    0xe1, 0x07, 0x1f, 0x3f, 0x87, 0xff, 0x84, 0xfe, 0x82, 0xfc, 0x10, 0xf8, 0xf9, 0xf9, 0xfb, 0xf3,
+    0xf2, 0xe4, 0xe4, 0xe9, 0xc9, 0xc8, 0x99, 0x99, 0x19, 0x39, 0x3d, 0x3d, 0x82, 0x7c, 0x11, 0xfc,
+    0xf9, 0xf9, 0xfb, 0xf3, 0xf3, 0xe3, 0xc3, 0xc6, 0x84, 0x08, 0x16, 0x23, 0xc1, 0x80, 0x60, 0x98,
+    0x30, 0x84, 0x00, 0x00, 0x80, 0x99, 0x00, 0x11, 0xc0, 0xc0, 0x80, 0x00, 0x80, 0x00, 0x08, 0x3e,
+    0x7a, 0xed, 0x00, 0xf2, 0x7e, 0x1f, 0x00, 0x80, 0xe0, 0xf8, 0x82, 0xff, 0x03, 0x00, 0x0b, 0x7d,
+    0x09, 0xdf, 0x78, 0x3f, 0x1f, 0x0f, 0x0f, 0x07, 0x07, 0x03, 0x03, 0x82, 0x01, 0x29, 0x80, 0x80,
+    0xc0, 0xe0, 0xf0, 0xf8, 0xf8, 0x7c, 0x7e, 0x7e, 0xbf, 0xbf, 0x5f, 0xa3, 0xb0, 0xb8, 0x7e, 0xa3,
+    0x9a, 0x20, 0x2e, 0x08, 0x01, 0x03, 0x03, 0x0e, 0x04, 0x04, 0x02, 0x03, 0x02, 0x02, 0x03, 0x01,
+    0x09, 0x05, 0x1d, 0x04, 0x2e, 0x0a, 0x0d, 0x03, 0xae, 0x00, 0x05, 0x48, 0x08, 0x58, 0x83, 0xf1,
+    0xff, 0x83, 0x00, 0x01, 0x01, 0x1f, 0x11, 0x0b, 0x74, 0x1e, 0xa9, 0x3c, 0x7c, 0x64, 0x44, 0x50,
+    0x50, 0x68, 0x6c, 0x20, 0x66, 0xbc, 0xb5, 0x15, 0x00, 0x20, 0x08, 0x04, 0x44, 0x5e, 0xee, 0xf3,
+    0xaf, 0x66, 0x06, 0x06, 0x81, 0x81, 0x01, 0x00, 0x01, 0xc1, 0x00, 0x07, 0x10, 0x18, 0x10, 0x00,
+    0x3b, 0x6f, 0x01, 0x00, 0x23, 0x0b, 0x7d, 0x36, 0xf3, 0x3e, 0xfc, 0xf8, 0xf0, 0xe0, 0xe0, 0xc0,
+    0xc0, 0x80, 0x80, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0e, 0x0e, 0x1e, 0x3e, 0x3e, 0x7e, 0xfd, 0xfc,
+    0xfb, 0xf4, 0xc4, 0x0d, 0x3f, 0x7b, 0x03, 0x39, 0x18, 0x84, 0xc0, 0xc0, 0x00, 0x40, 0x20, 0xc0,
+    0x60, 0x00, 0x00, 0x80, 0x60, 0x00, 0x40, 0x60, 0x50, 0x40, 0x58, 0x5c, 0x8c, 0x40, 0x40, 0xaf,
+    0x00, 0x04, 0x61, 0x6c, 0x43, 0x1f, 0xff, 0x83, 0x00, 0x08, 0x80, 0xf0, 0xff, 0xfe, 0xf0, 0x87,
+    0x0f, 0x3f, 0x7f, 0x87, 0xff, 0x83, 0xfe, 0x83, 0xfc, 0x14, 0xf8, 0xf9, 0xf9, 0xf3, 0xf2, 0xf4,
+    0xe6, 0xe6, 0xc8, 0xcb, 0x9a, 0x99, 0x19, 0x39, 0x39, 0x3d, 0x7c, 0x7c, 0x7d, 0x7c, 0xfc, 0x82,
+    0xfb, 0x0d, 0xf3, 0xf3, 0xe3, 0xc7, 0x86, 0x84, 0x09, 0x16, 0x22, 0xd0, 0x90, 0xf0, 0x18, 0x20,
+    0x84, 0x00, 0x00, 0x80, 0x98, 0x00, 0x02, 0x80, 0x00, 0xc0, 0x82, 0x00, 0x0f, 0x80, 0x00, 0x24,
+    0x20, 0x3f, 0x84, 0xe2, 0xf9, 0x7f, 0x0f, 0x00, 0xc0, 0xf0, 0xfc, 0xff, 0xff, 0x01, 0x03, 0x0a,
+    0x7e, 0x09, 0xff, 0xf3, 0x7e, 0x3f, 0x1f, 0x0f, 0x07, 0x07, 0x03, 0x03, 0x82, 0x01, 0x2a, 0x00,
+    0x80, 0xc0, 0xe0, 0xe0, 0xf0, 0xf8, 0x7c, 0x7c, 0x7e, 0xfe, 0x3f, 0x5f, 0x0f, 0xa1, 0xb0, 0xbc,
+    0x1f, 0x82, 0xb8, 0x30, 0x03, 0x02, 0x00, 0x07, 0x03, 0x02, 0x00, 0x04, 0x00, 0x01, 0x00, 0x06,
+    0x01, 0x03, 0x01, 0x05, 0x0c, 0x0e, 0x0a, 0x0a, 0x0d, 0x02, 0xaf, 0x00, 0x05, 0x15, 0xc0, 0x3c,
+    0xe0, 0xff, 0xff, 0x83, 0x00, 0x21, 0x03, 0x7f, 0x4e, 0x3c, 0x6c, 0x6c, 0x5e, 0x40, 0x40, 0x48,
+    0x78, 0x7c, 0x08, 0x76, 0xbc, 0x25, 0x15, 0x18, 0x20, 0x1c, 0x54, 0x5e, 0xce, 0xf3, 0xc7, 0x6d,
+    0x6a, 0x40, 0x46, 0x81, 0x81, 0x00, 0x80, 0x80, 0xc2, 0x00, 0x07, 0x10, 0x08, 0x3c, 0x00, 0xfc,
+    0x82, 0x00, 0xfe, 0x82, 0xff, 0x85, 0x00, 0x08, 0xff, 0x8f, 0x7c, 0xf8, 0xf0, 0xe0, 0xe0, 0xc0,
+    0xc0, 0x82, 0x80, 0x2a, 0x00, 0x01, 0x01, 0x03, 0x07, 0x0e, 0x1e, 0x1e, 0x3e, 0x7e, 0x7f, 0xfd,
+    0xfe, 0xfb, 0xf4, 0x8c, 0x1f, 0x3a, 0xfd, 0x88, 0x33, 0x28, 0xb0, 0x80, 0xc0, 0xc0, 0x40, 0xa0,
+    0xe0, 0x40, 0x80, 0x00, 0x80, 0xe0, 0x00, 0x20, 0x60, 0x50, 0x40, 0x58, 0x5c, 0x8c, 0x60, 0xaf,
+    0x00, 0x06, 0x10, 0x13, 0x0a, 0x78, 0x07, 0xff, 0xff, 0x83, 0x00, 0x08, 0xc0, 0xfc, 0xff, 0xff,
+    0xf8, 0xc3, 0x0f, 0x1f, 0x7f, 0x87, 0xff, 0x83, 0xfe, 0x83, 0xfc, 0x0d, 0xf8, 0xf8, 0xf9, 0xf1,
+    0xf3, 0xf2, 0xe4, 0xe3, 0xee, 0xc8, 0xc9, 0x9a, 0x99, 0x19, 0x82, 0x39, 0x15, 0x7c, 0x7d, 0x7d,
+    0xfc, 0xfa, 0xfb, 0xfb, 0xf3, 0xf3, 0xe3, 0xe3, 0xc6, 0x86, 0x8c, 0x09, 0x17, 0x22, 0xd2, 0x80,
+    0xf0, 0x98, 0x80, 0xa2, 0x00, 0x12, 0x80, 0x00, 0x80, 0x08, 0x04, 0x7f, 0x9a, 0x4e, 0x06, 0xf3,
+    0xfc, 0x3f, 0x01, 0x80, 0xe0, 0xf8, 0xfe, 0xff, 0xff, 0x01, 0x03, 0x0a, 0x7f, 0x08, 0xcf, 0x7c,
+    0x3f, 0x1f, 0x0f, 0x07, 0x07, 0x03, 0x03, 0x82, 0x01, 0x21, 0x00, 0x80, 0x80, 0xc0, 0xe0, 0xf0,
+    0xf8, 0x78, 0x7c, 0x7e, 0x7e, 0xbf, 0x3f, 0x1f, 0x27, 0xb1, 0xb8, 0xfc, 0x9d, 0x10, 0x38, 0x2e,
+    0x0f, 0x02, 0x00, 0x06, 0x06, 0x02, 0x07, 0x00, 0x01, 0x03, 0x04, 0x00, 0x82, 0x03, 0x06, 0x07,
+    0x0e, 0x0e, 0x0a, 0x18, 0x08, 0x02, 0xaf, 0x00, 0x05, 0x40, 0x8c, 0x59, 0x82, 0xf0, 0xff, 0x84,
+    0x00, 0x21, 0x0f, 0xff, 0xa9, 0x3c, 0x6c, 0x7e, 0x4e, 0x52, 0x58, 0x70, 0x6c, 0x60, 0x2a, 0xb4,
+    0xbd, 0x25, 0x00, 0x10, 0x10, 0x0c, 0x48, 0x5a, 0xea, 0xcb, 0x83, 0x68, 0xce, 0xc7, 0x42, 0x01,
+    0x80, 0x01, 0x81, 0x81, 0xc2, 0x00, 0x07, 0x10, 0x18, 0x18, 0x06, 0x3f, 0x66, 0x01, 0x00, 0x82,
+    0xff, 0x85, 0x00, 0x29, 0x83, 0xe7, 0x3e, 0xfc, 0xf8, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0x80, 0x80,
+    0x00, 0x00, 0x01, 0x03, 0x07, 0x06, 0x0e, 0x1e, 0x3e, 0x3e, 0x7e, 0xfd, 0xfd, 0xfe, 0xf8, 0xe4,
+    0x0c, 0x1f, 0x7a, 0xb1, 0x0c, 0x30, 0x30, 0xa8, 0x80, 0x00, 0x80, 0xc0, 0x80, 0x60, 0x82, 0x00,
+    0x0a, 0xc0, 0xe0, 0x00, 0x00, 0x60, 0x50, 0x40, 0x58, 0x5c, 0xac, 0x60, 0xb0, 0x00, 0x05, 0x22,
+    0x21, 0x6e, 0x41, 0x1f, 0xff, 0x84, 0x00, 0x08, 0xe0, 0xff, 0xff, 0xfe, 0xf1, 0x87, 0x1f, 0x3f,
+    0x7f, 0x86, 0xff, 0x83, 0xfe, 0x83, 0xfc, 0x0d, 0xf8, 0xf8, 0xf9, 0xf9, 0xf3, 0xf3, 0xf6, 0xe4,
+    0xe2, 0xcc, 0xc9, 0x98, 0x9a, 0x1b, 0x82, 0x3b, 0x16, 0x7b, 0x7e, 0x7e, 0x7f, 0xfa, 0xfa, 0xfb,
+    0xfb, 0xf3, 0xf3, 0xe3, 0xe7, 0xc6, 0x86, 0x0c, 0x09, 0x1f, 0x26, 0xd2, 0x90, 0xe0, 0x40, 0x90,
+    0xa2, 0x00, 0x10, 0x80, 0x00, 0x00, 0x08, 0x08, 0x0a, 0xa0, 0xfa, 0x87, 0xe1, 0xf9, 0x7f, 0x1f,
+    0x00, 0x80, 0xe0, 0xfc, 0x82, 0xff, 0x01, 0x03, 0x09, 0x7f, 0x06, 0x7f, 0xf1, 0x3e, 0x1f, 0x0f,
+    0x0f, 0x07, 0x82, 0x03, 0x2e, 0x01, 0x01, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0xe0, 0xf0, 0x78, 0x7c,
+    0x7c, 0x7e, 0xff, 0x3f, 0x7f, 0x8f, 0x23, 0xb0, 0xb8, 0x5e, 0xa8, 0xba, 0x28, 0x2e, 0x09, 0x01,
+    0x00, 0x02, 0x02, 0x04, 0x06, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x01, 0x07, 0x02, 0x0e, 0x1a,
+    0x2a, 0x31, 0x0e, 0x02, 0xb0, 0x00, 0x05, 0x10, 0xc8, 0x3c, 0xe0, 0xff, 0xff, 0x83, 0x00, 0x21,
+    0x03, 0x1f, 0xcb, 0x3c, 0x6c, 0x66, 0x5e, 0x42, 0x52, 0x40, 0x70, 0x6c, 0x0a, 0x26, 0xad, 0x2d,
+    0x24, 0x28, 0x10, 0x14, 0x18, 0x5a, 0x5a, 0xe3, 0xf7, 0x89, 0x62, 0xef, 0x63, 0x01, 0x81, 0x00,
+    0x01, 0x81, 0xc6, 0x00, 0x05, 0x0c, 0x02, 0xfc, 0x83, 0x00, 0x7e, 0x82, 0xff, 0x85, 0x00, 0x29,
+    0xfe, 0x9e, 0xfc, 0xf8, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0x80, 0x80, 0x00, 0x00, 0x01, 0x01, 0x03,
+    0x07, 0x0e, 0x1e, 0x1e, 0x3e, 0x7e, 0x7e, 0xfd, 0xfc, 0xf8, 0xf4, 0xc4, 0x0c, 0x3f, 0x7b, 0x97,
+    0x5e, 0x54, 0x24, 0xb8, 0xc0, 0x80, 0x80, 0xc0, 0xc0, 0x60, 0x82, 0x00, 0x0a, 0xc0, 0xc0, 0x00,
+    0x00, 0x60, 0x50, 0x40, 0x58, 0x5c, 0xac, 0x60, 0xb0, 0x00, 0x06, 0x30, 0x15, 0x5a, 0xf8, 0x07,
+    0xff, 0xff, 0x83, 0x00, 0x08, 0x80, 0xf8, 0xff, 0xff, 0xf8, 0xc3, 0x0f, 0x1f, 0x7f, 0x87, 0xff,
+    0x83, 0xfe, 0x83, 0xfc, 0x0d, 0xf8, 0xf8, 0xf9, 0xf1, 0xf3, 0xf3, 0xe4, 0xe0, 0xe8, 0xcf, 0xc3,
+    0x90, 0x92, 0x1b, 0x82, 0x3b, 0x82, 0x7a, 0x82, 0xfa, 0x11, 0xfb, 0xfb, 0xf3, 0xf3, 0xe3, 0xc7,
+    0xc6, 0x86, 0x0c, 0x09, 0x1f, 0x22, 0xc2, 0x80, 0x60, 0x40, 0x80, 0x20, 0xa0, 0x00, 0x01, 0x80,
+    0x80, 0x82, 0x00, 0x0f, 0x08, 0x00, 0x3a, 0x98, 0x4f, 0x04, 0xf3, 0xfc, 0x3f, 0x03, 0x00, 0xc0,
+    0xf0, 0xfc, 0xff, 0xff, 0x01, 0x03, 0x09, 0x80, 0x38, 0xe7, 0x7c, 0x3f, 0x1f, 0x0f, 0x07, 0x07,
+    0x03, 0x03, 0x01, 0x01, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xe0, 0xf0, 0x78, 0x78, 0x7c, 0x7e, 0x7e,
+    0xbf, 0x3f, 0x9f, 0x2f, 0x21, 0xb0, 0xfc, 0x5e, 0xe0, 0x5f, 0x09, 0x14, 0x01, 0x03, 0x00, 0x02,
+    0x01, 0x01, 0x00, 0x02, 0x00, 0x01, 0x03, 0x06, 0x02, 0x04, 0x06, 0x02, 0x0a, 0x1a, 0x3a, 0x31,
+    0x0a, 0x02, 0xb1, 0x00, 0x04, 0x86, 0x64, 0x83, 0xf0, 0xff, 0x84, 0x00, 0x21, 0x07, 0x7f, 0x25,
+    0x3c, 0x7e, 0x7e, 0x4a, 0x42, 0x4a, 0x40, 0x74, 0x72, 0x26, 0x24, 0xbd, 0x25, 0x24, 0x30, 0x14,
+    0x04, 0x40, 0x42, 0xda, 0xeb, 0xc7, 0xd9, 0x62, 0x00, 0xa0, 0x01, 0x80, 0x00, 0x01, 0x01, 0xc5,
+    0x00, 0x06, 0x18, 0x18, 0x04, 0x3f, 0x66, 0x01, 0x00, 0x82, 0xff, 0x86, 0x00, 0x07, 0xe7, 0x3e,
+    0xf8, 0xf0, 0xf0, 0xe0, 0xc0, 0xc0, 0x82, 0x80, 0x2d, 0x00, 0x00, 0x01, 0x03, 0x03, 0x07, 0x0e,
+    0x1e, 0x3e, 0x3e, 0x7e, 0xff, 0xfd, 0xfe, 0xfa, 0xf5, 0x8c, 0x1d, 0x3b, 0xfb, 0x83, 0x31, 0x98,
+    0x6c, 0x80, 0x40, 0x00, 0x80, 0xc0, 0xc0, 0x20, 0x40, 0x00, 0x00, 0xc0, 0x80, 0x00, 0x00, 0x40,
+    0x50, 0x40, 0x58, 0xdc, 0xa4, 0x60, 0x40, 0xb0, 0x00, 0x05, 0x32, 0x25, 0x2e, 0x41, 0x0f, 0xff,
+    0x84, 0x00, 0x07, 0xc0, 0xfe, 0xff, 0xfc, 0xe1, 0x87, 0x1f, 0x3f, 0x87, 0xff, 0x83, 0xfe, 0x83,
+    0xfc, 0x0d, 0xf8, 0xf8, 0xf9, 0xf9, 0xf3, 0xf3, 0xf6, 0xe4, 0xe6, 0xc8, 0xc2, 0x91, 0x90, 0x12,
+    0x82, 0x3b, 0x03, 0x7b, 0x7a, 0x7a, 0xfb, 0x82, 0xfa, 0x10, 0xfb, 0xf3, 0xf3, 0xe3, 0xe3, 0xc7,
+    0xc6, 0x84, 0x0c, 0x19, 0x1f, 0x36, 0xc2, 0x80, 0x40, 0x40, 0x80, 0xa2, 0x00, 0x00, 0x80, 0x83,
+    0x00, 0x0f, 0x18, 0x00, 0x24, 0xba, 0x8e, 0xc6, 0xfa, 0xfe, 0x1f, 0x00, 0x80, 0xe0, 0xf8, 0xfe,
+    0xff, 0xff, 0x01, 0x03, 0x08, 0x80, 0x0a, 0xbf, 0x78, 0x3f, 0x1f, 0x0f, 0x07, 0x07, 0x03, 0x03,
+    0x01, 0x01, 0x82, 0x00, 0x2a, 0x80, 0xc0, 0xe0, 0xf0, 0x70, 0x78, 0x7c, 0x7c, 0x7e, 0xff, 0xbf,
+    0x7f, 0x9f, 0x27, 0x31, 0xb8, 0xfc, 0xbf, 0x90, 0xce, 0x31, 0x28, 0x01, 0x02, 0x01, 0x01, 0x03,
+    0x03, 0x05, 0x02, 0x01, 0x01, 0x03, 0x01, 0x00, 0x04, 0x06, 0x02, 0x02, 0x1a, 0x3b, 0x35, 0x06,
+    0xb1, 0x00, 0x06, 0x0c, 0x08, 0xf2, 0x3f, 0xe0, 0xff, 0xff, 0x84, 0x00, 0x21, 0x0f, 0x8b, 0x24,
+    0x7c, 0x7e, 0x7e, 0x4a, 0x52, 0x42, 0x76, 0x66, 0x4e, 0x2c, 0xad, 0xbd, 0x34, 0x2c, 0x24, 0x1c,
+    0x00, 0x52, 0x42, 0xc3, 0xcf, 0xe3, 0x52, 0xf7, 0x46, 0x00, 0x01, 0x80, 0x00, 0x81, 0x80, 0xc5,
+    0x00, 0x07, 0x10, 0x00, 0x08, 0x00, 0xfc, 0x83, 0x00, 0x7e, 0x82, 0xff, 0x85, 0x00, 0x0a, 0xfd,
+    0x1e, 0xfc, 0xf8, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0x80, 0x80, 0x82, 0x00, 0x2b, 0x01, 0x03, 0x07,
+    0x0e, 0x0e, 0x1e, 0x3e, 0x7e, 0x7e, 0xfd, 0xfd, 0xfe, 0xfb, 0xe5, 0x0c, 0x1f, 0x3a, 0xfd, 0x08,
+    0x33, 0x08, 0x28, 0x80, 0x00, 0x00, 0x80, 0xe0, 0xc0, 0x20, 0x40, 0x00, 0x00, 0xc0, 0x80, 0x00,
+    0x20, 0x40, 0x70, 0x40, 0x58, 0xdc, 0xa0, 0x60, 0x40, 0xb0, 0x00, 0x06, 0x12, 0x13, 0x1b, 0xfc,
+    0x07, 0xff, 0xff, 0x84, 0x00, 0x07, 0xf0, 0xff, 0xff, 0xf8, 0xc3, 0x0f, 0x3f, 0x7f, 0x86, 0xff,
+    0x83, 0xfe, 0x83, 0xfc, 0x82, 0xf8, 0x12, 0xf9, 0xf1, 0xf3, 0xf3, 0xe6, 0xe4, 0xcf, 0xcf, 0xc1,
+    0x92, 0x92, 0x32, 0x33, 0x3b, 0x7b, 0x7b, 0x7a, 0x7b, 0xf8, 0x82, 0xfa, 0x10, 0xfb, 0xf3, 0xf3,
+    0xe3, 0xe7, 0xc7, 0x86, 0x8c, 0x0c, 0x19, 0x1e, 0x7e, 0xc2, 0xa0, 0x40, 0xd0, 0x40, 0xa7, 0x00,
+    0x0f, 0x08, 0x18, 0x58, 0x58, 0x5b, 0x04, 0xe0, 0xfd, 0x7f, 0x07, 0x00, 0x80, 0xe0, 0xfc, 0xff,
+    0xff, 0x03, 0x00, 0x08, 0x80, 0x07, 0xf3, 0x7e, 0x1f, 0x0f, 0x0f, 0x07, 0x03, 0x03, 0x82, 0x01,
+    0x2e, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0xe0, 0x70, 0x78, 0x78, 0x7c, 0x7e, 0x7e, 0xbf, 0x3f, 0xdf,
+    0x2f, 0x23, 0x30, 0xf8, 0x5e, 0x8c, 0x90, 0x2c, 0x17, 0x04, 0x01, 0x00, 0x02, 0x01, 0x07, 0x03,
+    0x06, 0x03, 0x01, 0x00, 0x03, 0x03, 0x01, 0x00, 0x02, 0x06, 0x02, 0x1a, 0x3b, 0x25, 0x06, 0x01,
+    0xb1, 0x00, 0x05, 0x4c, 0xae, 0x78, 0x82, 0xf0, 0xff, 0x84, 0x00, 0x00, 0x01, 0x11, 0x08, 0x77,
+    0x04, 0x24, 0x2c, 0x7e, 0x7e, 0x5a, 0x82, 0x42, 0x18, 0x7e, 0x4a, 0x24, 0x24, 0xbd, 0x3c, 0x3c,
+    0x24, 0x24, 0x00, 0x18, 0x42, 0x42, 0xeb, 0xff, 0x89, 0x62, 0xc3, 0x66, 0x01, 0x81, 0x81, 0x00,
+    0x81, 0x81, 0xc6, 0x00, 0x06, 0x18, 0x18, 0x24, 0x3e, 0x7e, 0x01, 0x00, 0x23, 0x08, 0x80, 0x09,
+    0xcf, 0x7c, 0xf8, 0xf0, 0xf0, 0xe0, 0xc0, 0xc0, 0x80, 0x80, 0x82, 0x00, 0x16, 0x01, 0x03, 0x03,
+    0x07, 0x0e, 0x1e, 0x1e, 0x3e, 0x7e, 0x7e, 0xfd, 0xfc, 0xf9, 0xf4, 0xc4, 0x0c, 0x1f, 0x7a, 0x31,
+    0x09, 0x34, 0x68, 0xa0, 0x82, 0x00, 0x01, 0xc0, 0xe0, 0x82, 0x40, 0x0d, 0x00, 0x00, 0x80, 0xc0,
+    0x80, 0x20, 0x40, 0x70, 0x40, 0x58, 0xdc, 0xa0, 0x70, 0x80, 0xb1, 0x00, 0x05, 0x32, 0x71, 0x0e,
+    0x41, 0x0f, 0xff, 0x84, 0x00, 0x06, 0x80, 0xff, 0xfc, 0xe1, 0x07, 0x1f, 0x7f, 0x87, 0xff, 0x82,
+    0xfe, 0x84, 0xfc, 0x18, 0xf8, 0xf8, 0xf9, 0xf1, 0xf3, 0xf3, 0xe7, 0xe4, 0xe0, 0xca, 0xc4, 0x93,
+    0x91, 0x12, 0x32, 0x33, 0x3b, 0x7b, 0x7a, 0x7a, 0xfa, 0xfa, 0xf8, 0xfa, 0xfa, 0x82, 0xf3, 0x0c,
+    0xe7, 0xe7, 0xc6, 0x86, 0x0c, 0x08, 0x11, 0x3d, 0x7e, 0xd2, 0xa0, 0x50, 0xf0, 0xa3, 0x00, 0x01,
+    0x80, 0x80, 0x84, 0x00, 0x0d, 0x02, 0x06, 0x38, 0x8a, 0xc4, 0xf0, 0xfe, 0x3f, 0x00, 0x00, 0xc0,
+    0xf0, 0xfe, 0xff, 0x01, 0x03, 0x07, 0x80, 0x07, 0xdf, 0x7c, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x03,
+    0x82, 0x01, 0x82, 0x00, 0x1d, 0x80, 0xc0, 0xe0, 0x70, 0x70, 0x78, 0x7c, 0x7e, 0x7e, 0xbf, 0xbf,
+    0x7f, 0x1f, 0x2f, 0x31, 0x38, 0x5c, 0xde, 0xe8, 0x48, 0x2c, 0x0e, 0x15, 0x01, 0x00, 0x00, 0x01,
+    0x07, 0x02, 0x02, 0x82, 0x00, 0x82, 0x01, 0x08, 0x04, 0x02, 0x06, 0x02, 0x0b, 0x31, 0x05, 0x06,
+    0x01, 0xb2, 0x00, 0x05, 0xa0, 0xc2, 0x3e, 0xc0, 0xff, 0xff, 0x84, 0x00, 0x01, 0x81, 0x24, 0x82,
+    0x7e, 0x1c, 0x52, 0x4a, 0x42, 0x6e, 0x66, 0x66, 0x00, 0xa5, 0xbd, 0x2c, 0x24, 0x3c, 0x38, 0x00,
+    0x4a, 0x42, 0xcb, 0xff, 0xdf, 0x93, 0x76, 0x00, 0x64, 0x01, 0x81, 0x00, 0x00, 0x81, 0x81, 0xc6,
+    0x00, 0x00, 0x10, 0x82, 0x00, 0x03, 0x3f, 0xc3, 0x00, 0x3c, 0x82, 0xff, 0x84, 0x00, 0x07, 0xfb,
+    0x3e, 0xfc, 0xf8, 0xf0, 0xe0, 0xe0, 0xc0, 0x82, 0x80, 0x82, 0x00, 0x16, 0x01, 0x03, 0x07, 0x0e,
+    0x0e, 0x1e, 0x3e, 0x3e, 0x7e, 0xff, 0xfd, 0xfe, 0xfb, 0xf5, 0x8c, 0x1c, 0x3b, 0x7b, 0x17, 0x1a,
+    0x34, 0xf0, 0xb8, 0x82, 0x00, 0x06, 0x80, 0xe0, 0x40, 0xc0, 0xc0, 0x80, 0x00, 0x82, 0x80, 0x07,
+    0x00, 0x40, 0x70, 0x40, 0xd8, 0x8c, 0xa0, 0x70, 0xb3, 0x00, 0x05, 0x01, 0x43, 0x7c, 0x83, 0xbf,
+    0xff, 0x84, 0x00, 0x05, 0xff, 0xff, 0xf0, 0x87, 0x0f, 0x3f, 0x87, 0xff, 0x83, 0xfe, 0x83, 0xfc,
+    0x82, 0xf8, 0x16, 0xf9, 0xf1, 0xf3, 0xf3, 0xe6, 0xe4, 0xc8, 0xc1, 0xd6, 0x92, 0x91, 0x32, 0x32,
+    0x33, 0x73, 0x7b, 0x7a, 0xfa, 0xf9, 0xf8, 0xf8, 0xfa, 0xfa, 0x82, 0xf3, 0x0e, 0xe7, 0xc7, 0xc6,
+    0x86, 0x0c, 0x08, 0x11, 0x2c, 0x56, 0xc0, 0xa0, 0x50, 0xf0, 0x40, 0x20, 0xa2, 0x00, 0x00, 0x80,
+    0x84, 0x00, 0x0d, 0x48, 0x58, 0xb2, 0x59, 0x00, 0xe6, 0xf9, 0x7f, 0x0f, 0x00, 0x80, 0xe0, 0xf8,
+    0xfe, 0x02, 0x02, 0x07, 0x7c, 0x09, 0xf1, 0x3e, 0x1f, 0x0f, 0x07, 0x07, 0x03, 0x03, 0x01, 0x01,
+    0x82, 0x00, 0x2d, 0x80, 0xc0, 0xc0, 0x60, 0x70, 0x78, 0x7c, 0x7c, 0x7e, 0x7f, 0xbf, 0xbf, 0x1f,
+    0x0f, 0x27, 0x30, 0x58, 0x5c, 0xbf, 0x50, 0x4f, 0x3c, 0x14, 0x14, 0x01, 0x00, 0x02, 0x01, 0x01,
+    0x00, 0x02, 0x00, 0x01, 0x01, 0x02, 0x00, 0x01, 0x07, 0x01, 0x03, 0x0f, 0x07, 0x15, 0x04, 0x06,
+    0x01, 0xb3, 0x00, 0x26, 0xa4, 0x61, 0x86, 0xf0, 0xff, 0xff, 0x24, 0x36, 0x76, 0x7e, 0x52, 0x4a,
+    0x42, 0x42, 0x7e, 0x42, 0x64, 0x2e, 0xbd, 0x34, 0x24, 0x24, 0x3c, 0x28, 0x08, 0x4a, 0x42, 0xd7,
+    0xfb, 0xc5, 0x4e, 0xef, 0x42, 0x00, 0x00, 0x81, 0x00, 0x00, 0x01, 0xc7, 0x00, 0x07, 0x08, 0x18,
+    0x18, 0x20, 0x7c, 0x7e, 0x80, 0x00, 0x83, 0xff, 0x09, 0x8f, 0x7c, 0xf8, 0xf0, 0xe0, 0xe0, 0xc0,
+    0xc0, 0x80, 0x80, 0x82, 0x00, 0x1e, 0x01, 0x01, 0x03, 0x07, 0x0e, 0x1e, 0x1e, 0x3e, 0x7e, 0x7e,
+    0xfd, 0xfd, 0xfa, 0xfa, 0xe4, 0x8c, 0x1f, 0x3a, 0xfd, 0x8b, 0x77, 0x7c, 0xe0, 0x08, 0x80, 0x00,
+    0x00, 0x80, 0xe0, 0x40, 0x40, 0x82, 0x00, 0x0b, 0x80, 0x80, 0xc0, 0x00, 0x60, 0x70, 0x40, 0xd8,
+    0x8c, 0xa0, 0x70, 0x80, 0xb2, 0x00, 0x06, 0x02, 0x31, 0x06, 0x60, 0x0f, 0xff, 0xff, 0x33, 0x08,
+    0x80, 0x04, 0xf8, 0xc3, 0x0f, 0x1f, 0x7f, 0x86, 0xff, 0x83, 0xfe, 0x83, 0xfc, 0x82, 0xf8, 0x12,
+    0xf9, 0xf1, 0xf3, 0xf3, 0xe7, 0xe4, 0xe8, 0xce, 0xc9, 0x90, 0x95, 0x11, 0x32, 0x32, 0x33, 0x73,
+    0x7a, 0x7a, 0xfa, 0x82, 0xf8, 0x13, 0xfa, 0xf2, 0xf3, 0xf3, 0xe7, 0xe7, 0xc7, 0xc6, 0x8e, 0x0c,
+    0x08, 0x11, 0x2c, 0x5c, 0x90, 0x00, 0x40, 0xa0, 0x40, 0x20, 0xa7, 0x00, 0x0e, 0x10, 0x10, 0x50,
+    0x46, 0x38, 0x89, 0x82, 0xf1, 0xfc, 0x7f, 0x03, 0x00, 0x80, 0xe0, 0xfc, 0x02, 0x02, 0x06, 0x7b,
+    0x09, 0xe7, 0x7c, 0x1f, 0x0f, 0x0f, 0x07, 0x03, 0x03, 0x01, 0x01, 0x82, 0x00, 0x2e, 0x80, 0x80,
+    0xc0, 0x60, 0x70, 0x70, 0x78, 0x7c, 0x7e, 0x7e, 0xbf, 0xbf, 0x7f, 0xdf, 0x2f, 0x33, 0x58, 0x5c,
+    0xde, 0x8f, 0xc0, 0x2e, 0x12, 0x13, 0x04, 0x00, 0x00, 0x01, 0x01, 0x00, 0x03, 0x00, 0x00, 0x01,
+    0x00, 0x02, 0x00, 0x00, 0x07, 0x01, 0x03, 0x07, 0x17, 0x05, 0x04, 0x04, 0x01, 0xb2, 0x00, 0x27,
+    0x82, 0x0a, 0xce, 0x37, 0xc1, 0xfc, 0x84, 0x3c, 0x7e, 0x7e, 0x7a, 0x42, 0x4a, 0x42, 0x6e, 0x66,
+    0x44, 0x06, 0xa7, 0xbc, 0x24, 0x30, 0x28, 0x20, 0x00, 0x0a, 0x42, 0xcb, 0xd7, 0xfb, 0x85, 0x46,
+    0xd3, 0xc3, 0x02, 0x00, 0x81, 0x00, 0x81, 0x01, 0xca, 0x00, 0x0f, 0x14, 0x02, 0x3f, 0xc3, 0x00,
+    0x1c, 0xff, 0xff, 0xf3, 0x3e, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0xc0, 0x82, 0x80, 0x82, 0x00, 0x1e,
+    0x01, 0x03, 0x07, 0x07, 0x0e, 0x1e, 0x3e, 0x3e, 0x7e, 0xfe, 0xfd, 0xfc, 0xf9, 0xf6, 0xc4, 0x0c,
+    0x1f, 0x7a, 0xfd, 0x88, 0xb7, 0x8c, 0xe8, 0x28, 0x80, 0x80, 0x00, 0xc0, 0xc0, 0x00, 0x40, 0x82,
+    0x00, 0x0b, 0x80, 0x00, 0x00, 0x80, 0x40, 0x60, 0x40, 0xd0, 0xac, 0xa0, 0x60, 0x80, 0xb3, 0x00,
+    0x04, 0x04, 0x47, 0xe4, 0x83, 0x1f, 0x33, 0x07, 0x80, 0x04, 0xfe, 0xe1, 0x87, 0x1f, 0x3f, 0x86,
+    0xff, 0x83, 0xfe, 0x83, 0xfc, 0x83, 0xf8, 0x28, 0xf1, 0xf1, 0xf3, 0xe3, 0xe7, 0xe4, 0xc8, 0xc7,
+    0xd9, 0x92, 0x96, 0x31, 0x33, 0x32, 0x72, 0x73, 0x7a, 0xfa, 0xf9, 0xf8, 0xfb, 0xf8, 0xfa, 0xf2,
+    0xf2, 0xf7, 0xe7, 0xe7, 0xc7, 0x86, 0x8e, 0x0c, 0x18, 0x10, 0x2c, 0x40, 0xa4, 0x00, 0x40, 0xb0,
+    0xc0, 0xa9, 0x00, 0x0d, 0x18, 0x08, 0xde, 0xb4, 0x78, 0x0a, 0xc5, 0xfb, 0xfe, 0x1f, 0x00, 0x00,
+    0xc0, 0xf0, 0x02, 0x02, 0x05, 0x7d, 0x09, 0x3f, 0x78, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x03, 0x01,
+    0x01, 0x83, 0x00, 0x17, 0x80, 0xc0, 0xe0, 0x60, 0x70, 0x78, 0x7c, 0x7c, 0x7e, 0x3f, 0xbf, 0xbf,
+    0x1f, 0xdf, 0x27, 0xd1, 0xd8, 0xdc, 0x7f, 0x4e, 0x88, 0x1e, 0x1a, 0x12, 0x83, 0x01, 0x05, 0x02,
+    0x02, 0x03, 0x00, 0x00, 0x01, 0x83, 0x00, 0x08, 0x03, 0x01, 0x03, 0x07, 0x05, 0x05, 0x08, 0x07,
+    0x01, 0xb3, 0x00, 0x29, 0x04, 0xe2, 0x61, 0x0f, 0xf0, 0xff, 0xff, 0xd3, 0x2c, 0x3e, 0x76, 0x7e,
+    0x52, 0x4a, 0x5a, 0x44, 0x6c, 0x48, 0x66, 0x3f, 0xb7, 0xb4, 0x20, 0x30, 0x04, 0x28, 0x08, 0x52,
+    0x4b, 0xd7, 0xff, 0xf3, 0x96, 0x47, 0x00, 0x40, 0x00, 0x00, 0x81, 0x80, 0x80, 0x81, 0xc9, 0x00,
+    0x06, 0x18, 0x1c, 0x20, 0x7c, 0x7e, 0x81, 0x00, 0x83, 0xff, 0x0a, 0xfe, 0x1f, 0xfc, 0xf8, 0xf0,
+    0xe0, 0xe0, 0xc0, 0xc0, 0x80, 0x80, 0x82, 0x00, 0x1e, 0x01, 0x01, 0x03, 0x07, 0x0e, 0x1e, 0x1e,
+    0x3e, 0x7e, 0x7e, 0xfd, 0xfd, 0xfe, 0xf9, 0xf4, 0xcc, 0x1c, 0x3b, 0x7a, 0x31, 0x89, 0x34, 0x08,
+    0x48, 0x20, 0x80, 0x80, 0x00, 0x80, 0xc0, 0x80, 0x83, 0x00, 0x0b, 0x40, 0x00, 0x00, 0x80, 0xc0,
+    0xe0, 0xe0, 0xd0, 0xac, 0x20, 0x60, 0x80, 0xb3, 0x00, 0x06, 0x26, 0x32, 0x02, 0xf8, 0x07, 0xff,
+    0xff, 0x33, 0x07, 0x80, 0x04, 0xf8, 0xc3, 0x0f, 0x3f, 0x7f, 0x86, 0xff, 0x82, 0xfe, 0x83, 0xfc,
+    0x83, 0xf8, 0x0d, 0xf1, 0xf1, 0xf3, 0xf3, 0xe7, 0xe6, 0xec, 0xc8, 0xcd, 0x9a, 0x90, 0x30, 0x31,
+    0x33, 0x82, 0x72, 0x08, 0xf2, 0xfa, 0xf9, 0xfa, 0xf9, 0xf9, 0xf2, 0xf2, 0xf6, 0x82, 0xe7, 0x0d,
+    0xc6, 0x86, 0x8e, 0x0c, 0x19, 0x10, 0x2c, 0x42, 0xa6, 0x00, 0x40, 0x80, 0xe0, 0x40, 0xa8, 0x00,
+    0x0d, 0x10, 0x10, 0x0a, 0xc0, 0xf4, 0x1a, 0x04, 0xe5, 0xf8, 0x7f, 0x0f, 0x00, 0x80, 0xe0, 0x02,
+    0x02, 0x05, 0x7c, 0x08, 0xf3, 0x3e, 0x1f, 0x0f, 0x07, 0x03, 0x03, 0x01, 0x01, 0x83, 0x00, 0x20,
+    0x80, 0x80, 0xc0, 0x60, 0x70, 0x78, 0x78, 0x7c, 0x7e, 0x3e, 0xbf, 0xbf, 0x7f, 0x1f, 0x2f, 0x17,
+    0xd0, 0xd8, 0x5e, 0x2f, 0x44, 0x4d, 0x1c, 0x16, 0x04, 0x00, 0x01, 0x00, 0x01, 0x02, 0x01, 0x00,
+    0x01, 0x82, 0x00, 0x0b, 0x03, 0x00, 0x00, 0x02, 0x03, 0x01, 0x05, 0x0d, 0x05, 0x18, 0x05, 0x01,
+    0xb3, 0x00, 0x23, 0x82, 0x06, 0xc6, 0x3f, 0xc1, 0xf8, 0x34, 0x3e, 0x76, 0x76, 0x72, 0x42, 0x4a,
+    0x40, 0x6c, 0x74, 0x52, 0x16, 0xaf, 0xbe, 0x20, 0x28, 0x18, 0x20, 0x20, 0x12, 0x52, 0x5b, 0xc7,
+    0xf3, 0xc1, 0x56, 0xf3, 0x42, 0xa3, 0x80, 0x82, 0x00, 0x01, 0x80, 0x80, 0xcb, 0x00, 0x11, 0x34,
+    0x42, 0x3f, 0x43, 0x00, 0x00, 0xff, 0xff, 0xc7, 0x7e, 0xf8, 0xf0, 0xf0, 0xe0, 0xc0, 0xc0, 0x80,
+    0x80, 0x83, 0x00, 0x18, 0x01, 0x03, 0x07, 0x07, 0x0e, 0x1e, 0x3e, 0x3e, 0x7e, 0xfe, 0xfd, 0xfd,
+    0xfa, 0xfa, 0xe5, 0x8c, 0x1f, 0x3b, 0xfb, 0x07, 0x12, 0x3c, 0xb0, 0xe0, 0x80, 0x82, 0x00, 0x0b,
+    0x80, 0x40, 0xc0, 0x40, 0x00, 0x80, 0x40, 0x40, 0x00, 0x40, 0xc0, 0x80, 0x82, 0xe0, 0x03, 0xac,
+    0x20, 0x20, 0x80, 0xb4, 0x00, 0x04, 0x54, 0x65, 0x74, 0x81, 0x1f, 0x33, 0x06, 0x80, 0x04, 0xfc,
+    0xe1, 0x07, 0x1f, 0x7f, 0x86, 0xff, 0x82, 0xfe, 0x84, 0xfc, 0x83, 0xf8, 0x0d, 0xf1, 0xf1, 0xf3,
+    0xe3, 0xe7, 0xe4, 0xc8, 0xc0, 0x9c, 0x98, 0x90, 0x24, 0x35, 0x33, 0x82, 0x72, 0x01, 0xf2, 0xf2,
+    0x82, 0xf8, 0x14, 0xf1, 0xf3, 0xf6, 0xf6, 0xe7, 0xe7, 0xc7, 0xc6, 0x8e, 0x0c, 0x0c, 0x19, 0x12,
+    0x2c, 0x48, 0xa4, 0x00, 0x40, 0x80, 0xe0, 0x40, 0xa9, 0x00, 0x0c, 0x10, 0x00, 0xb4, 0x34, 0x7e,
+    0x0c, 0xc1, 0xf2, 0xfc, 0x3f, 0x00, 0x00, 0x80, 0x01, 0x03, 0x04, 0x80, 0x08, 0xcf, 0x7c, 0x1f,
+    0x0f, 0x07, 0x07, 0x03, 0x01, 0x01, 0x84, 0x00, 0x08, 0x80, 0xc0, 0x60, 0x60, 0x70, 0x78, 0x7c,
+    0x7e, 0x3e, 0x82, 0xbf, 0x0b, 0x5f, 0xdf, 0x8f, 0x13, 0xd8, 0xdc, 0x7e, 0x2f, 0xf0, 0x5e, 0x14,
+    0x12, 0x82, 0x00, 0x83, 0x01, 0x01, 0x02, 0x01, 0x82, 0x00, 0x0a, 0x02, 0x00, 0x01, 0x00, 0x03,
+    0x05, 0x05, 0x0d, 0x1d, 0x1a, 0x03, 0xb5, 0x00, 0x2a, 0x86, 0xe2, 0x64, 0x1f, 0xe0, 0xff, 0xff,
+    0x00, 0x00, 0x95, 0x3c, 0x36, 0x76, 0x7a, 0x42, 0x42, 0x58, 0x44, 0x34, 0x56, 0x64, 0x2f, 0xbe,
+    0xba, 0x28, 0x30, 0x14, 0x2c, 0x30, 0x12, 0x5b, 0xd7, 0xcf, 0xf7, 0x93, 0x56, 0xd5, 0xc1, 0x00,
+    0x00, 0x01, 0x00, 0x80, 0xcb, 0x00, 0x08, 0x08, 0x08, 0x18, 0x22, 0x5c, 0x7e, 0x81, 0x00, 0x7f,
+    0x82, 0xff, 0x09, 0x00, 0x00, 0xf9, 0x3e, 0xfc, 0xf8, 0xf0, 0xe0, 0xe0, 0xc0, 0x82, 0x80, 0x82,
+    0x00, 0x2f, 0x01, 0x01, 0x03, 0x07, 0x0e, 0x1e, 0x1e, 0x3e, 0x7e, 0x7e, 0xfe, 0xfd, 0xfc, 0xf8,
+    0xf6, 0xe4, 0x0c, 0x1f, 0x7a, 0xfd, 0x0b, 0xf2, 0x38, 0xb0, 0x28, 0x80, 0x00, 0x80, 0x00, 0x80,
+    0x00, 0x40, 0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x40, 0xc0, 0x80, 0xf0, 0xe0, 0xe0, 0xac, 0x20,
+    0x20, 0x80, 0xb4, 0x00, 0x0e, 0x04, 0x00, 0x0a, 0xf8, 0x07, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff,
+    0xf0, 0x87, 0x1f, 0x3f, 0x86, 0xff, 0x83, 0xfe, 0x83, 0xfc, 0x83, 0xf8, 0x2b, 0xf1, 0xf1, 0xf3,
+    0xe3, 0xe7, 0xe7, 0xcc, 0xc8, 0xc7, 0x95, 0x9a, 0x26, 0x24, 0x25, 0x73, 0x72, 0x72, 0xf2, 0xf2,
+    0xf1, 0xf1, 0xfc, 0xf4, 0xf5, 0xf5, 0xf6, 0xf6, 0xe7, 0xe7, 0xc6, 0xc6, 0x8e, 0x0c, 0x0c, 0x19,
+    0x32, 0x2c, 0x60, 0x84, 0x00, 0x40, 0x80, 0x40, 0x40, 0xa9, 0x00, 0x0c, 0x10, 0x10, 0x80, 0x4a,
+    0x74, 0x1e, 0x08, 0xe2, 0xfb, 0xff, 0x1f, 0x00, 0x00, 0x01, 0x03, 0x03, 0x7f, 0x08, 0xff, 0x79,
+    0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x03, 0x01, 0x84, 0x00, 0x1e, 0x80, 0xc0, 0x40, 0x60, 0x70, 0x78,
+    0x7c, 0x7c, 0x3e, 0x3f, 0xbf, 0xbf, 0xdf, 0x1f, 0x0f, 0x47, 0x11, 0xd8, 0x5c, 0x7f, 0x5f, 0x48,
+    0x0e, 0x1c, 0x0b, 0x0c, 0x00, 0x00, 0x01, 0x00, 0x03, 0x82, 0x01, 0x02, 0x00, 0x00, 0x01, 0x83,
+    0x00, 0x06, 0x01, 0x05, 0x05, 0x0d, 0x1c, 0x1a, 0x03, 0xb6, 0x00, 0x29, 0x62, 0xc2, 0x3a, 0xc1,
+    0xf8, 0xff, 0xff, 0xa2, 0x34, 0x36, 0x7e, 0x6e, 0x7a, 0x4a, 0x48, 0x5c, 0x1c, 0x26, 0x50, 0x53,
+    0x37, 0xbe, 0x22, 0x20, 0x10, 0x04, 0x34, 0x12, 0x52, 0x53, 0xdf, 0xd3, 0xc1, 0x96, 0x57, 0x12,
+    0x43, 0x80, 0x00, 0x80, 0x00, 0x80, 0xcd, 0x00, 0x06, 0x04, 0x1e, 0x02, 0x3f, 0x63, 0x00, 0x00,
+    0x84, 0xff, 0x09, 0x8f, 0x7c, 0xf8, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0x80, 0x80, 0x83, 0x00, 0x1f,
+    0x01, 0x03, 0x07, 0x07, 0x0e, 0x1e, 0x3e, 0x3e, 0x7e, 0xfe, 0xfd, 0xfd, 0xfe, 0xf9, 0xf4, 0xcc,
+    0x1c, 0x3b, 0x7a, 0xf1, 0x08, 0x71, 0x2c, 0xa8, 0x08, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x40,
+    0x82, 0x00, 0x0c, 0x80, 0x00, 0x80, 0x40, 0xc0, 0x80, 0xd0, 0xe0, 0xe0, 0xa8, 0x20, 0xa0, 0x80,
+    0xb5, 0x00, 0x04, 0x24, 0xe5, 0x8e, 0xc1, 0x0f, 0x83, 0xff, 0x04, 0xf8, 0xc3, 0x0f, 0x3f, 0x7f,
+    0x86, 0xff, 0x82, 0xfe, 0x83, 0xfc, 0x83, 0xf8, 0x10, 0xf0, 0xf1, 0xf1, 0xf3, 0xe3, 0xe7, 0xe6,
+    0xc8, 0xc8, 0x97, 0x98, 0x08, 0x24, 0x24, 0x65, 0x67, 0x77, 0x82, 0xf6, 0x02, 0xf5, 0xf4, 0xf6,
+    0x82, 0xf5, 0x00, 0xf6, 0x82, 0xe6, 0x0e, 0xc6, 0x8e, 0x8e, 0x0c, 0x18, 0x19, 0x32, 0x3c, 0xe8,
+    0x80, 0x20, 0x00, 0xa0, 0x40, 0x40, 0xaa, 0x00, 0x0a, 0x10, 0x10, 0xf2, 0xa0, 0xf6, 0x1c, 0x8c,
+    0xe4, 0xfc, 0x7f, 0x07, 0x01, 0x03, 0x03, 0x7f, 0x08, 0xe7, 0x3e, 0x1f, 0x0f, 0x07, 0x03, 0x03,
+    0x01, 0x01, 0x84, 0x00, 0x19, 0x80, 0xc0, 0x60, 0x70, 0x70, 0x78, 0x3c, 0x3e, 0x3e, 0xbf, 0xbf,
+    0xff, 0x5f, 0x3f, 0x4f, 0x53, 0x18, 0xdc, 0x7e, 0xaf, 0xc6, 0x88, 0x46, 0x08, 0x0d, 0x02, 0x83,
+    0x00, 0x00, 0x03, 0x82, 0x01, 0x0d, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0x03, 0x07, 0x09,
+    0x0d, 0x1a, 0x12, 0x07, 0xb5, 0x00, 0x26, 0x80, 0xa4, 0xc4, 0x79, 0x1f, 0xe0, 0xfc, 0xff, 0x94,
+    0x3e, 0x3e, 0x76, 0x7a, 0x42, 0x48, 0x50, 0x14, 0x3c, 0x46, 0x70, 0x2b, 0xbe, 0xaa, 0x28, 0x28,
+    0x14, 0x04, 0x3a, 0x0a, 0x53, 0x57, 0xdf, 0xf5, 0xc3, 0x46, 0xd3, 0x24, 0x02, 0x80, 0x82, 0x00,
+    0x01, 0x80, 0x80, 0xcb, 0x00, 0x08, 0x08, 0x18, 0x08, 0x02, 0x1c, 0xfe, 0x81, 0x00, 0x3e, 0x82,
+    0xff, 0x09, 0xe7, 0x3e, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0xc0, 0x80, 0x80, 0x84, 0x00, 0x1f, 0x01,
+    0x03, 0x07, 0x0e, 0x0e, 0x1e, 0x3e, 0x7e, 0x7e, 0xfe, 0xfd, 0xfd, 0xf8, 0xfb, 0xe5, 0x8c, 0x1e,
+    0x3b, 0xfb, 0x31, 0x91, 0x34, 0xc8, 0x48, 0x20, 0x00, 0x00, 0x80, 0x40, 0x00, 0xc0, 0xc0, 0x82,
+    0x00, 0x0c, 0x80, 0x00, 0x00, 0x40, 0xe0, 0x80, 0xd0, 0xf0, 0xa0, 0xa8, 0x00, 0xa0, 0x80, 0xb5,
+    0x00, 0x0c, 0x40, 0x13, 0x03, 0xfc, 0x03, 0x3f, 0xff, 0xff, 0xfe, 0xe1, 0x07, 0x1f, 0x7f, 0x86,
+    0xff, 0x82, 0xfe, 0x83, 0xfc, 0x83, 0xf8, 0x17, 0xf0, 0xf1, 0xf1, 0xf3, 0xe3, 0xe7, 0xe7, 0xcc,
+    0xc8, 0xc0, 0x99, 0x80, 0x28, 0x22, 0x24, 0x65, 0x67, 0x77, 0xf6, 0xf6, 0xf7, 0xf5, 0xf7, 0xf6,
+    0x82, 0xf5, 0x12, 0xf6, 0xe6, 0xe6, 0xc6, 0xc6, 0x8e, 0x8e, 0x0c, 0x18, 0x11, 0x32, 0x7e, 0xe8,
+    0x80, 0x40, 0x00, 0xa0, 0x40, 0xc0, 0xab, 0x00, 0x09, 0x20, 0x84, 0x4c, 0x74, 0x34, 0x08, 0xc4,
+    0xf3, 0xfe, 0x3f, 0x01, 0x03, 0x02, 0x80, 0x08, 0x9f, 0x7c, 0x1f, 0x0f, 0x07, 0x03, 0x03, 0x01,
+    0x01, 0x84, 0x00, 0x1a, 0x80, 0xc0, 0x40, 0x60, 0x70, 0x78, 0x3c, 0x3c, 0x3e, 0x3f, 0xbf, 0xbf,
+    0xdf, 0x1f, 0xcf, 0x87, 0x93, 0x98, 0xdc, 0x6e, 0xaf, 0xe0, 0x74, 0x16, 0x0f, 0x00, 0x02, 0x82,
+    0x00, 0x03, 0x01, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x01, 0x83, 0x00, 0x06, 0x01, 0x03, 0x03,
+    0x0b, 0x1a, 0x02, 0x02, 0xb7, 0x00, 0x26, 0x03, 0xc7, 0x38, 0x87, 0xf0, 0xff, 0xff, 0xd5, 0x3e,
+    0x36, 0x76, 0x63, 0x63, 0x41, 0x48, 0x5c, 0x14, 0x3e, 0x44, 0x43, 0x32, 0xa2, 0x2a, 0x20, 0x1c,
+    0x04, 0x34, 0x32, 0x4a, 0x57, 0xd7, 0xc3, 0xd5, 0x92, 0x47, 0xd5, 0xc1, 0x00, 0x80, 0x82, 0x00,
+    0x01, 0x80, 0x80, 0xcb, 0x00, 0x08, 0x08, 0x00, 0x10, 0x1c, 0x63, 0x3f, 0x67, 0x80, 0x00, 0x83,
+    0xff, 0x09, 0xfc, 0x1f, 0xfc, 0xf8, 0xf0, 0xe0, 0xe0, 0xc0, 0x80, 0x80, 0x84, 0x00, 0x30, 0x01,
+    0x03, 0x03, 0x07, 0x0e, 0x1e, 0x3e, 0x3e, 0x7e, 0xfe, 0xfd, 0xfd, 0xfc, 0xf8, 0xf6, 0xc4, 0x0c,
+    0x1b, 0x7a, 0xff, 0x0f, 0x32, 0xbc, 0x60, 0x20, 0x00, 0x80, 0x00, 0x80, 0x00, 0x40, 0xc0, 0x80,
+    0x00, 0x00, 0x80, 0x80, 0x40, 0x80, 0x40, 0xe0, 0x80, 0xd0, 0xf0, 0xa0, 0xa8, 0x10, 0xe0, 0x80,
+    0xb6, 0x00, 0x04, 0x22, 0x65, 0x96, 0xf0, 0x07, 0x83, 0xff, 0x03, 0xf0, 0x83, 0x0f, 0x3f, 0x86,
+    0xff, 0x82, 0xfe, 0x83, 0xfc, 0x83, 0xf8, 0x1b, 0xf0, 0xf0, 0xf1, 0xf1, 0xe3, 0xe3, 0xe7, 0xc7,
+    0xcc, 0xc8, 0x9c, 0x90, 0x22, 0x2a, 0x22, 0x65, 0x65, 0x67, 0xe6, 0xf7, 0xf7, 0xf5, 0xf4, 0xf4,
+    0xf6, 0xf7, 0xf5, 0xf5, 0x82, 0xe6, 0x0f, 0xc6, 0xce, 0x8e, 0x0e, 0x0c, 0x18, 0x11, 0x22, 0x5e,
+    0xd0, 0xa0, 0x60, 0x00, 0xc0, 0x40, 0x40, 0xab, 0x00, 0x0a, 0x20, 0x30, 0x78, 0x88, 0xf4, 0x16,
+    0x0c, 0xe0, 0xf8, 0xff, 0x1f, 0x01, 0x03, 0x02, 0x80, 0x07, 0x79, 0x3f, 0x0f, 0x07, 0x07, 0x03,
+    0x01, 0x01, 0x84, 0x00, 0x1a, 0x80, 0x80, 0x40, 0x60, 0x70, 0x78, 0x38, 0x3c, 0x3e, 0x3f, 0xbf,
+    0xbf, 0xdf, 0xdf, 0x3f, 0x4f, 0x97, 0x99, 0x9c, 0x7e, 0x2f, 0xdf, 0x78, 0x27, 0x0e, 0x07, 0x0a,
+    0x83, 0x00, 0x02, 0x01, 0x00, 0x01, 0x87, 0x00, 0x07, 0x03, 0x00, 0x03, 0x03, 0x02, 0x1a, 0x00,
+    0x02, 0xb7, 0x00, 0x24, 0x30, 0xd5, 0x67, 0x13, 0xc0, 0xfc, 0xff, 0x1c, 0x3e, 0x36, 0x6f, 0x6b,
+    0x49, 0x41, 0x50, 0x14, 0x3e, 0x00, 0x61, 0x22, 0xaa, 0xaa, 0x22, 0x00, 0x14, 0x00, 0x36, 0x22,
+    0x43, 0x57, 0xd7, 0xd1, 0xc3, 0x02, 0x43, 0x02, 0x63, 0x83, 0x00, 0x00, 0x80, 0xce, 0x00, 0x82,
+    0x08, 0x05, 0x00, 0x1d, 0xbe, 0xc1, 0x00, 0x00, 0x82, 0xff, 0x09, 0xcf, 0x7e, 0xf8, 0xf0, 0xf0,
+    0xe0, 0xc0, 0xc0, 0x80, 0x80, 0x84, 0x00, 0x18, 0x01, 0x03, 0x07, 0x0f, 0x0e, 0x1e, 0x3e, 0x7e,
+    0x7e, 0xfe, 0xfd, 0xfd, 0xfe, 0xf9, 0xf4, 0xcc, 0x1c, 0x3b, 0x7a, 0xf5, 0x0f, 0xf3, 0x38, 0x70,
+    0x28, 0x82, 0x00, 0x04, 0x80, 0x40, 0x40, 0xc0, 0x40, 0x82, 0x00, 0x82, 0x80, 0x09, 0x40, 0xc0,
+    0x80, 0xd0, 0xf0, 0xa0, 0xa0, 0x10, 0xe0, 0x80, 0xb7, 0x00, 0x0b, 0x40, 0x23, 0xe4, 0x83, 0x1f,
+    0xff, 0xff, 0xfc, 0xc3, 0x0f, 0x3f, 0x7f, 0x85, 0xff, 0x83, 0xfe, 0x82, 0xfc, 0x84, 0xf8, 0x2f,
+    0xf0, 0xf1, 0xf1, 0xe3, 0xe3, 0xe7, 0xe7, 0xce, 0xc8, 0x90, 0x9f, 0x82, 0x20, 0x2a, 0x20, 0x65,
+    0x65, 0xe6, 0xe6, 0xf7, 0xf7, 0xf5, 0xf4, 0xf4, 0xf1, 0xf7, 0xf5, 0xf5, 0xe7, 0xe6, 0xe6, 0xce,
+    0x8e, 0x8e, 0x0c, 0x1c, 0x19, 0x11, 0x22, 0x5e, 0x90, 0x80, 0x04, 0x40, 0xe0, 0x60, 0x00, 0x80,
+    0xab, 0x00, 0x09, 0x10, 0x94, 0xd0, 0x60, 0xb6, 0x10, 0x88, 0xe6, 0xfc, 0x7f, 0x01, 0x03, 0x01,
+    0x80, 0x07, 0xe7, 0x3e, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x01, 0x85, 0x00, 0x1a, 0x80, 0x40, 0x60,
+    0x60, 0x70, 0x38, 0x3c, 0x3e, 0x3e, 0x3f, 0xbf, 0xbf, 0xdf, 0x5f, 0x8f, 0x07, 0x53, 0x98, 0x2c,
+    0xee, 0x2f, 0xc7, 0x00, 0x47, 0x1a, 0x0f, 0x0a, 0x83, 0x00, 0x00, 0x01, 0x85, 0x00, 0x0b, 0x01,
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x06, 0x02, 0x02, 0x04, 0x02, 0xb9, 0x00, 0x28, 0xb5, 0x30,
+    0x0f, 0xf0, 0xff, 0x9c, 0x3e, 0x36, 0x77, 0x63, 0x63, 0x41, 0x41, 0x14, 0x14, 0x36, 0x75, 0x41,
+    0x22, 0xa2, 0x22, 0x22, 0x14, 0x00, 0x14, 0x36, 0x22, 0x55, 0x75, 0xd5, 0xc1, 0xd5, 0x77, 0xd5,
+    0x36, 0x22, 0x80, 0x00, 0x80, 0x00, 0x80, 0xce, 0x00, 0x15, 0x08, 0x00, 0x14, 0x1c, 0x63, 0x7f,
+    0x7f, 0x80, 0x00, 0x7f, 0xff, 0xff, 0xf3, 0x3e, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0xc0, 0x80, 0x80,
+    0x84, 0x00, 0x20, 0x01, 0x03, 0x03, 0x07, 0x0e, 0x1e, 0x3e, 0x3e, 0x7e, 0xfe, 0xfe, 0xfd, 0xfd,
+    0xf8, 0xf0, 0xe5, 0x8c, 0x1e, 0x3b, 0xfa, 0x71, 0x00, 0xf1, 0x2c, 0x78, 0x28, 0x80, 0x00, 0x80,
+    0x80, 0x40, 0x80, 0x80, 0x82, 0x00, 0x0d, 0x80, 0x80, 0x00, 0x00, 0x40, 0xc0, 0x80, 0xc0, 0xb0,
+    0xa0, 0xa0, 0x10, 0xa0, 0x80, 0xb8, 0x00, 0x0a, 0x56, 0x02, 0xf8, 0x07, 0x7f, 0xff, 0xfe, 0xe1,
+    0x07, 0x1f, 0x7f, 0x86, 0xff, 0x82, 0xfe, 0x83, 0xfc, 0x83, 0xf8, 0x2e, 0xf0, 0xf0, 0xf1, 0xf1,
+    0xe3, 0xe3, 0xe7, 0xc7, 0xcc, 0xc8, 0x90, 0x8e, 0x3c, 0x20, 0x2c, 0x60, 0x65, 0x65, 0xe6, 0xe6,
+    0xe7, 0xf7, 0xf5, 0xf4, 0xf2, 0xf1, 0xf3, 0xf5, 0xe5, 0xe7, 0xe6, 0xc6, 0xce, 0x8e, 0x8e, 0x0c,
+    0x1c, 0x19, 0x31, 0x22, 0x5c, 0x94, 0x4c, 0x04, 0xc0, 0xc0, 0x20, 0xae, 0x00, 0x08, 0x20, 0xe4,
+    0x8c, 0xf0, 0x30, 0x04, 0xc6, 0xf3, 0xff, 0x01, 0x03, 0x00, 0x80, 0x07, 0xbf, 0x7c, 0x1f, 0x0f,
+    0x07, 0x03, 0x03, 0x01, 0x85, 0x00, 0x1a, 0x80, 0xc0, 0x40, 0x60, 0x70, 0x38, 0x3c, 0x3c, 0x3e,
+    0x3f, 0xbf, 0xbf, 0xdf, 0xdf, 0x3f, 0xef, 0x97, 0x59, 0x08, 0xae, 0xaf, 0x7f, 0xea, 0xc4, 0x1f,
+    0x0c, 0x0d, 0x86, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x82, 0x00, 0x07, 0x01, 0x00, 0x00,
+    0x02, 0x0a, 0x02, 0x05, 0x03, 0xb8, 0x00, 0x2b, 0x81, 0x93, 0x41, 0x11, 0xc1, 0xf8, 0xcd, 0x3e,
+    0x36, 0x3f, 0x6b, 0x6b, 0x41, 0x41, 0x15, 0x15, 0x3e, 0x01, 0x43, 0x22, 0xae, 0xa2, 0x22, 0x0a,
+    0x1c, 0x14, 0x36, 0x22, 0x61, 0x75, 0xf5, 0xc1, 0xe1, 0xa4, 0x71, 0xd5, 0xe1, 0x20, 0x80, 0x00,
+    0x80, 0x00, 0x80, 0x80, 0xce, 0x00, 0x14, 0x08, 0x0c, 0x08, 0x30, 0x48, 0xbe, 0x41, 0x00, 0x00,
+    0xff, 0xff, 0xfe, 0x9f, 0xfc, 0xf8, 0xf0, 0xe0, 0xe0, 0xc0, 0x80, 0x80, 0x85, 0x00, 0x18, 0x01,
+    0x03, 0x07, 0x0f, 0x0e, 0x1e, 0x3e, 0x7e, 0x7e, 0xfe, 0xfd, 0xfd, 0xfe, 0xf9, 0xf6, 0xc4, 0x0c,
+    0x1b, 0x7b, 0xff, 0x33, 0x10, 0x78, 0x58, 0x08, 0x84, 0x00, 0x13, 0xc0, 0x80, 0x00, 0x80, 0x00,
+    0x00, 0x80, 0xc0, 0x80, 0x00, 0x40, 0xc0, 0x80, 0x80, 0xb0, 0xa0, 0xa0, 0x50, 0xa0, 0x80, 0xb7,
+    0x00, 0x0b, 0x40, 0x66, 0x65, 0xce, 0xc1, 0x0f, 0xff, 0xff, 0xf8, 0x83, 0x0f, 0x3f, 0x86, 0xff,
+    0x82, 0xfe, 0x83, 0xfc, 0x83, 0xf8, 0x2f, 0xf0, 0xf0, 0xf1, 0xf1, 0xe3, 0xe3, 0xe7, 0xc7, 0xcf,
+    0xcc, 0x90, 0x90, 0x19, 0x3a, 0x28, 0x68, 0x60, 0x65, 0xe4, 0xe6, 0xe6, 0xe7, 0xf5, 0xf5, 0xf3,
+    0xf6, 0xf5, 0xf3, 0xf5, 0xe5, 0xe7, 0xe6, 0xce, 0xce, 0x8e, 0x8e, 0x0c, 0x1c, 0x19, 0x31, 0x22,
+    0x58, 0x94, 0x64, 0x44, 0x80, 0x00, 0x20, 0xad, 0x00, 0x09, 0x20, 0x00, 0x10, 0x70, 0x6c, 0xf0,
+    0x12, 0x00, 0xe1, 0xf8, 0x01, 0x03, 0x00, 0x80, 0x06, 0x79, 0x3f, 0x0f, 0x07, 0x03, 0x03, 0x01,
+    0x85, 0x00, 0x1b, 0x80, 0x80, 0x40, 0x60, 0x70, 0x30, 0x38, 0x3c, 0x3e, 0x3f, 0xbf, 0xbf, 0xdf,
+    0xdf, 0x5f, 0x0f, 0x57, 0x33, 0x68, 0x2c, 0xae, 0x6f, 0x57, 0x30, 0x27, 0x0b, 0x0d, 0x02, 0x86,
+    0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x01, 0x83, 0x00, 0x06, 0x03, 0x00, 0x02, 0x0e, 0x06, 0x0d,
+    0x01, 0xb9, 0x00, 0x23, 0x02, 0x91, 0x28, 0x0b, 0xe0, 0x94, 0x3e, 0x3f, 0x7f, 0x67, 0x69, 0x49,
+    0x49, 0x1d, 0x17, 0x33, 0x73, 0x64, 0x26, 0xa6, 0xaa, 0x2a, 0x0e, 0x00, 0x1e, 0x26, 0x21, 0x6d,
+    0x75, 0xf5, 0xd7, 0xf1, 0x35, 0x65, 0x24, 0xe1, 0x83, 0x00, 0x01, 0x80, 0x80, 0xd1, 0x00, 0x12,
+    0x04, 0x1c, 0x62, 0x5d, 0xff, 0x80, 0x00, 0x3e, 0xff, 0xc7, 0x7e, 0xfc, 0xf0, 0xf0, 0xe0, 0xc0,
+    0xc0, 0x80, 0x80, 0x84, 0x00, 0x1b, 0x01, 0x03, 0x03, 0x07, 0x0e, 0x1e, 0x3e, 0x3e, 0x7e, 0xfe,
+    0xfe, 0xfd, 0xfd, 0xfa, 0xf9, 0xe4, 0xcc, 0x18, 0x3b, 0x7a, 0xfd, 0x0b, 0xf2, 0x7c, 0x40, 0x68,
+    0x00, 0x80, 0x82, 0x00, 0x13, 0xc0, 0x80, 0x00, 0x80, 0x00, 0x00, 0x80, 0xc0, 0x00, 0x00, 0x40,
+    0xc0, 0x80, 0x80, 0xb0, 0xa0, 0xa0, 0x50, 0xe0, 0x80, 0xb8, 0x00, 0x0a, 0x64, 0x02, 0xa3, 0x6c,
+    0x03, 0xff, 0xfc, 0xc1, 0x0f, 0x3f, 0x7f, 0x85, 0xff, 0x82, 0xfe, 0x83, 0xfc, 0x83, 0xf8, 0x82,
+    0xf0, 0x2d, 0xf1, 0xe1, 0xe3, 0xe7, 0xc7, 0xcf, 0xce, 0x88, 0x90, 0x8d, 0x2b, 0x34, 0x2c, 0x49,
+    0x61, 0xe4, 0xe4, 0xe6, 0xe7, 0xe7, 0xe5, 0xf4, 0xf2, 0xf0, 0xf5, 0xf3, 0xe5, 0xe5, 0xe7, 0xcf,
+    0xce, 0xce, 0x8e, 0x0e, 0x1c, 0x19, 0x19, 0x31, 0x62, 0x58, 0x94, 0x40, 0x44, 0x80, 0x00, 0x80,
+    0xaf, 0x00, 0x07, 0x20, 0x20, 0x84, 0xec, 0x30, 0x14, 0x88, 0xe7, 0x01, 0x03, 0x00, 0x80, 0x05,
+    0x3e, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x86, 0x00, 0x1b, 0x80, 0x40, 0x60, 0x60, 0x30, 0x38, 0x3c,
+    0x3e, 0x3e, 0x3f, 0xbf, 0x9f, 0xdf, 0xdf, 0x2f, 0x8f, 0x57, 0xcb, 0x68, 0xac, 0x2f, 0x3f, 0x47,
+    0xf4, 0x2f, 0x0b, 0x09, 0x05, 0x84, 0x00, 0x00, 0x01, 0x8c, 0x00, 0x04, 0x02, 0x06, 0x0d, 0x0d,
+    0x01, 0xb9, 0x00, 0x28, 0x40, 0x51, 0x43, 0x38, 0x87, 0x3e, 0x37, 0x3f, 0x6f, 0x6d, 0x49, 0x49,
+    0x15, 0x19, 0x37, 0x01, 0x42, 0x36, 0xae, 0xae, 0x22, 0x02, 0x1e, 0x16, 0x36, 0x24, 0x65, 0x75,
+    0xfd, 0xed, 0xc5, 0xa4, 0x75, 0xd7, 0x11, 0x23, 0x80, 0x00, 0x80, 0x00, 0x80, 0xd2, 0x00, 0x11,
+    0x0c, 0x10, 0x14, 0x20, 0x3e, 0x63, 0x80, 0x00, 0xff, 0x3e, 0xfc, 0xf8, 0xf0, 0xe0, 0xc0, 0xc0,
+    0x80, 0x80, 0x85, 0x00, 0x19, 0x01, 0x03, 0x07, 0x0f, 0x0e, 0x1e, 0x3e, 0x7e, 0x7e, 0xfe, 0xfc,
+    0xfd, 0xfc, 0xf8, 0xf4, 0xe5, 0x8c, 0x1a, 0x3b, 0xfa, 0xf1, 0x06, 0x77, 0x2c, 0x68, 0x68, 0x84,
+    0x00, 0x12, 0x80, 0x80, 0xc0, 0x80, 0x00, 0x00, 0x80, 0xc0, 0x00, 0x00, 0x40, 0xc0, 0xa0, 0x80,
+    0xb0, 0xa0, 0x20, 0x50, 0xe0, 0xba, 0x00, 0x08, 0x45, 0x45, 0x86, 0xf0, 0xfe, 0xe1, 0x07, 0x1f,
+    0x7f, 0x85, 0xff, 0x82, 0xfe, 0x83, 0xfc, 0x83, 0xf8, 0x82, 0xf0, 0x2e, 0xf1, 0xe1, 0xe3, 0xe3,
+    0xe7, 0xc7, 0xcf, 0xcc, 0x98, 0x90, 0x3f, 0x39, 0x31, 0x46, 0x4b, 0x43, 0xc4, 0xe5, 0xe6, 0xe7,
+    0xe5, 0xe5, 0xf4, 0xf3, 0xf4, 0xf1, 0xe3, 0xe5, 0xed, 0xef, 0xcf, 0xce, 0x8e, 0x8e, 0x0c, 0x1c,
+    0x19, 0x39, 0x31, 0x62, 0x59, 0xf4, 0x44, 0x44, 0x80, 0x40, 0xc0, 0xb0, 0x00, 0x06, 0x40, 0x6c,
+    0x48, 0xe4, 0x36, 0x10, 0xc9, 0x01, 0x03, 0x00, 0x80, 0x05, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x01,
+    0x85, 0x00, 0x1c, 0x80, 0x00, 0x40, 0x60, 0x30, 0x38, 0x38, 0x3c, 0x3e, 0x3f, 0x9f, 0x9f, 0xdf,
+    0xdf, 0x7f, 0x0f, 0xd7, 0xc3, 0x89, 0x6c, 0xee, 0xaf, 0xb7, 0xa3, 0x94, 0x03, 0x0e, 0x03, 0x05,
+    0x8f, 0x00, 0x07, 0x01, 0x01, 0x03, 0x02, 0x06, 0x0d, 0x09, 0x03, 0xb9, 0x00, 0x24, 0x40, 0x50,
+    0x80, 0x63, 0x19, 0x36, 0x3f, 0x7f, 0x6f, 0x61, 0x41, 0x05, 0x11, 0x13, 0x3b, 0x66, 0x60, 0x32,
+    0xae, 0xa2, 0x02, 0x06, 0x12, 0x16, 0x28, 0x2d, 0x6d, 0x75, 0xf5, 0xe7, 0xe1, 0xb5, 0x71, 0xf1,
+    0x63, 0x00, 0x80, 0x82, 0x00, 0x01, 0x80, 0x80, 0xd2, 0x00, 0x0f, 0x04, 0x0c, 0x02, 0x1d, 0xbf,
+    0xc1, 0x00, 0x00, 0xfc, 0xf8, 0xf0, 0xe0, 0xe0, 0xc0, 0x80, 0x80, 0x85, 0x00, 0x1a, 0x01, 0x03,
+    0x03, 0x07, 0x0e, 0x1e, 0x3e, 0x3e, 0x7e, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfb, 0xf6, 0xcc, 0x08,
+    0x3b, 0x7b, 0xff, 0x71, 0x10, 0x7b, 0xa8, 0x58, 0x40, 0x82, 0x00, 0x01, 0x80, 0x00, 0x83, 0x80,
+    0x0e, 0x00, 0x00, 0x80, 0x40, 0x00, 0x00, 0x40, 0xc0, 0x80, 0x80, 0xb0, 0xa0, 0x20, 0x50, 0xe0,
+    0xba, 0x00, 0x07, 0x62, 0x20, 0x03, 0x54, 0xf8, 0x83, 0x0f, 0x3f, 0x86, 0xff, 0x82, 0xfe, 0x82,
+    0xfc, 0x83, 0xf8, 0x83, 0xf0, 0x1a, 0xe1, 0xe3, 0xe3, 0xe7, 0xc7, 0xcf, 0xce, 0x98, 0x90, 0x00,
+    0x2a, 0x3e, 0x50, 0x4d, 0x4b, 0xca, 0xc4, 0xe4, 0xe7, 0xe7, 0xe5, 0xe5, 0xe2, 0xe1, 0xe0, 0xe1,
+    0xeb, 0x82, 0xed, 0x10, 0xcf, 0xce, 0x8e, 0x8e, 0x1c, 0x1c, 0x19, 0x39, 0x33, 0x60, 0xd9, 0xc0,
+    0x00, 0x0c, 0x00, 0x00, 0xc0, 0xaf, 0x00, 0x07, 0x20, 0x20, 0x00, 0x90, 0xe8, 0x7c, 0x1c, 0x00,
+    0x01, 0x03, 0x00, 0x80, 0x04, 0x0f, 0x07, 0x03, 0x01, 0x01, 0x85, 0x00, 0x1d, 0x80, 0x80, 0x40,
+    0x60, 0x70, 0x30, 0x38, 0x3c, 0x3e, 0x3e, 0x1f, 0x9f, 0x9f, 0xdf, 0xdf, 0x2f, 0x8f, 0x27, 0x2b,
+    0x08, 0x6c, 0xee, 0x3f, 0x97, 0x20, 0x26, 0x23, 0x04, 0x0c, 0x04, 0x8e, 0x00, 0x08, 0x01, 0x00,
+    0x01, 0x03, 0x05, 0x05, 0x0d, 0x00, 0x01, 0xba, 0x00, 0x22, 0x40, 0x40, 0xf1, 0x30, 0x3f, 0x33,
+    0x6f, 0x65, 0x49, 0x09, 0x11, 0x1b, 0x37, 0x02, 0x53, 0x2f, 0xbe, 0xae, 0x2a, 0x0e, 0x12, 0x16,
+    0x10, 0x20, 0x29, 0x61, 0x75, 0xff, 0xd9, 0xe4, 0x35, 0x63, 0x00, 0xe2, 0x01, 0x82, 0x00, 0x82,
+    0x80, 0xd1, 0x00, 0x10, 0x08, 0x0c, 0x00, 0x3c, 0x61, 0x7e, 0x7f, 0x80, 0x00, 0xfc, 0xf8, 0xf0,
+    0xe0, 0xc0, 0xc0, 0x80, 0x80, 0x85, 0x00, 0x19, 0x01, 0x03, 0x07, 0x0f, 0x0e, 0x1e, 0x3e, 0x7e,
+    0x7e, 0xfe, 0xfc, 0xfd, 0xfd, 0xfa, 0xf3, 0xe6, 0x8c, 0x18, 0x3b, 0x7a, 0xff, 0x0b, 0x32, 0x7c,
+    0x18, 0x48, 0x84, 0x00, 0x03, 0x40, 0x80, 0x40, 0x80, 0x82, 0x00, 0x04, 0x80, 0x40, 0x00, 0x80,
+    0x40, 0x82, 0x80, 0x05, 0xb0, 0xa0, 0x30, 0x50, 0xc0, 0x80, 0xbb, 0x00, 0x05, 0xd6, 0xa2, 0xc3,
+    0x0f, 0x3f, 0x7f, 0x85, 0xff, 0x82, 0xfe, 0x82, 0xfc, 0x83, 0xf8, 0x83, 0xf0, 0x12, 0xe1, 0xe1,
+    0xe3, 0xe3, 0xc7, 0xc7, 0xcf, 0x8e, 0x98, 0x90, 0x29, 0x32, 0x08, 0x5a, 0x40, 0xcb, 0xca, 0xcd,
+    0xcc, 0x83, 0xed, 0x1a, 0xea, 0xec, 0xec, 0xe8, 0xeb, 0xed, 0xed, 0xcc, 0xcf, 0x8f, 0x8e, 0x0e,
+    0x1c, 0x1d, 0x19, 0x31, 0x22, 0x64, 0xd9, 0xa4, 0x50, 0x80, 0x00, 0x40, 0xc0, 0x00, 0x80, 0xae,
+    0x00, 0x06, 0x60, 0x60, 0x70, 0x00, 0xe8, 0x3c, 0x10, 0x01, 0x03, 0x00, 0x80, 0x03, 0x07, 0x03,
+    0x01, 0x01, 0x85, 0x00, 0x1d, 0x80, 0x80, 0x40, 0x40, 0x60, 0x30, 0x38, 0x3c, 0x3c, 0x3e, 0x1f,
+    0x9f, 0x9f, 0xdf, 0xdf, 0xef, 0x2f, 0x97, 0x43, 0xa9, 0x4c, 0xee, 0xbf, 0x37, 0x2f, 0x74, 0x2b,
+    0x0f, 0x01, 0x04, 0x91, 0x00, 0x06, 0x01, 0x01, 0x05, 0x05, 0x0d, 0x02, 0x01, 0xbb, 0x00, 0x26,
+    0xd0, 0x91, 0x61, 0x37, 0x7f, 0x65, 0x65, 0x41, 0x09, 0x1b, 0x17, 0x2a, 0x70, 0x61, 0x3b, 0xb6,
+    0xa6, 0x02, 0x02, 0x16, 0x14, 0x28, 0x29, 0x61, 0x79, 0xf9, 0xe7, 0xd1, 0xa5, 0x73, 0xc5, 0x41,
+    0x61, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0xd3, 0x00, 0x0e, 0x08, 0x0c, 0x0e, 0x32, 0x4d, 0xbf,
+    0x61, 0x00, 0xf8, 0xf0, 0xe0, 0xc0, 0xc0, 0x80, 0x80, 0x85, 0x00, 0x1a, 0x01, 0x03, 0x03, 0x07,
+    0x0e, 0x1e, 0x3e, 0x3e, 0x7e, 0xfe, 0xfe, 0xfd, 0xfd, 0xfe, 0xfa, 0xf4, 0xe5, 0x08, 0x1a, 0x3b,
+    0xfa, 0xf5, 0x07, 0xf2, 0x68, 0x60, 0xb0, 0x84, 0x00, 0x02, 0xc0, 0x80, 0x40, 0x83, 0x00, 0x0d,
+    0x80, 0x00, 0x00, 0x80, 0x40, 0x80, 0xc0, 0x80, 0xb0, 0xb8, 0x30, 0x50, 0xc0, 0x80, 0xbb, 0x00,
+    0x04, 0x66, 0x45, 0x07, 0x1f, 0x7f, 0x85, 0xff, 0x82, 0xfe, 0x82, 0xfc, 0x83, 0xf8, 0x84, 0xf0,
+    0x2f, 0xe1, 0xe3, 0xe3, 0xc7, 0xc7, 0xcf, 0x8f, 0x9c, 0x90, 0x00, 0x3f, 0x08, 0x45, 0x50, 0x40,
+    0xca, 0xca, 0xcf, 0xcc, 0xec, 0xed, 0xed, 0xe8, 0xe9, 0xec, 0xea, 0xe9, 0xea, 0xec, 0xec, 0xcc,
+    0xce, 0x8f, 0x8f, 0x1c, 0x1d, 0x1d, 0x39, 0x31, 0x22, 0x44, 0xb9, 0xa4, 0x10, 0x80, 0x80, 0xc0,
+    0x80, 0xb2, 0x00, 0x04, 0x20, 0xe8, 0xc0, 0xe8, 0x38, 0x01, 0x03, 0x00, 0x80, 0x02, 0x03, 0x03,
+    0x01, 0x86, 0x00, 0x0b, 0x80, 0x00, 0x40, 0x60, 0x30, 0x38, 0x38, 0x3c, 0x3e, 0x1f, 0x9f, 0x9f,
+    0x82, 0xdf, 0x0e, 0x6f, 0x8f, 0x87, 0xcb, 0x08, 0x4c, 0x6e, 0x37, 0x57, 0x63, 0x20, 0x03, 0x05,
+    0x01, 0x01, 0x91, 0x00, 0x06, 0x01, 0x01, 0x03, 0x01, 0x09, 0x02, 0x01, 0xbc, 0x00, 0x1e, 0x50,
+    0xd0, 0x37, 0x6d, 0x65, 0x49, 0x09, 0x10, 0x1e, 0x32, 0x06, 0x43, 0x33, 0xb7, 0xa6, 0x02, 0x04,
+    0x08, 0x00, 0x18, 0x29, 0x2d, 0x61, 0x79, 0xff, 0xe1, 0xe2, 0x3b, 0x77, 0x72, 0x40, 0x84, 0x00,
+    0x00, 0x80, 0xd5, 0x00, 0x0c, 0x04, 0x00, 0x1c, 0x40, 0x9e, 0xbf, 0xc0, 0xf0, 0xe0, 0xe0, 0xc0,
+    0x80, 0x80, 0x86, 0x00, 0x1a, 0x01, 0x03, 0x07, 0x0f, 0x0e, 0x1e, 0x3e, 0x7e, 0x7e, 0xfe, 0xfe,
+    0xfd, 0xfd, 0xfa, 0xfa, 0xf6, 0xcc, 0x18, 0x3b, 0x7b, 0xfe, 0xf1, 0x10, 0x7f, 0xa8, 0xc8, 0xc8,
+    0x84, 0x00, 0x02, 0xc0, 0x80, 0xc0, 0x83, 0x00, 0x0d, 0x80, 0x80, 0x00, 0x00, 0x40, 0x80, 0xc0,
+    0x80, 0xb0, 0xb8, 0x30, 0x58, 0xc0, 0x80, 0xbb, 0x00, 0x03, 0x06, 0xa1, 0x1f, 0x3f, 0x85, 0xff,
+    0x82, 0xfe, 0x83, 0xfc, 0x82, 0xf8, 0x84, 0xf0, 0x1d, 0xe1, 0xe1, 0xe3, 0xc3, 0xc7, 0xc7, 0xcf,
+    0x8e, 0x98, 0x10, 0x20, 0x2e, 0x5d, 0x48, 0x56, 0xc1, 0xcb, 0xca, 0xce, 0xcc, 0xcc, 0xed, 0xed,
+    0xea, 0xea, 0xe8, 0xec, 0xe9, 0xeb, 0xee, 0x82, 0xcc, 0x0b, 0x8f, 0x9d, 0x1d, 0x1d, 0x19, 0x39,
+    0x31, 0x62, 0x44, 0xb8, 0x24, 0xd0, 0x82, 0x00, 0x00, 0xc0, 0xb1, 0x00, 0x05, 0x40, 0x40, 0xc8,
+    0x18, 0xe8, 0x68, 0x01, 0x03, 0x00, 0x80, 0x01, 0x03, 0x01, 0x86, 0x00, 0x1e, 0x80, 0x00, 0x40,
+    0x60, 0x30, 0x30, 0x38, 0x3c, 0x1e, 0x1f, 0x1f, 0x9f, 0x9f, 0xdf, 0xdf, 0xef, 0x2f, 0x97, 0x13,
+    0x89, 0x4c, 0x4e, 0x37, 0x37, 0x7f, 0x75, 0x62, 0x37, 0x05, 0x06, 0x04, 0x91, 0x00, 0x05, 0x01,
+    0x01, 0x03, 0x01, 0x01, 0x02, 0xbd, 0x00, 0x22, 0xc0, 0x98, 0x6f, 0x65, 0x65, 0x0c, 0x00, 0x1a,
+    0x16, 0x29, 0x40, 0x71, 0x33, 0xbf, 0xa6, 0x04, 0x00, 0x1c, 0x16, 0x00, 0x2d, 0x69, 0x69, 0xf7,
+    0xf7, 0xc7, 0xe3, 0x37, 0x6f, 0x11, 0x61, 0x81, 0x80, 0x00, 0x00, 0x82, 0x80, 0xd5, 0x00, 0x0a,
+    0x0c, 0x1e, 0x32, 0x61, 0x7f, 0x73, 0xf0, 0xe0, 0xc0, 0x80, 0x80, 0x86, 0x00, 0x1b, 0x01, 0x03,
+    0x03, 0x07, 0x0e, 0x1e, 0x3e, 0x3e, 0x7e, 0xfe, 0xfe, 0xfc, 0xfd, 0xfd, 0xf8, 0xf7, 0xe6, 0x88,
+    0x1a, 0x3b, 0x7a, 0xf7, 0x2b, 0x10, 0x7f, 0xb8, 0xd8, 0x20, 0x84, 0x00, 0x00, 0xc0, 0x82, 0x80,
+    0x82, 0x00, 0x00, 0x80, 0x82, 0x00, 0x09, 0x40, 0x80, 0xe0, 0x80, 0xb0, 0xb8, 0x70, 0x58, 0xc0,
+    0x80, 0xbc, 0x00, 0x01, 0x44, 0x3f, 0x86, 0xff, 0x01, 0xfe, 0xfe, 0x83, 0xfc, 0x83, 0xf8, 0x83,
+    0xf0, 0x22, 0xe0, 0xe1, 0xe3, 0xe3, 0xc7, 0xc7, 0xcf, 0x8f, 0x9c, 0x98, 0x20, 0x31, 0x12, 0x63,
+    0x40, 0xd8, 0xc1, 0xcb, 0xcb, 0xcf, 0xcf, 0xcc, 0xed, 0xef, 0xea, 0xe8, 0xe4, 0xe4, 0xe9, 0xea,
+    0xca, 0xcc, 0xcd, 0x8c, 0x8d, 0x82, 0x1d, 0x0c, 0x19, 0x39, 0x31, 0x62, 0x44, 0xbc, 0x00, 0x80,
+    0x00, 0x00, 0x80, 0x00, 0x80, 0xb0, 0x00, 0x05, 0x40, 0x00, 0x20, 0xf0, 0x10, 0xe8, 0x01, 0x03,
+    0x00, 0x80, 0x00, 0x81, 0x86, 0x00, 0x1e, 0x80, 0x80, 0x40, 0x40, 0x20, 0x30, 0x38, 0x3c, 0x1c,
+    0x1e, 0x1f, 0x9f, 0x9f, 0xdf, 0xdf, 0xef, 0x6f, 0x9f, 0xd7, 0x8b, 0x8c, 0x44, 0x56, 0x37, 0x17,
+    0x6b, 0x70, 0x13, 0x05, 0x02, 0x05, 0x92, 0x00, 0x05, 0x01, 0x00, 0x03, 0x07, 0x02, 0x06, 0xbe,
+    0x00, 0x23, 0x01, 0x6d, 0x61, 0x0c, 0x00, 0x12, 0x1e, 0x33, 0x00, 0x63, 0x73, 0xbf, 0xbf, 0x00,
+    0x00, 0x0c, 0x12, 0x1c, 0x21, 0x21, 0x61, 0x7d, 0xf3, 0xe9, 0xc0, 0xb7, 0x73, 0xc0, 0x40, 0x61,
+    0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0xd6, 0x00, 0x0a, 0x04, 0x00, 0x0c, 0x01, 0x0c, 0x3f, 0xe0,
+    0xc0, 0xc0, 0x80, 0x80, 0x85, 0x00, 0x1b, 0x01, 0x01, 0x03, 0x07, 0x0f, 0x1e, 0x1e, 0x3e, 0x7e,
+    0x7e, 0xfe, 0xfe, 0xfd, 0xfd, 0xfa, 0xfa, 0xf4, 0xcd, 0x08, 0x1a, 0x7b, 0xfa, 0xf5, 0x03, 0x32,
+    0x68, 0x90, 0xe8, 0x84, 0x00, 0x04, 0x80, 0x80, 0x00, 0x80, 0x80, 0x82, 0x00, 0x00, 0x80, 0x82,
+    0x00, 0x08, 0x40, 0x40, 0xe0, 0x80, 0xb0, 0xb8, 0x50, 0x58, 0xc0, 0xbd, 0x00, 0x01, 0x20, 0x7f,
+    0x85, 0xff, 0x01, 0xfe, 0xfe, 0x83, 0xfc, 0x83, 0xf8, 0x83, 0xf0, 0x23, 0xe0, 0xe1, 0xe1, 0xe3,
+    0xc7, 0xc7, 0xcf, 0x8f, 0x9f, 0x98, 0x10, 0x20, 0x1f, 0x60, 0x6e, 0x54, 0xd4, 0xc0, 0xca, 0xcb,
+    0xce, 0xce, 0xcc, 0xcf, 0xea, 0xeb, 0xec, 0xe0, 0xe0, 0xe8, 0xeb, 0xca, 0xcc, 0xcd, 0x8c, 0x9d,
+    0x82, 0x1d, 0x08, 0x39, 0x39, 0x33, 0x62, 0xc5, 0xbc, 0x00, 0x80, 0x10, 0x82, 0x00, 0x00, 0x80,
+    0xb2, 0x00, 0x03, 0x60, 0x20, 0x20, 0xd0, 0x01, 0x03, 0x00, 0x80, 0x01, 0x80, 0x80, 0x84, 0x00,
+    0x1f, 0x80, 0x80, 0x40, 0x40, 0x20, 0x30, 0x38, 0x38, 0x1c, 0x1e, 0x1f, 0x9f, 0x9f, 0xdf, 0xdf,
+    0xcf, 0xef, 0x2f, 0x87, 0x23, 0x89, 0x84, 0x56, 0x17, 0x17, 0x3f, 0x63, 0x16, 0x37, 0x05, 0x05,
+    0x04, 0x94, 0x00, 0x04, 0x01, 0x07, 0x02, 0x04, 0x01, 0xbd, 0x00, 0x1d, 0x80, 0x61, 0x28, 0x04,
+    0x00, 0x1e, 0x12, 0x1a, 0x52, 0x69, 0x33, 0xbf, 0xa1, 0x04, 0x00, 0x1e, 0x1a, 0x00, 0x2d, 0x2d,
+    0x61, 0x7b, 0xfb, 0xfe, 0xe1, 0x3f, 0x7b, 0x21, 0xc0, 0x61, 0x83, 0x00, 0x00, 0x80, 0xd7, 0x00,
+    0x09, 0x04, 0x0c, 0x02, 0x3f, 0x01, 0x9e, 0xe0, 0xc0, 0x80, 0x80, 0x86, 0x00, 0x1f, 0x01, 0x03,
+    0x07, 0x07, 0x0e, 0x1e, 0x3e, 0x3e, 0x7e, 0xfe, 0xfe, 0xfc, 0xfd, 0xfd, 0xfa, 0xf3, 0xe7, 0xc8,
+    0x18, 0x3b, 0x7b, 0xfe, 0xf1, 0x12, 0xfb, 0x68, 0x68, 0x00, 0x40, 0x00, 0x00, 0x80, 0x83, 0x00,
+    0x00, 0x80, 0x83, 0x00, 0x00, 0x80, 0x82, 0x00, 0x08, 0x40, 0x00, 0xe0, 0x80, 0xb0, 0x38, 0x50,
+    0x58, 0x40, 0xbe, 0x00, 0x85, 0xff, 0x82, 0xfe, 0x82, 0xfc, 0x83, 0xf8, 0x83, 0xf0, 0x24, 0xe0,
+    0xe0, 0xe1, 0xe3, 0xc3, 0xc7, 0xc7, 0x8f, 0x8f, 0x9e, 0x18, 0x30, 0x20, 0x5c, 0x66, 0x75, 0x9c,
+    0x94, 0x80, 0xcb, 0xce, 0xcc, 0xcf, 0xce, 0xcf, 0xea, 0xe9, 0xe1, 0xe4, 0xe2, 0xe8, 0xcb, 0xca,
+    0xcc, 0x8c, 0x9c, 0x9d, 0x82, 0x1d, 0x0c, 0x39, 0x31, 0x73, 0x62, 0xc5, 0xbc, 0x00, 0x90, 0x10,
+    0x00, 0x00, 0x80, 0x80, 0xb2, 0x00, 0x03, 0x60, 0x40, 0xc8, 0x00, 0x04, 0x00, 0x06, 0x41, 0x20,
+    0x80, 0x80, 0x00, 0x40, 0x60, 0x30, 0x30, 0x38, 0x1c, 0x1e, 0x1f, 0x1f, 0x9f, 0x9f, 0xdf, 0xcf,
+    0xef, 0x6f, 0x97, 0xd7, 0x0b, 0xd5, 0x54, 0x56, 0x57, 0x17, 0x3b, 0x75, 0x46, 0x01, 0x03, 0x00,
+    0x02, 0x94, 0x00, 0x04, 0x01, 0x06, 0x06, 0x04, 0x00, 0x11, 0x00, 0x80, 0x1f, 0x28, 0x0c, 0x00,
+    0x16, 0x1e, 0x37, 0x12, 0x71, 0x37, 0xbb, 0xb9, 0x0d, 0x00, 0x06, 0x10, 0x0e, 0x21, 0x21, 0x61,
+    0x67, 0xf3, 0xed, 0xc8, 0xb1, 0x73, 0xe8, 0x02, 0x61, 0x80, 0x80, 0x00, 0x00, 0x82, 0x80, 0xd7,
+    0x00, 0x04, 0x04, 0x0c, 0x1c, 0x13, 0x24, 0x22, 0x00, 0x41, 0x02, 0xc0, 0x80, 0x80, 0x86, 0x00,
+    0x08, 0x01, 0x01, 0x03, 0x07, 0x0f, 0x1e, 0x1e, 0x3e, 0x7e, 0x82, 0xfe, 0x11, 0xfd, 0xfd, 0xfe,
+    0xfa, 0xf5, 0xe5, 0x88, 0x1a, 0x3b, 0xfa, 0xf7, 0x6b, 0x11, 0xf9, 0x78, 0x68, 0xf0, 0x40, 0x85,
+    0x00, 0x00, 0x80, 0x84, 0x00, 0x00, 0x80, 0x82, 0x00, 0x08, 0x40, 0x40, 0xe0, 0xc0, 0xb0, 0x38,
+    0x50, 0x48, 0x60, 0x33, 0x05, 0x80, 0x82, 0xfe, 0x82, 0xfc, 0x83, 0xf8, 0x83, 0xf0, 0x24, 0xe0,
+    0xe0, 0xe1, 0xe1, 0xc3, 0xc7, 0xc7, 0x8f, 0x8f, 0x9f, 0x1c, 0x30, 0x20, 0x11, 0x62, 0x6a, 0xa8,
+    0x96, 0x94, 0x82, 0x8a, 0xcd, 0xcc, 0xcf, 0xce, 0xca, 0xca, 0xe9, 0xe0, 0xe8, 0xe6, 0xc0, 0xcb,
+    0xca, 0xdf, 0x9c, 0x9c, 0x82, 0x1d, 0x0c, 0x39, 0x39, 0x31, 0x73, 0x62, 0xc5, 0xb8, 0xc0, 0x30,
+    0x80, 0x00, 0x00, 0x80, 0xb3, 0x00, 0x03, 0x40, 0x80, 0x00, 0xf8, 0x03, 0x01, 0x00, 0x80, 0x82,
+    0x80, 0x23, 0x00, 0x00, 0x80, 0x80, 0x00, 0x40, 0x60, 0x20, 0x30, 0x38, 0x1c, 0x1e, 0x1e, 0x1f,
+    0x9f, 0x9f, 0xdf, 0xcf, 0xef, 0xef, 0x3f, 0x87, 0xeb, 0xc1, 0x64, 0x16, 0x57, 0x57, 0x3b, 0x2b,
+    0x18, 0x57, 0x01, 0x06, 0x06, 0x02, 0x92, 0x00, 0x04, 0x01, 0x01, 0x00, 0x06, 0x06, 0xc0, 0x00,
+    0x1f, 0x20, 0x04, 0x02, 0x1e, 0x13, 0x18, 0x42, 0x79, 0xb7, 0xb9, 0x99, 0x04, 0x00, 0x0a, 0x1a,
+    0x05, 0x21, 0x21, 0x65, 0x73, 0xff, 0xea, 0xd3, 0xb3, 0x73, 0xd2, 0xc1, 0x60, 0x80, 0x80, 0x00,
+    0x00, 0x82, 0x80, 0xd7, 0x00, 0x04, 0x04, 0x00, 0x02, 0x0e, 0x00, 0x22, 0x02, 0x3e, 0x87, 0x00,
+    0x1c, 0x01, 0x03, 0x07, 0x07, 0x0e, 0x1e, 0x3e, 0x7e, 0x7e, 0xfe, 0xfe, 0xfc, 0xfd, 0xfd, 0xfa,
+    0xf9, 0xf4, 0xc9, 0x18, 0x3a, 0x7b, 0xfa, 0xf5, 0x0f, 0x3a, 0x68, 0x90, 0x58, 0x70, 0x83, 0x00,
+    0x03, 0x80, 0x00, 0x00, 0x80, 0x88, 0x00, 0x05, 0x80, 0x00, 0xe0, 0xc0, 0xf0, 0x78, 0x33, 0x04,
+    0x80, 0x82, 0xfe, 0x82, 0xfc, 0x83, 0xf8, 0x83, 0xf0, 0x25, 0xe0, 0xe0, 0xe1, 0xe1, 0xc3, 0xc3,
+    0xc7, 0xc7, 0x8f, 0x8f, 0x9e, 0x18, 0x30, 0x20, 0x7b, 0x56, 0x3b, 0xb4, 0x9a, 0x94, 0x8a, 0x8a,
+    0x89, 0xcc, 0xcf, 0xce, 0xca, 0xcb, 0xc4, 0xc8, 0xc8, 0xc2, 0xc0, 0xcb, 0xdb, 0x9e, 0x9c, 0x9c,
+    0x82, 0x1d, 0x0c, 0x39, 0x39, 0x31, 0x63, 0x62, 0xc5, 0xb0, 0x88, 0xb0, 0x18, 0x00, 0x00, 0x80,
+    0xb4, 0x00, 0x02, 0x40, 0xc0, 0xb0, 0x04, 0x00, 0x03, 0x40, 0x82, 0x80, 0x0b, 0x00, 0x40, 0x40,
+    0x20, 0x30, 0x38, 0x18, 0x1c, 0x1e, 0x1f, 0x1f, 0x9f, 0x82, 0xcf, 0x11, 0xef, 0x6f, 0x97, 0xc7,
+    0x23, 0x95, 0x04, 0x36, 0x77, 0x3f, 0x1b, 0x15, 0x72, 0x11, 0x07, 0x03, 0x02, 0x02, 0x94, 0x00,
+    0x03, 0x02, 0x02, 0x06, 0x01, 0x11, 0x00, 0x80, 0x1b, 0x0c, 0x02, 0x16, 0x1b, 0x23, 0x02, 0x71,
+    0x33, 0xbd, 0x99, 0x05, 0x0c, 0x02, 0x10, 0x03, 0x21, 0x21, 0x61, 0x67, 0xf3, 0xf8, 0xc9, 0xf8,
+    0x33, 0x78, 0x22, 0x41, 0x60, 0x83, 0x00, 0x00, 0x80, 0xda, 0x00, 0x03, 0x04, 0x0c, 0x16, 0x1a,
+    0x22, 0x00, 0x40, 0x01, 0x80, 0x80, 0x86, 0x00, 0x08, 0x01, 0x01, 0x03, 0x07, 0x0f, 0x1e, 0x1e,
+    0x3e, 0x7e, 0x82, 0xfe, 0x82, 0xfd, 0x0d, 0xf8, 0xf4, 0xe6, 0x88, 0x1a, 0x3b, 0x7b, 0xfe, 0xf1,
+    0x1f, 0xfa, 0x68, 0xb8, 0x90, 0x85, 0x00, 0x82, 0x80, 0x83, 0x00, 0x00, 0x80, 0x82, 0x00, 0x08,
+    0x80, 0x80, 0x00, 0xe0, 0xc0, 0xf0, 0x78, 0x50, 0x08, 0x33, 0x06, 0x80, 0x82, 0xfc, 0x83, 0xf8,
+    0x83, 0xf0, 0x82, 0xe0, 0x30, 0xe1, 0xc3, 0xc3, 0xc7, 0xc7, 0x8f, 0x8f, 0x9f, 0x1c, 0x30, 0x20,
+    0x41, 0x5d, 0x12, 0x82, 0xb9, 0x82, 0x94, 0x9a, 0x88, 0x89, 0xcc, 0xcf, 0xca, 0xca, 0xc9, 0xc0,
+    0xc8, 0xd2, 0xd2, 0xd0, 0xdb, 0xdb, 0x9e, 0x9c, 0x1c, 0x1d, 0x1d, 0x3d, 0x39, 0x39, 0x73, 0x63,
+    0xc2, 0x85, 0x30, 0x08, 0x30, 0x18, 0xb8, 0x00, 0x01, 0x80, 0x40, 0x04, 0x00, 0x05, 0x3f, 0x1e,
+    0x00, 0x40, 0x40, 0x20, 0x30, 0x30, 0x18, 0x1c, 0x1e, 0x1f, 0x1f, 0x9f, 0x8f, 0xcf, 0xcf, 0xef,
+    0xef, 0x37, 0x87, 0xdb, 0x81, 0x74, 0x26, 0x37, 0x77, 0x1b, 0x4b, 0x11, 0x41, 0x0d, 0x02, 0x97,
+    0x00, 0x02, 0x01, 0x00, 0x04, 0x11, 0x00, 0x80, 0x20, 0x00, 0x12, 0x17, 0x17, 0x31, 0x70, 0x77,
+    0xbd, 0xbd, 0x95, 0x05, 0x08, 0x06, 0x0e, 0x03, 0x21, 0x24, 0x62, 0x66, 0xfa, 0xe2, 0xc0, 0xb8,
+    0x72, 0xeb, 0x20, 0x20, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0xda, 0x00, 0x03, 0x04, 0x00, 0x0a,
+    0x1c, 0x22, 0x01, 0x41, 0x87, 0x00, 0x1d, 0x01, 0x03, 0x07, 0x0f, 0x0e, 0x1e, 0x3e, 0x7e, 0x7e,
+    0xfe, 0xfe, 0xfc, 0xfd, 0xfd, 0xfa, 0xfa, 0xf5, 0xc9, 0x08, 0x1a, 0x3b, 0xfa, 0xf7, 0x6b, 0x14,
+    0xeb, 0x68, 0xc8, 0x40, 0x40, 0x83, 0x00, 0x03, 0x80, 0x80, 0x00, 0x80, 0x83, 0x00, 0x00, 0x80,
+    0x82, 0x00, 0x09, 0x80, 0x80, 0x00, 0xe0, 0xc0, 0x70, 0x78, 0x58, 0x08, 0xc0, 0x33, 0x03, 0x80,
+    0x01, 0xfe, 0xfe, 0x82, 0xfc, 0x83, 0xf8, 0x83, 0xf0, 0x82, 0xe0, 0x26, 0xe1, 0xc1, 0xc3, 0xc3,
+    0xc7, 0x8f, 0x8f, 0x9f, 0x1f, 0x38, 0x30, 0x20, 0x41, 0x64, 0xa0, 0x91, 0xac, 0x82, 0x96, 0x98,
+    0x98, 0x9a, 0x9d, 0xde, 0xda, 0xdb, 0xd1, 0xd0, 0xd1, 0xd2, 0xd2, 0xd4, 0xdb, 0x9b, 0x9e, 0x9e,
+    0x1c, 0x1d, 0x3d, 0x82, 0x39, 0x07, 0x73, 0x62, 0xc6, 0x89, 0x32, 0x08, 0x10, 0x18, 0x82, 0x00,
+    0x00, 0x80, 0xb5, 0x00, 0x00, 0x80, 0x03, 0x00, 0x04, 0x3f, 0x21, 0x00, 0x00, 0x40, 0x20, 0x20,
+    0x30, 0x18, 0x1c, 0x1e, 0x1e, 0x1f, 0x8f, 0x8f, 0xcf, 0xcf, 0xef, 0xef, 0x77, 0x97, 0xcb, 0x0b,
+    0xc5, 0x26, 0x36, 0x37, 0x1b, 0x1b, 0x45, 0x7e, 0x19, 0x1b, 0x06, 0x02, 0x02, 0x95, 0x00, 0x82,
+    0x01, 0x11, 0x00, 0x80, 0x1e, 0x06, 0x12, 0x13, 0x30, 0x13, 0x6b, 0x31, 0xb9, 0x99, 0x15, 0x19,
+    0x16, 0x00, 0x07, 0x05, 0x28, 0x64, 0x66, 0xea, 0xfc, 0xe8, 0xea, 0x3a, 0x70, 0x40, 0xc0, 0x00,
+    0x00, 0x80, 0x00, 0x00, 0x82, 0x80, 0xdb, 0x00, 0x01, 0x0c, 0x02, 0x23, 0x00, 0x45, 0x87, 0x00,
+    0x08, 0x01, 0x03, 0x03, 0x07, 0x0f, 0x1e, 0x3e, 0x3e, 0x7e, 0x82, 0xfe, 0x11, 0xfc, 0xfd, 0xfd,
+    0xfa, 0xf5, 0xe4, 0xc9, 0x18, 0x3a, 0x7b, 0xfe, 0xf5, 0x0b, 0x30, 0xe9, 0x50, 0xc0, 0x50, 0x84,
+    0x00, 0x01, 0x80, 0x80, 0x85, 0x00, 0x0d, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0x00, 0x80, 0xc0,
+    0x70, 0x58, 0x58, 0x88, 0xc0, 0x83, 0x00, 0x01, 0xff, 0xff, 0x82, 0xfe, 0x01, 0xfc, 0xfc, 0x83,
+    0xf8, 0x83, 0xf0, 0x83, 0xe0, 0x31, 0xc1, 0xc3, 0xc3, 0xc7, 0x87, 0x8f, 0x8f, 0x1f, 0x1e, 0x38,
+    0x20, 0x40, 0x7b, 0x80, 0xac, 0x83, 0xb8, 0x87, 0x96, 0x9c, 0x99, 0x98, 0x99, 0xda, 0xdb, 0xdb,
+    0xd5, 0xd3, 0xd1, 0xd2, 0xd6, 0xd5, 0xdb, 0x9a, 0x9a, 0x9e, 0x1c, 0x1d, 0x3d, 0x39, 0x39, 0x31,
+    0x73, 0x62, 0xc4, 0x89, 0x32, 0x00, 0x30, 0x10, 0x04, 0x00, 0x03, 0x40, 0x21, 0x00, 0x00, 0x40,
+    0x40, 0x20, 0x30, 0x18, 0x1c, 0x1c, 0x1e, 0x1f, 0x0f, 0x8f, 0xcf, 0xcf, 0xef, 0xef, 0xe7, 0x37,
+    0x87, 0xc3, 0x8d, 0x04, 0x06, 0x33, 0x3b, 0x5b, 0x0f, 0x11, 0x38, 0x09, 0x02, 0x01, 0x03, 0x96,
+    0x00, 0x82, 0x01, 0x00, 0x02, 0x11, 0x00, 0x80, 0x1b, 0x16, 0x17, 0x13, 0x29, 0x72, 0x71, 0xbd,
+    0x9d, 0x91, 0x15, 0x1f, 0x12, 0x0b, 0x03, 0x28, 0x28, 0x62, 0x6e, 0xf2, 0xeb, 0xd1, 0xa8, 0x30,
+    0xeb, 0x22, 0x70, 0xa0, 0x80, 0x82, 0x00, 0x01, 0x80, 0x80, 0xdc, 0x00, 0x01, 0x04, 0x0e, 0x22,
+    0x0a, 0x41, 0x1b, 0x07, 0x0f, 0x0e, 0x1e, 0x3e, 0x7e, 0x7e, 0xfe, 0xfe, 0xfc, 0xfd, 0xfd, 0xfa,
+    0xfa, 0xf7, 0xe2, 0x88, 0x1a, 0x3b, 0x7b, 0xf6, 0xf9, 0x17, 0xf2, 0x68, 0x98, 0x90, 0x50, 0x84,
+    0x00, 0x03, 0x80, 0x00, 0x00, 0x80, 0x83, 0x00, 0x00, 0x80, 0x82, 0x00, 0x09, 0x80, 0x80, 0x00,
+    0x00, 0x40, 0x50, 0x58, 0x58, 0x88, 0x40, 0x33, 0x01, 0x49, 0x82, 0xfe, 0x82, 0xfc, 0x82, 0xf8,
+    0x83, 0xf0, 0x83, 0xe0, 0x32, 0xc1, 0xc1, 0xc3, 0xc7, 0x87, 0x8f, 0x8f, 0x1f, 0x1f, 0x3c, 0x30,
+    0x60, 0x41, 0x3d, 0xd6, 0xfb, 0x85, 0xa9, 0x87, 0x94, 0x9e, 0x9a, 0x98, 0x99, 0x9a, 0xdb, 0xd3,
+    0xd5, 0xd9, 0xd1, 0xd4, 0xd6, 0xd4, 0x9b, 0x9a, 0x9a, 0x1e, 0x1c, 0x3d, 0x3d, 0x39, 0x39, 0x73,
+    0x73, 0x62, 0xc4, 0x89, 0x33, 0x00, 0x30, 0x10, 0x83, 0x00, 0x04, 0x00, 0x02, 0x3f, 0x21, 0x00,
+    0x80, 0xc0, 0xc0, 0x20, 0x30, 0x18, 0x18, 0x1c, 0x1e, 0x1f, 0x0f, 0x8f, 0x8f, 0xcf, 0xcf, 0xef,
+    0xe7, 0x77, 0x97, 0xcb, 0xfb, 0xe5, 0xd2, 0x03, 0x7b, 0x5b, 0x1b, 0x3d, 0x32, 0x03, 0x1b, 0x02,
+    0x02, 0x97, 0x00, 0x02, 0x01, 0x03, 0x03, 0x11, 0x00, 0x80, 0x1f, 0x13, 0x13, 0x31, 0x33, 0x71,
+    0x3f, 0xbf, 0x91, 0x11, 0x1d, 0x1f, 0x11, 0x07, 0x0a, 0x28, 0x2a, 0x6e, 0x6a, 0xf9, 0xf1, 0xc8,
+    0x28, 0x73, 0xc2, 0xe1, 0x61, 0x80, 0x80, 0x00, 0x00, 0x80, 0x80, 0xdf, 0x00, 0x22, 0x07, 0x41,
+    0x08, 0x01, 0x03, 0x03, 0x07, 0x0f, 0x1e, 0x3e, 0x3e, 0x7e, 0x82, 0xfe, 0x12, 0xfc, 0xfd, 0xfd,
+    0xfa, 0xf1, 0xe4, 0xc8, 0x18, 0x3a, 0x7b, 0xfa, 0xf7, 0xe3, 0x18, 0xe3, 0x70, 0xc0, 0x18, 0x40,
+    0x84, 0x00, 0x00, 0x80, 0x86, 0x00, 0x02, 0x80, 0x00, 0x00, 0x82, 0x80, 0x07, 0x00, 0x00, 0x40,
+    0x50, 0x58, 0x58, 0x88, 0xc0, 0x33, 0x00, 0x80, 0x82, 0xfe, 0x82, 0xfc, 0x82, 0xf8, 0x83, 0xf0,
+    0x83, 0xe0, 0x33, 0xc1, 0xc1, 0xc3, 0xc3, 0x87, 0x87, 0x8f, 0x1f, 0x1f, 0x3e, 0x38, 0x20, 0x40,
+    0x43, 0x80, 0xfa, 0xe0, 0x28, 0x00, 0x16, 0x14, 0x9e, 0x9a, 0x98, 0x99, 0x9b, 0xdb, 0xd5, 0xd2,
+    0xd1, 0xc4, 0xdc, 0xd4, 0x94, 0x9b, 0x98, 0x98, 0x1f, 0x3e, 0x3d, 0x39, 0x39, 0x3b, 0x73, 0x73,
+    0xe2, 0xc4, 0x89, 0x71, 0x40, 0x20, 0x10, 0xba, 0x00, 0x03, 0x00, 0x00, 0x24, 0x82, 0x00, 0x20,
+    0xc0, 0xc0, 0xa0, 0x30, 0x10, 0x18, 0x1c, 0x1e, 0x0f, 0x0f, 0x8f, 0x8f, 0xcf, 0xcf, 0xef, 0xe7,
+    0xf7, 0xb7, 0x8b, 0xc3, 0x8d, 0x40, 0xc2, 0x0b, 0x2b, 0x5b, 0x0f, 0x35, 0x38, 0x23, 0x18, 0x01,
+    0x00, 0x11, 0x00, 0x80, 0x1d, 0x1b, 0x00, 0x1a, 0x6a, 0x71, 0xbb, 0x91, 0x11, 0x11, 0x1b, 0x11,
+    0x11, 0x0a, 0x2a, 0x2a, 0x6a, 0x6a, 0xea, 0xfb, 0xe0, 0xaa, 0x2a, 0x7b, 0x2a, 0x51, 0x60, 0x00,
+    0x80, 0x40, 0x00, 0x82, 0x80, 0xdd, 0x00, 0x00, 0x04, 0x23, 0x02, 0x42, 0x83, 0x00, 0x08, 0x01,
+    0x01, 0x03, 0x07, 0x0f, 0x1e, 0x1e, 0x3e, 0x7e, 0x82, 0xfe, 0x12, 0xfc, 0xfd, 0xfd, 0xfa, 0xf8,
+    0xf6, 0xe0, 0x88, 0x1a, 0x3a, 0x7b, 0xfe, 0xf5, 0x03, 0x38, 0xe3, 0x50, 0xc0, 0xc0, 0x87, 0x00,
+    0x00, 0x80, 0x84, 0x00, 0x00, 0x80, 0x83, 0x00, 0x09, 0x80, 0x00, 0x00, 0x40, 0x50, 0x58, 0x58,
+    0xa8, 0xc0, 0x00, 0x82, 0xfc, 0x82, 0xf8, 0x83, 0xf0, 0x83, 0xe0, 0x27, 0xc0, 0xc1, 0xc3, 0xc3,
+    0x87, 0x87, 0x8f, 0x8f, 0x1f, 0x1f, 0x3c, 0x30, 0x60, 0x41, 0xb7, 0xc0, 0xc0, 0x62, 0x37, 0x21,
+    0x14, 0x14, 0x1e, 0x9c, 0x9a, 0x99, 0x9a, 0x93, 0xd5, 0xd4, 0xc0, 0xd4, 0xc0, 0x94, 0x94, 0x98,
+    0x98, 0x18, 0x3a, 0x3e, 0x82, 0x3b, 0x06, 0x7b, 0x73, 0x63, 0xe2, 0xc4, 0x89, 0x7d, 0x04, 0x00,
+    0x01, 0x40, 0x23, 0x80, 0xc0, 0xc0, 0xa0, 0xa0, 0x30, 0x18, 0x1c, 0x1e, 0x0e, 0x0f, 0x0f, 0x8f,
+    0xcf, 0xcf, 0xef, 0xe7, 0xe7, 0x77, 0xb7, 0xcb, 0xe9, 0x88, 0x92, 0x2b, 0x2b, 0x0b, 0x2b, 0x1d,
+    0x32, 0x09, 0x08, 0x00, 0x01, 0x03, 0x01, 0x97, 0x00, 0x02, 0x03, 0x03, 0x00, 0x11, 0x00, 0x21,
+    0x1a, 0x19, 0x39, 0x31, 0x7f, 0xbf, 0x9b, 0x91, 0x11, 0x1b, 0x1b, 0x11, 0x0c, 0x0a, 0x22, 0x2a,
+    0x6e, 0x6a, 0xf3, 0xf1, 0xc8, 0xaa, 0x79, 0xea, 0x20, 0x31, 0x80, 0x80, 0x82, 0x00, 0x02, 0x80,
+    0x80, 0x00, 0x22, 0x07, 0x3c, 0x07, 0x03, 0x07, 0x07, 0x0f, 0x1e, 0x3e, 0x7e, 0x7e, 0x82, 0xfe,
+    0x12, 0xfc, 0xfd, 0xfd, 0xfa, 0xfa, 0xf5, 0xcb, 0x18, 0x1a, 0x7b, 0xfb, 0xf6, 0xf9, 0x13, 0xe2,
+    0xe0, 0x10, 0x90, 0xd0, 0x84, 0x00, 0x03, 0x80, 0x00, 0x00, 0x80, 0x84, 0x00, 0x00, 0x80, 0x83,
+    0x00, 0x03, 0x80, 0x00, 0x00, 0x60, 0x33, 0x01, 0x45, 0x82, 0xfc, 0x82, 0xf8, 0x83, 0xf0, 0x83,
+    0xe0, 0x18, 0xc0, 0xc1, 0xc1, 0xc3, 0x87, 0x87, 0x8f, 0x8f, 0x1f, 0x1f, 0x3f, 0x38, 0x60, 0x40,
+    0x41, 0xbd, 0x88, 0x53, 0x5c, 0x00, 0x23, 0x16, 0x16, 0x1c, 0x9c, 0x82, 0x9a, 0x05, 0x97, 0x95,
+    0x89, 0xd8, 0x90, 0x88, 0x82, 0x94, 0x10, 0xb8, 0x3a, 0x38, 0x3a, 0x3b, 0x3b, 0x7b, 0x73, 0x73,
+    0xe3, 0xc6, 0xc4, 0x89, 0x7c, 0x4a, 0xe0, 0x20, 0x04, 0x00, 0x01, 0x3f, 0x20, 0x40, 0xc0, 0xa0,
+    0xa0, 0xb0, 0x18, 0x18, 0x1c, 0x0e, 0x0f, 0x0f, 0x8f, 0x8f, 0xcf, 0xcf, 0xe7, 0xe7, 0x77, 0xb7,
+    0x8b, 0xc3, 0x99, 0x4a, 0x12, 0x2b, 0x0b, 0x2b, 0x0d, 0x15, 0x38, 0x38, 0x08, 0x03, 0x82, 0x01,
+    0x97, 0x00, 0x01, 0x03, 0x02, 0x11, 0x00, 0x80, 0x1e, 0x13, 0x38, 0x71, 0x7d, 0x9f, 0x93, 0x15,
+    0x10, 0x1e, 0x10, 0x1e, 0x08, 0x20, 0x20, 0x68, 0x6a, 0xe9, 0xfa, 0xe0, 0xca, 0x21, 0x79, 0x08,
+    0x70, 0x40, 0x00, 0xc0, 0x40, 0x00, 0x80, 0x80, 0xe0, 0x00, 0x22, 0x05, 0x40, 0x08, 0x01, 0x01,
+    0x03, 0x07, 0x0f, 0x1e, 0x1e, 0x3e, 0x7e, 0x82, 0xfe, 0x13, 0xfc, 0xfd, 0xfd, 0xfb, 0xf8, 0xf5,
+    0xe0, 0x89, 0x1a, 0x3a, 0x7b, 0xfe, 0xf7, 0xe3, 0x10, 0xe3, 0xf0, 0xb0, 0x98, 0x10, 0x84, 0x00,
+    0x03, 0x80, 0x80, 0x00, 0x80, 0x84, 0x00, 0x00, 0x80, 0x83, 0x00, 0x07, 0x80, 0x00, 0x00, 0x60,
+    0x40, 0x58, 0x58, 0xa0, 0x33, 0x00, 0x44, 0x82, 0xfc, 0x82, 0xf8, 0x83, 0xf0, 0x83, 0xe0, 0x19,
+    0xc0, 0xc0, 0xc1, 0xc3, 0x83, 0x87, 0x87, 0x8f, 0x1f, 0x1f, 0x3f, 0x3e, 0x30, 0x60, 0x40, 0xa3,
+    0x84, 0x60, 0x55, 0x1c, 0x0a, 0x21, 0x14, 0x16, 0x1e, 0x1a, 0x82, 0x9e, 0x08, 0x95, 0x93, 0x81,
+    0x81, 0x90, 0x8a, 0x94, 0xb5, 0xb4, 0x82, 0x38, 0x0c, 0x3a, 0x3b, 0x3b, 0x7b, 0x73, 0x73, 0xe3,
+    0xc6, 0x84, 0x09, 0x78, 0x42, 0xa0, 0x04, 0x00, 0x00, 0x3e, 0x21, 0x40, 0xc0, 0x80, 0xa0, 0xb0,
+    0x10, 0x18, 0x1c, 0x0e, 0x0f, 0x0f, 0x8f, 0x8f, 0xcf, 0xc7, 0xe7, 0xe7, 0xf7, 0xf7, 0xbb, 0xcb,
+    0xed, 0x10, 0xc2, 0x9b, 0x0b, 0x2b, 0x0d, 0x0d, 0x32, 0x2f, 0x24, 0x02, 0x01, 0x99, 0x00, 0x01,
+    0x01, 0x00, 0x11, 0x00, 0x20, 0x1c, 0x22, 0x69, 0x7d, 0x97, 0x97, 0x91, 0x10, 0x1e, 0x1a, 0x13,
+    0x1c, 0x0c, 0x20, 0x2c, 0x6c, 0x6d, 0xe3, 0xe0, 0xc1, 0xa3, 0x61, 0xe8, 0x28, 0x50, 0xa0, 0x80,
+    0xc0, 0x40, 0x00, 0x82, 0x80, 0x22, 0x06, 0x3b, 0x07, 0x03, 0x07, 0x0f, 0x0f, 0x1e, 0x3e, 0x7e,
+    0x7e, 0x82, 0xfe, 0x12, 0xfc, 0xfd, 0xfd, 0xfa, 0xfa, 0xf5, 0xca, 0x08, 0x1a, 0x3b, 0xfb, 0xf6,
+    0xf5, 0x03, 0x30, 0xe1, 0x58, 0xc0, 0x40, 0x85, 0x00, 0x00, 0x80, 0x8d, 0x00, 0x01, 0x80, 0x20,
+    0x33, 0x02, 0x44, 0x82, 0xf8, 0x83, 0xf0, 0x83, 0xe0, 0x36, 0xc0, 0xc0, 0xc1, 0xc1, 0x83, 0x87,
+    0x87, 0x8f, 0x0f, 0x1f, 0x1f, 0x3f, 0x3c, 0x70, 0x40, 0x81, 0xff, 0x6c, 0x2e, 0x00, 0x0d, 0x28,
+    0x22, 0x34, 0x16, 0x18, 0x1a, 0x9f, 0x9f, 0x96, 0x95, 0x82, 0x83, 0xb5, 0xb0, 0xa8, 0xa4, 0xb5,
+    0x35, 0x38, 0x38, 0x39, 0x3a, 0x3b, 0x7b, 0x7b, 0x73, 0x73, 0xe2, 0xc6, 0x84, 0x0b, 0x74, 0x42,
+    0x30, 0x04, 0x00, 0x01, 0x40, 0x1f, 0x80, 0xa0, 0xb0, 0x90, 0x18, 0x1c, 0x0e, 0x0f, 0x0f, 0x8f,
+    0x8f, 0xcf, 0xc7, 0xe7, 0xe7, 0xf7, 0x77, 0xbb, 0xcb, 0xc5, 0xe5, 0x72, 0x82, 0x1b, 0x1b, 0x39,
+    0x0d, 0x25, 0x28, 0x3e, 0x0c, 0x0b, 0x82, 0x01, 0x9a, 0x00, 0x00, 0x01, 0x11, 0x00, 0x20, 0x1f,
+    0x30, 0x75, 0x75, 0x93, 0x93, 0x14, 0x12, 0x18, 0x09, 0x1f, 0x0c, 0x24, 0x24, 0x68, 0x6d, 0xef,
+    0xf2, 0xe8, 0xcb, 0x29, 0x73, 0x49, 0xe0, 0x70, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x80, 0x80, 0x00,
+    0x22, 0x04, 0x3f, 0x08, 0x01, 0x03, 0x03, 0x07, 0x0f, 0x1e, 0x3e, 0x3e, 0x7e, 0x82, 0xfe, 0x13,
+    0xfc, 0xfd, 0xfd, 0xf9, 0xf8, 0xf4, 0xe0, 0xca, 0x1a, 0x3a, 0x7b, 0xfb, 0xf7, 0xe9, 0x13, 0xe2,
+    0xe0, 0x18, 0x98, 0x50, 0x85, 0x00, 0x02, 0x80, 0x00, 0x80, 0x8b, 0x00, 0x05, 0xc0, 0x00, 0x60,
+    0x40, 0x58, 0xd8, 0x33, 0x01, 0x45, 0x82, 0xf8, 0x83, 0xf0, 0x83, 0xe0, 0x38, 0xc0, 0xc0, 0xc1,
+    0xc1, 0x83, 0x83, 0x87, 0x8f, 0x0f, 0x1f, 0x1f, 0x3f, 0x3e, 0x78, 0x60, 0x40, 0x83, 0x79, 0xe0,
+    0x33, 0x28, 0x35, 0x29, 0x21, 0x34, 0x34, 0x3c, 0x39, 0x3e, 0xb4, 0xb4, 0xb5, 0xaa, 0xb1, 0xa0,
+    0xb8, 0xaa, 0xa4, 0xb7, 0x35, 0x3a, 0x39, 0x39, 0x3a, 0x7b, 0x7b, 0x73, 0x73, 0xe3, 0xe2, 0xc6,
+    0x8c, 0x0b, 0x68, 0xd2, 0x60, 0x30, 0x03, 0x00, 0x00, 0x3e, 0x0c, 0x80, 0xa0, 0xa0, 0x90, 0x98,
+    0x1c, 0x0e, 0x0e, 0x0f, 0x0f, 0x8f, 0x87, 0xc7, 0x82, 0xe7, 0x12, 0x77, 0xf3, 0x9b, 0xc3, 0x61,
+    0x16, 0xc2, 0x83, 0x19, 0x39, 0x3d, 0x0d, 0x26, 0x09, 0x29, 0x01, 0x01, 0x00, 0x01, 0x99, 0x00,
+    0x00, 0x01, 0x11, 0x00, 0x1f, 0x1e, 0x79, 0x71, 0x97, 0x96, 0x96, 0x16, 0x1c, 0x0b, 0x13, 0x18,
+    0x00, 0x22, 0x20, 0x68, 0x6b, 0xe7, 0xee, 0xc0, 0xa1, 0x29, 0x7a, 0x29, 0xc0, 0x60, 0x00, 0xc0,
+    0x40, 0x00, 0x80, 0x80, 0x00, 0x23, 0x00, 0x45, 0x82, 0x00, 0x08, 0x01, 0x01, 0x03, 0x07, 0x0f,
+    0x1f, 0x1e, 0x3e, 0x7e, 0x83, 0xfe, 0x13, 0xfc, 0xfd, 0xfd, 0xfa, 0xfa, 0xf5, 0xea, 0x88, 0x1a,
+    0x3a, 0x7b, 0xf6, 0xf5, 0xeb, 0x14, 0xe3, 0xf0, 0xb0, 0x98, 0x10, 0x85, 0x00, 0x00, 0x80, 0x8d,
+    0x00, 0x07, 0xc0, 0x00, 0x60, 0x40, 0x58, 0xc8, 0xa0, 0x80, 0x83, 0x00, 0x82, 0xf8, 0x83, 0xf0,
+    0x83, 0xe0, 0x82, 0xc0, 0x36, 0xc1, 0x83, 0x83, 0x87, 0x87, 0x0f, 0x0f, 0x1f, 0x3f, 0x3f, 0x3c,
+    0x70, 0x40, 0x81, 0xe3, 0xc8, 0x80, 0x01, 0x24, 0x05, 0x29, 0x20, 0x34, 0x32, 0x38, 0x3b, 0x3e,
+    0xb5, 0xb4, 0xa2, 0xa5, 0xb0, 0xb0, 0xbc, 0xa8, 0xa4, 0x37, 0x34, 0x3c, 0x38, 0x39, 0x3a, 0x7a,
+    0x7b, 0x73, 0x73, 0xe3, 0xe6, 0xc6, 0x8c, 0x1a, 0x61, 0xd2, 0x60, 0x20, 0x04, 0x00, 0x00, 0x3f,
+    0x1f, 0xa0, 0xa0, 0x90, 0x98, 0x9c, 0x0c, 0x0e, 0x0f, 0x0f, 0x8f, 0x87, 0xc7, 0xc7, 0xe7, 0xe7,
+    0x77, 0xf3, 0xbb, 0xcb, 0xe5, 0x74, 0xc6, 0xa1, 0x01, 0x19, 0x3d, 0x2d, 0x07, 0x2a, 0x3f, 0x39,
+    0x0d, 0x9c, 0x00, 0x01, 0x01, 0x01, 0x11, 0x00, 0x1f, 0x16, 0x71, 0x95, 0x93, 0x90, 0x12, 0x10,
+    0x0f, 0x00, 0x1b, 0x1c, 0x22, 0x22, 0x6c, 0x6f, 0xe9, 0xe2, 0xf1, 0xc0, 0x2b, 0x61, 0xf9, 0xe0,
+    0x20, 0x82, 0x80, 0x00, 0x40, 0x83, 0x80, 0x22, 0x04, 0x3f, 0x07, 0x03, 0x07, 0x07, 0x0f, 0x1e,
+    0x3e, 0x7e, 0x7e, 0x82, 0xfe, 0x14, 0xfc, 0xfd, 0xfd, 0xf9, 0xfa, 0xf5, 0xe0, 0xcb, 0x1a, 0x3a,
+    0x7b, 0xfb, 0xf6, 0xf9, 0x1f, 0x20, 0xe1, 0xd8, 0xc8, 0x50, 0x90, 0x93, 0x00, 0x06, 0x80, 0xc0,
+    0x00, 0x60, 0x40, 0x58, 0x88, 0x33, 0x02, 0x46, 0x83, 0xf0, 0x83, 0xe0, 0x82, 0xc0, 0x16, 0xc1,
+    0x81, 0x83, 0x87, 0x87, 0x0f, 0x0f, 0x1f, 0x1f, 0x3f, 0x3f, 0x78, 0x60, 0xc0, 0x81, 0x7f, 0x4c,
+    0x82, 0x03, 0x1c, 0x05, 0x2d, 0x28, 0x82, 0x30, 0x1e, 0x3e, 0x36, 0x35, 0xb4, 0xa2, 0xa9, 0xa3,
+    0xa0, 0xb4, 0xa8, 0x24, 0x37, 0x36, 0x3e, 0x38, 0x39, 0x7a, 0x7a, 0x7b, 0x73, 0xf3, 0xe3, 0xc6,
+    0xc4, 0x8c, 0x12, 0x64, 0xd2, 0x60, 0x20, 0x20, 0x04, 0x00, 0x01, 0x40, 0x20, 0x90, 0x98, 0x98,
+    0x0c, 0x0e, 0x0f, 0x0f, 0x87, 0x87, 0xc7, 0x47, 0x67, 0xe7, 0x77, 0x73, 0x7b, 0x1b, 0xc5, 0x61,
+    0x0a, 0xe8, 0x51, 0x11, 0x3d, 0x1d, 0x0d, 0x06, 0x19, 0x3e, 0x04, 0x08, 0x00, 0x01, 0x9a, 0x00,
+    0x02, 0x01, 0x01, 0x00, 0x11, 0x00, 0x1f, 0x1a, 0x5d, 0x97, 0x90, 0x94, 0x14, 0x0c, 0x02, 0x0d,
+    0x1f, 0x14, 0x24, 0x24, 0x6f, 0x6d, 0xed, 0xfb, 0xe1, 0xa1, 0x29, 0x7a, 0x08, 0xe0, 0xc0, 0x00,
+    0xc0, 0x40, 0x00, 0x82, 0x80, 0x00, 0x00, 0x22, 0x02, 0x39, 0x08, 0x01, 0x01, 0x03, 0x07, 0x0f,
+    0x1e, 0x3e, 0x3e, 0x7e, 0x83, 0xfe, 0x14, 0xfc, 0xfd, 0xfd, 0xfa, 0xf8, 0xf6, 0xeb, 0x8a, 0x1a,
+    0x3a, 0x7b, 0xfe, 0xf7, 0xe1, 0x13, 0xe2, 0xe0, 0x50, 0x98, 0x80, 0x80, 0x84, 0x00, 0x00, 0x80,
+    0x8c, 0x00, 0x01, 0x80, 0x00, 0x33, 0x01, 0x45, 0x83, 0xf0, 0x83, 0xe0, 0x83, 0xc0, 0x37, 0x81,
+    0x83, 0x83, 0x87, 0x0f, 0x0f, 0x1f, 0x1f, 0x3f, 0x3f, 0x7c, 0x70, 0xc0, 0x81, 0x83, 0xf1, 0x0c,
+    0xa1, 0x68, 0x31, 0x0c, 0x2c, 0x28, 0x30, 0x30, 0x34, 0x36, 0x37, 0x35, 0x26, 0xab, 0xa1, 0x92,
+    0x98, 0xa4, 0x28, 0x24, 0x37, 0x36, 0x36, 0x7f, 0x79, 0x7a, 0x7a, 0x73, 0x73, 0xf3, 0xe6, 0xc6,
+    0xc4, 0x88, 0x12, 0x60, 0x82, 0x60, 0x60, 0x02, 0x01, 0x00, 0x20, 0x1f, 0x90, 0x90, 0x98, 0x8c,
+    0x0e, 0x0f, 0x0f, 0x87, 0x87, 0x47, 0x47, 0x67, 0x67, 0x77, 0x73, 0xfb, 0x3b, 0x49, 0x65, 0x7e,
+    0x4c, 0x09, 0x15, 0x15, 0x1d, 0x2d, 0x06, 0x1a, 0x1d, 0x02, 0x0c, 0x01, 0x82, 0x90, 0x12, 0x16,
+    0x00, 0x0f, 0x09, 0x1f, 0x10, 0x20, 0x26, 0x69, 0x6f, 0xef, 0xe6, 0xf0, 0xc0, 0x2f, 0x69, 0xe9,
+    0x20, 0x00, 0x82, 0x80, 0x03, 0x40, 0x00, 0x80, 0x80, 0x82, 0x00, 0x23, 0x00, 0x43, 0x09, 0x00,
+    0x00, 0x01, 0x03, 0x07, 0x0f, 0x0f, 0x1e, 0x3e, 0x7e, 0x83, 0xfe, 0x14, 0xfc, 0xfd, 0xfd, 0xf9,
+    0xfa, 0xf7, 0xe3, 0xc9, 0x1a, 0x3a, 0x7b, 0xfb, 0xf6, 0xf5, 0xcb, 0x24, 0xe3, 0xf8, 0x30, 0xb8,
+    0xd0, 0x85, 0x00, 0x00, 0x80, 0x8c, 0x00, 0x0b, 0x80, 0x00, 0xc0, 0x80, 0x60, 0x40, 0xd8, 0xa8,
+    0x20, 0x80, 0x00, 0x00, 0x83, 0xf0, 0x83, 0xe0, 0x83, 0xc0, 0x36, 0x81, 0x83, 0x83, 0x87, 0x07,
+    0x0f, 0x1f, 0x1f, 0x3f, 0x3f, 0x7f, 0x78, 0x60, 0xc0, 0x81, 0x67, 0x48, 0xf0, 0xc3, 0x32, 0x51,
+    0x0c, 0x2c, 0x28, 0x3c, 0x30, 0x32, 0x34, 0x36, 0x37, 0x26, 0x23, 0x1f, 0x22, 0x10, 0x04, 0x28,
+    0x2e, 0x37, 0x34, 0x74, 0x7d, 0x79, 0x7a, 0x7a, 0x73, 0xf3, 0xe3, 0xe6, 0xc6, 0x84, 0x08, 0x12,
+    0x60, 0x80, 0x03, 0x01, 0x00, 0x22, 0x1e, 0x90, 0x98, 0x8c, 0x8e, 0x0e, 0x0f, 0x87, 0x87, 0x07,
+    0x47, 0x47, 0x67, 0x77, 0x73, 0xf3, 0x3b, 0x5b, 0x45, 0xe0, 0x00, 0x71, 0x25, 0x15, 0x35, 0x05,
+    0x06, 0x0e, 0x19, 0x1e, 0x18, 0x01, 0x82, 0x00, 0x1a, 0x96, 0x90, 0x16, 0x00, 0x0f, 0x0b, 0x0d,
+    0x1b, 0x14, 0x22, 0x22, 0x6f, 0x6b, 0xea, 0xed, 0xe0, 0x80, 0x29, 0x64, 0x00, 0x70, 0x50, 0x00,
+    0xc0, 0x80, 0x80, 0x00, 0x82, 0x80, 0x83, 0x00, 0x22, 0x01, 0x3d, 0x08, 0x01, 0x03, 0x03, 0x07,
+    0x0f, 0x1e, 0x3e, 0x3e, 0x7e, 0x82, 0xfe, 0x15, 0xfc, 0xfc, 0xfd, 0xfd, 0xfa, 0xf8, 0xf5, 0xea,
+    0x8b, 0x1a, 0x3a, 0x7b, 0xfb, 0xf6, 0xe9, 0x1f, 0x68, 0xe1, 0xd8, 0xc0, 0x30, 0x10, 0x92, 0x00,
+    0x06, 0x80, 0x00, 0x00, 0xc0, 0x80, 0x60, 0x60, 0x33, 0x03, 0x46, 0x82, 0xe0, 0x84, 0xc0, 0x3a,
+    0x81, 0x81, 0x83, 0x87, 0x07, 0x0f, 0x0f, 0x1f, 0x1f, 0x3f, 0x3f, 0x7e, 0x70, 0xc0, 0x80, 0x03,
+    0xff, 0x40, 0x58, 0x83, 0x18, 0x51, 0x4d, 0x2c, 0x2c, 0x3c, 0x34, 0x32, 0x34, 0x37, 0x27, 0x2b,
+    0x25, 0x02, 0x3a, 0x00, 0x04, 0x28, 0x2e, 0x76, 0x76, 0x70, 0x77, 0x7d, 0x7b, 0x72, 0xf3, 0xf3,
+    0xe7, 0xe6, 0xc6, 0x84, 0x09, 0x13, 0x70, 0x80, 0x40, 0x20, 0x60, 0x04, 0x00, 0x00, 0x3f, 0x1f,
+    0x98, 0x8c, 0x8c, 0x8e, 0x07, 0x87, 0x87, 0x07, 0x47, 0x47, 0x67, 0x63, 0x73, 0xf3, 0xfb, 0x3b,
+    0x4d, 0x61, 0x76, 0x48, 0x25, 0x6d, 0x15, 0x05, 0x06, 0x06, 0x0b, 0x1c, 0x04, 0x04, 0x01, 0x01,
+    0x9e, 0x00, 0x11, 0x00, 0x1e, 0x14, 0x94, 0x92, 0x12, 0x03, 0x0f, 0x04, 0x1d, 0x10, 0x36, 0x20,
+    0x61, 0x6d, 0xe9, 0xe0, 0xf1, 0xc1, 0x3d, 0x68, 0xf9, 0x21, 0x10, 0x82, 0x80, 0x05, 0x40, 0x00,
+    0x80, 0x80, 0x00, 0x00, 0x22, 0x00, 0x3e, 0x08, 0x01, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x1e, 0x3e,
+    0x7e, 0x83, 0xfe, 0x15, 0xfc, 0xfd, 0xfd, 0xf9, 0xfa, 0xf6, 0xe2, 0xca, 0x1a, 0x3a, 0x7a, 0xfb,
+    0xf6, 0xf7, 0xe1, 0x02, 0xea, 0xf8, 0x70, 0x98, 0x80, 0x80, 0x92, 0x00, 0x07, 0x80, 0x80, 0x00,
+    0xc0, 0x80, 0xe0, 0xe0, 0xe8, 0x33, 0x02, 0x46, 0x82, 0xe0, 0x83, 0xc0, 0x3c, 0x80, 0x80, 0x81,
+    0x83, 0x83, 0x07, 0x0f, 0x0f, 0x1f, 0x1f, 0x3f, 0x3f, 0x7f, 0x78, 0xe0, 0xc0, 0x81, 0x07, 0x69,
+    0x14, 0x67, 0x9b, 0x64, 0x41, 0x48, 0x28, 0x2c, 0x38, 0x38, 0x32, 0x34, 0x37, 0x2f, 0x2a, 0x08,
+    0x20, 0x00, 0x18, 0x40, 0x6c, 0x6e, 0x74, 0x72, 0x70, 0x75, 0x75, 0x77, 0x72, 0xf3, 0xf7, 0xe6,
+    0xe6, 0xc6, 0x8c, 0x09, 0x13, 0xf0, 0x94, 0xc0, 0x00, 0x20, 0x02, 0x01, 0x00, 0x20, 0x02, 0x8c,
+    0x8c, 0x8e, 0x82, 0x87, 0x35, 0x07, 0x47, 0x47, 0x63, 0x63, 0x73, 0xf3, 0x7b, 0x3b, 0x5d, 0x45,
+    0xe2, 0x0a, 0xb1, 0x61, 0x1d, 0x14, 0x04, 0x06, 0x06, 0x19, 0x14, 0x10, 0x04, 0x00, 0x00, 0x94,
+    0x14, 0x02, 0x0d, 0x00, 0x0f, 0x11, 0x14, 0x36, 0x31, 0x79, 0x79, 0xee, 0xe7, 0xe0, 0x9c, 0x39,
+    0x65, 0x00, 0x70, 0x40, 0x00, 0x80, 0xc0, 0x40, 0x00, 0xc0, 0x80, 0x83, 0x00, 0x23, 0x00, 0x44,
+    0x08, 0x01, 0x03, 0x07, 0x0f, 0x0f, 0x1e, 0x3e, 0x7e, 0x7e, 0x82, 0xfe, 0x15, 0xfc, 0xfc, 0xfd,
+    0xfd, 0xfa, 0xf8, 0xf5, 0xe2, 0x8a, 0x1a, 0x3a, 0x7b, 0xfb, 0xf6, 0xfd, 0xdb, 0x20, 0xe3, 0xd8,
+    0x30, 0xf8, 0xd0, 0x93, 0x00, 0x0a, 0x80, 0x00, 0x00, 0xc0, 0x80, 0xe0, 0xe0, 0xe8, 0xa8, 0x00,
+    0xc0, 0x82, 0x00, 0x83, 0xe0, 0x83, 0xc0, 0x3b, 0x80, 0x80, 0x81, 0x83, 0x03, 0x07, 0x07, 0x0f,
+    0x1f, 0x1f, 0x3f, 0x3f, 0x7f, 0x7e, 0xf0, 0xc0, 0x80, 0x03, 0xef, 0x80, 0xa4, 0x01, 0xda, 0x07,
+    0x45, 0x4c, 0x68, 0x6c, 0x78, 0x78, 0x72, 0x74, 0x6f, 0x6b, 0x6a, 0x50, 0x60, 0x68, 0x58, 0x40,
+    0x6c, 0x69, 0x61, 0x70, 0x70, 0x74, 0x75, 0x77, 0xf6, 0xf6, 0xe7, 0xe6, 0xc6, 0xc6, 0x8c, 0x09,
+    0x12, 0xfa, 0x84, 0xe0, 0x03, 0x01, 0x00, 0x1e, 0x01, 0x8c, 0x8e, 0x82, 0x87, 0x31, 0x07, 0x47,
+    0x47, 0x63, 0x63, 0x73, 0x73, 0xfb, 0x3b, 0x7d, 0x4d, 0xe2, 0x76, 0x47, 0xa1, 0x60, 0x0c, 0x1c,
+    0x1e, 0x06, 0x13, 0x14, 0x07, 0x16, 0x07, 0x92, 0x00, 0x01, 0x08, 0x09, 0x11, 0x13, 0x34, 0x31,
+    0x71, 0x7b, 0xff, 0xe5, 0xfd, 0xd0, 0x38, 0x39, 0xf5, 0x21, 0x30, 0x00, 0x80, 0xc0, 0x00, 0x00,
+    0x83, 0x80, 0x00, 0x00, 0x22, 0x00, 0x3e, 0x07, 0x03, 0x03, 0x07, 0x0f, 0x1e, 0x3e, 0x3e, 0x7e,
+    0x83, 0xfe, 0x14, 0xfc, 0xfd, 0xfd, 0xf9, 0xfa, 0xf6, 0xe1, 0xc8, 0x1a, 0x3a, 0x7a, 0xfb, 0xf6,
+    0xf7, 0xe9, 0x1f, 0x64, 0xe9, 0xd8, 0x80, 0x10, 0x94, 0x00, 0x07, 0x80, 0x00, 0x00, 0x40, 0x80,
+    0xe0, 0xe0, 0xa8, 0x33, 0x03, 0x45, 0x83, 0xc0, 0x3d, 0x80, 0x80, 0x81, 0x81, 0x03, 0x07, 0x07,
+    0x0f, 0x0f, 0x1f, 0x1f, 0x3f, 0x7f, 0x7f, 0x78, 0xe0, 0xc0, 0x81, 0x03, 0xff, 0x58, 0xb0, 0x41,
+    0xb8, 0x17, 0x40, 0x48, 0x6c, 0x68, 0x78, 0x7c, 0x78, 0x7c, 0x6f, 0x6a, 0x46, 0x53, 0x72, 0x48,
+    0x48, 0x40, 0x6c, 0x69, 0x69, 0x70, 0x70, 0x72, 0x75, 0xf7, 0xf6, 0xf6, 0xe6, 0xe6, 0xc6, 0xc4,
+    0x8c, 0x09, 0x12, 0xea, 0x80, 0xc0, 0x80, 0x02, 0x01, 0x00, 0x1e, 0x00, 0x8e, 0x82, 0x87, 0x37,
+    0x07, 0x07, 0x43, 0x63, 0x63, 0x73, 0x73, 0xfb, 0x7b, 0xb9, 0x5d, 0xe4, 0xf2, 0x61, 0x3b, 0x7c,
+    0x00, 0x0c, 0x1e, 0x0e, 0x0f, 0x03, 0x14, 0x1e, 0x02, 0x04, 0x02, 0x03, 0x0f, 0x04, 0x0f, 0x11,
+    0x10, 0x30, 0x33, 0x79, 0x79, 0xfc, 0xe4, 0xf0, 0x9d, 0x3d, 0x6d, 0x51, 0xf0, 0x70, 0x00, 0x80,
+    0xc0, 0x40, 0x00, 0xc0, 0x80, 0x40, 0x00, 0x00, 0x23, 0x01, 0x46, 0x05, 0x07, 0x0f, 0x1f, 0x1e,
+    0x3e, 0x7e, 0x83, 0xfe, 0x16, 0xfc, 0xfc, 0xfd, 0xfd, 0xfa, 0xf8, 0xf7, 0xe2, 0x8b, 0x1a, 0x3a,
+    0x7b, 0xfb, 0xf6, 0xf5, 0xc3, 0x22, 0xe2, 0xd8, 0x38, 0x90, 0xe0, 0x80, 0x93, 0x00, 0x0a, 0x80,
+    0x00, 0x00, 0x40, 0x80, 0xe0, 0xe0, 0xa8, 0xa8, 0x10, 0xc0, 0x84, 0x00, 0x00, 0xe0, 0x83, 0xc0,
+    0x82, 0x80, 0x3c, 0x81, 0x03, 0x03, 0x07, 0x0f, 0x0f, 0x1f, 0x1f, 0x3f, 0x3f, 0x7f, 0x7e, 0xf0,
+    0xc0, 0x80, 0x03, 0xc7, 0x09, 0xc8, 0x1f, 0x01, 0xe8, 0x17, 0x57, 0x4c, 0x6c, 0x64, 0x74, 0x7c,
+    0x78, 0x6c, 0x6f, 0x6a, 0x54, 0x43, 0x72, 0x40, 0x48, 0x50, 0x4c, 0x69, 0x6a, 0x74, 0x70, 0x72,
+    0xf5, 0xf7, 0xf6, 0xf6, 0xe6, 0xe6, 0xc6, 0x8c, 0x8c, 0x19, 0x37, 0xda, 0xa0, 0xc0, 0x80, 0x80,
+    0x02, 0x01, 0x00, 0x1e, 0x83, 0x07, 0x37, 0x03, 0x43, 0x43, 0x63, 0x63, 0x73, 0xf3, 0x79, 0xb9,
+    0xdd, 0xcd, 0xe2, 0x32, 0x03, 0x64, 0x18, 0x08, 0x0e, 0x1e, 0x1e, 0x03, 0x04, 0x1e, 0x11, 0x06,
+    0x00, 0x05, 0x01, 0x00, 0x0d, 0x13, 0x13, 0x35, 0x31, 0x71, 0x79, 0xfc, 0xe5, 0xe0, 0xd4, 0x3d,
+    0x38, 0xe5, 0x00, 0x70, 0x10, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0xc0, 0x80, 0x40, 0x00, 0x00, 0x23,
+    0x00, 0x45, 0x06, 0x07, 0x0f, 0x0f, 0x1e, 0x3e, 0x7e, 0x7e, 0x82, 0xfe, 0x16, 0xfc, 0xfc, 0xfd,
+    0xfd, 0xf9, 0xfa, 0xf6, 0xe3, 0xca, 0x1a, 0x3a, 0x7a, 0xfb, 0xf7, 0xf6, 0xe9, 0x1b, 0x25, 0xeb,
+    0xd8, 0x30, 0x30, 0xb0, 0x94, 0x00, 0x0a, 0x80, 0x00, 0x00, 0x40, 0x80, 0xe0, 0xe0, 0xa8, 0xa8,
+    0x10, 0x80, 0x83, 0x00, 0x00, 0xe0, 0x83, 0xc0, 0x82, 0x80, 0x30, 0x81, 0x03, 0x03, 0x07, 0x07,
+    0x0f, 0x1f, 0x1f, 0x3f, 0x3f, 0x7f, 0x7f, 0xfc, 0xe0, 0xc0, 0x01, 0x03, 0xff, 0x18, 0x34, 0x05,
+    0xc8, 0x89, 0x17, 0x57, 0x6c, 0x60, 0x60, 0x7c, 0x7c, 0x68, 0x6d, 0x6a, 0x4a, 0x45, 0x72, 0x02,
+    0x00, 0x4c, 0x58, 0x4c, 0x69, 0x68, 0x74, 0x74, 0xf2, 0xf5, 0xf7, 0xf6, 0x82, 0xe6, 0x08, 0xc6,
+    0x8c, 0x0c, 0x19, 0x27, 0xca, 0xa0, 0x40, 0x00, 0x03, 0x01, 0x01, 0x1d, 0x37, 0x07, 0x87, 0x03,
+    0x43, 0x43, 0x63, 0x63, 0x73, 0xf3, 0xf9, 0x39, 0x7d, 0xdd, 0xe2, 0xf0, 0xb3, 0x32, 0x52, 0x02,
+    0x0a, 0x1e, 0x06, 0x03, 0x17, 0x1c, 0x1e, 0x03, 0x04, 0x0d, 0x08, 0x00, 0x10, 0x11, 0x31, 0x30,
+    0x75, 0x79, 0xfd, 0xe0, 0xf0, 0xdd, 0x38, 0x78, 0x68, 0x60, 0x50, 0x00, 0x80, 0xc0, 0x00, 0x00,
+    0xc0, 0x80, 0xc0, 0x00, 0x00, 0x22, 0x02, 0x3c, 0x03, 0x1f, 0x3e, 0x3e, 0x7e, 0x83, 0xfe, 0x16,
+    0xfc, 0xfc, 0xfd, 0xfd, 0xfa, 0xf8, 0xf6, 0xe8, 0x89, 0x1a, 0x3a, 0x7a, 0xfb, 0xf6, 0xf7, 0xe1,
+    0x03, 0xe2, 0xdb, 0xd0, 0xc0, 0x10, 0x80, 0x97, 0x00, 0x02, 0x40, 0x80, 0xa0, 0x33, 0x00, 0x46,
+    0x83, 0xc0, 0x82, 0x80, 0x3e, 0x81, 0x01, 0x03, 0x07, 0x07, 0x0f, 0x0f, 0x1f, 0x3f, 0x3f, 0x7f,
+    0x7f, 0xfe, 0xf0, 0xc0, 0x80, 0x01, 0x07, 0xe3, 0x18, 0xb0, 0x51, 0x3a, 0x8d, 0x12, 0x50, 0x68,
+    0x64, 0x60, 0x64, 0x6c, 0x68, 0x68, 0x6a, 0x56, 0x53, 0x00, 0x40, 0x20, 0x4c, 0x5c, 0x4c, 0x6b,
+    0x68, 0xf8, 0xf0, 0xf3, 0xf4, 0xf7, 0xf6, 0xe6, 0xe6, 0xc6, 0xc6, 0x8c, 0x08, 0x11, 0x27, 0xc0,
+    0xa0, 0x40, 0x00, 0x00, 0x02, 0x01, 0x00, 0x1d, 0x1b, 0x07, 0x87, 0x83, 0x43, 0x43, 0x63, 0x63,
+    0x73, 0xf3, 0xf9, 0x39, 0x7d, 0x5d, 0xe6, 0xe2, 0x3b, 0x04, 0x7c, 0x1e, 0x02, 0x1a, 0x1a, 0x1b,
+    0x0b, 0x1d, 0x0e, 0x02, 0x06, 0x82, 0x00, 0x1a, 0x01, 0x10, 0x14, 0x34, 0x30, 0x76, 0x7d, 0xf9,
+    0xf5, 0xe0, 0xd9, 0x3d, 0x39, 0xe0, 0x00, 0x70, 0x80, 0x00, 0xc0, 0xc0, 0x40, 0x80, 0x40, 0x80,
+    0x40, 0x00, 0x00, 0x23, 0x00, 0x43, 0x04, 0x0f, 0x1f, 0x1e, 0x3e, 0x7e, 0x83, 0xfe, 0x16, 0xfc,
+    0xfc, 0xfd, 0xfd, 0xfb, 0xfa, 0xf6, 0xe1, 0xcb, 0x1b, 0x3a, 0x3a, 0xfb, 0xf7, 0xf6, 0xed, 0xd3,
+    0x22, 0xe6, 0xd8, 0x30, 0x90, 0x80, 0x98, 0x00, 0x0b, 0x40, 0x80, 0xa0, 0xa0, 0xa8, 0xa0, 0x50,
+    0x80, 0x00, 0x00, 0xc0, 0xc0, 0x84, 0x80, 0x3b, 0x01, 0x03, 0x03, 0x07, 0x0f, 0x0f, 0x1f, 0x1f,
+    0x3f, 0x3f, 0x7f, 0x7f, 0xfc, 0xe0, 0x80, 0x01, 0x03, 0xcf, 0x00, 0xf0, 0x83, 0x95, 0xc2, 0x89,
+    0x19, 0x50, 0x74, 0x64, 0x60, 0x62, 0x6c, 0x68, 0x68, 0x4a, 0x54, 0x03, 0x04, 0x40, 0x30, 0x18,
+    0x5c, 0x4e, 0xef, 0xec, 0xec, 0xf2, 0xf2, 0xf4, 0xf4, 0xe7, 0xe6, 0xe6, 0xc6, 0xce, 0x8c, 0x09,
+    0x11, 0x27, 0xc0, 0x80, 0x03, 0x01, 0x00, 0x1c, 0x33, 0x03, 0x83, 0x43, 0x43, 0x63, 0x63, 0x73,
+    0xf1, 0xf9, 0xb9, 0xbd, 0x3d, 0xce, 0xe2, 0xb1, 0xb1, 0x78, 0x42, 0x0a, 0x02, 0x1a, 0x13, 0x03,
+    0x07, 0x0c, 0x0f, 0x08, 0x01, 0x05, 0x05, 0x06, 0x14, 0x15, 0x34, 0x34, 0x74, 0x7d, 0xfd, 0xe9,
+    0xf8, 0x9d, 0x39, 0x7c, 0x7c, 0x60, 0x10, 0x00, 0x80, 0x80, 0x00, 0x00, 0x80, 0x82, 0xc0, 0x00,
+    0x00, 0x22, 0x01, 0x3d, 0x02, 0x1e, 0x3e, 0x7e, 0x84, 0xfe, 0x16, 0xfc, 0xfc, 0xfd, 0xfd, 0xfa,
+    0xf0, 0xf6, 0xe8, 0x89, 0x1a, 0x3a, 0x7a, 0xf3, 0xf6, 0xf7, 0xe9, 0x07, 0x64, 0xfb, 0xd8, 0x60,
+    0x30, 0xa0, 0x97, 0x00, 0x04, 0x80, 0x00, 0x80, 0xa0, 0xb0, 0x33, 0x01, 0x46, 0x83, 0x80, 0x40,
+    0x00, 0x01, 0x03, 0x03, 0x07, 0x0f, 0x0f, 0x1f, 0x1f, 0x3f, 0x3f, 0x7f, 0x7f, 0xfe, 0xf0, 0xc0,
+    0x80, 0x01, 0x07, 0xff, 0x88, 0x00, 0x0b, 0x69, 0x23, 0x9b, 0xda, 0x50, 0x70, 0x64, 0x60, 0x66,
+    0x6c, 0x6a, 0x49, 0x5e, 0x44, 0x2e, 0x66, 0x58, 0x80, 0x98, 0xdc, 0xce, 0xee, 0xe8, 0xec, 0xfe,
+    0xf2, 0xf4, 0xf4, 0xe7, 0xe6, 0xe6, 0xc6, 0x8c, 0x8c, 0x19, 0x11, 0x25, 0xd0, 0x00, 0x40, 0x40,
+    0x80, 0x02, 0x01, 0x01, 0x1c, 0x35, 0xc3, 0x43, 0x63, 0x23, 0x31, 0xb1, 0xb9, 0xb9, 0x3d, 0x3d,
+    0x1c, 0xa6, 0xb0, 0x7a, 0xa5, 0x70, 0x14, 0x0e, 0x02, 0x03, 0x1b, 0x07, 0x0d, 0x0e, 0x03, 0x03,
+    0x02, 0x07, 0x14, 0x15, 0x35, 0x34, 0x76, 0x7f, 0xf9, 0xf4, 0xe1, 0xdc, 0x3c, 0x38, 0xe5, 0x00,
+    0x70, 0x50, 0x00, 0xc0, 0xc0, 0x40, 0x00, 0x40, 0xc0, 0xc0, 0x00, 0x00, 0x23, 0x00, 0x45, 0x03,
+    0x1f, 0x3e, 0x7e, 0x7e, 0x83, 0xfe, 0x17, 0xfc, 0xfc, 0xfd, 0xfd, 0xfb, 0xfa, 0xf6, 0xe1, 0xcb,
+    0x1b, 0x3a, 0x7a, 0xfb, 0xf7, 0xf6, 0xed, 0xc3, 0x2a, 0xe2, 0xd8, 0xf8, 0xd0, 0x30, 0x20, 0x97,
+    0x00, 0x08, 0x80, 0x00, 0x80, 0xa0, 0xb0, 0xa0, 0x20, 0x50, 0x80, 0x83, 0x00, 0x83, 0x80, 0x40,
+    0x00, 0x01, 0x01, 0x03, 0x07, 0x07, 0x0f, 0x1f, 0x1f, 0x3f, 0x3f, 0x7f, 0x7f, 0xff, 0xfc, 0xe0,
+    0x80, 0x01, 0x03, 0x8f, 0x01, 0xa8, 0xf7, 0xb1, 0x30, 0x23, 0x9a, 0xd0, 0xd8, 0xf8, 0xf0, 0xe8,
+    0xe0, 0xe8, 0xea, 0xcd, 0xd4, 0x8e, 0x86, 0xc4, 0xc0, 0x80, 0x98, 0xd4, 0xde, 0xec, 0xe8, 0xe8,
+    0xea, 0xf3, 0xf4, 0xe4, 0xe7, 0xe6, 0xc6, 0xce, 0x8c, 0x8c, 0x19, 0x11, 0x25, 0xe2, 0x04, 0x00,
+    0x00, 0x03, 0x01, 0x00, 0x1c, 0x37, 0xc3, 0x43, 0x03, 0x21, 0x31, 0xb1, 0xb9, 0xb9, 0x39, 0x3d,
+    0x9c, 0xae, 0xa2, 0x31, 0x98, 0x35, 0x28, 0x38, 0x0e, 0x07, 0x0f, 0x03, 0x01, 0x0a, 0x0b, 0x08,
+    0x01, 0x00, 0x07, 0x04, 0x14, 0x10, 0x36, 0x74, 0x77, 0x7c, 0xff, 0xe1, 0xf0, 0x95, 0x38, 0x7d,
+    0x78, 0x20, 0x18, 0x10, 0x80, 0x80, 0x40, 0x00, 0x80, 0x40, 0xc0, 0x40, 0x00, 0x00, 0x22, 0x00,
+    0x3b, 0x02, 0x3e, 0x3e, 0x7e, 0x83, 0xfe, 0x82, 0xfc, 0x14, 0xfd, 0xf9, 0xfa, 0xf0, 0xf2, 0xe8,
+    0x8b, 0x1a, 0x3a, 0x7a, 0xf3, 0xf7, 0xf6, 0xe9, 0x0b, 0x21, 0xf7, 0xd8, 0x30, 0x10, 0x90, 0x98,
+    0x00, 0x02, 0x80, 0x00, 0xe0, 0x33, 0x03, 0x46, 0x42, 0x00, 0x01, 0x01, 0x03, 0x07, 0x07, 0x0f,
+    0x0f, 0x1f, 0x3f, 0x3f, 0x7f, 0x7f, 0xff, 0xfe, 0xf0, 0xc0, 0x80, 0x01, 0x07, 0xff, 0x10, 0x58,
+    0x67, 0x41, 0xc2, 0x25, 0x99, 0xd9, 0xd8, 0xf8, 0xf0, 0xec, 0xe0, 0xee, 0xcf, 0xdc, 0xd4, 0xb2,
+    0xc4, 0x90, 0xc8, 0xa0, 0x90, 0xd0, 0xde, 0xec, 0xe0, 0xe0, 0xea, 0xeb, 0xe4, 0xe5, 0xe7, 0xe6,
+    0xce, 0xce, 0x8c, 0x0c, 0x19, 0x10, 0x25, 0xf0, 0x2c, 0x40, 0x00, 0xc0, 0x02, 0x01, 0x00, 0x1b,
+    0x11, 0xc3, 0x03, 0x21, 0x21, 0x31, 0xb1, 0xb9, 0xb9, 0x7c, 0x5c, 0x1e, 0xa6, 0xb1, 0xb9, 0xa5,
+    0x13, 0x04, 0x0c, 0x82, 0x0f, 0x20, 0x07, 0x01, 0x0a, 0x07, 0x0b, 0x02, 0x05, 0x16, 0x13, 0x31,
+    0x36, 0x77, 0x75, 0xfa, 0xf5, 0xe0, 0xd4, 0x11, 0x3c, 0xf4, 0x04, 0x68, 0x50, 0x00, 0x80, 0xc0,
+    0x00, 0x00, 0x40, 0xc0, 0xc0, 0x00, 0x00, 0x23, 0x01, 0x44, 0x00, 0x7e, 0x84, 0xfe, 0x17, 0xfc,
+    0xfc, 0xfd, 0xfd, 0xfb, 0xfa, 0xf6, 0xe1, 0xc9, 0x1b, 0x3a, 0x7a, 0xfb, 0xf7, 0xf6, 0xed, 0xc1,
+    0x0f, 0xe2, 0xd1, 0xd0, 0x60, 0x30, 0xa0, 0x98, 0x00, 0x07, 0x80, 0x00, 0xe0, 0xa0, 0xb0, 0xa0,
+    0x20, 0x50, 0x83, 0x00, 0x42, 0x80, 0x00, 0x00, 0x01, 0x03, 0x03, 0x07, 0x0f, 0x0f, 0x1f, 0x1f,
+    0x3f, 0x7f, 0x7f, 0xff, 0xff, 0xfc, 0xe0, 0x80, 0x01, 0x03, 0x0f, 0xc3, 0x20, 0x00, 0x07, 0x25,
+    0x02, 0x25, 0x91, 0xd1, 0xdc, 0xf0, 0xe0, 0xf4, 0xf8, 0xf8, 0xdf, 0xd4, 0x86, 0x82, 0xe2, 0xc0,
+    0xe0, 0xa0, 0x98, 0xd0, 0xd6, 0xc2, 0xe0, 0xe8, 0xee, 0xeb, 0xed, 0xec, 0xef, 0xee, 0xce, 0xce,
+    0x8c, 0x0d, 0x19, 0x32, 0x65, 0xd0, 0x00, 0x00, 0x03, 0x01, 0x00, 0x1a, 0x11, 0x81, 0x21, 0x21,
+    0x31, 0xb1, 0xb9, 0xb9, 0x7c, 0x3c, 0x1e, 0x26, 0xb1, 0x78, 0x98, 0x70, 0x71, 0x20, 0x0d, 0x82,
+    0x0f, 0x1e, 0x01, 0x02, 0x03, 0x09, 0x01, 0x04, 0x11, 0x32, 0x34, 0x77, 0x75, 0xfc, 0xfc, 0xe0,
+    0xf0, 0x90, 0x38, 0x7d, 0x60, 0x20, 0x38, 0x10, 0x80, 0x80, 0xc0, 0xc0, 0x00, 0x40, 0xc0, 0x40,
+    0x00, 0x22, 0x00, 0x3a, 0x01, 0x7e, 0x7e, 0x83, 0xfe, 0x82, 0xfc, 0x15, 0xfd, 0xf9, 0xfa, 0xf0,
+    0xf2, 0xe8, 0x8b, 0x1a, 0x3a, 0x7a, 0xf3, 0xf7, 0xf6, 0xed, 0xd3, 0x22, 0xfa, 0xd8, 0xb8, 0x90,
+    0xa0, 0xa0, 0x98, 0x00, 0x01, 0x80, 0x40, 0x33, 0x00, 0x46, 0x82, 0x00, 0x42, 0x01, 0x03, 0x03,
+    0x07, 0x0f, 0x0f, 0x1f, 0x1f, 0x3f, 0x3f, 0x7f, 0x7f, 0xff, 0xfe, 0xf0, 0xc0, 0x00, 0x01, 0x07,
+    0xdf, 0x31, 0x98, 0x7f, 0xa1, 0x84, 0x2b, 0xa2, 0x90, 0xd8, 0xd8, 0xe0, 0xe0, 0xf4, 0xf8, 0xda,
+    0xdf, 0x96, 0x8e, 0xb4, 0x20, 0x10, 0xf0, 0xa8, 0x98, 0xd0, 0xd4, 0xd0, 0xe0, 0xe0, 0xee, 0xeb,
+    0xef, 0xec, 0xef, 0xcf, 0xce, 0x8c, 0x8c, 0x19, 0x19, 0x32, 0x67, 0xb0, 0x60, 0x00, 0x00, 0x80,
+    0x03, 0x01, 0x00, 0x1b, 0x35, 0x21, 0x21, 0x31, 0xb1, 0xb9, 0xb9, 0x7c, 0xbc, 0x1e, 0x2e, 0xa3,
+    0x71, 0xbd, 0xa0, 0x5b, 0x23, 0x01, 0x05, 0x0f, 0x03, 0x01, 0x0b, 0x02, 0x0f, 0x0e, 0x03, 0x00,
+    0x13, 0x10, 0x31, 0x37, 0x77, 0x74, 0xfb, 0xf4, 0xe0, 0xd4, 0x11, 0x38, 0xf4, 0x14, 0x68, 0x30,
+    0x00, 0x80, 0xc0, 0x00, 0x00, 0x40, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0x22, 0x01, 0x3f, 0x83, 0xfe,
+    0x82, 0xfc, 0x15, 0xfd, 0xfd, 0xfb, 0xfa, 0xf6, 0xe1, 0xc9, 0x1b, 0x3a, 0x7a, 0xf3, 0xf7, 0xf6,
+    0xef, 0xe1, 0x17, 0x60, 0xd7, 0xd0, 0x60, 0x10, 0x80, 0x99, 0x00, 0x06, 0x80, 0x00, 0xe0, 0xa0,
+    0xb0, 0xa0, 0x30, 0x33, 0x02, 0x47, 0x44, 0x01, 0x01, 0x03, 0x07, 0x07, 0x0f, 0x1f, 0x1f, 0x3f,
+    0x3f, 0x7f, 0x7f, 0xff, 0xff, 0xfc, 0xe0, 0x80, 0x01, 0x03, 0x0f, 0xef, 0x30, 0x38, 0x83, 0xc5,
+    0x52, 0x2f, 0xa9, 0x99, 0xd8, 0xc0, 0xd0, 0xec, 0xf4, 0xd8, 0xde, 0xd6, 0x96, 0xa8, 0x44, 0x44,
+    0x30, 0x50, 0xa0, 0x90, 0x90, 0xd0, 0xd0, 0xe8, 0xe0, 0xe6, 0xeb, 0xee, 0xec, 0xed, 0xcf, 0xce,
+    0x8c, 0x8d, 0x19, 0x19, 0x32, 0x47, 0x80, 0x40, 0x00, 0x00, 0x80, 0x80, 0x03, 0x01, 0x00, 0x1a,
+    0x33, 0x21, 0x31, 0xb1, 0xb9, 0xb8, 0xfc, 0xfc, 0xde, 0x3e, 0x27, 0x71, 0xf8, 0x3a, 0x15, 0x71,
+    0x25, 0x05, 0x05, 0x0d, 0x0d, 0x01, 0x0e, 0x07, 0x09, 0x03, 0x01, 0x11, 0x32, 0x35, 0x77, 0x75,
+    0xf7, 0xfa, 0xe0, 0xf0, 0x90, 0x34, 0x7c, 0x64, 0x20, 0x38, 0x10, 0x80, 0x80, 0xc0, 0x40, 0x00,
+    0x40, 0x80, 0xc0, 0x00, 0x00, 0x22, 0x00, 0x3f, 0x84, 0xfe, 0x18, 0xfc, 0xfc, 0xfd, 0xfd, 0xf9,
+    0xfa, 0xf0, 0xe3, 0xc8, 0x8b, 0x1a, 0x3a, 0x7a, 0xf3, 0xf7, 0xf6, 0xed, 0xd3, 0x32, 0xd2, 0xd3,
+    0xb8, 0xb0, 0x20, 0x20, 0x99, 0x00, 0x06, 0x80, 0x00, 0xe0, 0xa0, 0xb0, 0xa0, 0x10, 0x33, 0x03,
+    0x46, 0x34, 0x03, 0x07, 0x07, 0x0f, 0x0f, 0x1f, 0x3f, 0x3f, 0x7f, 0x7f, 0xff, 0xff, 0xfe, 0xf0,
+    0xc0, 0x00, 0x01, 0x07, 0x9f, 0x23, 0x20, 0xd5, 0x23, 0x71, 0x13, 0x27, 0xa9, 0xb9, 0xd0, 0xc8,
+    0xc0, 0xe8, 0xd4, 0xd8, 0xde, 0x96, 0x86, 0x90, 0x4c, 0x54, 0x70, 0x50, 0xa0, 0xb0, 0x90, 0xd2,
+    0xd0, 0xe0, 0xe4, 0xe6, 0xea, 0xee, 0xec, 0x82, 0xcd, 0x0a, 0x8d, 0x0d, 0x19, 0x11, 0x22, 0x4d,
+    0x84, 0x40, 0xc0, 0x00, 0x00, 0x02, 0x01, 0x00, 0x1a, 0x0e, 0x31, 0xb1, 0xb8, 0xb8, 0xfc, 0x7c,
+    0x1e, 0x3e, 0xaf, 0x73, 0xf8, 0x9d, 0x81, 0x38, 0x2a, 0x82, 0x05, 0x21, 0x09, 0x01, 0x03, 0x06,
+    0x07, 0x02, 0x01, 0x00, 0x10, 0x30, 0x34, 0x76, 0x74, 0xf8, 0xf3, 0xe8, 0xd0, 0x36, 0x38, 0xf4,
+    0x14, 0x68, 0x10, 0x00, 0x80, 0xc0, 0x00, 0x00, 0x40, 0x00, 0xc0, 0x40, 0x00, 0x00, 0x23, 0x01,
+    0x41, 0x82, 0xfe, 0x82, 0xfc, 0x16, 0xfd, 0xf9, 0xfb, 0xf0, 0xf6, 0xe1, 0xcb, 0x1b, 0x3a, 0x7a,
+    0xf3, 0xf7, 0xf6, 0xef, 0xe9, 0x1f, 0x71, 0xd3, 0xd0, 0xa0, 0x10, 0x30, 0xa0, 0x99, 0x00, 0x13,
+    0x80, 0x00, 0xe0, 0x80, 0xb0, 0xb0, 0x50, 0x50, 0x00, 0x01, 0x03, 0x03, 0x07, 0x0f, 0x0f, 0x1f,
+    0x3f, 0x3f, 0x7f, 0x7f, 0x82, 0xff, 0x31, 0xfc, 0xe0, 0x80, 0x01, 0x03, 0x0f, 0xff, 0x30, 0xa0,
+    0x87, 0x6b, 0x80, 0x1f, 0x30, 0xa0, 0xb8, 0xc8, 0xd8, 0xc0, 0xd8, 0xd0, 0xd8, 0xd6, 0x94, 0xac,
+    0x24, 0x08, 0x14, 0xd0, 0x50, 0x20, 0xb8, 0x92, 0xd2, 0xd0, 0xd8, 0xe4, 0xe6, 0xea, 0xee, 0xec,
+    0xcd, 0xcd, 0x8d, 0x8d, 0x1d, 0x19, 0x11, 0x22, 0x4f, 0x02, 0x01, 0x00, 0x19, 0x31, 0xb0, 0xb8,
+    0xb8, 0xfc, 0x7c, 0x9e, 0x1e, 0x6e, 0xf3, 0xf1, 0xf8, 0x8a, 0x1e, 0x21, 0x02, 0x05, 0x0d, 0x09,
+    0x09, 0x03, 0x06, 0x07, 0x01, 0x05, 0x00, 0x32, 0x35, 0x77, 0x75, 0xf4, 0xfa, 0xe6, 0xf0, 0x96,
+    0x34, 0x7a, 0x28, 0x20, 0x38, 0x10, 0x80, 0x80, 0xc0, 0x40, 0x00, 0x40, 0x80, 0xc0, 0x40, 0x00,
+    0x23, 0x00, 0x45, 0x82, 0xfe, 0x82, 0xfc, 0x15, 0xfd, 0xfd, 0xfb, 0xfa, 0xf4, 0xe3, 0xc8, 0x9b,
+    0x1a, 0x3a, 0x72, 0xf3, 0xf7, 0xf6, 0xed, 0xd3, 0x2f, 0xd6, 0xd5, 0xb8, 0x70, 0x20, 0x9b, 0x00,
+    0x07, 0x80, 0x00, 0xe0, 0x80, 0xb0, 0x30, 0x50, 0x40, 0x84, 0x00, 0x0a, 0x01, 0x03, 0x03, 0x07,
+    0x0f, 0x0f, 0x1f, 0x1f, 0x3f, 0x7f, 0x7f, 0x82, 0xff, 0x36, 0xfe, 0xf0, 0xc0, 0x00, 0x03, 0x07,
+    0x1f, 0x83, 0x70, 0x48, 0x53, 0xc1, 0x42, 0x17, 0x37, 0xa1, 0xa8, 0xe8, 0xc0, 0xc8, 0xd8, 0xd0,
+    0xd0, 0x94, 0xb4, 0x28, 0x66, 0xc8, 0x70, 0x30, 0x58, 0x20, 0xbc, 0x9e, 0xd6, 0xd8, 0xd8, 0xe4,
+    0xe6, 0xea, 0xee, 0xcc, 0xcc, 0xcd, 0x8d, 0x8d, 0x1d, 0x19, 0x31, 0x22, 0x4f, 0x84, 0x00, 0x80,
+    0x80, 0x03, 0x01, 0x00, 0x19, 0x31, 0xb8, 0xb8, 0xfc, 0x7c, 0x9e, 0x5e, 0x6e, 0xe7, 0xf1, 0x78,
+    0xbf, 0x10, 0x38, 0x0a, 0x06, 0x07, 0x03, 0x0f, 0x01, 0x00, 0x05, 0x05, 0x04, 0x01, 0x01, 0x30,
+    0x75, 0x77, 0x75, 0xfa, 0xfa, 0xe0, 0xd0, 0x36, 0x36, 0xf4, 0x14, 0x20, 0x10, 0x00, 0x80, 0xc0,
+    0x40, 0x00, 0x40, 0x00, 0x80, 0x40, 0x00, 0x00, 0x22, 0x07, 0x40, 0x15, 0xf9, 0xfb, 0xf0, 0xf6,
+    0xe9, 0xc9, 0x19, 0x3a, 0x72, 0xf3, 0xf7, 0xf6, 0xee, 0xe9, 0x83, 0x62, 0xd2, 0xd8, 0xa8, 0x80,
+    0x60, 0xa0, 0x9a, 0x00, 0x07, 0x80, 0x00, 0xe0, 0xc0, 0xb0, 0x30, 0x50, 0x00, 0x33, 0x02, 0x46,
+    0x08, 0x07, 0x07, 0x0f, 0x1f, 0x1f, 0x3f, 0x3f, 0x7f, 0x7f, 0x82, 0xff, 0x37, 0xf8, 0xe0, 0x80,
+    0x01, 0x03, 0x0f, 0xff, 0x21, 0x10, 0x7f, 0x43, 0x35, 0x43, 0x36, 0x33, 0xb8, 0xa0, 0xf0, 0xc0,
+    0xc4, 0xd8, 0xd4, 0xd0, 0xb4, 0xac, 0x0a, 0x1e, 0x8c, 0xb0, 0x70, 0x50, 0x28, 0xb8, 0x9e, 0xd8,
+    0xd8, 0xd0, 0xd8, 0xe6, 0xeb, 0xce, 0xcc, 0xcc, 0xcd, 0x8d, 0x9d, 0x19, 0x19, 0x31, 0x22, 0x4f,
+    0xe0, 0x40, 0x00, 0x80, 0x80, 0x02, 0x01, 0x00, 0x19, 0x00, 0x18, 0x82, 0xdc, 0x2d, 0x1e, 0x9e,
+    0x0f, 0xf3, 0x78, 0x1c, 0x20, 0x3e, 0x34, 0x18, 0x02, 0x07, 0x07, 0x01, 0x03, 0x00, 0x05, 0x03,
+    0x05, 0x00, 0x00, 0x34, 0x74, 0x76, 0xf6, 0xfa, 0xea, 0xd0, 0x94, 0x34, 0x7a, 0x00, 0xf0, 0x10,
+    0x10, 0x80, 0x80, 0xc0, 0x00, 0x00, 0x40, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0x23, 0x00, 0x47, 0x01,
+    0xfe, 0xfe, 0x82, 0xfc, 0x17, 0xfd, 0xf9, 0xfb, 0xfa, 0xf4, 0xe7, 0xc8, 0x9b, 0x1a, 0x32, 0x72,
+    0xf3, 0xf7, 0xf6, 0xed, 0xd3, 0x2f, 0xd0, 0xcf, 0xb0, 0x70, 0x80, 0x20, 0x20, 0x9a, 0x00, 0x08,
+    0x80, 0x00, 0xe0, 0xc0, 0xb0, 0x30, 0x50, 0x00, 0x80, 0x85, 0x00, 0x09, 0x03, 0x07, 0x07, 0x0f,
+    0x1f, 0x1f, 0x3f, 0x3f, 0x7f, 0x7f, 0x82, 0xff, 0x36, 0xfe, 0xf0, 0x80, 0x00, 0x03, 0x07, 0x1f,
+    0x87, 0x50, 0x40, 0x1f, 0xab, 0x84, 0x43, 0x30, 0x30, 0xb0, 0xb0, 0xe0, 0xe0, 0xc4, 0xd8, 0xd0,
+    0xb0, 0xbe, 0x28, 0x56, 0xec, 0x44, 0x00, 0x30, 0x50, 0x20, 0xb8, 0xbe, 0xd8, 0xc8, 0xd4, 0xd8,
+    0xd6, 0xc8, 0xca, 0xcd, 0xcc, 0x8d, 0x9d, 0x1d, 0x19, 0x19, 0x33, 0x62, 0xcb, 0xe0, 0x40, 0x80,
+    0x82, 0x00, 0x02, 0x01, 0x00, 0x18, 0x28, 0x5c, 0x5c, 0xdc, 0x9e, 0xbe, 0x0f, 0xd7, 0x51, 0x58,
+    0x5f, 0x33, 0x28, 0x05, 0x00, 0x02, 0x07, 0x07, 0x01, 0x00, 0x01, 0x05, 0x04, 0x00, 0x01, 0x74,
+    0x74, 0xf6, 0xf2, 0xfe, 0xe0, 0xd6, 0x36, 0x76, 0xf4, 0x14, 0x20, 0x00, 0x00, 0x80, 0xc0, 0x40,
+    0x82, 0x00, 0x03, 0x80, 0x40, 0x00, 0x00, 0x23, 0x01, 0x42, 0x83, 0xfc, 0x16, 0xfd, 0xf9, 0xfa,
+    0xf0, 0xf3, 0xed, 0x88, 0x19, 0x32, 0x72, 0xf2, 0xf7, 0xf6, 0xee, 0xe9, 0x83, 0x22, 0xc2, 0xcb,
+    0xa0, 0xe0, 0x60, 0x80, 0x9b, 0x00, 0x11, 0x80, 0x00, 0xe0, 0xc0, 0xb0, 0x70, 0x50, 0x00, 0x80,
+    0x00, 0x07, 0x0f, 0x0f, 0x1f, 0x3f, 0x3f, 0x7f, 0x7f, 0x83, 0xff, 0x34, 0xf8, 0xc0, 0x00, 0x01,
+    0x03, 0x0f, 0xff, 0x61, 0x30, 0x2f, 0x5b, 0x51, 0x06, 0x42, 0x25, 0x20, 0xb0, 0xb8, 0xc0, 0xf8,
+    0xe0, 0xf0, 0xbc, 0xb8, 0xa8, 0x08, 0x26, 0xc0, 0x00, 0x00, 0x30, 0x40, 0x28, 0xbc, 0xbe, 0x80,
+    0xc0, 0xc4, 0xd8, 0xd6, 0xd8, 0xc8, 0xce, 0xcc, 0x9d, 0x9d, 0x1d, 0x19, 0x39, 0x33, 0x62, 0xcb,
+    0x00, 0x02, 0x01, 0x01, 0x18, 0x2d, 0xdc, 0x9e, 0xde, 0x0f, 0x97, 0x51, 0x58, 0xbc, 0x01, 0x1e,
+    0x15, 0x10, 0x02, 0x02, 0x07, 0x01, 0x00, 0x05, 0x01, 0x07, 0x05, 0x01, 0x00, 0x76, 0xf2, 0xfe,
+    0xe0, 0xd0, 0x14, 0x34, 0x78, 0x00, 0xf0, 0x50, 0x10, 0xc0, 0x80, 0xc0, 0x00, 0x00, 0x40, 0x00,
+    0x80, 0x40, 0x00, 0x00, 0x23, 0x00, 0x43, 0x00, 0xfe, 0x82, 0xfc, 0x17, 0xfd, 0xf9, 0xfb, 0xf2,
+    0xf6, 0xe5, 0xc8, 0x9b, 0x3a, 0x32, 0x72, 0xf3, 0xf7, 0xf6, 0xed, 0xd1, 0x27, 0x41, 0xc3, 0xa0,
+    0x70, 0x80, 0x30, 0x20, 0x9b, 0x00, 0x07, 0x80, 0x00, 0xe0, 0xc0, 0x70, 0x70, 0x50, 0x80, 0x82,
+    0x00, 0x07, 0x07, 0x0f, 0x0f, 0x1f, 0x3f, 0x3f, 0x7f, 0x7f, 0x83, 0xff, 0x36, 0xfc, 0xf0, 0x80,
+    0x01, 0x03, 0x07, 0x1f, 0xcf, 0x60, 0xb0, 0x27, 0x03, 0x2d, 0x47, 0x46, 0x21, 0x20, 0xb8, 0x80,
+    0xc0, 0xf8, 0xe0, 0xb4, 0xbe, 0xba, 0x28, 0x5c, 0x04, 0x04, 0x00, 0xc0, 0x10, 0x60, 0x28, 0xac,
+    0xac, 0x88, 0xc0, 0xd4, 0xd8, 0xd6, 0xd8, 0xd8, 0xdf, 0x9c, 0x9d, 0x9d, 0x1d, 0x19, 0x31, 0x32,
+    0x62, 0xcb, 0x04, 0x98, 0x02, 0x01, 0x01, 0x17, 0x24, 0xde, 0x3e, 0x0f, 0x0f, 0x53, 0x58, 0xbc,
+    0x4f, 0x18, 0x08, 0x08, 0x00, 0x02, 0x06, 0x04, 0x00, 0x01, 0x07, 0x07, 0x04, 0x00, 0x00, 0xf6,
+    0xf2, 0xf0, 0xe2, 0x96, 0x34, 0x74, 0xfc, 0x90, 0x28, 0x40, 0x00, 0x80, 0xc0, 0xc0, 0x82, 0x00,
+    0x03, 0x80, 0xc0, 0x40, 0x00, 0x23, 0x00, 0x43, 0x82, 0xfc, 0x18, 0xfd, 0xf9, 0xfb, 0xfa, 0xf4,
+    0xe5, 0xcc, 0x88, 0x19, 0x32, 0x72, 0xf2, 0xf7, 0xf7, 0xee, 0xe9, 0x93, 0x22, 0xc6, 0xcd, 0xa0,
+    0x70, 0x20, 0x40, 0x20, 0x9b, 0x00, 0x07, 0x80, 0x00, 0x60, 0xc0, 0x70, 0x50, 0x50, 0x80, 0x82,
+    0x00, 0x06, 0x0f, 0x0f, 0x1f, 0x1f, 0x3f, 0x7f, 0x7f, 0x83, 0xff, 0x37, 0xfe, 0xf8, 0xc0, 0x00,
+    0x01, 0x03, 0x0f, 0x3f, 0x63, 0x40, 0x89, 0x07, 0x8b, 0xbc, 0x53, 0x51, 0x63, 0x30, 0x98, 0x80,
+    0xb0, 0xf8, 0xa0, 0xb8, 0xbe, 0x28, 0x28, 0x54, 0xdc, 0x88, 0x00, 0x40, 0x10, 0x70, 0x20, 0x2c,
+    0xa0, 0xa0, 0xd0, 0xd4, 0xd0, 0xd6, 0xd8, 0xda, 0xdf, 0x9c, 0x9d, 0x1d, 0x19, 0x19, 0x31, 0x32,
+    0x64, 0x8b, 0x00, 0x90, 0x03, 0x01, 0x00, 0x16, 0x2b, 0x5e, 0xbe, 0xbf, 0x0f, 0x17, 0xd9, 0x7c,
+    0xde, 0x50, 0x2e, 0x34, 0x13, 0x00, 0x06, 0x04, 0x04, 0x01, 0x07, 0x03, 0x02, 0x05, 0x00, 0xf5,
+    0xf2, 0xfa, 0xe0, 0xd6, 0x14, 0x34, 0x78, 0x00, 0xf8, 0x50, 0x10, 0xc0, 0x80, 0xc0, 0x00, 0x00,
+    0x40, 0x00, 0x80, 0x40, 0x00, 0x22, 0x06, 0x3c, 0x14, 0xf0, 0xf6, 0xec, 0xc8, 0x1b, 0x32, 0x72,
+    0xf2, 0xf3, 0xf7, 0xf6, 0xef, 0xd1, 0x2f, 0x41, 0xc2, 0xa8, 0xb0, 0x00, 0x30, 0x20, 0x9c, 0x00,
+    0x03, 0x80, 0x00, 0x40, 0x40, 0x33, 0x01, 0x44, 0x04, 0x1f, 0x1f, 0x3f, 0x7f, 0x7f, 0x84, 0xff,
+    0x11, 0xfc, 0xe0, 0x80, 0x01, 0x03, 0x07, 0x1f, 0xff, 0x60, 0x10, 0x0f, 0xc3, 0x29, 0xa7, 0x52,
+    0x43, 0x72, 0x70, 0x82, 0x80, 0x23, 0xb8, 0xa0, 0xb0, 0xbe, 0x2c, 0x4c, 0x64, 0x18, 0x08, 0x60,
+    0xa0, 0x50, 0x60, 0x30, 0x20, 0xa0, 0xa0, 0xc0, 0xd0, 0xc0, 0xd6, 0xd8, 0xd8, 0x9f, 0x9c, 0x9d,
+    0x1d, 0x19, 0x39, 0x33, 0x22, 0x44, 0x8f, 0x00, 0x90, 0x00, 0x02, 0x01, 0x00, 0x15, 0x23, 0x3e,
+    0xdf, 0x0f, 0x17, 0x99, 0x78, 0xfc, 0x7c, 0x09, 0x3c, 0x04, 0x03, 0x01, 0x00, 0x04, 0x01, 0x00,
+    0x02, 0x02, 0x01, 0x02, 0xf7, 0xf0, 0xf2, 0xe0, 0x96, 0x3c, 0x72, 0x66, 0xb8, 0x28, 0x40, 0x00,
+    0x80, 0xc0, 0xc0, 0x82, 0x00, 0x02, 0x40, 0xc0, 0x40, 0x23, 0x00, 0x43, 0x1a, 0xfc, 0xfc, 0xfd,
+    0xf9, 0xfb, 0xfa, 0xf4, 0xe4, 0xcd, 0x98, 0x10, 0x32, 0x72, 0xf3, 0xf7, 0xf7, 0xee, 0xed, 0x83,
+    0x27, 0xd6, 0xc5, 0xa0, 0x60, 0x30, 0x20, 0x20, 0x9b, 0x00, 0x04, 0x80, 0x00, 0x00, 0x40, 0x40,
+    0x82, 0x50, 0x00, 0xa0, 0x82, 0x00, 0x04, 0x1f, 0x1f, 0x3f, 0x3f, 0x7f, 0x84, 0xff, 0x38, 0xfe,
+    0xf8, 0xc0, 0x00, 0x01, 0x07, 0x0f, 0x3f, 0x07, 0xa0, 0x80, 0x07, 0xa3, 0x14, 0x3f, 0x6d, 0x40,
+    0x70, 0x40, 0x90, 0x80, 0x90, 0xb0, 0xa0, 0xb4, 0x2e, 0x2c, 0x58, 0xc0, 0x18, 0xa8, 0x20, 0x20,
+    0x70, 0x60, 0x78, 0x20, 0xa4, 0xa0, 0xb0, 0xd8, 0xc8, 0xd6, 0xda, 0x98, 0x9b, 0x9e, 0x1d, 0x19,
+    0x19, 0x39, 0x33, 0x62, 0x44, 0x9f, 0x00, 0x10, 0x03, 0x01, 0x00, 0x15, 0x10, 0x5f, 0x4f, 0x37,
+    0x13, 0x78, 0x3c, 0x4e, 0x41, 0x0d, 0x1c, 0x02, 0x03, 0x05, 0x01, 0x05, 0x01, 0x00, 0x82, 0x02,
+    0x0b, 0x00, 0xf2, 0xfe, 0xe2, 0xde, 0x1e, 0x36, 0xfa, 0x14, 0x78, 0x38, 0x10, 0x82, 0xc0, 0x06,
+    0x00, 0x00, 0x40, 0x40, 0x80, 0x40, 0x00, 0x22, 0x01, 0x1b, 0x19, 0xfd, 0xf9, 0xf9, 0xfb, 0xf0,
+    0xe2, 0xed, 0x8a, 0x11, 0x32, 0x72, 0xf2, 0xf3, 0xf7, 0xf6, 0xef, 0xd1, 0x27, 0x40, 0xc2, 0xa8,
+    0xb0, 0xc0, 0x70, 0x40, 0x00, 0x33, 0x01, 0x43, 0x03, 0x3f, 0x3f, 0x7f, 0x7f, 0x84, 0xff, 0x38,
+    0xfc, 0xe0, 0x00, 0x01, 0x03, 0x07, 0x1f, 0xff, 0x60, 0x00, 0xaf, 0x07, 0xcb, 0x94, 0x2e, 0x6b,
+    0x42, 0x40, 0xd0, 0xd0, 0x90, 0x90, 0xb0, 0xa4, 0x24, 0x2c, 0x48, 0x10, 0x48, 0x80, 0xe8, 0x20,
+    0x20, 0x60, 0x60, 0x78, 0x20, 0xa8, 0xb0, 0xa0, 0x90, 0xc8, 0xd6, 0x9c, 0x98, 0x9b, 0x9e, 0x1d,
+    0x19, 0x39, 0x3b, 0x33, 0x62, 0x44, 0x9b, 0xe8, 0x30, 0x03, 0x01, 0x00, 0x14, 0x21, 0xaf, 0x1f,
+    0x73, 0xb8, 0x3c, 0x4e, 0x14, 0x0c, 0x34, 0x18, 0x01, 0x01, 0x03, 0x03, 0x01, 0x00, 0x00, 0x02,
+    0x01, 0x02, 0xf5, 0xec, 0xce, 0x1e, 0x3e, 0x72, 0x22, 0x38, 0x28, 0x80, 0xc0, 0x80, 0xc0, 0xc0,
+    0x82, 0x00, 0x02, 0x40, 0x80, 0xc0, 0x22, 0x03, 0x3a, 0x16, 0xfb, 0xf2, 0xf4, 0xe7, 0xcc, 0x98,
+    0x32, 0x32, 0x72, 0xf3, 0xf7, 0xf7, 0xee, 0xed, 0x83, 0x0f, 0xc4, 0xc7, 0xa0, 0x60, 0x90, 0x30,
+    0x60, 0x9c, 0x00, 0x02, 0x80, 0x00, 0xc0, 0x33, 0x00, 0x43, 0x03, 0x3f, 0x3f, 0x7f, 0x7f, 0x84,
+    0xff, 0x39, 0xfe, 0xf0, 0x80, 0x00, 0x03, 0x07, 0x0f, 0x3f, 0x07, 0xa0, 0xd0, 0x27, 0x43, 0x01,
+    0xa7, 0x68, 0x62, 0x72, 0x40, 0x70, 0xc0, 0xa0, 0x90, 0xb0, 0xac, 0x24, 0x68, 0x58, 0x30, 0xbc,
+    0x88, 0x20, 0xe0, 0xa0, 0x60, 0x60, 0x78, 0x34, 0xb0, 0xa0, 0xa0, 0xb0, 0x88, 0x96, 0x9c, 0x99,
+    0x9b, 0x9a, 0x1b, 0x19, 0x3b, 0x33, 0x33, 0x62, 0xc4, 0x9a, 0xa8, 0x90, 0x03, 0x01, 0x00, 0x14,
+    0x1d, 0x1f, 0x37, 0x79, 0x7c, 0x6e, 0x4f, 0x08, 0x1c, 0x1c, 0x00, 0x01, 0x03, 0x03, 0x00, 0x00,
+    0x02, 0x00, 0x01, 0x02, 0x00, 0xf8, 0xec, 0x9e, 0x3c, 0x3e, 0xfa, 0x92, 0xb8, 0x38, 0x00, 0x82,
+    0xc0, 0x06, 0x00, 0x00, 0x40, 0x40, 0x80, 0x40, 0x00, 0x22, 0x00, 0x1a, 0x19, 0xfd, 0xf9, 0xfb,
+    0xfa, 0xf4, 0xe3, 0xcd, 0x99, 0x10, 0x32, 0x72, 0xf2, 0xf7, 0xf7, 0xe6, 0xef, 0xd1, 0x27, 0x4a,
+    0xc6, 0xa7, 0xb0, 0xe0, 0x30, 0x00, 0x00, 0x33, 0x01, 0x43, 0x01, 0x7f, 0x7f, 0x85, 0xff, 0x39,
+    0xf8, 0xc0, 0x00, 0x01, 0x03, 0x0f, 0x1f, 0xff, 0x80, 0x20, 0x5f, 0x27, 0xb3, 0x04, 0xae, 0xe5,
+    0x41, 0x60, 0x70, 0x50, 0xa0, 0xd8, 0x90, 0xb0, 0x60, 0x6c, 0x78, 0x54, 0xc8, 0x18, 0x88, 0x40,
+    0xc0, 0xa0, 0x60, 0x40, 0x7c, 0x7c, 0xb0, 0x80, 0xa8, 0xa4, 0xaa, 0x94, 0x9c, 0x9b, 0x9b, 0x1a,
+    0x1b, 0x3b, 0x3b, 0x33, 0x73, 0x62, 0xc4, 0x9e, 0x2a, 0x20, 0x03, 0x01, 0x00, 0x13, 0x1b, 0x07,
+    0x6b, 0x68, 0x2c, 0x5e, 0x10, 0x1f, 0x1c, 0x0d, 0x00, 0x01, 0x03, 0x02, 0x01, 0x00, 0x03, 0x01,
+    0x03, 0x03, 0xe8, 0xce, 0x1c, 0x3c, 0x72, 0x02, 0xf0, 0x0c, 0x30, 0x83, 0xc0, 0x82, 0x00, 0x02,
+    0x40, 0x80, 0xc0, 0x22, 0x00, 0x19, 0x18, 0xf9, 0xf9, 0xfb, 0xf0, 0xe2, 0xed, 0xc8, 0x13, 0x32,
+    0x72, 0xf2, 0xf3, 0xf7, 0xf7, 0xee, 0xed, 0x83, 0x1f, 0xd0, 0xc3, 0xa0, 0x60, 0x00, 0x70, 0x60,
+    0x33, 0x00, 0x3f, 0x01, 0x7f, 0x7f, 0x85, 0xff, 0x30, 0xfc, 0xf0, 0x80, 0x01, 0x03, 0x07, 0x1f,
+    0x7f, 0x47, 0x40, 0x00, 0xdf, 0x07, 0x4b, 0x07, 0xae, 0xce, 0x42, 0x60, 0x60, 0x00, 0x80, 0xc8,
+    0xe0, 0x70, 0x60, 0x68, 0x58, 0x94, 0x8c, 0x80, 0x08, 0x80, 0x40, 0x80, 0x60, 0x58, 0x7c, 0x7c,
+    0x10, 0x80, 0x80, 0xa0, 0xaa, 0xb4, 0x94, 0x9b, 0x9b, 0x1a, 0x82, 0x3b, 0x02, 0x33, 0x62, 0x66,
+    0x03, 0x01, 0x00, 0x13, 0x07, 0x4b, 0x68, 0x2c, 0x0e, 0x67, 0x08, 0x07, 0x1a, 0x82, 0x01, 0x02,
+    0x02, 0x02, 0x00, 0x82, 0x03, 0x14, 0x02, 0x00, 0xea, 0x9d, 0x3c, 0x7f, 0xf6, 0x90, 0x3c, 0xe8,
+    0x00, 0x80, 0xc0, 0xc0, 0x00, 0x80, 0x00, 0x40, 0xc0, 0x40, 0x00, 0x22, 0x01, 0x39, 0x17, 0xfb,
+    0xf2, 0xf4, 0xe0, 0xcc, 0x90, 0x11, 0x32, 0x72, 0xf2, 0xf7, 0xf7, 0xe6, 0xef, 0xd1, 0x37, 0x42,
+    0xd6, 0xa5, 0xb0, 0xe0, 0xb0, 0x20, 0x40, 0x9d, 0x00, 0x01, 0x80, 0x80, 0x33, 0x01, 0x42, 0x85,
+    0xff, 0x18, 0xfe, 0xf8, 0xc0, 0x00, 0x01, 0x07, 0x0f, 0x3f, 0xff, 0xc1, 0xe0, 0x1f, 0x17, 0x13,
+    0x68, 0x86, 0x89, 0xe7, 0x40, 0x70, 0x00, 0x40, 0xb0, 0xc0, 0x60, 0x82, 0x70, 0x0c, 0x50, 0xbc,
+    0x7c, 0x00, 0x00, 0x80, 0x40, 0x80, 0xd0, 0x50, 0x5c, 0x50, 0x00, 0x82, 0xa0, 0x05, 0xaa, 0xb4,
+    0xb4, 0xbb, 0x39, 0x3a, 0x82, 0x3b, 0x05, 0x33, 0x62, 0x46, 0x84, 0x16, 0x02, 0x02, 0x01, 0x00,
+    0x12, 0x0a, 0x69, 0x2c, 0x2e, 0x2f, 0x28, 0x06, 0x18, 0x08, 0x01, 0x03, 0x02, 0x82, 0x00, 0x00,
+    0x03, 0x82, 0x01, 0x0b, 0xd9, 0x1e, 0x3c, 0xf2, 0x02, 0x70, 0x0c, 0x20, 0x80, 0x80, 0xc0, 0xc0,
+    0x82, 0x00, 0x02, 0x40, 0x80, 0x40, 0x23, 0x00, 0x44, 0x17, 0xfb, 0xf2, 0xf4, 0xe6, 0xcc, 0x88,
+    0x13, 0x32, 0x72, 0xf2, 0xf3, 0xf7, 0xe7, 0xee, 0xcd, 0x83, 0x07, 0xc1, 0x83, 0xb0, 0x60, 0x40,
+    0x70, 0x20, 0xa0, 0x00, 0x06, 0xc0, 0x40, 0x40, 0x50, 0x50, 0x90, 0xa0, 0x83, 0x00, 0x86, 0xff,
+    0x3c, 0xfc, 0xe0, 0x00, 0x01, 0x03, 0x07, 0x1f, 0x7f, 0x8f, 0xc0, 0x20, 0x0f, 0x97, 0x43, 0x6f,
+    0xb6, 0xa6, 0xe2, 0xe0, 0x30, 0x00, 0x00, 0x30, 0x40, 0x70, 0x78, 0x70, 0x50, 0x90, 0x2c, 0x18,
+    0x18, 0x00, 0x00, 0x60, 0xa0, 0xe0, 0x50, 0x5c, 0x40, 0x40, 0xa0, 0xa8, 0xa8, 0xaa, 0xb0, 0xb4,
+    0x3d, 0x39, 0x3a, 0x3b, 0x3b, 0x33, 0x73, 0x62, 0xc6, 0x8c, 0x16, 0xca, 0x30, 0x20, 0x02, 0x01,
+    0x00, 0x11, 0x18, 0x2c, 0x2e, 0x5f, 0x1a, 0x14, 0x1f, 0x02, 0x01, 0x01, 0x02, 0x00, 0x02, 0x00,
+    0x00, 0x01, 0x01, 0x00, 0x1b, 0x3e, 0x7b, 0x24, 0x30, 0x3c, 0x20, 0x00, 0x82, 0xc0, 0x82, 0x00,
+    0x02, 0x40, 0xc0, 0x40, 0x23, 0x01, 0x43, 0x16, 0xf0, 0xe4, 0xe9, 0xce, 0x10, 0x31, 0x72, 0x72,
+    0xf2, 0xf7, 0xf7, 0xee, 0xef, 0xd1, 0x37, 0x42, 0xc6, 0xa5, 0xb0, 0x60, 0x20, 0x60, 0x40, 0xa0,
+    0x00, 0x06, 0xc0, 0x40, 0x60, 0x50, 0x50, 0x80, 0x20, 0x82, 0x00, 0x84, 0xff, 0x3c, 0xfe, 0xf0,
+    0x80, 0x01, 0x03, 0x07, 0x0f, 0x3f, 0xff, 0xc3, 0x00, 0x53, 0x0f, 0x47, 0x28, 0x6e, 0x88, 0xa3,
+    0xe0, 0xa0, 0x80, 0x00, 0x20, 0x30, 0x40, 0x68, 0x7c, 0x54, 0xd0, 0xb8, 0x8c, 0x30, 0x10, 0xc0,
+    0x80, 0x60, 0x80, 0xf0, 0x50, 0x58, 0x48, 0x40, 0x00, 0xa8, 0xac, 0xaa, 0xb0, 0xb0, 0x3f, 0x39,
+    0x3a, 0x3b, 0x3b, 0x33, 0x73, 0x62, 0xc4, 0x88, 0x16, 0xca, 0x20, 0x03, 0x01, 0x00, 0x12, 0x23,
+    0x2c, 0x5e, 0x27, 0x24, 0x16, 0x1f, 0x09, 0x00, 0x03, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00,
+    0x01, 0x00, 0x1e, 0x3d, 0xf2, 0x92, 0x34, 0x3c, 0x00, 0x80, 0xc0, 0xc0, 0xe0, 0x80, 0x00, 0x00,
+    0x40, 0x80, 0x40, 0x00, 0x22, 0x00, 0x17, 0x16, 0xf2, 0xf4, 0xe3, 0xcd, 0x92, 0x11, 0x32, 0x72,
+    0xf2, 0xf7, 0xf7, 0xe6, 0xee, 0xdd, 0x83, 0x17, 0xc1, 0x93, 0xb0, 0x60, 0xc0, 0xf0, 0x00, 0x33,
+    0x05, 0x43, 0x3d, 0xfe, 0xf8, 0xc0, 0x00, 0x01, 0x03, 0x0f, 0x1f, 0x7f, 0x0f, 0x40, 0x20, 0x6f,
+    0x27, 0xd3, 0x1c, 0x76, 0xc6, 0x80, 0xa0, 0x80, 0xa0, 0x00, 0x00, 0x70, 0x50, 0x60, 0x7c, 0x54,
+    0x98, 0x38, 0x18, 0x08, 0x50, 0x40, 0x00, 0x40, 0x80, 0xe0, 0xc0, 0x40, 0x40, 0x60, 0x40, 0x08,
+    0x8c, 0xa8, 0x30, 0x30, 0x3f, 0x39, 0x3a, 0x3b, 0x33, 0x73, 0x73, 0x66, 0xc4, 0x88, 0x37, 0x42,
+    0x60, 0x03, 0x01, 0x00, 0x10, 0x09, 0x1e, 0x67, 0x00, 0x07, 0x1a, 0x0c, 0x01, 0x00, 0x01, 0x01,
+    0x82, 0x00, 0x82, 0x01, 0x09, 0x3f, 0x73, 0x00, 0x70, 0x0c, 0x00, 0x80, 0xc0, 0xe0, 0xc0, 0x82,
+    0x00, 0x02, 0x40, 0xc0, 0x40, 0x22, 0x00, 0x3b, 0x16, 0xf4, 0xe2, 0xcd, 0x86, 0x13, 0x30, 0x72,
+    0xf2, 0xf2, 0xf7, 0xe7, 0xee, 0xed, 0xd1, 0x37, 0x4a, 0xc6, 0xb5, 0xb0, 0x70, 0x20, 0x60, 0x40,
+    0xa1, 0x00, 0x01, 0xc0, 0xc0, 0x33, 0x05, 0x43, 0x21, 0xfc, 0xe0, 0x80, 0x01, 0x03, 0x07, 0x1f,
+    0x3f, 0xff, 0x83, 0x40, 0x93, 0x0f, 0x87, 0x00, 0x7f, 0x55, 0xc7, 0x84, 0x80, 0xa0, 0xa0, 0x80,
+    0x20, 0x60, 0x40, 0x48, 0xdc, 0xd8, 0xb0, 0x28, 0xf0, 0x00, 0x50, 0x82, 0x40, 0x02, 0x80, 0xe0,
+    0xe0, 0x83, 0x40, 0x11, 0x48, 0x08, 0x2c, 0x30, 0x30, 0x3f, 0x39, 0x3a, 0x3b, 0x73, 0x73, 0x62,
+    0xe6, 0xc4, 0x89, 0x3f, 0x42, 0x20, 0x02, 0x01, 0x00, 0x11, 0x04, 0x77, 0x3b, 0x04, 0x1e, 0x0a,
+    0x82, 0x00, 0x00, 0x01, 0x84, 0x00, 0x13, 0x01, 0x01, 0x00, 0x7c, 0x7a, 0x10, 0x3c, 0xa8, 0x00,
+    0x80, 0xe0, 0xc0, 0x60, 0x00, 0x40, 0x00, 0x40, 0x80, 0x40, 0x00, 0x23, 0x00, 0x43, 0x16, 0xe4,
+    0xec, 0xcc, 0x10, 0x30, 0x72, 0x72, 0xf2, 0xf7, 0xf7, 0xe6, 0xee, 0xd9, 0x83, 0x47, 0xc9, 0xb7,
+    0xb0, 0x70, 0xc0, 0x20, 0x00, 0x40, 0xa1, 0x00, 0x05, 0xc0, 0xc0, 0x60, 0x50, 0xd0, 0xa0, 0x83,
+    0x00, 0x83, 0xff, 0x3e, 0xfe, 0xf0, 0xc0, 0x00, 0x03, 0x07, 0x0f, 0x1f, 0xff, 0x8f, 0x40, 0x00,
+    0x3f, 0x2f, 0x97, 0x08, 0x5f, 0xdb, 0x80, 0xe4, 0xe0, 0xe0, 0x00, 0x80, 0xa0, 0x60, 0x48, 0xc8,
+    0xdc, 0x90, 0x30, 0xc0, 0xb0, 0x10, 0x80, 0x00, 0x00, 0xc0, 0xa0, 0xf0, 0xe0, 0x68, 0x60, 0x60,
+    0x50, 0x48, 0x08, 0x2c, 0x34, 0x30, 0x37, 0x3d, 0x3a, 0x33, 0x73, 0x73, 0x62, 0xe6, 0xc4, 0x89,
+    0x3f, 0x50, 0x60, 0x03, 0x01, 0x00, 0x10, 0x06, 0x2f, 0x2c, 0x0f, 0x0d, 0x06, 0x00, 0x00, 0x82,
+    0x01, 0x00, 0x00, 0x83, 0x01, 0x09, 0x00, 0xf3, 0x82, 0x70, 0x0c, 0x28, 0xc0, 0x80, 0xa0, 0xe0,
+    0x82, 0x00, 0x03, 0x40, 0xc0, 0x00, 0x40, 0x22, 0x00, 0x3b, 0x16, 0xe3, 0xcd, 0x94, 0x13, 0x30,
+    0x72, 0xf2, 0xf2, 0xf7, 0xe7, 0xee, 0xcd, 0xd1, 0x17, 0x4a, 0x86, 0xb5, 0x30, 0x70, 0x20, 0x60,
+    0x00, 0x40, 0xa1, 0x00, 0x01, 0xc0, 0x80, 0x33, 0x03, 0x44, 0x2a, 0xfe, 0xf8, 0xe0, 0x00, 0x01,
+    0x03, 0x07, 0x1f, 0x7f, 0xff, 0x83, 0xc0, 0x23, 0x4f, 0x27, 0xc2, 0x0e, 0x5c, 0x96, 0xc4, 0xc0,
+    0xe0, 0x20, 0x80, 0xd0, 0xa0, 0xe0, 0xd8, 0xcc, 0xd8, 0xb0, 0x20, 0x10, 0x10, 0x90, 0x80, 0x80,
+    0x00, 0x80, 0xa0, 0xf0, 0xe8, 0xf8, 0x82, 0x00, 0x12, 0x40, 0x48, 0x6c, 0x38, 0x30, 0x36, 0x35,
+    0x72, 0x72, 0x73, 0x73, 0x66, 0xc6, 0xc4, 0x89, 0x36, 0x50, 0x60, 0x00, 0x03, 0x01, 0x00, 0x10,
+    0x03, 0x20, 0x0e, 0x0a, 0x01, 0x82, 0x00, 0x12, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01,
+    0x00, 0x08, 0x30, 0x38, 0xa0, 0x00, 0x80, 0xa0, 0x80, 0x60, 0x00, 0x82, 0x40, 0x02, 0x80, 0x40,
+    0x00, 0x22, 0x00, 0x3d, 0x15, 0xcb, 0x84, 0x12, 0x31, 0x72, 0xf2, 0xf2, 0xf7, 0xe7, 0xee, 0xee,
+    0xd9, 0xa3, 0x67, 0xc9, 0xa6, 0xb2, 0x60, 0xc0, 0x20, 0x40, 0x40, 0xa2, 0x00, 0x03, 0xc0, 0x80,
+    0xe0, 0xd0, 0x33, 0x03, 0x44, 0x40, 0xfc, 0xf0, 0x80, 0x01, 0x03, 0x07, 0x0f, 0x3f, 0xff, 0x0f,
+    0x80, 0xc0, 0xff, 0x0f, 0x87, 0x88, 0x0c, 0x12, 0x84, 0x84, 0xe0, 0x40, 0x00, 0xc0, 0xd0, 0x80,
+    0xe0, 0xc0, 0xc8, 0xb0, 0xb0, 0x60, 0xd8, 0x00, 0x10, 0x00, 0x80, 0x00, 0x80, 0x80, 0xb0, 0xb8,
+    0xa0, 0x00, 0x40, 0x10, 0x50, 0x48, 0x6c, 0x78, 0x76, 0x76, 0x75, 0x76, 0x72, 0x73, 0x76, 0xe6,
+    0xc6, 0x8c, 0x09, 0x3e, 0xd4, 0x60, 0x40, 0x02, 0x01, 0x00, 0x0f, 0x05, 0x0e, 0x03, 0x05, 0x04,
+    0x00, 0x01, 0x88, 0x00, 0x0e, 0x90, 0xb0, 0xac, 0x48, 0xc0, 0xe0, 0xa0, 0xe0, 0x80, 0x80, 0x00,
+    0x40, 0xc0, 0x00, 0x40, 0x23, 0x00, 0x43, 0x15, 0xcc, 0x11, 0x31, 0x72, 0x72, 0xf2, 0xf7, 0xf7,
+    0xe7, 0xee, 0xcd, 0x91, 0x37, 0xea, 0xa6, 0xb1, 0x70, 0xf0, 0x20, 0xe0, 0x00, 0x40, 0xa2, 0x00,
+    0x05, 0xc0, 0x80, 0xe0, 0xd0, 0x90, 0xa0, 0x83, 0x00, 0x37, 0xff, 0xff, 0xfe, 0xf8, 0xc0, 0x00,
+    0x01, 0x07, 0x0f, 0x1f, 0x7f, 0xff, 0x82, 0x00, 0xa3, 0x3f, 0x0f, 0x12, 0xcf, 0x7c, 0x5e, 0x80,
+    0xc0, 0x60, 0x00, 0x00, 0x20, 0x90, 0x80, 0xc0, 0xe0, 0xe0, 0xb8, 0x20, 0x50, 0x78, 0x10, 0x00,
+    0x00, 0xc0, 0x40, 0x80, 0x90, 0xb0, 0xb8, 0x80, 0x80, 0x00, 0x10, 0x50, 0x58, 0x68, 0x68, 0x72,
+    0x77, 0x75, 0x82, 0x76, 0x07, 0x66, 0xe6, 0xc6, 0x8c, 0x09, 0x2c, 0xd4, 0x40, 0x02, 0x01, 0x00,
+    0x0f, 0x01, 0x03, 0x04, 0x82, 0x00, 0x82, 0x01, 0x86, 0x00, 0x0e, 0xf0, 0x18, 0x00, 0xc0, 0x80,
+    0xa0, 0xa0, 0x20, 0x00, 0x00, 0x40, 0x40, 0x80, 0x40, 0x00, 0x23, 0x00, 0x43, 0x14, 0x94, 0x13,
+    0x30, 0x72, 0xf2, 0xf2, 0xf7, 0xe7, 0xee, 0xee, 0xd9, 0xa3, 0x67, 0xa9, 0xa6, 0xb2, 0x60, 0xc0,
+    0x20, 0x40, 0x40, 0xa3, 0x00, 0x05, 0xc0, 0x80, 0xe0, 0xf0, 0xa0, 0xa0, 0x83, 0x00, 0x37, 0xff,
+    0xfe, 0xf8, 0xe0, 0x00, 0x01, 0x03, 0x07, 0x1f, 0x3f, 0xff, 0x0f, 0x80, 0x41, 0x5f, 0x2f, 0x27,
+    0x10, 0xed, 0x52, 0x0c, 0xc4, 0x40, 0x20, 0x80, 0x00, 0x60, 0x80, 0xa0, 0xd0, 0xe0, 0xa0, 0xa0,
+    0x68, 0x98, 0x30, 0x30, 0x00, 0x00, 0x80, 0x00, 0xe0, 0x90, 0xb8, 0xb8, 0xa0, 0xc0, 0x40, 0x30,
+    0x58, 0x50, 0x6c, 0x68, 0x72, 0x77, 0x74, 0x82, 0x76, 0x07, 0xe6, 0xe6, 0xc4, 0x8c, 0x19, 0x2c,
+    0xc4, 0xc0, 0x02, 0x01, 0x00, 0x0d, 0x01, 0x0f, 0x05, 0x8a, 0x00, 0x0c, 0x30, 0x28, 0x08, 0xc0,
+    0xa0, 0x80, 0xe0, 0x80, 0x00, 0x00, 0x40, 0xc0, 0x00, 0x23, 0x00, 0x43, 0x14, 0x12, 0x31, 0x72,
+    0xf2, 0xf2, 0xf7, 0xe7, 0xe7, 0xee, 0xdd, 0x83, 0x17, 0xc2, 0xa6, 0xa1, 0x70, 0xd0, 0x20, 0xc0,
+    0x80, 0x40, 0xa3, 0x00, 0x05, 0xc0, 0x80, 0xe0, 0xe0, 0xa0, 0xa0, 0x83, 0x00, 0x42, 0xff, 0xfc,
+    0xf0, 0x80, 0x01, 0x03, 0x07, 0x0f, 0x3f, 0xff, 0x7f, 0x80, 0x00, 0x23, 0x9f, 0x2f, 0x16, 0x9e,
+    0xcc, 0x8e, 0x02, 0x40, 0x00, 0x40, 0x00, 0xc0, 0x60, 0x80, 0x90, 0xd0, 0xe0, 0xa8, 0x20, 0x78,
+    0x38, 0x00, 0x20, 0x00, 0x00, 0x80, 0x00, 0x80, 0xc0, 0xb8, 0x80, 0x80, 0xc0, 0x90, 0x10, 0x50,
+    0x50, 0x60, 0x68, 0x70, 0x73, 0x74, 0x77, 0x76, 0x76, 0xe6, 0xe6, 0xc4, 0x8c, 0x19, 0x6c, 0x94,
+    0x60, 0x03, 0x00, 0x00, 0x01, 0x00, 0x0e, 0x11, 0x00, 0x0e, 0x0d, 0xa8, 0x48, 0xc0, 0xc0, 0xa0,
+    0x80, 0x20, 0x00, 0x00, 0x40, 0x40, 0x80, 0x40, 0x00, 0x23, 0x00, 0x43, 0x13, 0x33, 0x70, 0x72,
+    0xf2, 0xf6, 0xe7, 0xe7, 0xee, 0xcf, 0xd9, 0x23, 0x57, 0xa9, 0xa7, 0x32, 0x60, 0xe0, 0x00, 0x60,
+    0xc0, 0xa3, 0x00, 0x07, 0x80, 0xc0, 0x80, 0xe0, 0xe0, 0xa0, 0xa0, 0x40, 0x82, 0x00, 0x16, 0xfe,
+    0xf8, 0xc0, 0x00, 0x01, 0x07, 0x0f, 0x1f, 0x7f, 0xff, 0x0f, 0x80, 0x41, 0x3f, 0x0f, 0x27, 0x50,
+    0xfc, 0xba, 0x84, 0x84, 0x40, 0x40, 0x82, 0x00, 0x11, 0x60, 0xa0, 0x80, 0xf8, 0xa0, 0xa0, 0x70,
+    0xd8, 0xf0, 0x10, 0x20, 0x00, 0x00, 0xc0, 0x00, 0x80, 0xc0, 0x98, 0x82, 0x80, 0x13, 0xd0, 0x90,
+    0x18, 0x54, 0x60, 0x60, 0x7c, 0x73, 0x74, 0x77, 0x76, 0xe6, 0xe6, 0xc6, 0xc4, 0x88, 0x11, 0x6c,
+    0x84, 0xc0, 0x03, 0x00, 0x00, 0x02, 0x01, 0x04, 0x00, 0x12, 0x00, 0x14, 0x0c, 0x00, 0xc0, 0xc0,
+    0xa0, 0x80, 0xe0, 0x80, 0x00, 0x00, 0x40, 0xc0, 0x00, 0x40, 0x86, 0x00, 0x13, 0x30, 0x72, 0xf2,
+    0xf2, 0xe7, 0xe7, 0xee, 0xee, 0xdd, 0xa3, 0x57, 0x82, 0x86, 0xa1, 0x70, 0xd0, 0x80, 0xc0, 0x00,
+    0x40, 0x33, 0x00, 0x41, 0x23, 0xf8, 0xe0, 0x00, 0x01, 0x03, 0x07, 0x1f, 0x3f, 0xff, 0x3f, 0x00,
+    0x80, 0x27, 0x9f, 0x4f, 0x86, 0x1e, 0xac, 0x8c, 0x06, 0x80, 0xc0, 0xc0, 0x40, 0x80, 0x40, 0xc0,
+    0x80, 0x80, 0xb8, 0xb8, 0x70, 0x70, 0x18, 0x60, 0x20, 0x82, 0x00, 0x19, 0x80, 0x40, 0xc0, 0xc0,
+    0x80, 0xb0, 0x80, 0x40, 0xc0, 0xb0, 0x98, 0x54, 0x60, 0x60, 0x7c, 0x73, 0x74, 0x77, 0xf6, 0xe6,
+    0xe6, 0xc6, 0x8c, 0x89, 0x11, 0x7c, 0x03, 0x00, 0x00, 0x01, 0x00, 0x02, 0x11, 0x00, 0x0d, 0x0c,
+    0x08, 0xc0, 0xa0, 0x80, 0x80, 0x20, 0x80, 0x00, 0x40, 0x40, 0x80, 0xc0, 0x00, 0x23, 0x00, 0x44,
+    0x02, 0x72, 0xf2, 0xf2, 0x82, 0xe7, 0x0c, 0xee, 0xdd, 0x91, 0x23, 0x57, 0x80, 0x87, 0x02, 0x50,
+    0xc0, 0x00, 0xe0, 0xc0, 0xa4, 0x00, 0x82, 0x80, 0x83, 0xa0, 0x00, 0x40, 0x83, 0x00, 0x15, 0xf0,
+    0x80, 0x01, 0x03, 0x07, 0x0f, 0x3f, 0x7f, 0xff, 0x0f, 0x00, 0x01, 0x7f, 0x1f, 0xaf, 0x10, 0x3d,
+    0xa8, 0x0e, 0x8c, 0x80, 0xc0, 0x82, 0x00, 0x12, 0x40, 0xc0, 0x90, 0x90, 0xb8, 0xb0, 0x60, 0xd0,
+    0x20, 0x30, 0x20, 0x00, 0x80, 0x00, 0x00, 0x80, 0x40, 0xc0, 0xc0, 0x82, 0x40, 0x09, 0x80, 0xb0,
+    0x98, 0xd0, 0x60, 0x68, 0x68, 0x73, 0x75, 0xf7, 0x82, 0xe6, 0x07, 0xc6, 0x8c, 0x09, 0x11, 0x7c,
+    0x84, 0xc0, 0xc0, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x11, 0x00, 0x0c, 0x00, 0xc0, 0x82, 0x80,
+    0x07, 0x60, 0x00, 0x00, 0x60, 0x40, 0xc0, 0x00, 0x40, 0x23, 0x00, 0x42, 0x12, 0xf2, 0xf2, 0xe6,
+    0xe7, 0xe7, 0xee, 0xce, 0xd9, 0xa3, 0x5f, 0xa2, 0x86, 0x01, 0x40, 0xd0, 0x80, 0xc0, 0x40, 0xc0,
+    0xa4, 0x00, 0x82, 0x80, 0x82, 0xa0, 0x45, 0x20, 0x40, 0x00, 0x00, 0xc0, 0x01, 0x03, 0x07, 0x0f,
+    0x1f, 0x7f, 0xff, 0x3f, 0x00, 0x80, 0x67, 0x5f, 0x0f, 0x26, 0x1a, 0x3f, 0x04, 0x06, 0x08, 0xc0,
+    0xc0, 0x00, 0x00, 0xe0, 0x40, 0xc0, 0x90, 0x98, 0xb8, 0x60, 0x60, 0xc0, 0xe0, 0x00, 0x20, 0x00,
+    0x00, 0x80, 0x00, 0xc0, 0x40, 0x60, 0x70, 0x00, 0x40, 0x80, 0x70, 0xb0, 0x98, 0xd0, 0xe0, 0xe0,
+    0xe8, 0xfa, 0xf4, 0xe7, 0xe6, 0xe6, 0xc6, 0xcc, 0x8c, 0x09, 0x10, 0x6c, 0xa4, 0x02, 0x12, 0x01,
+    0x13, 0x09, 0xa0, 0xa0, 0xc0, 0x80, 0x80, 0x20, 0x40, 0x40, 0x80, 0xc0, 0x87, 0x00, 0x11, 0xe2,
+    0xe7, 0xe7, 0xef, 0xee, 0xdd, 0x91, 0x27, 0x87, 0xa8, 0x87, 0x42, 0x50, 0xc0, 0x00, 0xe0, 0xc0,
+    0x00, 0x33, 0x00, 0x44, 0x14, 0x00, 0x01, 0x03, 0x0f, 0x1f, 0x3f, 0xff, 0xff, 0x0e, 0x00, 0x03,
+    0x7f, 0x1f, 0x0e, 0x11, 0x9e, 0x28, 0xae, 0x88, 0x80, 0x80, 0x82, 0x00, 0x0a, 0xa0, 0x00, 0x80,
+    0xf0, 0xd8, 0xf0, 0x60, 0xc0, 0x20, 0x70, 0x60, 0x82, 0x00, 0x1d, 0x80, 0x00, 0xc0, 0x60, 0x70,
+    0x70, 0x40, 0x00, 0x20, 0x30, 0xb0, 0x98, 0xd8, 0xf8, 0xe0, 0xe8, 0xea, 0xe4, 0xe7, 0xe6, 0xe6,
+    0xc6, 0xcc, 0x8c, 0x19, 0x12, 0x6e, 0xa4, 0xc0, 0x80, 0x02, 0x12, 0x00, 0x11, 0x09, 0xa0, 0x80,
+    0x80, 0x20, 0x00, 0x00, 0x60, 0x40, 0xc0, 0x60, 0x86, 0x00, 0x10, 0xe2, 0xe6, 0xe7, 0xe7, 0xee,
+    0xde, 0x99, 0x23, 0x4f, 0xa0, 0x8e, 0x01, 0x50, 0xf0, 0x80, 0xe0, 0x40, 0x33, 0x00, 0x44, 0x22,
+    0x01, 0x03, 0x07, 0x0f, 0x3f, 0x7f, 0xff, 0x3f, 0x00, 0x81, 0xff, 0x5f, 0x0f, 0x66, 0x9a, 0xfb,
+    0x14, 0x84, 0x88, 0x80, 0x40, 0x00, 0x80, 0x80, 0xa0, 0x00, 0xc0, 0xc0, 0xd8, 0x60, 0x40, 0xc0,
+    0x30, 0x60, 0x60, 0x84, 0x00, 0x1b, 0xc0, 0x60, 0x70, 0x10, 0x00, 0x80, 0x20, 0x10, 0xb0, 0x98,
+    0xd8, 0xd0, 0xe0, 0xe8, 0xea, 0xec, 0xe7, 0xe6, 0xe6, 0xce, 0xcc, 0x8c, 0x19, 0x12, 0x5e, 0xac,
+    0xc0, 0x00, 0x02, 0x12, 0x00, 0x12, 0x09, 0x80, 0xa0, 0xe0, 0x00, 0x00, 0x60, 0x40, 0x40, 0xa0,
+    0x40, 0x87, 0x00, 0x11, 0xe6, 0xe7, 0xe7, 0xee, 0xce, 0xdd, 0xa3, 0x47, 0x96, 0xa0, 0x07, 0x42,
+    0xd0, 0xc0, 0x40, 0xe0, 0xc0, 0x80, 0x33, 0x00, 0x43, 0x2a, 0x03, 0x07, 0x0f, 0x1f, 0x7f, 0xff,
+    0xff, 0x06, 0x00, 0x83, 0xbf, 0xdf, 0x0e, 0x21, 0x1c, 0x78, 0xbc, 0x00, 0x80, 0x40, 0x80, 0x00,
+    0x80, 0xe0, 0x80, 0x40, 0x80, 0xc0, 0x40, 0x40, 0xc0, 0xb0, 0x70, 0x00, 0x40, 0x00, 0x00, 0x80,
+    0x00, 0x80, 0xe0, 0x60, 0x70, 0x84, 0x00, 0x12, 0xb0, 0xb8, 0xd0, 0xd0, 0xe4, 0xe8, 0xea, 0xec,
+    0xed, 0xe7, 0xce, 0xcc, 0x8c, 0x8d, 0x19, 0x32, 0xdc, 0x8c, 0x00, 0x02, 0x12, 0x00, 0x12, 0x08,
+    0xa0, 0x80, 0x20, 0x80, 0x00, 0x60, 0x40, 0xe0, 0x60, 0x88, 0x00, 0x11, 0xe7, 0xe7, 0xef, 0xce,
+    0xdd, 0x91, 0x03, 0x1f, 0x81, 0x8e, 0x45, 0x40, 0xc0, 0xa0, 0xe0, 0x00, 0x80, 0x00, 0x33, 0x00,
+    0x42, 0x1a, 0x07, 0x0f, 0x1f, 0x3f, 0xff, 0xff, 0x1f, 0x00, 0x01, 0xff, 0xbf, 0x5f, 0x64, 0x3e,
+    0x19, 0x04, 0x18, 0x88, 0x80, 0x80, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0x20, 0xa0, 0x82, 0x40, 0x23,
+    0xe0, 0x30, 0xe0, 0x20, 0x40, 0x00, 0x00, 0x80, 0x00, 0x00, 0xe0, 0x30, 0x10, 0x40, 0x80, 0x00,
+    0x80, 0x40, 0xb0, 0xa0, 0xd0, 0xd0, 0xe8, 0xe8, 0xea, 0xec, 0xed, 0xef, 0xce, 0xcc, 0x8c, 0x09,
+    0x19, 0x32, 0xdc, 0x28, 0x02, 0x12, 0x01, 0x10, 0x07, 0x60, 0x00, 0x00, 0x60, 0x40, 0x40, 0xa0,
+    0x40, 0x86, 0x00, 0x0e, 0xe7, 0xee, 0xde, 0x99, 0x23, 0x47, 0x86, 0xa6, 0x17, 0x50, 0xe0, 0xc0,
+    0x60, 0xe0, 0x40, 0x33, 0x01, 0x43, 0x10, 0x1f, 0x3f, 0x7f, 0xff, 0x7f, 0x00, 0x00, 0x87, 0x3f,
+    0x9f, 0x0e, 0x21, 0x7c, 0x30, 0x2c, 0x00, 0x00, 0x82, 0x80, 0x0c, 0x00, 0x00, 0xc0, 0x80, 0x40,
+    0x30, 0x40, 0x40, 0xc0, 0xb0, 0x70, 0x40, 0x40, 0x82, 0x00, 0x1d, 0x80, 0x00, 0x00, 0xe0, 0xb0,
+    0x10, 0xc0, 0x00, 0x00, 0x40, 0x40, 0x38, 0xa0, 0xc0, 0xd0, 0xe8, 0xe8, 0xea, 0xec, 0xed, 0xed,
+    0xcc, 0xcc, 0x8d, 0x19, 0x11, 0x22, 0xd8, 0x08, 0x40, 0x02, 0x11, 0x00, 0x09, 0x08, 0x80, 0x80,
+    0x00, 0x20, 0x60, 0x40, 0xe0, 0x60, 0x00, 0x23, 0x00, 0x41, 0x0f, 0xe7, 0xef, 0xce, 0xdd, 0xb1,
+    0x63, 0x9f, 0x81, 0x06, 0x57, 0x40, 0xc0, 0x00, 0xe0, 0x00, 0x80, 0xa7, 0x00, 0x02, 0x80, 0x80,
+    0xc0, 0x82, 0xa0, 0x82, 0x00, 0x12, 0x0f, 0x3f, 0x7f, 0xff, 0xff, 0x1e, 0x00, 0x03, 0x7f, 0x3f,
+    0x1e, 0x04, 0x3c, 0x79, 0x45, 0x08, 0x08, 0x00, 0x80, 0x82, 0x00, 0x82, 0x80, 0x08, 0x00, 0x70,
+    0x70, 0xe0, 0xe0, 0xb0, 0x60, 0x20, 0x40, 0x85, 0x00, 0x10, 0xc0, 0x80, 0x80, 0x00, 0x80, 0x00,
+    0xe0, 0x40, 0x38, 0xa0, 0xc0, 0xc0, 0xf8, 0xe0, 0xea, 0xec, 0xed, 0x82, 0xcd, 0x04, 0x8d, 0x19,
+    0x11, 0x22, 0xf8, 0x02, 0x11, 0x00, 0x08, 0x02, 0x20, 0x80, 0x00, 0x82, 0x60, 0x01, 0x20, 0x40,
+    0x23, 0x00, 0x42, 0x0f, 0xef, 0xce, 0xde, 0x99, 0x03, 0x3f, 0x82, 0x26, 0x55, 0x50, 0xe0, 0x80,
+    0x60, 0xe0, 0x40, 0x80, 0xa7, 0x00, 0x06, 0x80, 0x00, 0xc0, 0xa0, 0xa0, 0x20, 0x40, 0x82, 0x00,
+    0x0f, 0x1f, 0x7f, 0xff, 0xff, 0x7f, 0x00, 0x01, 0x87, 0xbf, 0x1f, 0x4e, 0x21, 0x7a, 0x50, 0x58,
+    0x10, 0x84, 0x00, 0x0c, 0x40, 0x00, 0x80, 0xa0, 0x20, 0x70, 0xe0, 0xc0, 0x80, 0x70, 0xc0, 0x00,
+    0x40, 0x83, 0x00, 0x11, 0x80, 0xc0, 0xc0, 0x80, 0xe0, 0x00, 0x00, 0x40, 0x20, 0x50, 0x38, 0xa0,
+    0xc0, 0xc0, 0xd0, 0xe4, 0xe8, 0xec, 0x82, 0xcd, 0x06, 0x8d, 0x8d, 0x19, 0x11, 0x22, 0xf8, 0x48,
+    0x02, 0x12, 0x00, 0x10, 0x01, 0x00, 0x00, 0x82, 0x60, 0x01, 0xa0, 0xe0, 0x88, 0x00, 0x0f, 0xce,
+    0xde, 0x9d, 0xa3, 0x67, 0x87, 0x88, 0x0e, 0x57, 0xe0, 0xc0, 0x40, 0xe0, 0x80, 0x80, 0x00, 0x33,
+    0x00, 0x44, 0x00, 0x3f, 0x82, 0xff, 0x0b, 0x0e, 0x00, 0x03, 0x7f, 0xbf, 0x9e, 0x45, 0x3c, 0xf9,
+    0x20, 0x0c, 0x10, 0x84, 0x00, 0x0b, 0xc0, 0x00, 0x00, 0xa0, 0xb0, 0xf0, 0xc0, 0xe0, 0x80, 0x40,
+    0xe0, 0xc0, 0x84, 0x00, 0x04, 0x80, 0x80, 0xe0, 0xe0, 0x40, 0x83, 0x00, 0x08, 0x50, 0x38, 0xa0,
+    0xc0, 0xd0, 0xd4, 0xe4, 0xe8, 0xef, 0x82, 0xcd, 0x08, 0x8d, 0x9d, 0x19, 0x11, 0x22, 0xd8, 0x48,
+    0xc0, 0x80, 0x02, 0x12, 0x01, 0x0e, 0x04, 0x20, 0x60, 0x60, 0xe0, 0x20, 0x87, 0x00, 0x0c, 0xdd,
+    0xb1, 0x43, 0xaf, 0x80, 0x26, 0x41, 0x60, 0xe0, 0x80, 0x60, 0xc0, 0x00, 0x33, 0x00, 0x44, 0x10,
+    0x7f, 0xff, 0xff, 0x3f, 0x00, 0x01, 0xdf, 0xff, 0x3e, 0x0c, 0x63, 0xb8, 0x54, 0x59, 0x00, 0x00,
+    0x80, 0x83, 0x00, 0x0b, 0x40, 0x00, 0x80, 0xc0, 0xb0, 0xe0, 0xe0, 0x80, 0x40, 0xc0, 0x00, 0xc0,
+    0x85, 0x00, 0x02, 0xc0, 0xe0, 0xe0, 0x83, 0x00, 0x09, 0x80, 0x50, 0x30, 0xa0, 0xb0, 0xd0, 0xd4,
+    0xd4, 0xc8, 0xcf, 0x82, 0xcd, 0x08, 0x8d, 0x19, 0x19, 0x33, 0x62, 0xd8, 0x48, 0x80, 0x00, 0x02,
+    0x11, 0x01, 0x06, 0x82, 0x60, 0x01, 0xa0, 0x60, 0x23, 0x00, 0x42, 0x0d, 0xde, 0x99, 0x03, 0x27,
+    0x86, 0x28, 0x4f, 0x72, 0xe0, 0xe0, 0x40, 0xe0, 0x80, 0x80, 0xa9, 0x00, 0x09, 0x80, 0x00, 0xc0,
+    0xa0, 0xa0, 0x20, 0x40, 0x80, 0x00, 0x00, 0x82, 0xff, 0x0d, 0x00, 0x01, 0x07, 0x7f, 0x3e, 0x9e,
+    0x41, 0x3c, 0x35, 0x28, 0x0c, 0x10, 0x00, 0x80, 0x82, 0x00, 0x01, 0xc0, 0x00, 0x82, 0x80, 0x00,
+    0xb0, 0x82, 0x80, 0x03, 0x40, 0xe0, 0x40, 0x80, 0x85, 0x00, 0x02, 0xc0, 0xe0, 0x20, 0x83, 0x00,
+    0x13, 0xa0, 0x40, 0x30, 0xb0, 0xa0, 0xc0, 0xd4, 0xd6, 0xca, 0xcf, 0xcd, 0xcd, 0x8d, 0x9d, 0x19,
+    0x19, 0x33, 0x64, 0xb8, 0x58, 0x02, 0x12, 0x00, 0x0d, 0x82, 0x60, 0x01, 0xe0, 0x60, 0x87, 0x00,
+    0x0c, 0x9d, 0x21, 0x67, 0xcf, 0x01, 0x66, 0x41, 0xe0, 0xc0, 0x80, 0x60, 0x80, 0x00, 0x33, 0x02,
+    0x42, 0x0c, 0x1e, 0x00, 0x03, 0xff, 0x7f, 0xbe, 0x9d, 0xe3, 0x3e, 0xc0, 0x7d, 0x00, 0x10, 0x84,
+    0x00, 0x0b, 0x80, 0x80, 0x00, 0x40, 0x80, 0x80, 0xa0, 0x80, 0x60, 0xe0, 0x80, 0xc0, 0x85, 0x00,
+    0x02, 0x80, 0x40, 0x60, 0x83, 0x00, 0x14, 0x40, 0x80, 0x40, 0x30, 0xa0, 0xb0, 0xd8, 0xd4, 0xd6,
+    0xd8, 0xcf, 0xcd, 0xcd, 0x8d, 0x9d, 0x19, 0x19, 0x32, 0x64, 0xbc, 0x18, 0x02, 0x11, 0x01, 0x05,
+    0x03, 0x40, 0x60, 0x20, 0x40, 0x23, 0x00, 0x43, 0x0c, 0xb1, 0x43, 0xdf, 0x52, 0x66, 0x6f, 0x62,
+    0xe0, 0x80, 0x40, 0xc0, 0xc0, 0x80, 0xaa, 0x00, 0x07, 0x80, 0x00, 0xc0, 0xe0, 0x20, 0x60, 0x40,
+    0x80, 0x82, 0x00, 0x0d, 0xff, 0x7f, 0x00, 0x01, 0x0f, 0x7f, 0x3e, 0x9e, 0x41, 0xf8, 0xb1, 0x28,
+    0x35, 0x10, 0x85, 0x00, 0x03, 0x80, 0x00, 0x40, 0x60, 0x82, 0x80, 0x04, 0xc0, 0x60, 0xe0, 0x00,
+    0x80, 0x85, 0x00, 0x03, 0x80, 0x40, 0x20, 0xc0, 0x82, 0x00, 0x15, 0x40, 0x80, 0x40, 0x60, 0xa0,
+    0xa0, 0xd0, 0xd4, 0xd4, 0xd8, 0xdf, 0xdd, 0x9d, 0x9d, 0x19, 0x19, 0x31, 0x32, 0x44, 0xbc, 0x18,
+    0x00, 0x02, 0x11, 0x00, 0x05, 0x04, 0x40, 0x40, 0xa0, 0xe0, 0x00, 0x23, 0x00, 0x3f, 0x06, 0x03,
+    0x67, 0xd7, 0x40, 0x66, 0x67, 0xe0, 0x82, 0xc0, 0x01, 0x80, 0x80, 0xab, 0x00, 0x12, 0x80, 0x00,
+    0xc0, 0xe0, 0x60, 0x60, 0x40, 0xff, 0x0c, 0x01, 0x07, 0xff, 0x7e, 0x3e, 0x1d, 0x67, 0xf2, 0xc0,
+    0x1d, 0x89, 0x00, 0x09, 0x80, 0x60, 0xc0, 0x80, 0xc0, 0x60, 0xe0, 0x80, 0x00, 0x80, 0x85, 0x00,
+    0x02, 0xc0, 0x40, 0x20, 0x82, 0x00, 0x12, 0x80, 0x40, 0xe0, 0x40, 0x40, 0x80, 0xa0, 0xd0, 0xd4,
+    0xd4, 0xd8, 0xda, 0xdd, 0x9d, 0x9d, 0x19, 0x19, 0x33, 0x22, 0x02, 0x11, 0x01, 0x04, 0x02, 0xe0,
+    0x20, 0x00, 0x23, 0x00, 0x41, 0x0b, 0x47, 0xcf, 0x10, 0x46, 0x6d, 0xe0, 0xe0, 0x80, 0x40, 0x80,
+    0x00, 0x80, 0xab, 0x00, 0x15, 0x80, 0x00, 0x40, 0x60, 0x60, 0x40, 0x40, 0x80, 0x00, 0x3e, 0x00,
+    0x03, 0x9f, 0x7e, 0x3e, 0x9d, 0x43, 0x78, 0xb1, 0xb8, 0x11, 0x10, 0x84, 0x00, 0x0c, 0x80, 0x00,
+    0x00, 0x40, 0x40, 0x60, 0xe0, 0xc0, 0x80, 0x60, 0xe0, 0xc0, 0x80, 0x86, 0x00, 0x02, 0xc0, 0x00,
+    0x80, 0x83, 0x00, 0x13, 0x40, 0xc0, 0x40, 0x40, 0x80, 0x80, 0xa0, 0xd4, 0xd4, 0xd8, 0xda, 0x9f,
+    0x9d, 0x9d, 0x19, 0x19, 0x33, 0x22, 0x44, 0xf0, 0x03, 0x11, 0x01, 0x03, 0x01, 0xa0, 0x60, 0x22,
+    0x00, 0x39, 0x0a, 0x8f, 0x06, 0x0a, 0x47, 0x63, 0xe0, 0xa0, 0x00, 0x80, 0xc0, 0x80, 0xad, 0x00,
+    0x33, 0x00, 0x43, 0x0b, 0x00, 0x01, 0x07, 0xff, 0x7e, 0x3c, 0x89, 0x65, 0xf2, 0x89, 0x91, 0x20,
+    0x85, 0x00, 0x0c, 0x80, 0x00, 0x00, 0x40, 0x60, 0x60, 0xc0, 0x80, 0x00, 0xa0, 0x80, 0x00, 0x80,
+    0x85, 0x00, 0x03, 0x80, 0xc0, 0x80, 0xc0, 0x83, 0x00, 0x15, 0x40, 0xc0, 0x50, 0x40, 0x80, 0x80,
+    0xa8, 0xc0, 0xd4, 0xd8, 0x9a, 0x9f, 0x9d, 0x19, 0x19, 0x39, 0x33, 0x62, 0x44, 0xf0, 0x80, 0x80,
+    0x02, 0x12, 0x00, 0x0a, 0x01, 0xe0, 0x60, 0x87, 0x00, 0x09, 0x3f, 0x01, 0x26, 0x69, 0xe0, 0x80,
+    0x80, 0x00, 0x80, 0x00, 0x33, 0x00, 0x41, 0x0b, 0x01, 0x07, 0xff, 0x7e, 0x3e, 0x1d, 0xc3, 0x70,
+    0xe3, 0x78, 0x19, 0x20, 0x84, 0x00, 0x0c, 0x80, 0x80, 0x00, 0x00, 0x80, 0x60, 0x60, 0x80, 0x40,
+    0x00, 0x80, 0xc0, 0x80, 0x87, 0x00, 0x01, 0xc0, 0xc0, 0x83, 0x00, 0x14, 0x80, 0x00, 0xe0, 0x70,
+    0x40, 0x00, 0xa0, 0xa8, 0xa0, 0x94, 0x98, 0x9a, 0x9b, 0x99, 0x19, 0x19, 0x33, 0x33, 0x62, 0xc4,
+    0x30, 0x03, 0x11, 0x00, 0x01, 0x00, 0x20, 0x22, 0x00, 0x0b, 0x0a, 0x42, 0x0e, 0x0d, 0xe2, 0xa0,
+    0xc0, 0x00, 0x80, 0xc0, 0x80, 0x00, 0x33, 0x00, 0x43, 0x0a, 0x03, 0x1f, 0xfe, 0x7e, 0x3d, 0x83,
+    0xf8, 0x73, 0x8b, 0xb1, 0x30, 0x85, 0x00, 0x00, 0x80, 0x82, 0x00, 0x01, 0x80, 0x60, 0x82, 0x00,
+    0x03, 0x80, 0xc0, 0x00, 0x80, 0x87, 0x00, 0x1c, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x80, 0xc0, 0x80,
+    0xe0, 0x60, 0x40, 0x60, 0x88, 0xa8, 0xa0, 0x94, 0x98, 0x9a, 0x9b, 0x9b, 0x19, 0x39, 0x33, 0x33,
+    0x62, 0xc4, 0x70, 0x80, 0x00, 0x02, 0x11, 0x00, 0x02, 0x01, 0x60, 0x00, 0x23, 0x00, 0x42, 0x07,
+    0x48, 0x06, 0xaf, 0xa0, 0xa0, 0x80, 0x80, 0xc0, 0xb1, 0x00, 0x84, 0x40, 0x0d, 0x80, 0x00, 0x00,
+    0x07, 0xfe, 0x7e, 0x7c, 0x19, 0xc7, 0x70, 0xe9, 0x70, 0x09, 0x20, 0x88, 0x00, 0x04, 0x80, 0xa0,
+    0x20, 0x00, 0x00, 0x82, 0xc0, 0x88, 0x00, 0x02, 0x80, 0xc0, 0x40, 0x82, 0x00, 0x82, 0x80, 0x13,
+    0xa0, 0x60, 0x60, 0x40, 0xa8, 0xac, 0xa8, 0xb0, 0x9a, 0x9b, 0x9b, 0x1b, 0x1b, 0x3b, 0x33, 0x32,
+    0x66, 0xcc, 0x70, 0x20, 0x02, 0x11, 0x00, 0x01, 0x00, 0x00, 0x23, 0x00, 0x40, 0x05, 0x06, 0x09,
+    0xa0, 0x80, 0x80, 0x00, 0x82, 0x80, 0xb0, 0x00, 0x84, 0x40, 0x0a, 0x00, 0xfe, 0xfe, 0x7c, 0x3d,
+    0x83, 0xf4, 0x6b, 0x90, 0x79, 0x20, 0x88, 0x00, 0x07, 0x80, 0xc0, 0xa0, 0x00, 0x00, 0x80, 0xc0,
+    0xc0, 0x89, 0x00, 0x01, 0x80, 0xc0, 0x83, 0x00, 0x82, 0x80, 0x11, 0xa0, 0xe0, 0x60, 0x40, 0xa8,
+    0xac, 0xa8, 0xb0, 0x9e, 0x9b, 0x9b, 0x1b, 0x3b, 0x3b, 0x33, 0x62, 0x46, 0x88, 0x01, 0x23, 0x00,
+    0x3f, 0x07, 0x07, 0xa2, 0x80, 0xe0, 0x00, 0x80, 0xc0, 0x80, 0xb1, 0x00, 0x83, 0x40, 0x0a, 0x80,
+    0xfe, 0xfe, 0x7d, 0x1b, 0xef, 0xf0, 0xc1, 0xb2, 0x01, 0x20, 0x89, 0x00, 0x07, 0xc0, 0x80, 0x40,
+    0x80, 0x80, 0xc0, 0xc0, 0x80, 0x89, 0x00, 0x01, 0x40, 0x80, 0x82, 0x00, 0x13, 0x80, 0x80, 0xc0,
+    0x80, 0x80, 0x40, 0x40, 0xa0, 0xac, 0xa8, 0xb0, 0xbe, 0xbb, 0x3a, 0x3b, 0x3b, 0x33, 0x33, 0x62,
+    0x44, 0x02, 0x22, 0x00, 0x08, 0x07, 0x8b, 0xa0, 0xe0, 0x80, 0x80, 0xc0, 0x00, 0x00, 0x33, 0x01,
+    0x42, 0x07, 0x7c, 0x39, 0x87, 0xf0, 0x63, 0x10, 0x39, 0x20, 0x88, 0x00, 0x07, 0x80, 0x80, 0xc0,
+    0xc0, 0x80, 0x00, 0x80, 0xc0, 0x91, 0x00, 0x15, 0x80, 0xc0, 0x80, 0x80, 0x00, 0x40, 0x40, 0xac,
+    0xac, 0xb4, 0xbc, 0x3b, 0x3a, 0x3b, 0x3b, 0x33, 0x33, 0x62, 0xc4, 0x89, 0xf8, 0x30, 0x01, 0x23,
+    0x00, 0x42, 0x05, 0x82, 0xa0, 0xc0, 0x40, 0xc0, 0x80, 0xb2, 0x00, 0x00, 0x80, 0x83, 0x40, 0x00,
+    0x80, 0x82, 0x00, 0x07, 0xfc, 0x7d, 0x03, 0xf8, 0xe9, 0x09, 0x3b, 0x41, 0x89, 0x00, 0x08, 0x80,
+    0xc0, 0xc0, 0x80, 0x00, 0x00, 0x40, 0x00, 0x80, 0x88, 0x00, 0x02, 0x80, 0x00, 0x80, 0x84, 0x00,
+    0x15, 0x80, 0xe0, 0x80, 0x80, 0x00, 0x00, 0x50, 0xa8, 0xa8, 0xb0, 0xb4, 0x3b, 0x3a, 0x3b, 0x3b,
+    0x33, 0x73, 0x62, 0xc4, 0x89, 0x78, 0x10, 0x02, 0x22, 0x00, 0x04, 0x03, 0x80, 0xa0, 0x00, 0xc0,
+    0x33, 0x00, 0x41, 0x07, 0x7d, 0x3b, 0xc7, 0xe0, 0x43, 0xf8, 0x23, 0x60, 0x8a, 0x00, 0x01, 0xc0,
+    0xc0, 0x8e, 0x00, 0x82, 0x80, 0x84, 0x00, 0x14, 0x80, 0xe0, 0xa0, 0x80, 0x00, 0x40, 0x50, 0x08,
+    0x28, 0x30, 0x34, 0x3b, 0x3a, 0x3b, 0x33, 0x33, 0x72, 0x66, 0xc4, 0x89, 0x60, 0x02, 0x22, 0x00,
+    0x06, 0x05, 0xe0, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0x33, 0x00, 0x41, 0x06, 0x39, 0x87, 0xf8, 0xe3,
+    0x11, 0x63, 0x61, 0x8a, 0x00, 0x07, 0x80, 0xc0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x89, 0x00,
+    0x01, 0x80, 0x80, 0x84, 0x00, 0x15, 0x80, 0x80, 0xe0, 0xe0, 0x80, 0xc0, 0x50, 0x50, 0x48, 0x28,
+    0x30, 0x34, 0x3f, 0x3a, 0x3b, 0x33, 0x73, 0x62, 0x66, 0xc4, 0x89, 0xe0, 0x01, 0x23, 0x00, 0x42,
+    0x03, 0x80, 0x80, 0xc0, 0x80, 0xb4, 0x00, 0x00, 0x80, 0x82, 0x40, 0x01, 0xc0, 0x80, 0x82, 0x00,
+    0x06, 0x13, 0xda, 0xe1, 0x53, 0xe0, 0x33, 0x40, 0x8a, 0x00, 0x03, 0x40, 0x40, 0x00, 0x00, 0x82,
+    0x80, 0x8a, 0x00, 0x01, 0x80, 0x80, 0x85, 0x00, 0x15, 0x80, 0xe0, 0xc0, 0xc0, 0x80, 0x50, 0x58,
+    0x40, 0x28, 0x30, 0x34, 0x37, 0x32, 0x33, 0x33, 0x73, 0x62, 0xc6, 0xc4, 0x09, 0xe0, 0x40, 0x02,
+    0x22, 0x00, 0x02, 0x01, 0x00, 0xc0, 0x33, 0x00, 0x40, 0x05, 0x8f, 0xe0, 0xc7, 0xa1, 0xf3, 0x40,
+    0x8a, 0x00, 0x01, 0x80, 0x40, 0x82, 0x00, 0x01, 0x80, 0x80, 0x8b, 0x00, 0x01, 0x80, 0x80, 0x85,
+    0x00, 0x13, 0x80, 0x40, 0xc0, 0x80, 0x80, 0x70, 0x58, 0x40, 0x68, 0x30, 0x34, 0x37, 0x32, 0x33,
+    0x73, 0x72, 0x66, 0xc6, 0x8c, 0x19, 0x01, 0x23, 0x00, 0x40, 0x01, 0x80, 0xc0, 0xb6, 0x00, 0x0c,
+    0x80, 0xc0, 0x40, 0x40, 0xc0, 0x80, 0x00, 0xf8, 0xc7, 0x07, 0x63, 0x03, 0x40, 0x8c, 0x00, 0x04,
+    0x80, 0x00, 0x00, 0x80, 0x80, 0x8b, 0x00, 0x00, 0x80, 0x86, 0x00, 0x13, 0xc0, 0x40, 0x00, 0x80,
+    0x80, 0x50, 0x58, 0x40, 0x68, 0x74, 0x34, 0x37, 0x36, 0x72, 0x73, 0x62, 0x66, 0xc4, 0x8c, 0x11,
+    0x01, 0x23, 0x00, 0x42, 0x00, 0xc0, 0xb7, 0x00, 0x05, 0x80, 0xc0, 0x40, 0xc0, 0xc0, 0x80, 0x82,
+    0x00, 0x04, 0xe1, 0x83, 0xe0, 0x53, 0x40, 0x8a, 0x00, 0x82, 0x80, 0x82, 0x00, 0x00, 0x80, 0x93,
+    0x00, 0x0c, 0x80, 0xc0, 0x00, 0x40, 0x00, 0x80, 0x90, 0x58, 0x50, 0x60, 0x7c, 0x74, 0x77, 0x82,
+    0x76, 0x06, 0x66, 0xe6, 0xc4, 0x8c, 0x11, 0xe0, 0x00, 0x01, 0x23, 0x00, 0x41, 0x01, 0x40, 0x80,
+    0xb6, 0x00, 0x00, 0x80, 0x82, 0xc0, 0x07, 0x80, 0x80, 0x00, 0x00, 0xd7, 0x25, 0x73, 0x82, 0x8b,
+    0x00, 0x01, 0x80, 0x80, 0x83, 0x00, 0x00, 0x80, 0x93, 0x00, 0x01, 0x80, 0xc0, 0x83, 0x00, 0x06,
+    0xb0, 0x58, 0x50, 0x60, 0x7a, 0x74, 0x77, 0x82, 0x76, 0x05, 0x66, 0xe6, 0xc4, 0x88, 0x11, 0xf0,
+    0x02, 0x22, 0x00, 0x02, 0x01, 0x80, 0x00, 0x33, 0x00, 0x42, 0x03, 0x03, 0xf1, 0x22, 0xc0, 0x8b,
+    0x00, 0x01, 0x80, 0x80, 0x99, 0x00, 0x0a, 0xc0, 0x40, 0x00, 0x80, 0xa0, 0xb0, 0x98, 0x50, 0x68,
+    0x7a, 0x74, 0x82, 0x76, 0x07, 0x66, 0xe6, 0xc6, 0xc4, 0x88, 0x12, 0xf0, 0x20, 0x02, 0x22, 0x00,
+    0x01, 0x00, 0x00, 0x33, 0x00, 0x41, 0x02, 0xf4, 0x43, 0xc0, 0x8b, 0x00, 0x01, 0x80, 0x80, 0x9a,
+    0x00, 0x0a, 0xc0, 0x00, 0x00, 0x80, 0xa0, 0xb0, 0x98, 0x58, 0x60, 0x6a, 0x74, 0x82, 0x76, 0x06,
+    0x66, 0xe6, 0xc6, 0xcc, 0x89, 0x12, 0xd0, 0x02, 0x22, 0x3e, 0x3f, 0x00, 0x00, 0x33, 0x00, 0x42,
+    0x02, 0xc7, 0x02, 0x80, 0x8b, 0x00, 0x00, 0x80, 0x9b, 0x00, 0x15, 0xc0, 0x80, 0x80, 0x00, 0xa0,
+    0xb0, 0x90, 0xd0, 0x60, 0x6a, 0x74, 0x74, 0x76, 0x66, 0xe6, 0xe6, 0xc6, 0x8c, 0x09, 0x12, 0xc0,
+    0xa0, 0x01, 0x33, 0x00, 0x40, 0x01, 0x62, 0x80, 0xa9, 0x00, 0x0c, 0x80, 0x80, 0x00, 0x00, 0xa0,
+    0xa0, 0x90, 0xd0, 0x60, 0x6a, 0x6c, 0x74, 0x76, 0x82, 0xe6, 0x03, 0xc4, 0x8c, 0x09, 0x32, 0x02,
+    0x22, 0x3c, 0x3d, 0x00, 0x80, 0x33, 0x00, 0x42, 0x00, 0x80, 0xab, 0x00, 0x00, 0x80, 0x82, 0x00,
+    0x06, 0xa0, 0x80, 0xd0, 0xe0, 0xea, 0x6e, 0x64, 0x82, 0xe6, 0x06, 0xc6, 0xcc, 0x8c, 0x19, 0x32,
+    0xc0, 0x00, 0x01, 0x33, 0x2d, 0x40, 0x82, 0x00, 0x0f, 0x40, 0xb0, 0x80, 0xd0, 0xe8, 0xea, 0xee,
+    0xe4, 0xe7, 0xe6, 0xe6, 0xc6, 0xcc, 0x8c, 0x19, 0x22, 0x02, 0x22, 0x3a, 0x3b, 0x00, 0x80, 0x33,
+    0x00, 0x3e, 0xa9, 0x00, 0x00, 0x80, 0x84, 0x00, 0x0d, 0x40, 0xb0, 0x80, 0xd0, 0xe8, 0xea, 0xee,
+    0xec, 0xe7, 0xe6, 0xe6, 0xcc, 0x8c, 0x88, 0x02, 0x22, 0x3b, 0x3c, 0x00, 0x80, 0x33, 0x2b, 0x41,
+    0x00, 0x80, 0x82, 0x00, 0x11, 0x40, 0x40, 0x30, 0xa0, 0xc0, 0xfc, 0xe8, 0xee, 0xec, 0xef, 0xe6,
+    0xc6, 0xcc, 0x8c, 0x09, 0x11, 0x22, 0xe0, 0x01, 0x33, 0x2f, 0x42, 0x12, 0x00, 0x40, 0x30, 0xa0,
+    0xc0, 0xd4, 0xe8, 0xee, 0xec, 0xef, 0xee, 0xce, 0xcc, 0x8c, 0x09, 0x11, 0x26, 0xa0, 0x40, 0x01,
+    0x33, 0x2b, 0x40, 0x83, 0x00, 0x10, 0x80, 0x40, 0x30, 0xb0, 0xc0, 0xd4, 0xe8, 0xee, 0xec, 0xed,
+    0xce, 0xcc, 0xcc, 0x8c, 0x19, 0x11, 0x66, 0x01, 0x33, 0x2a, 0x41, 0x85, 0x00, 0x10, 0x40, 0x30,
+    0xa0, 0xc0, 0xd4, 0xe8, 0xee, 0xec, 0xed, 0xcd, 0xcc, 0x8c, 0x8d, 0x19, 0x11, 0x64, 0x80, 0x02,
+    0x22, 0x3d, 0x3e, 0x00, 0x00, 0x33, 0x2f, 0x3f, 0x0f, 0x80, 0x40, 0x20, 0xa0, 0xc0, 0xd4, 0xc8,
+    0xee, 0xec, 0xcd, 0xcd, 0xcc, 0x8c, 0x89, 0x19, 0x33, 0x01, 0x33, 0x35, 0x42, 0x02, 0xd8, 0xca,
+    0xcc, 0x82, 0xcd, 0x06, 0x8d, 0x19, 0x19, 0x33, 0x44, 0x80, 0x00, 0x01, 0x33, 0x2e, 0x3f, 0x10,
+    0x80, 0x80, 0x40, 0x00, 0xa0, 0xd0, 0xd4, 0xd8, 0xc8, 0xcc, 0xcd, 0xcd, 0x8d, 0x8d, 0x19, 0x19,
+    0x32, 0x01, 0x33, 0x2e, 0x3f, 0x10, 0x00, 0x80, 0x40, 0x00, 0xa0, 0xd0, 0xd4, 0xd8, 0xd8, 0xcc,
+    0xcd, 0xcd, 0x8d, 0x9d, 0x19, 0x11, 0x22, 0x01, 0x33, 0x2f, 0x41, 0x11, 0xe0, 0x40, 0x40, 0x80,
+    0xa8, 0xd4, 0xd8, 0xd8, 0xcc, 0xcd, 0xcd, 0x8d, 0x99, 0x19, 0x11, 0x22, 0xc4, 0x40, 0x01, 0x33,
+    0x30, 0x42, 0x11, 0x60, 0x40, 0x80, 0xa8, 0xd4, 0xd8, 0xd8, 0xdc, 0xcd, 0x9d, 0x9d, 0x19, 0x19,
+    0x31, 0x22, 0xcc, 0x40, 0x80, 0x02, 0x22, 0x3c, 0x3d, 0x00, 0x00, 0x33, 0x2d, 0x41, 0x0a, 0x80,
+    0x00, 0xa0, 0x60, 0x60, 0x80, 0xa8, 0xd4, 0xdc, 0xd8, 0xdf, 0x82, 0x9d, 0x05, 0x19, 0x19, 0x33,
+    0x62, 0xcc, 0x00, 0x01, 0x33, 0x2f, 0x3b, 0x0b, 0x80, 0x40, 0x40, 0x80, 0xa8, 0x94, 0xdc, 0xd8,
+    0xdf, 0x9d, 0x9d, 0x99, 0x01, 0x33, 0x2e, 0x40, 0x11, 0x80, 0x80, 0x40, 0x40, 0x80, 0xa8, 0xb0,
+    0x9c, 0x98, 0x9b, 0x9d, 0x9d, 0x19, 0x19, 0x31, 0x33, 0x62, 0x88, 0x02, 0x22, 0x3b, 0x3c, 0x00,
+    0x00, 0x33, 0x2e, 0x42, 0x13, 0xc0, 0x80, 0x00, 0x40, 0xa0, 0xa8, 0xb0, 0x9c, 0x98, 0x9b, 0x99,
+    0x99, 0x19, 0x19, 0x31, 0x33, 0x66, 0x88, 0x00, 0x00, 0x01, 0x33, 0x38, 0x41, 0x08, 0x9b, 0x19,
+    0x19, 0x39, 0x33, 0x22, 0x46, 0x88, 0x80, 0x02, 0x22, 0x39, 0x3b, 0x01, 0x00, 0x00, 0x33, 0x2d,
+    0x40, 0x12, 0x00, 0xc0, 0x80, 0x00, 0x00, 0x50, 0xa8, 0xb0, 0xb4, 0x98, 0x9b, 0x9b, 0x19, 0x19,
+    0x39, 0x33, 0x62, 0x44, 0x98, 0x01, 0x33, 0x30, 0x3c, 0x0b, 0x80, 0x00, 0x50, 0xa8, 0xb0, 0xb4,
+    0x98, 0x9b, 0x1b, 0x1b, 0x39, 0x33, 0x01, 0x33, 0x2f, 0x41, 0x11, 0xc0, 0xc0, 0x40, 0x50, 0xa8,
+    0xb0, 0xb4, 0xba, 0xbb, 0x1b, 0x3b, 0x3b, 0x33, 0x33, 0x62, 0xc4, 0x98, 0x00, 0x01, 0x33, 0x2d,
+    0x40, 0x09, 0x80, 0x40, 0xc0, 0xc0, 0x00, 0x50, 0x28, 0xb0, 0xb4, 0xba, 0x83, 0x3b, 0x04, 0x33,
+    0x33, 0x62, 0xc4, 0x18, 0x01, 0x33, 0x2e, 0x40, 0x08, 0x00, 0x80, 0x80, 0x40, 0x50, 0x68, 0x30,
+    0x34, 0x3a, 0x82, 0x3b, 0x05, 0x33, 0x33, 0x63, 0x66, 0xc4, 0x38, 0x01, 0x33, 0x2f, 0x3f, 0x0f,
+    0x00, 0x80, 0x40, 0x50, 0x68, 0x30, 0x34, 0x3e, 0x3a, 0x3b, 0x3b, 0x33, 0x33, 0x62, 0x46, 0x84,
+    0x01, 0x33, 0x34, 0x40, 0x0b, 0x38, 0x34, 0x36, 0x3a, 0x3b, 0x33, 0x33, 0x73, 0x62, 0xc6, 0x8c,
+    0x30, 0x01, 0x33, 0x30, 0x40, 0x0f, 0x00, 0xa0, 0x50, 0x60, 0x78, 0x34, 0x36, 0x3a, 0x3b, 0x33,
+    0x33, 0x73, 0x62, 0xc6, 0x8c, 0x70, 0x01, 0x33, 0x37, 0x3f, 0x07, 0x32, 0x33, 0x33, 0x73, 0x63,
+    0x66, 0xc4, 0x88, 0x01, 0x33, 0x2e, 0x3a, 0x82, 0x80, 0x08, 0xa0, 0x50, 0x60, 0x68, 0x74, 0x36,
+    0x32, 0x33, 0x73, 0x01, 0x33, 0x30, 0x3d, 0x07, 0x00, 0xa0, 0x50, 0x60, 0x68, 0x74, 0x76, 0x76,
+    0x82, 0x73, 0x01, 0x62, 0xe6, 0x01, 0x33, 0x2d, 0x40, 0x82, 0x00, 0x0f, 0x80, 0xa0, 0xd0, 0x60,
+    0x68, 0x74, 0x76, 0x76, 0x73, 0x73, 0x63, 0x66, 0xc6, 0x84, 0x08, 0xf0, 0x01, 0x33, 0x38, 0x3e,
+    0x05, 0x77, 0x77, 0x66, 0xe6, 0xc6, 0x8c, 0x01, 0x33, 0x30, 0x40, 0x05, 0x00, 0xa0, 0xd0, 0x60,
+    0x68, 0x74, 0x82, 0x76, 0x06, 0x77, 0x66, 0xe6, 0xc6, 0x8c, 0x08, 0xe0, 0x01, 0x33, 0x30, 0x3f,
+    0x05, 0x40, 0xa0, 0xd0, 0xe0, 0x68, 0x74, 0x82, 0x76, 0x05, 0x66, 0xe6, 0xe6, 0xc4, 0x8c, 0x18,
+    0x01, 0x33, 0x30, 0x3c, 0x0b, 0x60, 0xa0, 0xd0, 0xe0, 0xe8, 0x6c, 0x76, 0x76, 0x66, 0xe6, 0xe6,
+    0xc6, 0x01, 0x33, 0x32, 0x3f, 0x05, 0xc0, 0xf0, 0xe8, 0xec, 0x66, 0x66, 0x82, 0xe6, 0x03, 0xc6,
+    0xcc, 0x8c, 0x10, 0x01, 0x33, 0x33, 0x3e, 0x02, 0xd0, 0xe8, 0xec, 0x84, 0xe6, 0x02, 0xc6, 0x8c,
+    0x08, 0x01, 0x33, 0x3a, 0x3b, 0x00, 0xc6, 0x01, 0x33, 0x36, 0x3c, 0x00, 0xec, 0x82, 0xe6, 0x01,
+    0xc6, 0xcc, 0x01, 0x33, 0x2f, 0x40, 0x07, 0xc0, 0x60, 0xa0, 0xc0, 0xd0, 0xe8, 0xec, 0xec, 0x82,
+    0xe6, 0x05, 0xc6, 0xcc, 0x8c, 0x18, 0x30, 0xc0, 0x01, 0x33, 0x30, 0x3c, 0x0b, 0x40, 0xa0, 0xc0,
+    0xd0, 0xe8, 0xec, 0xec, 0xee, 0xe6, 0xc6, 0xce, 0x8c, 0x01, 0x33, 0x34, 0x3d, 0x08, 0xc8, 0xec,
+    0xec, 0xee, 0xee, 0xce, 0xcc, 0x8c, 0x0c, 0x01, 0x33, 0x34, 0x3f, 0x0a, 0xd8, 0xec, 0xec, 0xee,
+    0xce, 0xce, 0xcc, 0x8c, 0x08, 0x18, 0x20, 0x01, 0x33, 0x32, 0x3e, 0x04, 0x80, 0xd0, 0xd8, 0xcc,
+    0xcc, 0x82, 0xce, 0x03, 0x8c, 0x8c, 0x18, 0x10, 0x01, 0x33, 0x31, 0x3a, 0x03, 0x80, 0xa0, 0xd0,
+    0xd8, 0x84, 0xcc, 0x01, 0x33, 0x2e, 0x3c, 0x06, 0x80, 0xc0, 0x40, 0x80, 0xa0, 0xd0, 0xd8, 0x84,
+    0xcc, 0x01, 0x8c, 0x0c, 0x01, 0x33, 0x35, 0x40, 0x00, 0xdc, 0x82, 0xcc, 0x06, 0x8c, 0x8c, 0x18,
+    0x18, 0x30, 0x60, 0x80, 0x00, 0x01, 0x33, 0x2f, 0x3b, 0x0b, 0x80, 0x40, 0x80, 0xa0, 0xd0, 0xd8,
+    0xdc, 0xdc, 0xcc, 0x8c, 0x8c, 0x9c, 0x01, 0x33, 0x33, 0x3f, 0x03, 0x90, 0xd8, 0xdc, 0xdc, 0x82,
+    0x9c, 0x04, 0x1c, 0x18, 0x10, 0x30, 0x40, 0x01, 0x33, 0x31, 0x3e, 0x04, 0x00, 0xa0, 0xb0, 0x98,
+    0xd8, 0x83, 0x9c, 0x03, 0x18, 0x18, 0x30, 0x20, 0x01, 0x33, 0x30, 0x3f, 0x05, 0x00, 0x00, 0xa0,
+    0xb0, 0x98, 0x98, 0x82, 0x9c, 0x05, 0x1c, 0x18, 0x18, 0x30, 0x20, 0xc0, 0x01, 0x03, 0x00, 0x80,
+    0xa6, 0xff, 0x05, 0x9f, 0xc7, 0xf1, 0xf8, 0xfc, 0xfe, 0x82, 0xff, 0x82, 0x7f, 0x30, 0xff, 0xbf,
+    0x3f, 0x5f, 0x5f, 0x4f, 0x67, 0x67, 0x63, 0x73, 0x71, 0xb0, 0x98, 0x48, 0xc8, 0x1c, 0x4c, 0x0a,
+    0x0a, 0x01, 0x0d, 0x05, 0x08, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x09, 0x0a, 0x05, 0x03, 0x0b,
+    0x1a, 0x1e, 0x14, 0xb0, 0x89, 0x73, 0x8f, 0x3f, 0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0x80, 0x92,
+    0x00, 0x02, 0x03, 0x0f, 0x3f, 0xab, 0xff, 0x1a, 0x6c, 0xa7, 0xc3, 0x83, 0x01, 0x61, 0x70, 0x08,
+    0x2c, 0xec, 0xde, 0xa7, 0x2f, 0x14, 0x0e, 0x04, 0x02, 0x01, 0x01, 0x02, 0x00, 0x00, 0x01, 0x01,
+    0x07, 0x02, 0x03, 0x94, 0x00, 0x08, 0x40, 0x40, 0x50, 0x10, 0xf1, 0xff, 0x00, 0x00, 0x07, 0x84,
+    0xff, 0x01, 0xfe, 0xf0, 0x93, 0x00, 0x00, 0x01, 0xaa, 0xff, 0x1d, 0xe6, 0x1c, 0x78, 0xf8, 0xf0,
+    0xf0, 0xf1, 0xe3, 0xe2, 0xe6, 0xee, 0xce, 0xde, 0xc3, 0xad, 0x85, 0x42, 0x58, 0x58, 0xe8, 0xf0,
+    0xe0, 0xd0, 0xd8, 0x98, 0x2e, 0x18, 0x00, 0x40, 0x40, 0x94, 0x00, 0x05, 0x29, 0xd9, 0x3f, 0x80,
+    0xe0, 0xfc, 0x83, 0xff, 0x02, 0x3f, 0x0f, 0x01, 0x92, 0x00, 0x01, 0x80, 0xf8, 0xac, 0xff, 0x0a,
+    0xfc, 0xf1, 0xe3, 0x87, 0x0f, 0x0f, 0x1f, 0x3f, 0x3f, 0x7f, 0x7f, 0x84, 0xff, 0x29, 0xfe, 0xfe,
+    0xfc, 0xf8, 0xf8, 0xf1, 0xf1, 0xe1, 0xc3, 0xc2, 0x85, 0x85, 0x08, 0x0a, 0x19, 0x34, 0x76, 0xe8,
+    0xc8, 0x20, 0xc0, 0xa0, 0x40, 0xe0, 0x60, 0x48, 0x36, 0x18, 0x8b, 0x8d, 0xc5, 0xe5, 0xe3, 0x72,
+    0x7c, 0x3e, 0x1f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x91, 0x00, 0x04, 0x80, 0xc0, 0xe0, 0xf8, 0xfe,
+    0x86, 0xff,
+};
+
+const struct anim anim_zoom = {
+    .frames = 240,
+    .frame_ticks = 1092,
+    .data = anim_zoom_data,
+    .loop = anim_zoom_data + 38284,
+};
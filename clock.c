@@ -0,0 +1,129 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#include "clock.h"
+
+#include <stdint.h>
+#include "platform.h"
+
+/** PLL limits */
+#define REF_MIN   6000000UL
+#define REF_MAX  12000000UL
+#define VCO_MIN 384000000UL
+#define VCO_MAX 768000000UL
+/** Time to wait after configuring the PLL before checking for lock, in
+ * 32768 Hz ticks (100 us)
+ */
+#define PLL_SETTLE_TICKS 4
+
+static unsigned long cpu_freq;
+
+unsigned long clock_pll_freq(const struct clock_pll *pll)
+{
+    if (pll->bypass) {
+        return CLOCK_XTAL_FREQ;
+    }
+    unsigned long f = CLOCK_XTAL_FREQ / (pll->r + 1) * 2 * (pll->f + 1) >> pll->q;
+    return pll->by1 ? f : f / (2 * (pll->div + 1));
+}
+
+unsigned long clock_pll_solve(unsigned long freq, struct clock_pll *pll)
+{
+    struct clock_pll best = {.bypass = 1};
+    unsigned long best_freq = 0;
+    if (freq > CLOCK_MAX_FREQ) {
+        freq = CLOCK_MAX_FREQ;
+    }
+    for (unsigned r=0; r<4; ++r) {
+        unsigned long ref = CLOCK_XTAL_FREQ / (r + 1);
+        if (ref < REF_MIN || ref > REF_MAX) {
+            continue;
+        }
+        for (unsigned f=0; f<64; ++f) {
+            unsigned long vco = ref * 2 * (f + 1);
+            if (vco < VCO_MIN || vco > VCO_MAX) {
+                continue;
+            }
+            for (unsigned q=1; q<4; ++q) {
+                /* Final divider: by 1, then by 2*(div+1) for decreasing frequency */
+                for (int div=-1; div<64; ++div) {
+                    struct clock_pll cand = {0, r, f, q, div < 0, div < 0 ? 0 : div};
+                    unsigned long cand_freq = clock_pll_freq(&cand);
+                    if (cand_freq <= freq) {
+                        if (cand_freq > best_freq) {
+                            best = cand;
+                            best_freq = cand_freq;
+                        }
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    if (best_freq <= CLOCK_XTAL_FREQ && freq >= CLOCK_XTAL_FREQ) {
+        /* The crystal is exact and needs no PLL */
+        best = (struct clock_pll){.bypass = 1};
+        best_freq = CLOCK_XTAL_FREQ;
+    } else if (best_freq == 0) {
+        best_freq = CLOCK_XTAL_FREQ;
+    }
+    *pll = best;
+    return best_freq;
+}
+
+unsigned clock_spi_div(unsigned long fin, unsigned long fmax)
+{
+    unsigned long div = (fin + 2 * fmax - 1) / (2 * fmax);
+    return div ? div - 1 : 0;
+}
+
+static void wait_ticks(unsigned n)
+{
+    uint64_t start = get_timer_value();
+    while (get_timer_value() - start < n)
+        ;
+}
+
+unsigned long clock_init(unsigned long freq)
+{
+    struct clock_pll pll;
+    unsigned long new_freq = clock_pll_solve(freq, &pll);
+
+    // Run from the internal oscillator while the PLL is reconfigured
+    PRCI_REG(PRCI_HFROSCCFG) |= ROSC_EN(1);
+    while (!(PRCI_REG(PRCI_HFROSCCFG) & ROSC_RDY(1)))
+        ;
+    PRCI_REG(PRCI_PLLCFG) &= ~PLL_SEL(1);
+
+    // Crystal as reference
+    PRCI_REG(PRCI_HFXOSCCFG) = XOSC_EN(1);
+    while (!(PRCI_REG(PRCI_HFXOSCCFG) & XOSC_RDY(1)))
+        ;
+
+    if (pll.bypass) {
+        PRCI_REG(PRCI_PLLCFG) = PLL_REFSEL(1) | PLL_BYPASS(1);
+        // The final divider also applies to the bypassed PLL
+        PRCI_REG(PRCI_PLLDIV) = PLL_FINAL_DIV_BY_1(1) | PLL_FINAL_DIV(0);
+    } else {
+        PRCI_REG(PRCI_PLLCFG) = PLL_REFSEL(1) | PLL_R(pll.r) | PLL_F(pll.f) | PLL_Q(pll.q);
+        PRCI_REG(PRCI_PLLDIV) = PLL_FINAL_DIV_BY_1(pll.by1) | PLL_FINAL_DIV(pll.div);
+        // Lock may read as set before the PLL has settled
+        wait_ticks(PLL_SETTLE_TICKS);
+        while (!(PRCI_REG(PRCI_PLLCFG) & PLL_LOCK(1)))
+            ;
+    }
+    PRCI_REG(PRCI_PLLCFG) |= PLL_SEL(1);
+    PRCI_REG(PRCI_HFROSCCFG) &= ~ROSC_EN(1);
+
+    cpu_freq = new_freq;
+    return cpu_freq;
+}
+
+unsigned long clock_cpu_freq(void)
+{
+    if (!cpu_freq) {
+        /* Not configured: measured by the BSP */
+        cpu_freq = get_cpu_freq();
+    }
+    return cpu_freq;
+}
@@ -0,0 +1,55 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#ifndef H_CLOCK
+#define H_CLOCK
+/* Core clock configuration.
+ *
+ * The core runs from the PLL, which takes the 16 MHz crystal (HFXOSC)
+ * divided down to a reference of 6 to 12 MHz, multiplies it to a VCO of
+ * 384 to 768 MHz, and divides that by 2, 4 or 8 and then by a final divider:
+ *
+ *   f = 16 MHz / (r+1) * 2*(f+1) / 2^q / (by1 ? 1 : 2*(div+1))
+ *
+ * The real-time clock (mtime) is not affected, so timing in 32768 Hz ticks
+ * stays the same at any core frequency. Anything counted in cycles must be
+ * converted with clock_cpu_freq().
+ */
+#include <stdint.h>
+
+/** Crystal frequency of the HiFive1 */
+#define CLOCK_XTAL_FREQ 16000000UL
+/** Highest supported core frequency */
+#define CLOCK_MAX_FREQ 320000000UL
+
+/** PLL settings, as register field values */
+struct clock_pll {
+    uint8_t bypass; /**< PLL bypassed: core runs at crystal frequency */
+    uint8_t r;      /**< reference divider: divide by r+1 */
+    uint8_t f;      /**< multiplier: multiply by 2*(f+1) */
+    uint8_t q;      /**< output divider: divide by 2^q */
+    uint8_t by1;    /**< final divider bypassed */
+    uint8_t div;    /**< final divider: divide by 2*(div+1) */
+};
+
+/** Frequency in Hz that PLL settings produce */
+unsigned long clock_pll_freq(const struct clock_pll *pll);
+/** Find PLL settings for the highest frequency not above freq. Returns
+ * that frequency. Below the lowest PLL frequency, or at the crystal
+ * frequency, the PLL is bypassed.
+ */
+unsigned long clock_pll_solve(unsigned long freq, struct clock_pll *pll);
+/** SPI clock divider for the fastest SCK not above fmax, with
+ * Fsck = fin/(2*(div+1))
+ */
+unsigned clock_spi_div(unsigned long fin, unsigned long fmax);
+
+/** Switch the core to the highest frequency not above freq. Returns the
+ * new frequency. Peripherals that depend on the core clock (UART baud rate,
+ * SPI clock) must be set up again afterwards.
+ */
+unsigned long clock_init(unsigned long freq);
+/** Current core frequency in Hz */
+unsigned long clock_cpu_freq(void);
+
+#endif
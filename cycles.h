@@ -0,0 +1,24 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#ifndef H_CYCLES
+#define H_CYCLES
+/* Cycle counting */
+
+#include <stdint.h>
+
+#ifdef HOST
+/** Simulated cycle counter of the host emulator */
+uint32_t host_rdcycle(void);
+#define rdcycle host_rdcycle
+#else
+/** Read low 32 bits of cycle counter */
+static inline uint32_t rdcycle(void)
+{
+    uint32_t cycles;
+    asm volatile ("rdcycle %0" : "=r"(cycles));
+    return cycles;
+}
+#endif
+
+#endif
@@ -1,11 +1,18 @@
 #include "display.h"
 
-#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "platform.h"
 
 #include "sleep.h"
 #include "bits.h"
+#include "gpio.h"
+#include "irq.h"
+#include "perf.h"
+#include "cycles.h"
+#include "clock.h"
+#include "events.h"
+#include "uart.h"
 
 /**
  * Define the following to fall back to GPIO bitbanging,
@@ -39,6 +46,11 @@
  *
  * Oled is the name of the pin at the side of the PMODoled module
  *
+ * This is the wiring of the first module, the pins of which are given to
+ * pmodoled_init() in a pmodoled_t. Further modules share SDIN, SCLK and D/C
+ * with it and need a chip select of their own; RES, Vbatc and Vddc can be
+ * shared or separate.
+ *
  ** Hard constraints on wiring:
  *
  * To use SPI controller instead of bitbanging,
@@ -49,8 +61,9 @@
  ** SPI Setup
  *
  * SPI_REG_SCKDIV
- *   Fsck = Fin/(2*(div+1))   Fin=tlclk=cpuclk=16 MHz
- *   So at least 1, which puts the clock rate at 8 MHz (of max 10 MHz)
+ *   Fsck = Fin/(2*(div+1))   Fin=tlclk=cpuclk
+ *   The smallest div that keeps Fsck at most 10 MHz: 0 (8 MHz) at 16 MHz,
+ *   15 (10 MHz) at 320 MHz. See clock_spi_div().
  *
  * SPI_REG_CSMODE
  *   mode
@@ -66,189 +79,703 @@
  *   endian
  *     0 Data is clocked from bit 7 (MSB) to bit 0 (LSB)
  *   dir
- *     1 Tx: the receive fifo is not populated
+ *     0 Rx: every byte shifted out also puts one in the receive fifo, which
+ *       tells when it has left the shift register
  *   len
  *     8 bits per frame
  */
-#define OLED_CS    23
 #define OLED_SDIN  3
 #define OLED_SCLK  5
 #define OLED_DC    2
-#define OLED_RES   0
-#define OLED_VBATC 1
-#define OLED_VDDC  4
 
 /** SPI speed cannot exceed 10MHz for SSD1306 */
 #define MAX_SPI_FREQ (10000000)
 
+/********* Modules **********
+ *
+ * Bytes are addressed to a module by chip select and D/C level. Both are
+ * tracked for the bytes queued last, and only changed when a byte needs a
+ * different one, so flushing several modules in a row costs one switch per
+ * module and mode.
+ *
+ * The chip selects are plain GPIO outputs. With the SPI controller they are
+ * changed by the transmit interrupt, so the main program changes GPIO
+ * outputs with gpio_set() and gpio_clear() only, which cannot undo a chip
+ * select switched in between.
+ */
+/** No module selected */
+#define PANEL_NONE PMODOLED_MAX
+/** D/C level for command and data bytes */
+#define DC_CMD  0
+#define DC_DATA 1
+
+/** GPIO mask of the chip select of every module (0 for PANEL_NONE), and of
+ * all of them */
+static uint32_t cs_mask[PMODOLED_MAX + 1];
+static uint32_t cs_all;
+/** Module and D/C level of the bytes queued last */
+static unsigned cur_panel = PANEL_NONE;
+static unsigned cur_dc = DC_CMD;
+
+/** Address the following bytes to module panel with D/C level dc */
+static void bus_select(unsigned panel, unsigned dc);
+
+#ifdef HOST
+/** Bytes queued for the display bus since startup, so that the emulator
+ * knows where a frame ends in the stream (see host_frame())
+ */
+static unsigned long bus_bytes;
+#define BUS_COUNT(n) (bus_bytes += (n))
+#else
+#define BUS_COUNT(n) do {} while (0)
+#endif
+
+/** Address the following bytes to module panel with D/C level dc, if they
+ * are not already */
+static inline void bus_mode(unsigned panel, unsigned dc)
+{
+    if (panel != cur_panel || dc != cur_dc) {
+        bus_select(panel, dc);
+        cur_panel = panel;
+        cur_dc = dc;
+    }
+}
+
 #ifdef SPI_BITBANG
+/********* Bitbang **********
+ *
+ * Every bit is two full stores to the GPIO output register: SCLK low with
+ * the new SDIN level, then SCLK high. The other output bits are read once per
+ * call, which is safe because no interrupt handler changes GPIO outputs.
+ * The SDIN level of every bit of a nibble comes from a table, so a byte is
+ * two lookups and sixteen stores.
+ *
+ * If the stores alone are faster than MAX_SPI_FREQ allows, SCLK is held low
+ * and high for at least half a period each, timed with rdcycle.
+ */
+/** Stores timed to calibrate the bitbang delay */
+#define BB_CAL_STORES 32
+
+/** SDIN mask for every bit of a nibble, MSB first */
+static uint32_t bb_nibble[16][4];
+/** Minimum cycles per half SCLK period, 0 if no delay is needed */
+static uint32_t bb_half;
+
 void spi_init(void)
 {
+    for (unsigned nib=0; nib<16; ++nib) {
+        for (unsigned bit=0; bit<4; ++bit) {
+            bb_nibble[nib][bit] = (nib & (8 >> bit)) ? BIT(OLED_SDIN) : 0;
+        }
+    }
+    // Time stores to the output register, with SCLK held low
+    uint32_t base = GPIO_REG(GPIO_OUTPUT_VAL) & ~(BIT(OLED_SCLK) | BIT(OLED_SDIN));
+    uint32_t start = rdcycle();
+    for (unsigned i=0; i<BB_CAL_STORES; ++i) {
+        GPIO_REG(GPIO_OUTPUT_VAL) = base;
+    }
+    uint32_t store = (rdcycle() - start) / BB_CAL_STORES;
+    uint32_t half = (clock_cpu_freq() + 2 * MAX_SPI_FREQ - 1) / (2 * MAX_SPI_FREQ);
+    bb_half = store >= half ? 0 : half;
 }
 
-void spi(uint8_t data)
+/** Output register value with SCLK and SDIN low */
+static inline uint32_t bb_base(void)
+{
+    return GPIO_REG(GPIO_OUTPUT_VAL) & ~(BIT(OLED_SCLK) | BIT(OLED_SDIN));
+}
+
+/** Clock out a nibble as fast as the stores go */
+static inline void bb_nibble_fast(uint32_t base, const uint32_t *bits)
 {
-    unsigned bit;
     // Value of SDIN is sampled at SCLK's rising edge
     // so put in new bit at falling edge
-    // Data is clocked from bit 7 (MSB) to bit 0 (LSB)
-    for (bit=0; bit<8; ++bit) {
-        GPIO_REG(GPIO_OUTPUT_VAL) &= ~BIT(OLED_SCLK);
-        if (data & (1<<(7-bit))) {
-            GPIO_REG(GPIO_OUTPUT_VAL) |= BIT(OLED_SDIN);
-        } else {
-            GPIO_REG(GPIO_OUTPUT_VAL) &= ~BIT(OLED_SDIN);
+    GPIO_REG(GPIO_OUTPUT_VAL) = base | bits[0];
+    GPIO_REG(GPIO_OUTPUT_VAL) = base | bits[0] | BIT(OLED_SCLK);
+    GPIO_REG(GPIO_OUTPUT_VAL) = base | bits[1];
+    GPIO_REG(GPIO_OUTPUT_VAL) = base | bits[1] | BIT(OLED_SCLK);
+    GPIO_REG(GPIO_OUTPUT_VAL) = base | bits[2];
+    GPIO_REG(GPIO_OUTPUT_VAL) = base | bits[2] | BIT(OLED_SCLK);
+    GPIO_REG(GPIO_OUTPUT_VAL) = base | bits[3];
+    GPIO_REG(GPIO_OUTPUT_VAL) = base | bits[3] | BIT(OLED_SCLK);
+}
+
+/** Wait until bb_half cycles have passed since start */
+static inline void bb_wait(uint32_t start)
+{
+    while (rdcycle() - start < bb_half)
+        IDLE;
+}
+
+/** Clock out a nibble, with SCLK low and high for at least bb_half cycles each */
+static inline void bb_nibble_timed(uint32_t base, const uint32_t *bits)
+{
+    for (unsigned bit=0; bit<4; ++bit) {
+        GPIO_REG(GPIO_OUTPUT_VAL) = base | bits[bit];
+        bb_wait(rdcycle());
+        GPIO_REG(GPIO_OUTPUT_VAL) = base | bits[bit] | BIT(OLED_SCLK);
+        bb_wait(rdcycle());
+    }
+}
+
+/** Clock out n bytes from data, or n times value if step is 0 */
+static void bb_send(const uint8_t *data, size_t step, size_t n)
+{
+    uint32_t base = bb_base();
+    BUS_COUNT(n);
+    if (!bb_half) {
+        for (size_t i=0; i<n; ++i, data+=step) {
+            bb_nibble_fast(base, bb_nibble[*data >> 4]);
+            bb_nibble_fast(base, bb_nibble[*data & 15]);
+        }
+    } else {
+        for (size_t i=0; i<n; ++i, data+=step) {
+            bb_nibble_timed(base, bb_nibble[*data >> 4]);
+            bb_nibble_timed(base, bb_nibble[*data & 15]);
         }
-        GPIO_REG(GPIO_OUTPUT_VAL) |= BIT(OLED_SCLK);
-        // Maximum SCLK is 10 MHz
-        // Would need to insert delay here at high clock speeds
     }
 }
-void spi_complete()
+
+void spi(uint8_t data)
+{
+    bb_send(&data, 0, 1);
+}
+void spi_write(const uint8_t *data, size_t n)
+{
+    bb_send(data, 1, n);
+}
+void spi_fill(uint8_t value, size_t n)
+{
+    bb_send(&value, 0, n);
+}
+void spi_wait()
 {
     /* no-op with synchronous bit-banging */
 }
-void mode_data(void)
+int spi_queue_empty(void)
 {
-    GPIO_REG(GPIO_OUTPUT_VAL)  |= BIT(OLED_DC);
+    return 1;
 }
-void mode_cmd(void)
+static void bus_select(unsigned panel, unsigned dc)
 {
-    GPIO_REG(GPIO_OUTPUT_VAL)  &= ~BIT(OLED_DC);
+    uint32_t out = (GPIO_REG(GPIO_OUTPUT_VAL) | cs_all) & ~cs_mask[panel];
+    if (dc) {
+        out |= BIT(OLED_DC);
+    } else {
+        out &= ~BIT(OLED_DC);
+    }
+    GPIO_REG(GPIO_OUTPUT_VAL) = out;
 }
 
 #else
 
+/********* Transmit queue **********
+ *
+ * Bytes are queued in a ring buffer which is drained into the SPI
+ * controller FIFO by the SPI1 transmit watermark interrupt. D/C is driven
+ * through the hardware chip select (CSID), which can only be changed when no
+ * byte is being sent, so mode switches are queued in-band as markers. The
+ * same markers switch the module chip select.
+ *
+ * The transmit FIFO empties while its last byte is still in the shift
+ * register. To know when that byte is out, the controller runs full duplex:
+ * every byte sent puts one in the receive FIFO once its last bit has gone,
+ * and the interrupt handler counts the bytes it wrote against those it reads
+ * back. At a marker it waits for the receive watermark until the count is
+ * zero. Writing no more than the receive FIFO holds keeps any from being
+ * lost.
+ */
+/** Size of transmit queue in entries, must be a power of two */
+#define SPI_QUEUE_SIZE 1024
+/** Depth of SPI controller transmit FIFO */
+#define SPI_FIFO_DEPTH 8
+/** Queue entry is a marker: bit 0 is the new CSID, bits 1-3 the module */
+#define SPIQ_MARK 0x100
+#define SPIQ_PANEL(panel) ((panel) << 1)
+#define SPIQ_PANEL_OF(entry) (((entry) >> 1) & 7)
+/** CSID for command and data mode: D/C is low when SS0 is selected */
+#define CSID_CMD  0
+#define CSID_DATA 1
+/** Transmit watermark while streaming: interrupt when FIFO is less than half full */
+#define SPI_TXMARK_REFILL 4
+/** Transmit watermark for completion: interrupt when FIFO is empty */
+#define SPI_TXMARK_EMPTY 1
+/** Transmit watermark that never interrupts */
+#define SPI_TXMARK_OFF 0
+/** Receive watermark while streaming: interrupt only when the FIFO is full */
+#define SPI_RXMARK_FULL (SPI_FIFO_DEPTH - 1)
+
+static uint16_t spi_queue[SPI_QUEUE_SIZE];
+/** Producer index, only written outside interrupt */
+static volatile unsigned spi_head;
+/** Consumer index, only written by interrupt handler */
+static volatile unsigned spi_tail;
+/** Current transmit watermark */
+static unsigned spi_txmark;
+/** Module selected by the interrupt handler */
+static unsigned spi_panel = PANEL_NONE;
+/** Bytes written to the transmit FIFO whose receive FIFO entry has not been
+ * read yet, only used by interrupt handler */
+static unsigned spi_inflight;
+
+static void spi_set_txmark(unsigned mark)
+{
+    spi_txmark = mark;
+    SPI1_REG(SPI_REG_TXCTRL) = mark;
+}
+
+/** Read back the receive FIFO entries of the bytes that are out */
+static inline void spi_rx_drain(void)
+{
+    while (spi_inflight && !(SPI1_REG(SPI_REG_RXFIFO) & SPI_RXFIFO_EMPTY)) {
+        --spi_inflight;
+    }
+}
+
+/** SPI1 interrupt: move queued bytes to the FIFO.
+ * The FIFO is refilled in batches: every byte in the transmit FIFO is also
+ * in flight, so the free space can be written without checking for full on
+ * every byte.
+ */
+static void spi_isr(void)
+{
+    PERF_START(t);
+    unsigned tail = spi_tail;
+    unsigned head = spi_head;
+    spi_rx_drain();
+    while (tail != head) {
+        uint16_t entry = spi_queue[tail % SPI_QUEUE_SIZE];
+        if (entry & SPIQ_MARK) {
+            spi_rx_drain();
+            if (spi_inflight) {
+                /* D/C and chip select must hold until the last byte is out:
+                 * come back when its receive FIFO entry is in */
+                spi_set_txmark(SPI_TXMARK_OFF);
+                SPI1_REG(SPI_REG_RXCTRL) = spi_inflight - 1;
+                break;
+            }
+            SPI1_REG(SPI_REG_CSID) = entry & 1;
+            unsigned panel = SPIQ_PANEL_OF(entry);
+            if (panel != spi_panel) {
+                gpio_set(cs_all & ~cs_mask[panel]);
+                gpio_clear(cs_mask[panel]);
+                spi_panel = panel;
+            }
+            if (spi_txmark != SPI_TXMARK_REFILL) {
+                spi_set_txmark(SPI_TXMARK_REFILL);
+                SPI1_REG(SPI_REG_RXCTRL) = SPI_RXMARK_FULL;
+            }
+        } else {
+            if (spi_inflight == SPI_FIFO_DEPTH) {
+                spi_rx_drain();
+                if (spi_inflight == SPI_FIFO_DEPTH) {
+                    break;
+                }
+            }
+            SPI1_REG(SPI_REG_TXFIFO) = entry;
+            ++spi_inflight;
+        }
+        if (++tail == head) {
+            head = spi_head; /* pick up anything queued in the meantime */
+        }
+    }
+    spi_tail = tail;
+    if (tail == head) {
+        /* Queue empty: disable interrupt, leave watermark set up for spi_wait */
+        spi_set_txmark(SPI_TXMARK_EMPTY);
+        SPI1_REG(SPI_REG_RXCTRL) = SPI_RXMARK_FULL;
+        SPI1_REG(SPI_REG_IE) = 0;
+        event_post(EVENT_SPI_IDLE);
+    } else if (spi_txmark == SPI_TXMARK_EMPTY) {
+        spi_set_txmark(SPI_TXMARK_REFILL);
+    }
+    PERF_STOP(PERF_SPI_ISR, t);
+}
+
+/** Start draining the queue. Must be called after adding entries. Which of
+ * the two interrupts can fire is up to the watermarks the handler sets.
+ */
+static inline void spi_queue_kick(void)
+{
+    SPI1_REG(SPI_REG_IE) = SPI_IP_TXWM | SPI_IP_RXWM;
+}
+
+/** Wait until there is free space in the queue, return amount of free space */
+static inline unsigned spi_queue_space(void)
+{
+    unsigned space = SPI_QUEUE_SIZE - (spi_head - spi_tail);
+    if (space == 0) {
+        PERF_START(t);
+        do {
+            PERF_COUNT(PERF_QUEUE_FULL, 1);
+            spi_queue_kick();
+            /* The interrupt stays enabled while the queue is not empty */
+            irq_wait();
+        } while ((space = SPI_QUEUE_SIZE - (spi_head - spi_tail)) == 0);
+        PERF_STOP(PERF_SPI_STALL, t);
+    }
+    return space;
+}
+
+/** Add an entry to the queue, waiting for space if it is full */
+static inline void spi_queue_put(uint16_t entry)
+{
+    unsigned head = spi_head;
+    spi_queue_space();
+    spi_queue[head % SPI_QUEUE_SIZE] = entry;
+    spi_head = head + 1;
+}
+
+void spi(uint8_t data)
+{
+    spi_queue_put(data);
+    BUS_COUNT(1);
+    spi_queue_kick();
+}
+
+void spi_write(const uint8_t *data, size_t n)
+{
+    while (n) {
+        unsigned head = spi_head;
+        unsigned batch = spi_queue_space();
+        if (batch > n) {
+            batch = n;
+        }
+        for (unsigned i=0; i<batch; ++i) {
+            spi_queue[(head + i) % SPI_QUEUE_SIZE] = data[i];
+        }
+        spi_head = head + batch;
+        BUS_COUNT(batch);
+        spi_queue_kick();
+        data += batch;
+        n -= batch;
+    }
+}
+
+void spi_fill(uint8_t value, size_t n)
+{
+    while (n) {
+        unsigned head = spi_head;
+        unsigned batch = spi_queue_space();
+        if (batch > n) {
+            batch = n;
+        }
+        for (unsigned i=0; i<batch; ++i) {
+            spi_queue[(head + i) % SPI_QUEUE_SIZE] = value;
+        }
+        spi_head = head + batch;
+        BUS_COUNT(batch);
+        spi_queue_kick();
+        n -= batch;
+    }
+}
+
+void spi_wait()
+{
+    PERF_START(t);
+    /* Sleep until the queue has drained. Check with interrupts disabled,
+     * so that the last interrupt cannot come between check and wait.
+     */
+    irq_disable();
+    while (spi_tail != spi_head) {
+        irq_wait();
+        irq_enable();
+        irq_disable();
+    }
+    irq_enable();
+    /* The last bytes in the FIFO take at most a few microseconds */
+    while (!(SPI1_REG(SPI_REG_IP) & SPI_IP_TXWM))
+        IDLE;
+    PERF_STOP(PERF_SPI_WAIT, t);
+}
+
+int spi_queue_empty(void)
+{
+    return spi_tail == spi_head;
+}
+
+static void bus_select(unsigned panel, unsigned dc)
+{
+    spi_queue_put(SPIQ_MARK | SPIQ_PANEL(panel) | (dc ? CSID_DATA : CSID_CMD));
+    spi_queue_kick();
+}
+
 void spi_init(void)
 {
     // Select IOF SPI1.MOSI [SDIN] and SPI1.SCK [SLCK] and SPI1.SS0 [DC]
     GPIO_REG(GPIO_IOF_SEL)    &= ~(BIT(OLED_SDIN) | BIT(OLED_SCLK) | BIT(OLED_DC));
     GPIO_REG(GPIO_IOF_EN )    |=  (BIT(OLED_SDIN) | BIT(OLED_SCLK) | BIT(OLED_DC));
-    GPIO_REG(GPIO_OUTPUT_VAL) |=  (BIT(OLED_SDIN) | BIT(OLED_SCLK) | BIT(OLED_DC)); /* is this necessary? */
+    gpio_set(BIT(OLED_SDIN) | BIT(OLED_SCLK) | BIT(OLED_DC)); /* is this necessary? */
 
     // Set up SPI controller
     /** SPI clock divider: determines the speed of SPI
      * transfers. This cannot exceed 10Mhz for the SSD1306.
-     * CPUfreq is set to 16Mhz in this demo.
-     * The formula is CPU_FREQ/(1+SPI_SCKDIV)
+     * The formula is Fsck = CPU_FREQ/(2*(1+SPI_SCKDIV))
      */
-    SPI1_REG(SPI_REG_SCKDIV)    = (get_cpu_freq() / MAX_SPI_FREQ) - 1;
+    SPI1_REG(SPI_REG_SCKDIV)    = clock_spi_div(clock_cpu_freq(), MAX_SPI_FREQ);
     SPI1_REG(SPI_REG_SCKMODE)   = 0; /* pol and pha both 0 - SCLK is active-high, */
-    SPI1_REG(SPI_REG_CSID)      = 0; /* CS 0 */
+    SPI1_REG(SPI_REG_CSID)      = CSID_CMD;
     SPI1_REG(SPI_REG_CSDEF)     = 0xffff; /* CS is active-low */
     SPI1_REG(SPI_REG_CSMODE)    = SPI_CSMODE_HOLD; /* hold CS where possible */
     /* SPI1_REG(SPI_REG_DCSSCK)    = */
     /* SPI1_REG(SPI_REG_DSCKCS)    = */
     /* SPI1_REG(SPI_REG_DINTERCS)  = */
     /* SPI1_REG(SPI_REG_DINTERXFR) = */
-    SPI1_REG(SPI_REG_FMT)       = SPI_FMT_PROTO(SPI_PROTO_S) | SPI_FMT_ENDIAN(SPI_ENDIAN_MSB) | SPI_FMT_DIR(SPI_DIR_TX) | SPI_FMT_LEN(8);
-    SPI1_REG(SPI_REG_TXCTRL)    = 1; /* interrupt when <1 in tx fifo (completion) */
-    /* SPI1_REG(SPI_REG_RXCTRL)    = */
-    /* SPI1_REG(SPI_REG_IE)        = */
-}
-
-void spi(uint8_t data)
-{
-    while (SPI1_REG(SPI_REG_TXFIFO) & SPI_TXFIFO_FULL)
-        IDLE;
-    SPI1_REG(SPI_REG_TXFIFO) = data;
-}
-
-void spi_complete()
-{
-    // Wait for interrupt condition.
-    // It would be more efficient to use an actual interrupt here.
-    while (!(SPI1_REG(SPI_REG_IP) & SPI_IP_TXWM))
-        IDLE;
+    SPI1_REG(SPI_REG_FMT)       = SPI_FMT_PROTO(SPI_PROTO_S) | SPI_FMT_ENDIAN(SPI_ENDIAN_MSB) | SPI_FMT_DIR(SPI_DIR_RX) | SPI_FMT_LEN(8);
+    spi_set_txmark(SPI_TXMARK_EMPTY); /* interrupt when <1 in tx fifo (completion) */
+    SPI1_REG(SPI_REG_RXCTRL)    = SPI_RXMARK_FULL; /* interrupt when rx fifo is full */
+    SPI1_REG(SPI_REG_IE)        = 0; /* enabled when there is something in the queue */
+    irq_register(INT_SPI1_BASE, spi_isr, 1);
 }
+#endif
 
 void mode_data(void)
 {
-    spi_complete(); /* wait for SPI to complete before toggling */
-    SPI1_REG(SPI_REG_CSID)      = 1; /* CS 1 */
+    bus_mode(cur_panel, DC_DATA);
 }
 
 void mode_cmd(void)
 {
-    spi_complete(); /* wait for SPI to complete before toggling */
-    SPI1_REG(SPI_REG_CSID)      = 0; /* CS 0 */
+    bus_mode(cur_panel, DC_CMD);
 }
-#endif
 
-/** Initialize pmodoled module */
-void pmodoled_init()
+void pmodoled_init(pmodoled_t *panels, unsigned n)
 {
+    uint32_t res = 0, vbatc = 0, vddc = 0;
+    if (n > PMODOLED_MAX) {
+        n = PMODOLED_MAX;
+    }
+    cs_all = 0;
+    for (unsigned i=0; i<n; ++i) {
+        pmodoled_t *p = &panels[i];
+        p->index = i;
+        p->start_line = 0;
+        /* Display memory is cleared below, so the framebuffer starts out in sync */
+        memset(p->fb, 0, sizeof(p->fb));
+        memset(p->dirty_end, 0, sizeof(p->dirty_end));
+        cs_mask[i] = BIT(p->cs);
+        cs_all |= BIT(p->cs);
+        res |= BIT(p->res);
+        vbatc |= BIT(p->vbatc);
+        vddc |= BIT(p->vddc);
+    }
+    cur_panel = PANEL_NONE;
+
     // Set up OLED pins: all are output
-    GPIO_REG(GPIO_INPUT_EN)    &= ~(BIT(OLED_CS)|BIT(OLED_SDIN)|BIT(OLED_SCLK)|BIT(OLED_DC)|BIT(OLED_RES)|BIT(OLED_VBATC)|BIT(OLED_VDDC));
-    GPIO_REG(GPIO_OUTPUT_EN)   |=  BIT(OLED_CS)|BIT(OLED_SDIN)|BIT(OLED_SCLK)|BIT(OLED_DC)|BIT(OLED_RES)|BIT(OLED_VBATC)|BIT(OLED_VDDC);
+    uint32_t pins = cs_all | res | vbatc | vddc | BIT(OLED_SDIN) | BIT(OLED_SCLK) | BIT(OLED_DC);
+    GPIO_REG(GPIO_INPUT_EN)    &= ~pins;
+    GPIO_REG(GPIO_OUTPUT_EN)   |=  pins;
 #ifndef SPI_BITBANG
-    puts("SPI mode: controller\r\n");
+    uart_printf(UART_BLOCK, "SPI mode: controller\r\n");
 #else
-    puts("SPI mode: bitbang\r\n");
+    uart_printf(UART_BLOCK, "SPI mode: bitbang\r\n");
 #endif
     spi_init();
 
     // Initial setup
     //
-    // Select chip
-    GPIO_REG(GPIO_OUTPUT_VAL)  &= ~BIT(OLED_CS);
-    // Command mode
-    GPIO_REG(GPIO_OUTPUT_VAL)  &= ~BIT(OLED_DC);
-    // Not reset mode
-    GPIO_REG(GPIO_OUTPUT_VAL)  |=  BIT(OLED_RES);
-    // Disable power
-    GPIO_REG(GPIO_OUTPUT_VAL)  |=  BIT(OLED_VBATC);
-    GPIO_REG(GPIO_OUTPUT_VAL)  |=  BIT(OLED_VDDC);
-
-    // Startup sequence
+    // No chip selected, command mode, not reset mode, power disabled
+    gpio_set(cs_all | res | vbatc | vddc);
+    gpio_clear(BIT(OLED_DC));
+
+    // Startup sequence, all modules at once
     //
     // 1. Apply power to VDD.
-    GPIO_REG(GPIO_OUTPUT_VAL)  &= ~BIT(OLED_VDDC);
+    gpio_clear(vddc);
     // 2. Send Display Off command (0xAE)
-    spi(0xAE);
-    spi_complete();
+    for (unsigned i=0; i<n; ++i) {
+        bus_mode(i, DC_CMD);
+        spi(0xAE);
+    }
+    spi_wait();
     // Reset
-    GPIO_REG(GPIO_OUTPUT_VAL)  &= ~BIT(OLED_RES);
+    gpio_clear(res);
     sleep_ticks(1); // at least 3us
-    GPIO_REG(GPIO_OUTPUT_VAL)  |=  BIT(OLED_RES);
+    gpio_set(res);
     // 3. Initialize display to desired operating mode.
-    spi(0x8D); spi(0x14); // charge pump
-    spi(0xD9); spi(0xF1); // precharge
     // 4. Clear screen (entire memory)
-    spi(0x20); spi(0x00); // horizontal addressing mode
-    spi(0x22); spi(0x00); spi(0x07); // page start and end address
-    mode_data();
-    for (unsigned x=0; x<1024; ++x) {
-        spi(0);
+    static const uint8_t init_mode[] = {
+        0x8D, 0x14, // charge pump
+        0xD9, 0xF1, // precharge
+        0x20, 0x00, // horizontal addressing mode
+        0x22, 0x00, 0x07, // page start and end address
+    };
+    for (unsigned i=0; i<n; ++i) {
+        bus_mode(i, DC_CMD);
+        spi_write(init_mode, sizeof(init_mode));
+        bus_mode(i, DC_DATA);
+        spi_fill(0, GDDRAM_PAGES*DISP_W);
     }
-    mode_cmd();
+    spi_wait();
     // 5. Apply power to VBAT.
-    GPIO_REG(GPIO_OUTPUT_VAL)  &= ~BIT(OLED_VBATC);
-    spi(0x81); spi(0x0F); // contrast
-    spi(0xA1); spi(0xC8); // invert display
-    spi(0xDA); spi(0x20); // comconfig
+    gpio_clear(vbatc);
+    for (unsigned i=0; i<n; ++i) {
+        const uint8_t init_panel[] = {
+            0x81, 0x0F, // contrast
+            0xA1, 0xC8, // invert display
+            0xDA, panels[i].comconfig, // comconfig
+        };
+        bus_mode(i, DC_CMD);
+        spi_write(init_panel, sizeof(init_panel));
+    }
 
     // 6. Delay 100ms.
     sleep_ticks(3277);
     // 7. Send Display On command (0xAF).
-    spi(0xAF);
-
     // Display setup
-    // spi(0xA5); // full display (only for testing)
-    spi(0xA4); // display according to memory
-    spi(0x20); spi(0x00); // horizontal addressing mode
-    //spi([0x20,0x01]) # vertical addressing mode
-    spi(0x22); spi(0x00); spi(0x03); // page start and end address (create wraparound at line 32)
+    for (unsigned i=0; i<n; ++i) {
+        const uint8_t init_display[] = {
+            0xAF, // display on
+            // 0xA5, // full display (only for testing)
+            0xA4, // display according to memory
+            0x20, 0x00, // horizontal addressing mode
+            // 0x20, 0x01, // vertical addressing mode
+            0x22, 0x00, panels[i].pages - 1, // page start and end address (wraparound at the last visible line)
+        };
+        bus_mode(i, DC_CMD);
+        spi_write(init_display, sizeof(init_display));
+    }
+}
+
+void pmodoled_clear(pmodoled_t *p)
+{
+    for (unsigned page=0; page<GDDRAM_PAGES; ++page) {
+        pmodoled_fill(p, page, 0, 0, DISP_W);
+    }
+    pmodoled_flush(p);
+    pmodoled_start_line(p, 0);
+}
+
+void pmodoled_start_line(pmodoled_t *p, unsigned line)
+{
+    p->start_line = line % GDDRAM_LINES;
+    bus_mode(p->index, DC_CMD);
+    spi(0x40 | p->start_line); // display start line
+}
+
+void pmodoled_command(pmodoled_t *p, const uint8_t *cmd, size_t n)
+{
+    bus_mode(p->index, DC_CMD);
+    spi_write(cmd, n);
 }
 
-void pmodoled_clear(void)
+/********* Framebuffer **********/
+
+/** Extend dirty span of page to include column x */
+static inline void mark_dirty(pmodoled_t *p, unsigned page, unsigned x)
 {
-    mode_cmd();
-    spi(0x22); spi(0x00); spi(0x03); // page start and end address (create wraparound at line 32)
-    spi(0x00); spi(0x10); spi(0xb0); // reset pointer
-    mode_data();
-    for (unsigned x=0; x<512; ++x) {
-        spi(0);
+    if (p->dirty_end[page] == 0) {
+        p->dirty_lo[page] = x;
+        p->dirty_end[page] = x + 1;
+    } else if (x < p->dirty_lo[page]) {
+        p->dirty_lo[page] = x;
+    } else if (x >= p->dirty_end[page]) {
+        p->dirty_end[page] = x + 1;
     }
 }
 
+void pmodoled_write(pmodoled_t *p, unsigned page, unsigned col, const uint8_t *data, unsigned n)
+{
+    uint8_t *dst = &p->fb[page][col];
+    for (unsigned x=0; x<n; ++x) {
+        if (dst[x] != data[x]) {
+            dst[x] = data[x];
+            mark_dirty(p, page, col + x);
+        }
+    }
+}
+
+void pmodoled_fill(pmodoled_t *p, unsigned page, unsigned col, uint8_t value, unsigned n)
+{
+    uint8_t *dst = &p->fb[page][col];
+    for (unsigned x=0; x<n; ++x) {
+        if (dst[x] != value) {
+            dst[x] = value;
+            mark_dirty(p, page, col + x);
+        }
+    }
+}
+
+void pmodoled_present(pmodoled_t *p, const uint8_t frame[][DISP_W])
+{
+    for (unsigned page=0; page<p->pages; ++page) {
+        pmodoled_write(p, page, 0, frame[page], DISP_W);
+    }
+    pmodoled_flush(p);
+}
+
+/** Cost of setting up an address window, in bytes: six command bytes and
+ * two mode switches, which each wait for the FIFO to drain.
+ */
+#define WINDOW_COST 8
+
+void pmodoled_window(pmodoled_t *p, unsigned first, unsigned last, unsigned lo, unsigned end)
+{
+    const uint8_t cmd[] = {
+        0x21, lo, end - 1, // column start and end address
+        0x22, first, last // page start and end address
+    };
+    bus_mode(p->index, DC_CMD);
+    spi_write(cmd, sizeof(cmd));
+    bus_mode(p->index, DC_DATA);
+}
+
+void pmodoled_invalidate(pmodoled_t *p)
+{
+    for (unsigned page=0; page<GDDRAM_PAGES; ++page) {
+        p->dirty_lo[page] = 0;
+        p->dirty_end[page] = DISP_W;
+    }
+}
+
+/** Send columns [lo, end) of pages first to last as one address window */
+static void flush_window(pmodoled_t *p, unsigned first, unsigned last, unsigned lo, unsigned end)
+{
+    pmodoled_window(p, first, last, lo, end);
+    for (unsigned page=first; page<=last; ++page) {
+        spi_write(&p->fb[page][lo], end - lo);
+        p->dirty_end[page] = 0;
+    }
+}
+
+void pmodoled_flush(pmodoled_t *p)
+{
+    unsigned page = 0;
+    while (page < GDDRAM_PAGES) {
+        if (p->dirty_end[page] == 0) {
+            ++page;
+            continue;
+        }
+        /* Merge following dirty pages into the window while that is
+         * cheaper than giving them a window of their own. A full frame
+         * update becomes a single window starting at page 0, column 0.
+         */
+        unsigned first = page;
+        unsigned lo = p->dirty_lo[page];
+        unsigned end = p->dirty_end[page];
+        unsigned cost = WINDOW_COST + (end - lo);
+        for (++page; page < GDDRAM_PAGES && p->dirty_end[page]; ++page) {
+            unsigned mlo = p->dirty_lo[page] < lo ? p->dirty_lo[page] : lo;
+            unsigned mend = p->dirty_end[page] > end ? p->dirty_end[page] : end;
+            unsigned merged = WINDOW_COST + (page - first + 1) * (mend - mlo);
+            unsigned separate = cost + WINDOW_COST + (p->dirty_end[page] - p->dirty_lo[page]);
+            if (merged > separate) {
+                break;
+            }
+            lo = mlo;
+            end = mend;
+            cost = merged;
+        }
+        flush_window(p, first, page - 1, lo, end);
+    }
+#ifdef HOST
+    pmodoled_host_frame();
+#endif
+}
+
+#ifdef HOST
+void pmodoled_host_frame(void)
+{
+    host_frame(bus_bytes);
+}
+#endif
@@ -2,27 +2,120 @@
 // Distributed under the MIT software license, see the accompanying
 // file COPYING or http://www.opensource.org/licenses/mit-license.php.
 #ifndef H_DISPLAY
+#define H_DISPLAY
 
+#include <stddef.h>
 #include <stdint.h>
 
 /** Display width in pixels */
 #define DISP_W 128
 /** Display height in pixels */
 #define DISP_H 32
+/** Number of display pages (rows of 8 pixels, one byte per column) */
+#define DISP_PAGES (DISP_H/8)
+/** Number of pages of display memory. The display shows DISP_PAGES worth of
+ * lines from this, starting at the display start line and wrapping around.
+ */
+#define GDDRAM_PAGES 8
+/** Number of lines of display memory */
+#define GDDRAM_LINES (GDDRAM_PAGES*8)
 
-/** Initialize pmodoled module */
-void pmodoled_init();
+/** Largest number of modules driven together */
+#define PMODOLED_MAX 4
+
+/** A PMODoled module.
+ * All modules hang off SPI1: SCLK, SDIN and D/C are shared, and every module
+ * has a chip select of its own. Reset and power pins can be shared between
+ * modules or separate.
+ */
+typedef struct pmodoled {
+    /* Wiring: GPIO numbers */
+    uint8_t cs;
+    uint8_t res;
+    uint8_t vbatc;
+    uint8_t vddc;
+    /* Geometry */
+    uint8_t pages;      /**< number of visible pages, height/8 */
+    uint8_t comconfig;  /**< COM pins hardware configuration (0xDA) */
+    /* State, set up by pmodoled_init() */
+    uint8_t index;      /**< position among the modules initialized together */
+    uint8_t start_line; /**< display memory line at the top of the screen */
+    /** Framebuffer, see below */
+    uint8_t fb[GDDRAM_PAGES][DISP_W];
+    uint8_t dirty_lo[GDDRAM_PAGES];
+    uint8_t dirty_end[GDDRAM_PAGES];
+} pmodoled_t;
+
+/** Initializer for a 128x32 PMODoled module with the given pins */
+#define PMODOLED_128X32(cs_, res_, vbatc_, vddc_) { \
+    .cs = (cs_), .res = (res_), .vbatc = (vbatc_), .vddc = (vddc_), \
+    .pages = DISP_PAGES, .comconfig = 0x20 }
+
+/** Initialize SPI and n modules. The modules go through the startup sequence
+ * together, so that the delays are only waited for once, and one module's
+ * memory is cleared while the others wait.
+ */
+void pmodoled_init(pmodoled_t *panels, unsigned n);
 /** Initialize SPI */
 void spi_init(void);
-/** write a byte to OLED spi */
+/** queue a byte for OLED spi */
 void spi(uint8_t data);
+/** queue n bytes for OLED spi. Data is copied, and the buffer can be reused on return */
+void spi_write(const uint8_t *data, size_t n);
+/** queue n copies of a byte for OLED spi */
+void spi_fill(uint8_t value, size_t n);
 /** wait for completion of queued spi bytes */
-void spi_complete(void);
-/** set mode to data */
+void spi_wait(void);
+/** Is everything queued passed on to the SPI controller? EVENT_SPI_IDLE is
+ * posted when this becomes true.
+ */
+int spi_queue_empty(void);
+/** queue switch to data mode, for the module addressed last */
 void mode_data(void);
-/** set mode to commands */
+/** queue switch to command mode, for the module addressed last */
 void mode_cmd(void);
-/** clear (visible portion of) screen, reset pointers */
-void pmodoled_clear(void);
+/** clear display memory and reset display start line to 0 */
+void pmodoled_clear(pmodoled_t *p);
+/** set display memory line shown at the top of the screen. Sent immediately,
+ * so flush framebuffer changes that should be visible first.
+ */
+void pmodoled_start_line(pmodoled_t *p, unsigned line);
+/** queue command bytes for a module, sent immediately like
+ * pmodoled_start_line()
+ */
+void pmodoled_command(pmodoled_t *p, const uint8_t *cmd, size_t n);
+
+/* Framebuffer.
+ * All drawing goes to a RAM copy of the display memory, pages 0 to
+ * GDDRAM_PAGES-1. Changes are
+ * tracked per page as a span of dirty columns, and only those spans are sent
+ * to the display on pmodoled_flush().
+ * Sending is asynchronous, so drawing and flushing one module overlaps with
+ * the transfer to the module flushed before it.
+ */
+/** write n bytes to framebuffer page at column col */
+void pmodoled_write(pmodoled_t *p, unsigned page, unsigned col, const uint8_t *data, unsigned n);
+/** fill n bytes of framebuffer page at column col with value */
+void pmodoled_fill(pmodoled_t *p, unsigned page, unsigned col, uint8_t value, unsigned n);
+/** replace the visible framebuffer pages with a complete frame and flush it */
+void pmodoled_present(pmodoled_t *p, const uint8_t frame[][DISP_W]);
+/** send dirty spans of framebuffer to display */
+void pmodoled_flush(pmodoled_t *p);
+/** Set up an address window of columns [lo, end) of pages first to last, in
+ * data mode. The following spi bytes fill it page by page. This bypasses the
+ * framebuffer, call pmodoled_invalidate() when done.
+ */
+void pmodoled_window(pmodoled_t *p, unsigned first, unsigned last, unsigned lo, unsigned end);
+/** Display memory was changed without the framebuffer: send all of the
+ * framebuffer on the next flush
+ */
+void pmodoled_invalidate(pmodoled_t *p);
+
+#ifdef HOST
+/** Host build: everything queued so far makes up a frame. Called by
+ * pmodoled_flush(), and by code that sends to the display without it.
+ */
+void pmodoled_host_frame(void);
+#endif
 
 #endif
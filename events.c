@@ -0,0 +1,120 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#include "events.h"
+
+#include <stdint.h>
+#include "platform.h"
+
+#include "irq.h"
+
+/** Running timers, earliest first */
+static struct timer *timers;
+/** Posted events, set by interrupt handlers */
+static volatile unsigned pending;
+
+static void timer_insert(struct timer *t)
+{
+    struct timer **p = &timers;
+    while (*p && (*p)->when <= t->when) {
+        p = &(*p)->next;
+    }
+    t->next = *p;
+    *p = t;
+    t->active = 1;
+}
+
+void timer_start(struct timer *t, uint32_t delay, uint32_t period, timer_fn_t fn)
+{
+    timer_stop(t);
+    t->when = get_timer_value() + delay;
+    t->period = period;
+    t->fn = fn;
+    timer_insert(t);
+}
+
+void timer_stop(struct timer *t)
+{
+    if (!t->active) {
+        return;
+    }
+    for (struct timer **p = &timers; *p; p = &(*p)->next) {
+        if (*p == t) {
+            *p = t->next;
+            break;
+        }
+    }
+    t->active = 0;
+}
+
+/** Run callbacks of expired timers. Returns 1 if any ran. */
+static int run_timers(void)
+{
+    int ran = 0;
+    uint64_t now = get_timer_value();
+    while (timers && timers->when <= now) {
+        struct timer *t = timers;
+        timers = t->next;
+        t->active = 0;
+        if (t->period) {
+            /* Keep the phase, unless more than a period behind */
+            t->when += t->period;
+            if (t->when <= now) {
+                t->when = now + t->period;
+            }
+            timer_insert(t);
+        }
+        t->fn();
+        ran = 1;
+    }
+    return ran;
+}
+
+static void timer_isr(void)
+{
+    /* Waking up is enough, the timers run from event_wait */
+}
+
+/** Sleep until an interrupt, unless one of the events in mask is pending or
+ * deadline has passed. Returns with interrupts enabled, and any interrupt
+ * handled.
+ */
+static void sleep_until(uint64_t deadline, unsigned mask)
+{
+    irq_disable();
+    if (!(pending & mask) && get_timer_value() < deadline) {
+        if (deadline != UINT64_MAX) {
+            irq_timer(deadline, timer_isr);
+        }
+        irq_wait();
+    }
+    irq_enable();
+}
+
+void event_post(unsigned events)
+{
+    pending |= events;
+}
+
+unsigned event_wait(unsigned mask)
+{
+    while (1) {
+        unsigned events = run_timers() ? (mask & EVENT_TIMER) : 0;
+        irq_disable();
+        events |= pending & mask;
+        pending &= ~events;
+        irq_enable();
+        if (events) {
+            return events;
+        }
+        sleep_until(timers ? timers->when : UINT64_MAX, mask);
+    }
+}
+
+void event_sleep(uint32_t ticks)
+{
+    uint64_t deadline = get_timer_value() + ticks;
+    while (get_timer_value() < deadline) {
+        sleep_until(deadline, 0);
+    }
+}
@@ -0,0 +1,50 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#ifndef H_EVENTS
+#define H_EVENTS
+/* Cooperative event loop.
+ *
+ * Interrupt handlers post events, the main program waits for them with
+ * event_wait(), which sleeps the core (wfi) until something happens. Timers
+ * are kept in a list sorted by expiry and run from event_wait() in the main
+ * program, never from interrupts, so their callbacks can draw and send
+ * freely. The machine timer interrupt is only used to wake up for the first
+ * timer that is due.
+ *
+ * Times are in mtime ticks (32768 Hz).
+ */
+#include <stdint.h>
+
+/** Events */
+#define EVENT_UART_RX  0x01 /**< bytes received, see uart_read() */
+#define EVENT_SPI_IDLE 0x02 /**< SPI transmit queue has drained */
+#define EVENT_TIMER    0x04 /**< one or more timer callbacks ran */
+
+typedef void (*timer_fn_t)(void);
+
+struct timer {
+    uint64_t when;       /**< expiry */
+    uint32_t period;     /**< reload interval, 0 for one-shot */
+    timer_fn_t fn;
+    struct timer *next;
+    uint8_t active;
+};
+
+/** Start (or restart) timer to expire delay ticks from now, and then every
+ * period ticks if period is not 0
+ */
+void timer_start(struct timer *t, uint32_t delay, uint32_t period, timer_fn_t fn);
+/** Stop timer. Does nothing if it is not running. */
+void timer_stop(struct timer *t);
+
+/** Post events. Call from interrupt handlers only. */
+void event_post(unsigned events);
+/** Run due timers, and sleep until one of the events in mask has been
+ * posted. Returns these events and clears them.
+ */
+unsigned event_wait(unsigned mask);
+/** Sleep for the given number of ticks. Timers are not run meanwhile. */
+void event_sleep(uint32_t ticks);
+
+#endif
@@ -0,0 +1,94 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#include "font.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/** Number of unpacked glyphs kept in RAM */
+#define CACHE_SIZE 16
+/** Largest cell that can be cached, in bytes */
+#define CACHE_GLYPH_BYTES 16
+
+static struct {
+    const struct font *font;
+    uint16_t ch;
+    uint8_t data[CACHE_GLYPH_BYTES];
+} cache[CACHE_SIZE];
+/** Cache entries, most recently used first */
+static uint8_t lru[CACHE_SIZE] = {0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15};
+static unsigned cache_hits, cache_misses;
+
+/** Unpack glyph i of the compressed glyph store into buf */
+static void unpack(const struct font *font, unsigned i, uint8_t *buf)
+{
+    unsigned n = font->pages * font->width;
+    const uint8_t *p = font->packed + font->index[i / FONT_BLOCK];
+    /* Skip to the glyph: every glyph is its nibbles followed by one
+     * literal byte for every LITERAL nibble.
+     */
+    for (unsigned skip = i % FONT_BLOCK; skip; --skip) {
+        const uint8_t *lit = p + (n + 1) / 2;
+        for (unsigned j=0; j<n; ++j) {
+            if (((p[j/2] >> (4*(j%2))) & 0xf) == FONT_LITERAL) {
+                ++lit;
+            }
+        }
+        p = lit;
+    }
+    const uint8_t *lit = p + (n + 1) / 2;
+    for (unsigned j=0; j<n; ++j) {
+        unsigned code = (p[j/2] >> (4*(j%2))) & 0xf;
+        buf[j] = code == FONT_LITERAL ? *lit++ : font->dict[code];
+    }
+}
+
+/** Index of ch in the compressed glyph store, or -1 */
+static int store_index(const struct font *font, unsigned ch)
+{
+    unsigned base = 0;
+    for (unsigned r=0; r<font->nranges; ++r) {
+        if (ch >= font->ranges[r].first && ch - font->ranges[r].first < font->ranges[r].count) {
+            return base + ch - font->ranges[r].first;
+        }
+        base += font->ranges[r].count;
+    }
+    return -1;
+}
+
+const uint8_t *font_lookup(const struct font *font, unsigned ch)
+{
+    if (ch >= font->first && ch - font->first < font->count) {
+        return font->data + (ch - font->first) * font->pages * font->width;
+    }
+    int i = store_index(font, ch);
+    if (i < 0 || font->pages * font->width > CACHE_GLYPH_BYTES) {
+        return font_glyph(font, font->first);
+    }
+    unsigned pos;
+    for (pos=0; pos<CACHE_SIZE-1; ++pos) {
+        if (cache[lru[pos]].font == font && cache[lru[pos]].ch == ch) {
+            break;
+        }
+    }
+    /* pos is now the hit, or the least recently used entry */
+    unsigned e = lru[pos];
+    if (cache[e].font == font && cache[e].ch == ch) {
+        ++cache_hits;
+    } else {
+        ++cache_misses;
+        cache[e].font = font;
+        cache[e].ch = ch;
+        unpack(font, i, cache[e].data);
+    }
+    memmove(&lru[1], &lru[0], pos);
+    lru[0] = e;
+    return cache[e].data;
+}
+
+void font_cache_stats(unsigned *hits, unsigned *misses)
+{
+    *hits = cache_hits;
+    *misses = cache_misses;
+}
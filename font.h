@@ -1,133 +1,68 @@
-#define FONT_W 6
-#define FONT_H 1
-#define FONT_N 128
-uint8_t font[FONT_N][FONT_W] = {
-  {0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x00},
-  {0x10, 0x38, 0x7c, 0x3e, 0x1c, 0x08},
-  {0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c},
-  {0x08, 0x1c, 0x3e, 0x7c, 0x38, 0x10},
-  {0x00, 0x18, 0x3c, 0x3c, 0x18, 0x00},
-  {0x00, 0x00, 0x18, 0x18, 0x00, 0x00},
-  {0x1c, 0x3e, 0x3e, 0x3e, 0x1c, 0x00},
-  {0x1c, 0x22, 0x22, 0x22, 0x1c, 0x00},
-  {0x00, 0x1c, 0x1c, 0x1c, 0x1c, 0x00},
-  {0xf8, 0x06, 0xef, 0xef, 0x06, 0xf8},
-  {0xf8, 0x06, 0x0f, 0x0f, 0x06, 0xf8},
-  {0x38, 0x7c, 0x7c, 0x7c, 0xba, 0x8a},
-  {0x82, 0x82, 0x82, 0x82, 0x82, 0x82},
-  {0x0a, 0x7e, 0x7e, 0x7e, 0x7e, 0x00},
-  {0x4a, 0x4e, 0x7e, 0x7e, 0x7e, 0x00},
-  {0x7a, 0x7e, 0x7e, 0x4e, 0x4e, 0x00},
-  {0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00},
-  {0x00, 0x00, 0x38, 0x08, 0x38, 0x00},
-  {0x18, 0x24, 0x42, 0x42, 0x24, 0x18},
-  {0x6c, 0x6c, 0x7c, 0x7c, 0x7c, 0x00},
-  {0xd8, 0xdb, 0xc3, 0x00, 0x6e, 0x6e},
-  {0x44, 0x28, 0x1c, 0x0a, 0x11, 0x00},
-  {0x7e, 0x42, 0x42, 0x40, 0x7e, 0x00},
-  {0x2a, 0x1c, 0x7f, 0x1c, 0x2a, 0x00},
-  {0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00},
-  {0x24, 0x2a, 0x7f, 0x2a, 0x12, 0x00},
-  {0x3c, 0x32, 0x05, 0x18, 0x18, 0x00},
-  {0x41, 0x63, 0x3e, 0x3e, 0x1c, 0x00},
-  {0x24, 0x1c, 0x0f, 0x1c, 0x24, 0x00},
-  {0x10, 0x1c, 0x3e, 0x1c, 0x10, 0x00},
-  {0x08, 0x08, 0x0c, 0x0c, 0x08, 0x08},
-  {0x00, 0x40, 0x08, 0x00, 0x12, 0x00},
-  {0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-  {0x00, 0x00, 0x5f, 0x5f, 0x00, 0x00},
-  {0x02, 0x01, 0x00, 0x02, 0x01, 0x00},
-  {0x3c, 0x46, 0x83, 0x83, 0x87, 0x5e},
-  {0x78, 0xe0, 0xc3, 0xc3, 0x60, 0x3c},
-  {0xf2, 0x1a, 0x7e, 0x8c, 0x1b, 0x23},
-  {0x20, 0x60, 0xff, 0xff, 0x60, 0x20},
-  {0x00, 0x00, 0x05, 0x03, 0x00, 0x00},
-  {0x00, 0x1c, 0x3e, 0x63, 0x41, 0x00},
-  {0x00, 0x41, 0x63, 0x3e, 0x1c, 0x00},
-  {0x2a, 0x1c, 0x3e, 0x3e, 0x1c, 0x2a},
-  {0x08, 0x08, 0x3e, 0x3e, 0x08, 0x08},
-  {0x00, 0x00, 0xa0, 0x60, 0x00, 0x00},
-  {0x08, 0x08, 0x08, 0x08, 0x08, 0x08},
-  {0x00, 0x00, 0x40, 0x40, 0x00, 0x00},
-  {0x40, 0x70, 0x38, 0x0e, 0x07, 0x01},
-  {0x3e, 0x7f, 0x41, 0x41, 0x7f, 0x3e},
-  {0x42, 0x42, 0x7f, 0x7f, 0x40, 0x40},
-  {0x42, 0x63, 0x71, 0x59, 0x4f, 0x46},
-  {0x21, 0x61, 0x49, 0x4d, 0x7f, 0x33},
-  {0x18, 0x1c, 0x16, 0x7f, 0x7f, 0x10},
-  {0x2f, 0x6f, 0x49, 0x49, 0x79, 0x31},
-  {0x38, 0x7c, 0x4e, 0x4b, 0x79, 0x30},
-  {0x41, 0x61, 0x31, 0x19, 0x0f, 0x07},
-  {0x36, 0x7f, 0x49, 0x49, 0x7f, 0x36},
-  {0x06, 0x4f, 0x69, 0x39, 0x1f, 0x0e},
-  {0x00, 0x00, 0x14, 0x14, 0x00, 0x00},
-  {0x00, 0x00, 0x54, 0x34, 0x00, 0x00},
-  {0x08, 0x1c, 0x36, 0x63, 0x41, 0x00},
-  {0x14, 0x14, 0x14, 0x14, 0x14, 0x14},
-  {0x00, 0x41, 0x63, 0x36, 0x1c, 0x08},
-  {0x02, 0x03, 0x51, 0x59, 0x0f, 0x06},
-  {0x40, 0xa0, 0x40, 0x00, 0x00, 0x00},
-  {0x7e, 0x7f, 0x09, 0x09, 0x7f, 0x7e},
-  {0x7f, 0x7f, 0x49, 0x49, 0x7f, 0x36},
-  {0x3e, 0x7f, 0x41, 0x41, 0x63, 0x22},
-  {0x7f, 0x7f, 0x41, 0x41, 0x7f, 0x3e},
-  {0x7f, 0x7f, 0x49, 0x49, 0x41, 0x41},
-  {0x7f, 0x7f, 0x09, 0x09, 0x01, 0x01},
-  {0x3e, 0x7f, 0x41, 0x49, 0x7b, 0x3a},
-  {0x7f, 0x7f, 0x08, 0x08, 0x7f, 0x7f},
-  {0x41, 0x41, 0x7f, 0x7f, 0x41, 0x41},
-  {0x20, 0x60, 0x41, 0x7f, 0x3f, 0x01},
-  {0x7f, 0x7f, 0x1c, 0x36, 0x63, 0x41},
-  {0x7f, 0x7f, 0x40, 0x40, 0x40, 0x40},
-  {0x7f, 0x7f, 0x06, 0x0c, 0x06, 0x7f},
-  {0x7f, 0x7f, 0x0c, 0x18, 0x7f, 0x7f},
-  {0x3e, 0x7f, 0x41, 0x41, 0x7f, 0x3e},
-  {0x7f, 0x7f, 0x09, 0x09, 0x0f, 0x06},
-  {0x3e, 0x7f, 0x41, 0x41, 0xff, 0xbe},
-  {0x7f, 0x7f, 0x19, 0x39, 0x6f, 0x46},
-  {0x26, 0x6f, 0x49, 0x49, 0x7b, 0x32},
-  {0x01, 0x01, 0x7f, 0x7f, 0x01, 0x01},
-  {0x3f, 0x7f, 0x40, 0x40, 0x7f, 0x3f},
-  {0x1f, 0x3f, 0x60, 0x60, 0x3f, 0x1f},
-  {0x7f, 0x7f, 0x30, 0x18, 0x30, 0x7f},
-  {0x63, 0x36, 0x1c, 0x1c, 0x36, 0x63},
-  {0x07, 0x0f, 0x78, 0x78, 0x0f, 0x07},
-  {0x61, 0x71, 0x59, 0x4d, 0x47, 0x43},
-  {0x00, 0x7f, 0x7f, 0x41, 0x41, 0x00},
-  {0x01, 0x07, 0x0e, 0x38, 0x70, 0x40},
-  {0x00, 0x41, 0x41, 0x7f, 0x7f, 0x00},
-  {0x10, 0x18, 0x0c, 0x06, 0x0c, 0x18},
-  {0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
-  {0x04, 0x06, 0xff, 0xff, 0x06, 0x04},
-  {0x24, 0x74, 0x54, 0x54, 0x7c, 0x78},
-  {0x7f, 0x7f, 0x44, 0x44, 0x7c, 0x38},
-  {0x38, 0x7c, 0x44, 0x44, 0x6c, 0x28},
-  {0x38, 0x7c, 0x44, 0x44, 0x7f, 0x7f},
-  {0x38, 0x7c, 0x54, 0x54, 0x5c, 0x18},
-  {0x7e, 0x7f, 0x09, 0x09, 0x03, 0x02},
-  {0x18, 0xbc, 0xa4, 0xa4, 0xfc, 0x78},
-  {0x7f, 0x7f, 0x04, 0x04, 0x7c, 0x78},
-  {0x40, 0x44, 0x7d, 0x7d, 0x40, 0x40},
-  {0x40, 0xc0, 0x84, 0xfd, 0x7d, 0x04},
-  {0x7f, 0x7f, 0x10, 0x38, 0x6c, 0x44},
-  {0x41, 0x41, 0x7f, 0x7f, 0x40, 0x40},
-  {0x7c, 0x7c, 0x18, 0x30, 0x18, 0x7c},
-  {0x7c, 0x7c, 0x04, 0x04, 0x7c, 0x78},
-  {0x38, 0x7c, 0x44, 0x44, 0x7c, 0x38},
-  {0xfc, 0xfc, 0x24, 0x24, 0x3c, 0x18},
-  {0x18, 0x3c, 0x24, 0x24, 0xfc, 0xfc},
-  {0x7c, 0x7c, 0x04, 0x04, 0x0c, 0x08},
-  {0x48, 0x5c, 0x54, 0x54, 0x74, 0x24},
-  {0x04, 0x04, 0x3f, 0x7f, 0x44, 0x04},
-  {0x3c, 0x7c, 0x40, 0x40, 0x7c, 0x3c},
-  {0x1c, 0x3c, 0x60, 0x60, 0x3c, 0x1c},
-  {0x7c, 0x7c, 0x30, 0x18, 0x30, 0x7c},
-  {0x44, 0x6c, 0x38, 0x38, 0x6c, 0x44},
-  {0x1c, 0xbc, 0xa0, 0xa0, 0xfc, 0x7c},
-  {0x44, 0x64, 0x74, 0x5c, 0x4c, 0x44},
-  {0x08, 0x08, 0x3e, 0x77, 0x41, 0x00},
-  {0x00, 0x00, 0x77, 0x77, 0x00, 0x00},
-  {0x00, 0x41, 0x77, 0x3e, 0x08, 0x08},
-  {0x01, 0x0f, 0x01, 0x3c, 0x08, 0x3c},
-  {0x10, 0x18, 0x14, 0x12, 0x14, 0x18},
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#ifndef H_FONT
+#define H_FONT
+/* Fonts in display page layout.
+ *
+ * The tables are generated from the BDF files in fonts/ by tools/bdf2c.py
+ * and are const, so they stay in flash. Every glyph is stored as a complete
+ * cell including spacing: for each page of the cell, one byte per column,
+ * least significant bit at the top.
+ *
+ * Characters first to first+count-1 are stored as is. A font can have more
+ * characters in a compressed glyph store, which are unpacked on use into a
+ * small cache in RAM.
+ */
+#include <stdint.h>
+
+/** Number of entries in the dictionary of a compressed glyph store */
+#define FONT_DICT_SIZE 15
+/** Nibble code for a byte that is not in the dictionary */
+#define FONT_LITERAL 15
+/** Number of glyphs per compressed glyph store index entry */
+#define FONT_BLOCK 16
+
+/** Range of characters in a compressed glyph store */
+struct font_range {
+    uint16_t first;
+    uint16_t count;
 };
+
+struct font {
+    uint8_t width;  /* cell width in pixels */
+    uint8_t pages;  /* cell height in display pages */
+    uint8_t first;  /* first character in table */
+    uint16_t count; /* number of characters in table */
+    const uint8_t *data;
+    /* Compressed glyph store, nranges is 0 if there is none */
+    uint8_t nranges;
+    const struct font_range *ranges;
+    const uint8_t *dict;    /* FONT_DICT_SIZE most common bytes */
+    const uint16_t *index;  /* offset in packed of every FONT_BLOCK-th glyph */
+    const uint8_t *packed;
+};
+
+/** Glyph data of character ch. Characters not in the table get the first glyph. */
+static inline const uint8_t *font_glyph(const struct font *font, unsigned ch)
+{
+    if (ch < font->first || ch - font->first >= font->count) {
+        ch = font->first;
+    }
+    return font->data + (ch - font->first) * font->pages * font->width;
+}
+
+/** Glyph data of character ch, from the table or the compressed glyph store.
+ * Characters that the font does not have get the first glyph. The data is
+ * valid until the next call.
+ */
+const uint8_t *font_lookup(const struct font *font, unsigned ch);
+/** Glyph cache statistics since startup */
+void font_cache_stats(unsigned *hits, unsigned *misses);
+
+/** 6x8 font in 7x8 cells */
+extern const struct font font_6x8;
+/** 8x16 font in 8x16 cells */
+extern const struct font font_8x16;
+
+#endif
@@ -0,0 +1,235 @@
+/* Generated by tools/bdf2c.py from fonts/6x8.bdf, do not edit */
+#include "font.h"
+
+static const uint8_t font_6x8_data[] = {
+  0x00, 0x7e, 0x7e, 0x7e, 0x00, 0x00, 0x00, /* 0 */
+  0x10, 0x38, 0x7c, 0x3e, 0x1c, 0x08, 0x00, /* 1 */
+  0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x00, /* 2 */
+  0x08, 0x1c, 0x3e, 0x7c, 0x38, 0x10, 0x00, /* 3 */
+  0x00, 0x18, 0x3c, 0x3c, 0x18, 0x00, 0x00, /* 4 */
+  0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, /* 5 */
+  0x1c, 0x3e, 0x3e, 0x3e, 0x1c, 0x00, 0x00, /* 6 */
+  0x1c, 0x22, 0x22, 0x22, 0x1c, 0x00, 0x00, /* 7 */
+  0x00, 0x1c, 0x1c, 0x1c, 0x1c, 0x00, 0x00, /* 8 */
+  0xf8, 0x06, 0xef, 0xef, 0x06, 0xf8, 0x00, /* 9 */
+  0xf8, 0x06, 0x0f, 0x0f, 0x06, 0xf8, 0x00, /* 10 */
+  0x38, 0x7c, 0x7c, 0x7c, 0xba, 0x8a, 0x00, /* 11 */
+  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x00, /* 12 */
+  0x0a, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x00, /* 13 */
+  0x4a, 0x4e, 0x7e, 0x7e, 0x7e, 0x00, 0x00, /* 14 */
+  0x7a, 0x7e, 0x7e, 0x4e, 0x4e, 0x00, 0x00, /* 15 */
+  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x00, /* 16 */
+  0x00, 0x00, 0x38, 0x08, 0x38, 0x00, 0x00, /* 17 */
+  0x18, 0x24, 0x42, 0x42, 0x24, 0x18, 0x00, /* 18 */
+  0x6c, 0x6c, 0x7c, 0x7c, 0x7c, 0x00, 0x00, /* 19 */
+  0xd8, 0xdb, 0xc3, 0x00, 0x6e, 0x6e, 0x00, /* 20 */
+  0x44, 0x28, 0x1c, 0x0a, 0x11, 0x00, 0x00, /* 21 */
+  0x7e, 0x42, 0x42, 0x40, 0x7e, 0x00, 0x00, /* 22 */
+  0x2a, 0x1c, 0x7f, 0x1c, 0x2a, 0x00, 0x00, /* 23 */
+  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, 0x00, /* 24 */
+  0x24, 0x2a, 0x7f, 0x2a, 0x12, 0x00, 0x00, /* 25 */
+  0x3c, 0x32, 0x05, 0x18, 0x18, 0x00, 0x00, /* 26 */
+  0x41, 0x63, 0x3e, 0x3e, 0x1c, 0x00, 0x00, /* 27 */
+  0x24, 0x1c, 0x0f, 0x1c, 0x24, 0x00, 0x00, /* 28 */
+  0x10, 0x1c, 0x3e, 0x1c, 0x10, 0x00, 0x00, /* 29 */
+  0x08, 0x08, 0x0c, 0x0c, 0x08, 0x08, 0x00, /* 30 */
+  0x00, 0x40, 0x08, 0x00, 0x12, 0x00, 0x00, /* 31 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 32 */
+  0x00, 0x00, 0x5f, 0x5f, 0x00, 0x00, 0x00, /* 33 */
+  0x02, 0x01, 0x00, 0x02, 0x01, 0x00, 0x00, /* 34 */
+  0x3c, 0x46, 0x83, 0x83, 0x87, 0x5e, 0x00, /* 35 */
+  0x78, 0xe0, 0xc3, 0xc3, 0x60, 0x3c, 0x00, /* 36 */
+  0xf2, 0x1a, 0x7e, 0x8c, 0x1b, 0x23, 0x00, /* 37 */
+  0x20, 0x60, 0xff, 0xff, 0x60, 0x20, 0x00, /* 38 */
+  0x00, 0x00, 0x05, 0x03, 0x00, 0x00, 0x00, /* 39 */
+  0x00, 0x1c, 0x3e, 0x63, 0x41, 0x00, 0x00, /* 40 */
+  0x00, 0x41, 0x63, 0x3e, 0x1c, 0x00, 0x00, /* 41 */
+  0x2a, 0x1c, 0x3e, 0x3e, 0x1c, 0x2a, 0x00, /* 42 */
+  0x08, 0x08, 0x3e, 0x3e, 0x08, 0x08, 0x00, /* 43 */
+  0x00, 0x00, 0xa0, 0x60, 0x00, 0x00, 0x00, /* 44 */
+  0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, /* 45 */
+  0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, /* 46 */
+  0x40, 0x70, 0x38, 0x0e, 0x07, 0x01, 0x00, /* 47 */
+  0x3e, 0x7f, 0x41, 0x41, 0x7f, 0x3e, 0x00, /* 48 */
+  0x42, 0x42, 0x7f, 0x7f, 0x40, 0x40, 0x00, /* 49 */
+  0x42, 0x63, 0x71, 0x59, 0x4f, 0x46, 0x00, /* 50 */
+  0x21, 0x61, 0x49, 0x4d, 0x7f, 0x33, 0x00, /* 51 */
+  0x18, 0x1c, 0x16, 0x7f, 0x7f, 0x10, 0x00, /* 52 */
+  0x2f, 0x6f, 0x49, 0x49, 0x79, 0x31, 0x00, /* 53 */
+  0x38, 0x7c, 0x4e, 0x4b, 0x79, 0x30, 0x00, /* 54 */
+  0x41, 0x61, 0x31, 0x19, 0x0f, 0x07, 0x00, /* 55 */
+  0x36, 0x7f, 0x49, 0x49, 0x7f, 0x36, 0x00, /* 56 */
+  0x06, 0x4f, 0x69, 0x39, 0x1f, 0x0e, 0x00, /* 57 */
+  0x00, 0x00, 0x14, 0x14, 0x00, 0x00, 0x00, /* 58 */
+  0x00, 0x00, 0x54, 0x34, 0x00, 0x00, 0x00, /* 59 */
+  0x08, 0x1c, 0x36, 0x63, 0x41, 0x00, 0x00, /* 60 */
+  0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, /* 61 */
+  0x00, 0x41, 0x63, 0x36, 0x1c, 0x08, 0x00, /* 62 */
+  0x02, 0x03, 0x51, 0x59, 0x0f, 0x06, 0x00, /* 63 */
+  0x40, 0xa0, 0x40, 0x00, 0x00, 0x00, 0x00, /* 64 */
+  0x7e, 0x7f, 0x09, 0x09, 0x7f, 0x7e, 0x00, /* 65 */
+  0x7f, 0x7f, 0x49, 0x49, 0x7f, 0x36, 0x00, /* 66 */
+  0x3e, 0x7f, 0x41, 0x41, 0x63, 0x22, 0x00, /* 67 */
+  0x7f, 0x7f, 0x41, 0x41, 0x7f, 0x3e, 0x00, /* 68 */
+  0x7f, 0x7f, 0x49, 0x49, 0x41, 0x41, 0x00, /* 69 */
+  0x7f, 0x7f, 0x09, 0x09, 0x01, 0x01, 0x00, /* 70 */
+  0x3e, 0x7f, 0x41, 0x49, 0x7b, 0x3a, 0x00, /* 71 */
+  0x7f, 0x7f, 0x08, 0x08, 0x7f, 0x7f, 0x00, /* 72 */
+  0x41, 0x41, 0x7f, 0x7f, 0x41, 0x41, 0x00, /* 73 */
+  0x20, 0x60, 0x41, 0x7f, 0x3f, 0x01, 0x00, /* 74 */
+  0x7f, 0x7f, 0x1c, 0x36, 0x63, 0x41, 0x00, /* 75 */
+  0x7f, 0x7f, 0x40, 0x40, 0x40, 0x40, 0x00, /* 76 */
+  0x7f, 0x7f, 0x06, 0x0c, 0x06, 0x7f, 0x00, /* 77 */
+  0x7f, 0x7f, 0x0c, 0x18, 0x7f, 0x7f, 0x00, /* 78 */
+  0x3e, 0x7f, 0x41, 0x41, 0x7f, 0x3e, 0x00, /* 79 */
+  0x7f, 0x7f, 0x09, 0x09, 0x0f, 0x06, 0x00, /* 80 */
+  0x3e, 0x7f, 0x41, 0x41, 0xff, 0xbe, 0x00, /* 81 */
+  0x7f, 0x7f, 0x19, 0x39, 0x6f, 0x46, 0x00, /* 82 */
+  0x26, 0x6f, 0x49, 0x49, 0x7b, 0x32, 0x00, /* 83 */
+  0x01, 0x01, 0x7f, 0x7f, 0x01, 0x01, 0x00, /* 84 */
+  0x3f, 0x7f, 0x40, 0x40, 0x7f, 0x3f, 0x00, /* 85 */
+  0x1f, 0x3f, 0x60, 0x60, 0x3f, 0x1f, 0x00, /* 86 */
+  0x7f, 0x7f, 0x30, 0x18, 0x30, 0x7f, 0x00, /* 87 */
+  0x63, 0x36, 0x1c, 0x1c, 0x36, 0x63, 0x00, /* 88 */
+  0x07, 0x0f, 0x78, 0x78, 0x0f, 0x07, 0x00, /* 89 */
+  0x61, 0x71, 0x59, 0x4d, 0x47, 0x43, 0x00, /* 90 */
+  0x00, 0x7f, 0x7f, 0x41, 0x41, 0x00, 0x00, /* 91 */
+  0x01, 0x07, 0x0e, 0x38, 0x70, 0x40, 0x00, /* 92 */
+  0x00, 0x41, 0x41, 0x7f, 0x7f, 0x00, 0x00, /* 93 */
+  0x10, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x00, /* 94 */
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, /* 95 */
+  0x04, 0x06, 0xff, 0xff, 0x06, 0x04, 0x00, /* 96 */
+  0x24, 0x74, 0x54, 0x54, 0x7c, 0x78, 0x00, /* 97 */
+  0x7f, 0x7f, 0x44, 0x44, 0x7c, 0x38, 0x00, /* 98 */
+  0x38, 0x7c, 0x44, 0x44, 0x6c, 0x28, 0x00, /* 99 */
+  0x38, 0x7c, 0x44, 0x44, 0x7f, 0x7f, 0x00, /* 100 */
+  0x38, 0x7c, 0x54, 0x54, 0x5c, 0x18, 0x00, /* 101 */
+  0x7e, 0x7f, 0x09, 0x09, 0x03, 0x02, 0x00, /* 102 */
+  0x18, 0xbc, 0xa4, 0xa4, 0xfc, 0x78, 0x00, /* 103 */
+  0x7f, 0x7f, 0x04, 0x04, 0x7c, 0x78, 0x00, /* 104 */
+  0x40, 0x44, 0x7d, 0x7d, 0x40, 0x40, 0x00, /* 105 */
+  0x40, 0xc0, 0x84, 0xfd, 0x7d, 0x04, 0x00, /* 106 */
+  0x7f, 0x7f, 0x10, 0x38, 0x6c, 0x44, 0x00, /* 107 */
+  0x41, 0x41, 0x7f, 0x7f, 0x40, 0x40, 0x00, /* 108 */
+  0x7c, 0x7c, 0x18, 0x30, 0x18, 0x7c, 0x00, /* 109 */
+  0x7c, 0x7c, 0x04, 0x04, 0x7c, 0x78, 0x00, /* 110 */
+  0x38, 0x7c, 0x44, 0x44, 0x7c, 0x38, 0x00, /* 111 */
+  0xfc, 0xfc, 0x24, 0x24, 0x3c, 0x18, 0x00, /* 112 */
+  0x18, 0x3c, 0x24, 0x24, 0xfc, 0xfc, 0x00, /* 113 */
+  0x7c, 0x7c, 0x04, 0x04, 0x0c, 0x08, 0x00, /* 114 */
+  0x48, 0x5c, 0x54, 0x54, 0x74, 0x24, 0x00, /* 115 */
+  0x04, 0x04, 0x3f, 0x7f, 0x44, 0x04, 0x00, /* 116 */
+  0x3c, 0x7c, 0x40, 0x40, 0x7c, 0x3c, 0x00, /* 117 */
+  0x1c, 0x3c, 0x60, 0x60, 0x3c, 0x1c, 0x00, /* 118 */
+  0x7c, 0x7c, 0x30, 0x18, 0x30, 0x7c, 0x00, /* 119 */
+  0x44, 0x6c, 0x38, 0x38, 0x6c, 0x44, 0x00, /* 120 */
+  0x1c, 0xbc, 0xa0, 0xa0, 0xfc, 0x7c, 0x00, /* 121 */
+  0x44, 0x64, 0x74, 0x5c, 0x4c, 0x44, 0x00, /* 122 */
+  0x08, 0x08, 0x3e, 0x77, 0x41, 0x00, 0x00, /* 123 */
+  0x00, 0x00, 0x77, 0x77, 0x00, 0x00, 0x00, /* 124 */
+  0x00, 0x41, 0x77, 0x3e, 0x08, 0x08, 0x00, /* 125 */
+  0x01, 0x0f, 0x01, 0x3c, 0x08, 0x3c, 0x00, /* 126 */
+  0x10, 0x18, 0x14, 0x12, 0x14, 0x18, 0x00, /* 127 */
+};
+
+static const struct font_range font_6x8_ranges[] = {
+    {0x00a0, 96},
+    {0x2500, 128},
+};
+
+static const uint8_t font_6x8_dict[] = {
+  0x00, 0x08, 0x18, 0x14, 0xff, 0x7d, 0xf8, 0x7c, 0x0f, 0x7e, 0x44, 0x1f, 0x7f, 0x38, 0x45,
+};
+
+static const uint16_t font_6x8_index[] = {
+    0, 124, 247, 351, 470, 600, 715, 785, 849, 913, 977, 1044, 1120, 1203
+};
+
+static const uint8_t font_6x8_packed[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0xff, 0xff, 0x0f, 0x00, 0x1c, 0x3e, 0x63, 0x3e,
+  0x22, 0x9f, 0xfc, 0xff, 0x00, 0x48, 0x49, 0x41, 0x62, 0xff, 0xff, 0xff, 0x00, 0x42, 0x3c, 0x24,
+  0x24, 0x3c, 0x42, 0xff, 0x77, 0xff, 0x00, 0x2b, 0x2f, 0x2f, 0x2b, 0x00, 0xff, 0x00, 0x00, 0x77,
+  0x77, 0xff, 0x5f, 0x0f, 0x00, 0x4a, 0x5f, 0x55, 0x29, 0xff, 0x00, 0xff, 0x00, 0x01, 0x01, 0x01,
+  0x01, 0xff, 0xff, 0xff, 0x00, 0x3e, 0x41, 0x5d, 0x55, 0x41, 0x3e, 0xff, 0xff, 0xff, 0x00, 0x48,
+  0x5d, 0x55, 0x5f, 0x5e, 0x40, 0x31, 0x1f, 0xf3, 0x00, 0x22, 0x22, 0xff, 0xff, 0xff, 0x00, 0x04,
+  0x04, 0x04, 0x04, 0x1c, 0x1c, 0x11, 0x11, 0x11, 0x00, 0xff, 0xf5, 0xff, 0x00, 0x3e, 0x41, 0x55,
+  0x69, 0x3e, 0xff, 0xff, 0xff, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xff, 0xff, 0x0f, 0x00,
+  0x02, 0x07, 0x05, 0x07, 0x02, 0xaa, 0xff, 0xaa, 0x00, 0x5f, 0x5f, 0xf0, 0xff, 0x0f, 0x00, 0x19,
+  0x1d, 0x17, 0x12, 0xf0, 0xbf, 0x0f, 0x00, 0x11, 0x15, 0x0a, 0x00, 0xff, 0x0f, 0x00, 0x02, 0x03,
+  0x01, 0xff, 0xff, 0xf7, 0x00, 0xfc, 0xfc, 0x20, 0x60, 0x3c, 0x8f, 0xc8, 0xcf, 0x00, 0x06, 0x01,
+  0x00, 0x22, 0x00, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x80, 0xc0, 0x40, 0xf0, 0xbb, 0x0f, 0x00, 0x12,
+  0x10, 0xff, 0xff, 0xff, 0x00, 0x26, 0x2f, 0x29, 0x2f, 0x26, 0x20, 0x3f, 0xf1, 0x13, 0x00, 0x22,
+  0x22, 0xff, 0xff, 0xff, 0x00, 0x21, 0x17, 0x28, 0x34, 0x7a, 0x21, 0xff, 0xf1, 0xff, 0x00, 0x21,
+  0x17, 0x04, 0x6a, 0x59, 0xff, 0xff, 0xff, 0x00, 0x25, 0x17, 0x28, 0x34, 0x7a, 0x21, 0xff, 0xef,
+  0xff, 0x00, 0x30, 0x78, 0x4d, 0x60, 0x20, 0x5f, 0xff, 0xf7, 0x00, 0x78, 0x17, 0x16, 0x78, 0x7f,
+  0xff, 0xf5, 0x00, 0x78, 0x16, 0x17, 0x78, 0x9f, 0xff, 0xf9, 0x00, 0x78, 0x15, 0x15, 0x78, 0x5f,
+  0xff, 0xf9, 0x00, 0x7a, 0x15, 0x16, 0x79, 0x5f, 0x33, 0xf5, 0x00, 0x79, 0x79, 0xcf, 0xff, 0xfc,
+  0x00, 0x78, 0x15, 0x15, 0x78, 0xc9, 0xcf, 0xfc, 0x00, 0x09, 0x49, 0xcf, 0xff, 0xff, 0x00, 0x3e,
+  0xc1, 0xc1, 0x63, 0x22, 0x57, 0xff, 0xaa, 0x00, 0x57, 0x56, 0x77, 0xff, 0xae, 0x00, 0x56, 0x57,
+  0x97, 0xff, 0xaf, 0x00, 0x55, 0x55, 0x46, 0x55, 0xff, 0xee, 0x00, 0x54, 0x54, 0xea, 0x9c, 0xaa,
+  0x00, 0xaa, 0xc9, 0xae, 0x00, 0xfa, 0x55, 0xaf, 0x00, 0x46, 0x46, 0xee, 0x77, 0xee, 0x00, 0xcf,
+  0xfc, 0xff, 0x00, 0x49, 0x49, 0x77, 0x3e, 0x59, 0xff, 0x59, 0x00, 0x19, 0x32, 0x5d, 0xff, 0xd7,
+  0x00, 0x47, 0x46, 0x7d, 0xff, 0xd5, 0x00, 0x46, 0x47, 0x9d, 0xee, 0xd9, 0x00, 0x5f, 0xfe, 0xf9,
+  0x00, 0x3a, 0x46, 0x39, 0x5f, 0xaa, 0xf5, 0x00, 0x39, 0x39, 0xff, 0xff, 0xff, 0x00, 0x22, 0x36,
+  0x1c, 0x1c, 0x36, 0x22, 0xcf, 0xff, 0xfc, 0x00, 0x3e, 0x59, 0x4d, 0x3e, 0x5f, 0xff, 0xf7, 0x00,
+  0x3c, 0x43, 0x42, 0x3c, 0x7f, 0xff, 0xf5, 0x00, 0x3c, 0x42, 0x43, 0x3c, 0x9f, 0xff, 0xf9, 0x00,
+  0x3c, 0x41, 0x41, 0x3c, 0x5f, 0xff, 0xf5, 0x00, 0x3d, 0x40, 0x40, 0x3d, 0xff, 0xff, 0xff, 0x00,
+  0x0c, 0x1c, 0x72, 0x73, 0x1d, 0x0c, 0xcc, 0xff, 0xff, 0x00, 0x12, 0x12, 0x1e, 0x0c, 0x4f, 0xff,
+  0xfc, 0x00, 0xfe, 0x01, 0x49, 0x36, 0xff, 0xff, 0xf7, 0x00, 0x24, 0x75, 0x57, 0x56, 0x78, 0xff,
+  0xff, 0xf5, 0x00, 0x24, 0x74, 0x56, 0x57, 0x78, 0xff, 0xff, 0xf9, 0x00, 0x24, 0x76, 0x55, 0x55,
+  0x78, 0xff, 0xff, 0xf9, 0x00, 0x26, 0x75, 0x55, 0x56, 0x79, 0xff, 0xff, 0xf5, 0x00, 0x25, 0x75,
+  0x54, 0x54, 0x79, 0xff, 0xff, 0xfc, 0x00, 0x24, 0x77, 0x55, 0x55, 0x78, 0xff, 0xdf, 0xff, 0x00,
+  0x24, 0x74, 0x5c, 0x54, 0x58, 0x7d, 0xff, 0xff, 0x00, 0xc4, 0xc4, 0x6c, 0x28, 0x5d, 0xff, 0x2f,
+  0x00, 0x57, 0x56, 0x5c, 0x7d, 0xff, 0x2f, 0x00, 0x56, 0x57, 0x5d, 0x9d, 0xff, 0x2f, 0x00, 0x55,
+  0x55, 0x5e, 0x5f, 0xff, 0xff, 0x00, 0x39, 0x54, 0x54, 0x5d, 0x19, 0xef, 0x9c, 0xff, 0x00, 0x40,
+  0x40, 0x40, 0xaf, 0xc9, 0xff, 0x00, 0x40, 0x41, 0x40, 0xff, 0x55, 0xff, 0x00, 0x40, 0x46, 0x42,
+  0x40, 0xef, 0x77, 0xff, 0x00, 0x41, 0x41, 0x41, 0x5f, 0xff, 0xf7, 0x00, 0x30, 0x4a, 0x4d, 0x30,
+  0x59, 0xff, 0xf9, 0x00, 0x05, 0x06, 0x79, 0x5d, 0xff, 0xd7, 0x00, 0x47, 0x46, 0x7d, 0xff, 0xd5,
+  0x00, 0x46, 0x47, 0x9d, 0xee, 0xd9, 0x00, 0x5f, 0xfe, 0xf9, 0x00, 0x3a, 0x46, 0x39, 0x5f, 0xaa,
+  0xf5, 0x00, 0x39, 0x39, 0x11, 0xff, 0x11, 0x00, 0x2a, 0x2a, 0x7d, 0xff, 0xd7, 0x00, 0x74, 0x5c,
+  0x5f, 0xff, 0xf7, 0x00, 0x3c, 0x43, 0x42, 0x3c, 0x7f, 0xff, 0xf5, 0x00, 0x3c, 0x42, 0x43, 0x3c,
+  0x9f, 0xff, 0xf9, 0x00, 0x3c, 0x41, 0x41, 0x3c, 0x5f, 0xff, 0xf5, 0x00, 0x3d, 0x40, 0x40, 0x3d,
+  0xff, 0xff, 0x7f, 0x00, 0x1c, 0xbc, 0xa2, 0xa3, 0xfd, 0xff, 0xff, 0x2f, 0x00, 0xfe, 0xfe, 0x24,
+  0x24, 0x3c, 0xff, 0xff, 0x5f, 0x00, 0x1d, 0xbd, 0xa0, 0xa0, 0xfd, 0x11, 0x11, 0x11, 0x01, 0x22,
+  0x22, 0x22, 0x02, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x11, 0x10, 0x01, 0x01, 0x22,
+  0x20, 0x02, 0x02, 0x00, 0xf0, 0x00, 0x00, 0xdb, 0x00, 0xf0, 0x0f, 0x00, 0xdb, 0xdb, 0x01, 0x01,
+  0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0xf0, 0x00, 0x00, 0x55, 0x00, 0xf0, 0x0f, 0x00, 0x55,
+  0x55, 0x00, 0x60, 0x11, 0x01, 0x00, 0x60, 0x22, 0x02, 0x00, 0x60, 0x16, 0x01, 0x00, 0x60, 0x26,
+  0x02, 0x11, 0x61, 0x00, 0x00, 0x22, 0x62, 0x00, 0x00, 0x11, 0x61, 0x06, 0x00, 0x22, 0x62, 0x06,
+  0x00, 0x00, 0x80, 0x11, 0x01, 0x00, 0xb0, 0x22, 0x02, 0x00, 0x80, 0x18, 0x01, 0x00, 0xb0, 0x2b,
+  0x02, 0x11, 0x81, 0x00, 0x00, 0x22, 0xb2, 0x00, 0x00, 0x11, 0x81, 0x08, 0x00, 0x22, 0xb2, 0x08,
+  0x00, 0x00, 0x40, 0x11, 0x01, 0x00, 0x40, 0x22, 0x02, 0x00, 0x40, 0x18, 0x01, 0x00, 0x40, 0x16,
+  0x01, 0x00, 0x40, 0x14, 0x01, 0x00, 0x40, 0x2b, 0x02, 0x00, 0x40, 0x26, 0x02, 0x00, 0x40, 0x24,
+  0x02, 0x11, 0x41, 0x00, 0x00, 0x22, 0x42, 0x00, 0x00, 0x11, 0x41, 0x08, 0x00, 0x11, 0x41, 0x06,
+  0x00, 0x11, 0x41, 0x04, 0x00, 0x22, 0x42, 0x08, 0x00, 0x22, 0x42, 0x06, 0x00, 0x22, 0x42, 0x04,
+  0x00, 0x11, 0x61, 0x11, 0x01, 0x22, 0x62, 0x11, 0x01, 0x11, 0x61, 0x22, 0x02, 0x22, 0x62, 0x22,
+  0x02, 0x11, 0x61, 0x16, 0x01, 0x22, 0x62, 0x16, 0x01, 0x11, 0x61, 0x26, 0x02, 0x22, 0x62, 0x26,
+  0x02, 0x11, 0x81, 0x11, 0x01, 0x22, 0xb2, 0x11, 0x01, 0x11, 0xb1, 0x22, 0x02, 0x22, 0xb2, 0x22,
+  0x02, 0x11, 0x81, 0x18, 0x01, 0x22, 0xb2, 0x18, 0x01, 0x11, 0xb1, 0x2b, 0x02, 0x22, 0xb2, 0x2b,
+  0x02, 0x11, 0x41, 0x11, 0x01, 0x22, 0x42, 0x11, 0x01, 0x11, 0x41, 0x22, 0x02, 0x22, 0x42, 0x22,
+  0x02, 0x11, 0x41, 0x18, 0x01, 0x11, 0x41, 0x16, 0x01, 0x11, 0x41, 0x14, 0x01, 0x22, 0x42, 0x18,
+  0x01, 0x11, 0x41, 0x2b, 0x02, 0x22, 0x42, 0x16, 0x01, 0x11, 0x41, 0x26, 0x02, 0x22, 0x42, 0x2b,
+  0x02, 0x22, 0x42, 0x26, 0x02, 0x22, 0x42, 0x14, 0x01, 0x11, 0x41, 0x24, 0x02, 0x22, 0x42, 0x24,
+  0x02, 0x11, 0x01, 0x11, 0x01, 0x22, 0x02, 0x22, 0x02, 0x00, 0xf0, 0x00, 0x00, 0x77, 0x00, 0xf0,
+  0x0f, 0x00, 0x77, 0x77, 0x33, 0x33, 0x33, 0x03, 0x00, 0x04, 0x04, 0x00, 0x00, 0xf0, 0x33, 0x03,
+  0xfc, 0x00, 0x16, 0x16, 0x01, 0x00, 0xff, 0x3f, 0x03, 0xfc, 0x04, 0xf4, 0x33, 0xf3, 0x00, 0x00,
+  0xfc, 0x11, 0x16, 0x06, 0x00, 0x33, 0xff, 0x0f, 0x00, 0xf4, 0x04, 0xfc, 0x00, 0xb0, 0x33, 0x03,
+  0x00, 0x18, 0x18, 0x01, 0x00, 0xfb, 0x3f, 0x03, 0x10, 0x17, 0x33, 0xb3, 0x00, 0x00, 0x11, 0x18,
+  0x08, 0x00, 0x33, 0xff, 0x0b, 0x00, 0x17, 0x10, 0x00, 0x40, 0x33, 0x03, 0x00, 0x04, 0x14, 0x01,
+  0x00, 0x04, 0x3f, 0x03, 0xf7, 0x33, 0x43, 0x00, 0x00, 0x11, 0x04, 0x04, 0x00, 0x33, 0x0f, 0x04,
+  0x00, 0xf7, 0x33, 0xf3, 0x33, 0x03, 0xf4, 0x11, 0x16, 0x16, 0x01, 0x33, 0xff, 0x3f, 0x03, 0xf4,
+  0x04, 0xf4, 0x33, 0xf3, 0x33, 0x03, 0x17, 0x11, 0x18, 0x18, 0x01, 0x33, 0xff, 0x3f, 0x03, 0x17,
+  0x10, 0x17, 0x33, 0xf3, 0x33, 0x03, 0xf7, 0x11, 0x04, 0x14, 0x01, 0x33, 0x0f, 0x3f, 0x03, 0xf7,
+  0xf7, 0x00, 0xf0, 0x1f, 0x01, 0xe0, 0x10, 0x11, 0xff, 0x00, 0x00, 0x10, 0xe0, 0x11, 0xff, 0x00,
+  0x00, 0x04, 0x03, 0x00, 0xf0, 0x1f, 0x01, 0x03, 0x04, 0xff, 0xff, 0xf1, 0x0f, 0x80, 0x40, 0x20,
+  0x10, 0x04, 0x03, 0xff, 0xf1, 0xff, 0x0f, 0x03, 0x04, 0x10, 0x20, 0x40, 0x80, 0xaf, 0xff, 0xaf,
+  0x0f, 0x83, 0x28, 0x10, 0x28, 0x83, 0x11, 0x11, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x10,
+  0x11, 0x01, 0x00, 0x60, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0x20,
+  0x22, 0x02, 0x00, 0x60, 0x06, 0x00, 0x11, 0x21, 0x22, 0x02, 0x00, 0x40, 0x06, 0x00, 0x22, 0x22,
+  0x11, 0x01, 0x00, 0x40, 0x08, 0x00,
+};
+
+const struct font font_6x8 = {
+    7, 1, 0, 128, font_6x8_data,
+    2, font_6x8_ranges, font_6x8_dict, font_6x8_index, font_6x8_packed
+};
@@ -0,0 +1,267 @@
+/* Generated by tools/bdf2c.py from fonts/8x16.bdf, do not edit */
+#include "font.h"
+
+static const uint8_t font_8x16_data[] = {
+  0x00, 0x00, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x00, 0x00, 0x00, /* 0 */
+  0x00, 0x00, 0xc0, 0xf0, 0xfc, 0xf0, 0xc0, 0x00, 0x00, 0x03, 0x0f, 0x3f, 0x0f, 0x03, 0x00, 0x00, /* 1 */
+  0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, /* 2 */
+  0x00, 0xc0, 0xf0, 0xfc, 0xf0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x3f, 0x0f, 0x03, 0x00, /* 3 */
+  0x00, 0x00, 0xc0, 0xf0, 0xf0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x0f, 0x03, 0x00, 0x00, /* 4 */
+  0x00, 0x00, 0x00, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, /* 5 */
+  0x00, 0xf0, 0xfc, 0xfc, 0xfc, 0xf0, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x0f, 0x0f, 0x03, 0x00, 0x00, /* 6 */
+  0x00, 0xf0, 0x0c, 0x0c, 0x0c, 0xf0, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x0c, 0x0c, 0x03, 0x00, 0x00, /* 7 */
+  0x00, 0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, /* 8 */
+  0x00, 0xc0, 0x3c, 0xff, 0xff, 0x3c, 0xc0, 0x00, 0x00, 0xff, 0x00, 0xfc, 0xfc, 0x00, 0xff, 0x00, /* 9 */
+  0x00, 0xc0, 0x3c, 0xff, 0xff, 0x3c, 0xc0, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, /* 10 */
+  0x00, 0xc0, 0xf0, 0xf0, 0xf0, 0xcc, 0xcc, 0x00, 0x00, 0x0f, 0x3f, 0x3f, 0x3f, 0xcf, 0xc0, 0x00, /* 11 */
+  0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, /* 12 */
+  0x00, 0xcc, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, /* 13 */
+  0x00, 0xcc, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x30, 0x30, 0x3f, 0x3f, 0x3f, 0x00, 0x00, /* 14 */
+  0x00, 0xcc, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x30, 0x30, 0x00, 0x00, /* 15 */
+  0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, /* 16 */
+  0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x00, /* 17 */
+  0x00, 0xc0, 0x30, 0x0c, 0x0c, 0x30, 0xc0, 0x00, 0x00, 0x03, 0x0c, 0x30, 0x30, 0x0c, 0x03, 0x00, /* 18 */
+  0x00, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x3c, 0x3c, 0x3f, 0x3f, 0x3f, 0x00, 0x00, /* 19 */
+  0x00, 0xc0, 0xcf, 0x0f, 0x00, 0xfc, 0xfc, 0x00, 0x00, 0xf3, 0xf3, 0xf0, 0x00, 0x3c, 0x3c, 0x00, /* 20 */
+  0x00, 0x30, 0xc0, 0xf0, 0xcc, 0x03, 0x00, 0x00, 0x00, 0x30, 0x0c, 0x03, 0x00, 0x03, 0x00, 0x00, /* 21 */
+  0x00, 0xfc, 0x0c, 0x0c, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x3f, 0x30, 0x30, 0x30, 0x3f, 0x00, 0x00, /* 22 */
+  0x00, 0xcc, 0xf0, 0xff, 0xf0, 0xcc, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x3f, 0x03, 0x0c, 0x00, 0x00, /* 23 */
+  0x00, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x00, 0x00, /* 24 */
+  0x00, 0x30, 0xcc, 0xff, 0xcc, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x3f, 0x0c, 0x03, 0x00, 0x00, /* 25 */
+  0x00, 0xf0, 0x0c, 0x33, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x03, 0x03, 0x00, 0x00, /* 26 */
+  0x00, 0x03, 0x0f, 0xfc, 0xfc, 0xf0, 0x00, 0x00, 0x00, 0x30, 0x3c, 0x0f, 0x0f, 0x03, 0x00, 0x00, /* 27 */
+  0x00, 0x30, 0xf0, 0xff, 0xf0, 0x30, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x03, 0x0c, 0x00, 0x00, /* 28 */
+  0x00, 0x00, 0xf0, 0xfc, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x0f, 0x03, 0x03, 0x00, 0x00, /* 29 */
+  0x00, 0xc0, 0xc0, 0xf0, 0xf0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 30 */
+  0x00, 0x00, 0x00, 0xc0, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x03, 0x00, 0x00, /* 31 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 32 */
+  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x00, 0x00, 0x00, /* 33 */
+  0x00, 0x0c, 0x03, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 34 */
+  0x00, 0xf0, 0x3c, 0x0f, 0x0f, 0x3f, 0xfc, 0x00, 0x00, 0x0f, 0x30, 0xc0, 0xc0, 0xc0, 0x33, 0x00, /* 35 */
+  0x00, 0xc0, 0x00, 0x0f, 0x0f, 0x00, 0xf0, 0x00, 0x00, 0x3f, 0xfc, 0xf0, 0xf0, 0x3c, 0x0f, 0x00, /* 36 */
+  0x00, 0x0c, 0xcc, 0xfc, 0xf0, 0xcf, 0x0f, 0x00, 0x00, 0xff, 0x03, 0x3f, 0xc0, 0x03, 0x0c, 0x00, /* 37 */
+  0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x3c, 0xff, 0xff, 0x3c, 0x0c, 0x00, /* 38 */
+  0x00, 0x00, 0x00, 0x33, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 39 */
+  0x00, 0x00, 0xf0, 0xfc, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x3c, 0x30, 0x00, 0x00, /* 40 */
+  0x00, 0x00, 0x03, 0x0f, 0xfc, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x30, 0x3c, 0x0f, 0x03, 0x00, 0x00, /* 41 */
+  0x00, 0xcc, 0xf0, 0xfc, 0xfc, 0xf0, 0xcc, 0x00, 0x00, 0x0c, 0x03, 0x0f, 0x0f, 0x03, 0x0c, 0x00, /* 42 */
+  0x00, 0xc0, 0xc0, 0xfc, 0xfc, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x0f, 0x00, 0x00, 0x00, /* 43 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x3c, 0x00, 0x00, 0x00, /* 44 */
+  0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* 45 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, /* 46 */
+  0x00, 0x00, 0x00, 0xc0, 0xfc, 0x3f, 0x03, 0x00, 0x00, 0x30, 0x3f, 0x0f, 0x00, 0x00, 0x00, 0x00, /* 47 */
+  0x00, 0xfc, 0xff, 0x03, 0x03, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0x3f, 0x30, 0x30, 0x3f, 0x0f, 0x00, /* 48 */
+  0x00, 0x0c, 0x0c, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x3f, 0x3f, 0x30, 0x30, 0x00, /* 49 */
+  0x00, 0x0c, 0x0f, 0x03, 0xc3, 0xff, 0x3c, 0x00, 0x00, 0x30, 0x3c, 0x3f, 0x33, 0x30, 0x30, 0x00, /* 50 */
+  0x00, 0x03, 0x03, 0xc3, 0xf3, 0xff, 0x0f, 0x00, 0x00, 0x0c, 0x3c, 0x30, 0x30, 0x3f, 0x0f, 0x00, /* 51 */
+  0x00, 0xc0, 0xf0, 0x3c, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x3f, 0x3f, 0x03, 0x00, /* 52 */
+  0x00, 0xff, 0xff, 0xc3, 0xc3, 0xc3, 0x03, 0x00, 0x00, 0x0c, 0x3c, 0x30, 0x30, 0x3f, 0x0f, 0x00, /* 53 */
+  0x00, 0xc0, 0xf0, 0xfc, 0xcf, 0xc3, 0x00, 0x00, 0x00, 0x0f, 0x3f, 0x30, 0x30, 0x3f, 0x0f, 0x00, /* 54 */
+  0x00, 0x03, 0x03, 0x03, 0xc3, 0xff, 0x3f, 0x00, 0x00, 0x30, 0x3c, 0x0f, 0x03, 0x00, 0x00, 0x00, /* 55 */
+  0x00, 0x3c, 0xff, 0xc3, 0xc3, 0xff, 0x3c, 0x00, 0x00, 0x0f, 0x3f, 0x30, 0x30, 0x3f, 0x0f, 0x00, /* 56 */
+  0x00, 0x3c, 0xff, 0xc3, 0xc3, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x30, 0x3c, 0x0f, 0x03, 0x00, 0x00, /* 57 */
+  0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, /* 58 */
+  0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0f, 0x00, 0x00, 0x00, /* 59 */
+  0x00, 0xc0, 0xf0, 0x3c, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x3c, 0x30, 0x00, 0x00, /* 60 */
+  0x00, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, /* 61 */
+  0x00, 0x00, 0x03, 0x0f, 0x3c, 0xf0, 0xc0, 0x00, 0x00, 0x00, 0x30, 0x3c, 0x0f, 0x03, 0x00, 0x00, /* 62 */
+  0x00, 0x0c, 0x0f, 0x03, 0xc3, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x00, 0x00, 0x00, /* 63 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xcc, 0x30, 0x00, 0x00, 0x00, 0x00, /* 64 */
+  0x00, 0xfc, 0xff, 0xc3, 0xc3, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x3f, 0x3f, 0x00, /* 65 */
+  0x00, 0xff, 0xff, 0xc3, 0xc3, 0xff, 0x3c, 0x00, 0x00, 0x3f, 0x3f, 0x30, 0x30, 0x3f, 0x0f, 0x00, /* 66 */
+  0x00, 0xfc, 0xff, 0x03, 0x03, 0x0f, 0x0c, 0x00, 0x00, 0x0f, 0x3f, 0x30, 0x30, 0x3c, 0x0c, 0x00, /* 67 */
+  0x00, 0xff, 0xff, 0x03, 0x03, 0xff, 0xfc, 0x00, 0x00, 0x3f, 0x3f, 0x30, 0x30, 0x3f, 0x0f, 0x00, /* 68 */
+  0x00, 0xff, 0xff, 0xc3, 0xc3, 0x03, 0x03, 0x00, 0x00, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x00, /* 69 */
+  0x00, 0xff, 0xff, 0xc3, 0xc3, 0x03, 0x03, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, /* 70 */
+  0x00, 0xfc, 0xff, 0x03, 0xc3, 0xcf, 0xcc, 0x00, 0x00, 0x0f, 0x3f, 0x30, 0x30, 0x3f, 0x0f, 0x00, /* 71 */
+  0x00, 0xff, 0xff, 0xc0, 0xc0, 0xff, 0xff, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x3f, 0x3f, 0x00, /* 72 */
+  0x00, 0x03, 0x03, 0xff, 0xff, 0x03, 0x03, 0x00, 0x00, 0x30, 0x30, 0x3f, 0x3f, 0x30, 0x30, 0x00, /* 73 */
+  0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x03, 0x00, 0x00, 0x0c, 0x3c, 0x30, 0x3f, 0x0f, 0x00, 0x00, /* 74 */
+  0x00, 0xff, 0xff, 0xf0, 0x3c, 0x0f, 0x03, 0x00, 0x00, 0x3f, 0x3f, 0x03, 0x0f, 0x3c, 0x30, 0x00, /* 75 */
+  0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x30, 0x30, 0x30, 0x30, 0x00, /* 76 */
+  0x00, 0xff, 0xff, 0x3c, 0xf0, 0x3c, 0xff, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x3f, 0x00, /* 77 */
+  0x00, 0xff, 0xff, 0xf0, 0xc0, 0xff, 0xff, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x03, 0x3f, 0x3f, 0x00, /* 78 */
+  0x00, 0xfc, 0xff, 0x03, 0x03, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0x3f, 0x30, 0x30, 0x3f, 0x0f, 0x00, /* 79 */
+  0x00, 0xff, 0xff, 0xc3, 0xc3, 0xff, 0x3c, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, /* 80 */
+  0x00, 0xfc, 0xff, 0x03, 0x03, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0x3f, 0x30, 0x30, 0xff, 0xcf, 0x00, /* 81 */
+  0x00, 0xff, 0xff, 0xc3, 0xc3, 0xff, 0x3c, 0x00, 0x00, 0x3f, 0x3f, 0x03, 0x0f, 0x3c, 0x30, 0x00, /* 82 */
+  0x00, 0x3c, 0xff, 0xc3, 0xc3, 0xcf, 0x0c, 0x00, 0x00, 0x0c, 0x3c, 0x30, 0x30, 0x3f, 0x0f, 0x00, /* 83 */
+  0x00, 0x03, 0x03, 0xff, 0xff, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, /* 84 */
+  0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x0f, 0x3f, 0x30, 0x30, 0x3f, 0x0f, 0x00, /* 85 */
+  0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x03, 0x0f, 0x3c, 0x3c, 0x0f, 0x03, 0x00, /* 86 */
+  0x00, 0xff, 0xff, 0x00, 0xc0, 0x00, 0xff, 0x00, 0x00, 0x3f, 0x3f, 0x0f, 0x03, 0x0f, 0x3f, 0x00, /* 87 */
+  0x00, 0x0f, 0x3c, 0xf0, 0xf0, 0x3c, 0x0f, 0x00, 0x00, 0x3c, 0x0f, 0x03, 0x03, 0x0f, 0x3c, 0x00, /* 88 */
+  0x00, 0x3f, 0xff, 0xc0, 0xc0, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, /* 89 */
+  0x00, 0x03, 0x03, 0xc3, 0xf3, 0x3f, 0x0f, 0x00, 0x00, 0x3c, 0x3f, 0x33, 0x30, 0x30, 0x30, 0x00, /* 90 */
+  0x00, 0x00, 0xff, 0xff, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x30, 0x30, 0x00, 0x00, /* 91 */
+  0x00, 0x03, 0x3f, 0xfc, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x3f, 0x30, 0x00, /* 92 */
+  0x00, 0x00, 0x03, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x3f, 0x3f, 0x00, 0x00, /* 93 */
+  0x00, 0x00, 0xc0, 0xf0, 0x3c, 0xf0, 0xc0, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, /* 94 */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, /* 95 */
+  0x00, 0x30, 0x3c, 0xff, 0xff, 0x3c, 0x30, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, /* 96 */
+  0x00, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xc0, 0x00, 0x00, 0x0c, 0x3f, 0x33, 0x33, 0x3f, 0x3f, 0x00, /* 97 */
+  0x00, 0xff, 0xff, 0x30, 0x30, 0xf0, 0xc0, 0x00, 0x00, 0x3f, 0x3f, 0x30, 0x30, 0x3f, 0x0f, 0x00, /* 98 */
+  0x00, 0xc0, 0xf0, 0x30, 0x30, 0xf0, 0xc0, 0x00, 0x00, 0x0f, 0x3f, 0x30, 0x30, 0x3c, 0x0c, 0x00, /* 99 */
+  0x00, 0xc0, 0xf0, 0x30, 0x30, 0xff, 0xff, 0x00, 0x00, 0x0f, 0x3f, 0x30, 0x30, 0x3f, 0x3f, 0x00, /* 100 */
+  0x00, 0xc0, 0xf0, 0x30, 0x30, 0xf0, 0xc0, 0x00, 0x00, 0x0f, 0x3f, 0x33, 0x33, 0x33, 0x03, 0x00, /* 101 */
+  0x00, 0xfc, 0xff, 0xc3, 0xc3, 0x0f, 0x0c, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, /* 102 */
+  0x00, 0xc0, 0xf0, 0x30, 0x30, 0xf0, 0xc0, 0x00, 0x00, 0x03, 0xcf, 0xcc, 0xcc, 0xff, 0x3f, 0x00, /* 103 */
+  0x00, 0xff, 0xff, 0x30, 0x30, 0xf0, 0xc0, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x3f, 0x3f, 0x00, /* 104 */
+  0x00, 0x00, 0x30, 0xf3, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x3f, 0x3f, 0x30, 0x30, 0x00, /* 105 */
+  0x00, 0x00, 0x00, 0x30, 0xf3, 0xf3, 0x30, 0x00, 0x00, 0x30, 0xf0, 0xc0, 0xff, 0x3f, 0x00, 0x00, /* 106 */
+  0x00, 0xff, 0xff, 0x00, 0xc0, 0xf0, 0x30, 0x00, 0x00, 0x3f, 0x3f, 0x03, 0x0f, 0x3c, 0x30, 0x00, /* 107 */
+  0x00, 0x03, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x3f, 0x3f, 0x30, 0x30, 0x00, /* 108 */
+  0x00, 0xf0, 0xf0, 0xc0, 0x00, 0xc0, 0xf0, 0x00, 0x00, 0x3f, 0x3f, 0x03, 0x0f, 0x03, 0x3f, 0x00, /* 109 */
+  0x00, 0xf0, 0xf0, 0x30, 0x30, 0xf0, 0xc0, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x3f, 0x3f, 0x00, /* 110 */
+  0x00, 0xc0, 0xf0, 0x30, 0x30, 0xf0, 0xc0, 0x00, 0x00, 0x0f, 0x3f, 0x30, 0x30, 0x3f, 0x0f, 0x00, /* 111 */
+  0x00, 0xf0, 0xf0, 0x30, 0x30, 0xf0, 0xc0, 0x00, 0x00, 0xff, 0xff, 0x0c, 0x0c, 0x0f, 0x03, 0x00, /* 112 */
+  0x00, 0xc0, 0xf0, 0x30, 0x30, 0xf0, 0xf0, 0x00, 0x00, 0x03, 0x0f, 0x0c, 0x0c, 0xff, 0xff, 0x00, /* 113 */
+  0x00, 0xf0, 0xf0, 0x30, 0x30, 0xf0, 0xc0, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, /* 114 */
+  0x00, 0xc0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00, 0x30, 0x33, 0x33, 0x33, 0x3f, 0x0c, 0x00, /* 115 */
+  0x00, 0x30, 0x30, 0xff, 0xff, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x3f, 0x30, 0x00, 0x00, /* 116 */
+  0x00, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0x0f, 0x3f, 0x30, 0x30, 0x3f, 0x0f, 0x00, /* 117 */
+  0x00, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0x03, 0x0f, 0x3c, 0x3c, 0x0f, 0x03, 0x00, /* 118 */
+  0x00, 0xf0, 0xf0, 0x00, 0xc0, 0x00, 0xf0, 0x00, 0x00, 0x3f, 0x3f, 0x0f, 0x03, 0x0f, 0x3f, 0x00, /* 119 */
+  0x00, 0x30, 0xf0, 0xc0, 0xc0, 0xf0, 0x30, 0x00, 0x00, 0x30, 0x3c, 0x0f, 0x0f, 0x3c, 0x30, 0x00, /* 120 */
+  0x00, 0xf0, 0xf0, 0x00, 0x00, 0xf0, 0xf0, 0x00, 0x00, 0x03, 0xcf, 0xcc, 0xcc, 0xff, 0x3f, 0x00, /* 121 */
+  0x00, 0x30, 0x30, 0x30, 0xf0, 0xf0, 0x30, 0x00, 0x00, 0x30, 0x3c, 0x3f, 0x33, 0x30, 0x30, 0x00, /* 122 */
+  0x00, 0xc0, 0xc0, 0xfc, 0x3f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x3f, 0x30, 0x00, 0x00, /* 123 */
+  0x00, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x3f, 0x00, 0x00, 0x00, /* 124 */
+  0x00, 0x00, 0x03, 0x3f, 0xfc, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x30, 0x3f, 0x0f, 0x00, 0x00, 0x00, /* 125 */
+  0x00, 0x03, 0xff, 0x03, 0xf0, 0xc0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x0f, 0x00, /* 126 */
+  0x00, 0x00, 0xc0, 0x30, 0x0c, 0x30, 0xc0, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, /* 127 */
+};
+
+static const struct font_range font_8x16_ranges[] = {
+    {0x00a0, 96},
+    {0x2500, 128},
+};
+
+static const uint8_t font_8x16_dict[] = {
+  0x00, 0xc0, 0xff, 0x03, 0x30, 0x3f, 0x33, 0x0f, 0xf0, 0x0c, 0xf3, 0xfc, 0x3c, 0xc3, 0xcc,
+};
+
+static const uint16_t font_8x16_index[] = {
+    0, 130, 258, 386, 514, 642, 772, 905, 1033, 1161, 1289, 1417, 1545, 1673
+};
+
+static const uint8_t font_8x16_packed[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x0a, 0x00, 0x00, 0x50, 0x05, 0x00,
+  0x80, 0x7b, 0x9b, 0x00, 0x30, 0xc7, 0x97, 0x00, 0x10, 0x2b, 0x3d, 0x09, 0x40, 0x55, 0x44, 0x0c,
+  0x90, 0x48, 0x84, 0x09, 0x40, 0x97, 0x79, 0x04, 0xf0, 0x82, 0x28, 0x0f, 0x90, 0x59, 0x95, 0x09,
+  0xcf, 0xcf, 0x00, 0x50, 0x05, 0x00, 0x00, 0x50, 0x05, 0x00, 0xe0, 0x62, 0xda, 0x00, 0x40, 0x66,
+  0x95, 0x00, 0x30, 0x03, 0x30, 0x03, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xa3, 0x36, 0x0b, 0x70, 0x64,
+  0x46, 0x07, 0x10, 0x6a, 0xb2, 0x00, 0x40, 0x66, 0x66, 0x04, 0x10, 0x94, 0x41, 0x09, 0x00, 0x93,
+  0x30, 0x09, 0x40, 0x44, 0x84, 0x08, 0x00, 0x00, 0x30, 0x03, 0x10, 0x11, 0x11, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0xb0, 0xa3, 0xd6, 0x0b, 0x70, 0x54, 0xc6, 0x07, 0x30, 0x33, 0x33, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x90, 0x65, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x24, 0x42, 0x04, 0x40, 0x64,
+  0x46, 0x04, 0x00, 0xad, 0x95, 0x00, 0x00, 0x33, 0x33, 0x00, 0x00, 0x63, 0xe2, 0x00, 0x00, 0x33,
+  0x03, 0x00, 0x00, 0x90, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x08, 0x80, 0x08, 0x20, 0x92,
+  0x5c, 0x07, 0xc0, 0x22, 0x32, 0x02, 0x00, 0x00, 0x05, 0x05, 0x00, 0x10, 0x01, 0x00, 0x00, 0x30,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x48, 0x00, 0x00, 0x29, 0x02, 0x00, 0x00, 0x33,
+  0x33, 0x00, 0xc0, 0xd2, 0xc2, 0x00, 0x90, 0x99, 0x99, 0x09, 0x90, 0x14, 0x49, 0x01, 0x90, 0x03,
+  0x39, 0x00, 0x30, 0x15, 0xe4, 0x03, 0x90, 0x93, 0x57, 0x09, 0x30, 0x15, 0xe4, 0x0d, 0x90, 0x03,
+  0xc0, 0x06, 0x60, 0x15, 0xe4, 0x03, 0x90, 0x93, 0x57, 0x09, 0x00, 0xa1, 0x06, 0x00, 0x70, 0x45,
+  0xc4, 0x09, 0x10, 0x5a, 0x8c, 0x01, 0x50, 0x35, 0x53, 0x05, 0x10, 0xc8, 0xa5, 0x01, 0x50, 0x35,
+  0x53, 0x05, 0x10, 0x6b, 0xb6, 0x01, 0x50, 0x35, 0x53, 0x05, 0xe0, 0x6a, 0xbc, 0x0d, 0x50, 0x35,
+  0x53, 0x05, 0xd0, 0x4a, 0xa4, 0x0d, 0x50, 0x35, 0x53, 0x05, 0x10, 0x62, 0x26, 0x01, 0x50, 0x35,
+  0x53, 0x05, 0xb0, 0xd2, 0x22, 0x0d, 0x50, 0x05, 0x55, 0x04, 0xb0, 0x32, 0x73, 0x09, 0x70, 0x85,
+  0xc8, 0x09, 0x80, 0x5a, 0x4c, 0x04, 0x50, 0x65, 0x46, 0x04, 0x80, 0xc8, 0x65, 0x04, 0x50, 0x65,
+  0x46, 0x04, 0x80, 0x6b, 0xc6, 0x04, 0x50, 0x65, 0x46, 0x04, 0xa0, 0x4a, 0x64, 0x06, 0x50, 0x65,
+  0x46, 0x04, 0x40, 0x26, 0x4b, 0x04, 0x40, 0x54, 0x45, 0x04, 0x40, 0xb4, 0x62, 0x04, 0x40, 0x54,
+  0x45, 0x04, 0x40, 0xac, 0xca, 0x04, 0x40, 0x54, 0x45, 0x04, 0x60, 0x86, 0x68, 0x06, 0x40, 0x54,
+  0x45, 0x04, 0xd0, 0x22, 0x5d, 0x0b, 0x40, 0x55, 0x54, 0x07, 0xb0, 0xda, 0xb9, 0x0a, 0x50, 0x35,
+  0x57, 0x05, 0x10, 0x5a, 0x8c, 0x01, 0x70, 0x45, 0x54, 0x07, 0x10, 0xc8, 0xa5, 0x01, 0x70, 0x45,
+  0x54, 0x07, 0x10, 0x6b, 0xb6, 0x01, 0x70, 0x45, 0x54, 0x07, 0xe0, 0x6a, 0xbc, 0x0d, 0x70, 0x45,
+  0x54, 0x07, 0xd0, 0x4a, 0xa4, 0x0d, 0x70, 0x45, 0x54, 0x07, 0x90, 0x8c, 0xc8, 0x09, 0x90, 0x37,
+  0x73, 0x09, 0xb0, 0xd2, 0x2a, 0x0b, 0x70, 0x65, 0x54, 0x07, 0x80, 0x7a, 0x89, 0x08, 0x70, 0x45,
+  0x54, 0x07, 0x80, 0x98, 0xa7, 0x08, 0x70, 0x45, 0x54, 0x07, 0x80, 0x3b, 0xb3, 0x08, 0x70, 0x45,
+  0x54, 0x07, 0xa0, 0x0a, 0xa0, 0x0a, 0x70, 0x45, 0x54, 0x07, 0x80, 0x98, 0xa7, 0x08, 0x00, 0x53,
+  0x35, 0x00, 0x20, 0x92, 0xb9, 0x08, 0x50, 0x35, 0x33, 0x00, 0xb0, 0x32, 0x2d, 0x0c, 0x20, 0x02,
+  0x54, 0x07, 0x40, 0x56, 0x8c, 0x01, 0x90, 0x65, 0x56, 0x05, 0x40, 0xc4, 0xa5, 0x01, 0x90, 0x65,
+  0x56, 0x05, 0x40, 0x6c, 0xb6, 0x01, 0x90, 0x65, 0x56, 0x05, 0xc0, 0x66, 0xbc, 0x0d, 0x90, 0x65,
+  0x56, 0x05, 0x60, 0x46, 0xa4, 0x0d, 0x90, 0x65, 0x56, 0x05, 0x40, 0x65, 0x26, 0x01, 0x90, 0x65,
+  0x56, 0x05, 0x40, 0x84, 0x41, 0x01, 0x90, 0x65, 0x67, 0x06, 0x10, 0x48, 0x84, 0x01, 0x70, 0x85,
+  0xc8, 0x09, 0x10, 0x5a, 0x8c, 0x01, 0x70, 0x65, 0x66, 0x03, 0x10, 0xc8, 0xa5, 0x01, 0x70, 0x65,
+  0x66, 0x03, 0x10, 0x6b, 0xb6, 0x01, 0x70, 0x65, 0x66, 0x03, 0xd0, 0x4a, 0xa4, 0x0d, 0x70, 0x65,
+  0x66, 0x03, 0x00, 0x26, 0x0b, 0x00, 0x40, 0x54, 0x45, 0x04, 0x00, 0xb4, 0x32, 0x00, 0x40, 0x54,
+  0x45, 0x04, 0x00, 0xac, 0x9a, 0x00, 0x40, 0x54, 0x45, 0x04, 0x30, 0x86, 0x38, 0x03, 0x40, 0x54,
+  0x45, 0x04, 0x00, 0xea, 0x8a, 0x00, 0x70, 0x45, 0x54, 0x07, 0xb0, 0x6a, 0xbc, 0x0d, 0x50, 0x05,
+  0x50, 0x05, 0x10, 0x5a, 0x8c, 0x01, 0x70, 0x45, 0x54, 0x07, 0x10, 0xc8, 0xa5, 0x01, 0x70, 0x45,
+  0x54, 0x07, 0x10, 0x6b, 0xb6, 0x01, 0x70, 0x45, 0x54, 0x07, 0xe0, 0x6a, 0xbc, 0x0d, 0x70, 0x45,
+  0x54, 0x07, 0xd0, 0x4a, 0xa4, 0x0d, 0x70, 0x45, 0x54, 0x07, 0x10, 0xe1, 0x1e, 0x01, 0x00, 0x90,
+  0x09, 0x00, 0x10, 0x48, 0x88, 0x01, 0x70, 0x55, 0x56, 0x07, 0x80, 0x7a, 0x89, 0x08, 0x70, 0x45,
+  0x54, 0x07, 0x80, 0x98, 0xa7, 0x08, 0x70, 0x45, 0x54, 0x07, 0x80, 0x3b, 0xb3, 0x08, 0x70, 0x45,
+  0x54, 0x07, 0xa0, 0x0a, 0xa0, 0x0a, 0x70, 0x45, 0x54, 0x07, 0x80, 0x98, 0xa7, 0x08, 0x30, 0xef,
+  0x2e, 0x05, 0xcf, 0xb0, 0x4b, 0x84, 0x01, 0x20, 0x92, 0x79, 0x03, 0xa0, 0x0a, 0xa0, 0x0a, 0x30,
+  0xef, 0x2e, 0x05, 0xcf, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+  0x33, 0x33, 0x33, 0x33, 0x00, 0x20, 0x02, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x20, 0x22, 0x00,
+  0x00, 0x20, 0x22, 0x00, 0x11, 0x10, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x11, 0x10,
+  0x33, 0x30, 0x33, 0x30, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xa0, 0x0a, 0x00, 0xcf, 0xcf, 0x00, 0xf0,
+  0xff, 0x00, 0x00, 0xa0, 0xaa, 0x00, 0xcf, 0xcf, 0xcf, 0x01, 0x01, 0x10, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x10, 0x10, 0x03, 0x03, 0x30, 0x30, 0x00, 0x60, 0x06, 0x00, 0x00, 0x60, 0x06,
+  0x00, 0x00, 0x60, 0x66, 0x00, 0x00, 0x60, 0x66, 0x00, 0x00, 0x10, 0x11, 0x11, 0x00, 0x20, 0x02,
+  0x00, 0x00, 0x10, 0x11, 0x11, 0x00, 0x20, 0x32, 0x33, 0x00, 0x10, 0x11, 0x11, 0x00, 0x20, 0x22,
+  0x00, 0x00, 0x10, 0x11, 0x11, 0x00, 0x20, 0x22, 0x33, 0x11, 0x11, 0x01, 0x00, 0x00, 0x20, 0x02,
+  0x00, 0x11, 0x11, 0x01, 0x00, 0x33, 0x23, 0x02, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x20, 0x22,
+  0x00, 0x11, 0x11, 0x11, 0x00, 0x33, 0x23, 0x22, 0x00, 0x00, 0x20, 0x12, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x12, 0x11, 0x00, 0x30, 0x33, 0x33, 0x00, 0x20, 0x22, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x22, 0x11, 0x00, 0x30, 0x33, 0x33, 0x11, 0x21, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x21, 0x02, 0x00, 0x33, 0x33, 0x03, 0x00, 0x11, 0x21, 0x22, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x21, 0x22, 0x00, 0x33, 0x33, 0x03, 0x00, 0x00, 0x20, 0x12, 0x11, 0x00, 0x20, 0x02,
+  0x00, 0x00, 0x20, 0x12, 0x11, 0x00, 0x20, 0x32, 0x33, 0x00, 0x20, 0x22, 0x11, 0x00, 0x20, 0x02,
+  0x00, 0x00, 0x20, 0x12, 0x11, 0x00, 0x20, 0x22, 0x00, 0x00, 0x20, 0x22, 0x11, 0x00, 0x20, 0x22,
+  0x00, 0x00, 0x20, 0x22, 0x11, 0x00, 0x20, 0x32, 0x33, 0x00, 0x20, 0x12, 0x11, 0x00, 0x20, 0x22,
+  0x33, 0x00, 0x20, 0x22, 0x11, 0x00, 0x20, 0x22, 0x33, 0x11, 0x21, 0x02, 0x00, 0x00, 0x20, 0x02,
+  0x00, 0x11, 0x21, 0x02, 0x00, 0x33, 0x23, 0x02, 0x00, 0x11, 0x21, 0x22, 0x00, 0x00, 0x20, 0x02,
+  0x00, 0x11, 0x21, 0x12, 0x00, 0x00, 0x20, 0x22, 0x00, 0x11, 0x21, 0x22, 0x00, 0x00, 0x20, 0x22,
+  0x00, 0x11, 0x21, 0x22, 0x00, 0x33, 0x23, 0x02, 0x00, 0x11, 0x21, 0x12, 0x00, 0x33, 0x23, 0x22,
+  0x00, 0x11, 0x21, 0x22, 0x00, 0x33, 0x23, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x20, 0x02,
+  0x00, 0x11, 0x11, 0x11, 0x11, 0x33, 0x23, 0x02, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x20, 0x32,
+  0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x23, 0x32, 0x33, 0x11, 0x11, 0x11, 0x11, 0x00, 0x20, 0x22,
+  0x00, 0x11, 0x11, 0x11, 0x11, 0x33, 0x23, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x20, 0x22,
+  0x33, 0x11, 0x11, 0x11, 0x11, 0x33, 0x23, 0x22, 0x33, 0x11, 0x21, 0x12, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x21, 0x12, 0x11, 0x33, 0x33, 0x03, 0x00, 0x11, 0x21, 0x12, 0x11, 0x00, 0x30, 0x33,
+  0x33, 0x11, 0x21, 0x12, 0x11, 0x33, 0x33, 0x33, 0x33, 0x11, 0x21, 0x22, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x21, 0x22, 0x11, 0x33, 0x33, 0x03, 0x00, 0x11, 0x21, 0x22, 0x11, 0x00, 0x30, 0x33,
+  0x33, 0x11, 0x21, 0x22, 0x11, 0x33, 0x33, 0x33, 0x33, 0x11, 0x21, 0x12, 0x11, 0x00, 0x20, 0x02,
+  0x00, 0x11, 0x21, 0x12, 0x11, 0x33, 0x23, 0x02, 0x00, 0x11, 0x21, 0x12, 0x11, 0x00, 0x20, 0x32,
+  0x33, 0x11, 0x21, 0x12, 0x11, 0x33, 0x23, 0x32, 0x33, 0x11, 0x21, 0x22, 0x11, 0x00, 0x20, 0x02,
+  0x00, 0x11, 0x21, 0x12, 0x11, 0x00, 0x20, 0x22, 0x00, 0x11, 0x21, 0x22, 0x11, 0x00, 0x20, 0x22,
+  0x00, 0x11, 0x21, 0x22, 0x11, 0x33, 0x23, 0x02, 0x00, 0x11, 0x21, 0x22, 0x11, 0x00, 0x20, 0x32,
+  0x33, 0x11, 0x21, 0x12, 0x11, 0x33, 0x23, 0x22, 0x00, 0x11, 0x21, 0x12, 0x11, 0x00, 0x20, 0x22,
+  0x33, 0x11, 0x21, 0x22, 0x11, 0x33, 0x23, 0x32, 0x33, 0x11, 0x21, 0x12, 0x11, 0x33, 0x23, 0x22,
+  0x33, 0x11, 0x21, 0x22, 0x11, 0x33, 0x23, 0x22, 0x00, 0x11, 0x21, 0x22, 0x11, 0x00, 0x20, 0x22,
+  0x33, 0x11, 0x21, 0x22, 0x11, 0x33, 0x23, 0x22, 0x33, 0x11, 0x01, 0x10, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x01, 0x10, 0x11, 0x33, 0x03, 0x30, 0x33, 0x00, 0x50, 0x05, 0x00, 0x00, 0x50, 0x05,
+  0x00, 0x00, 0x50, 0x55, 0x00, 0x00, 0x50, 0x55, 0x00, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x33,
+  0x33, 0x00, 0x02, 0x20, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x80, 0x48, 0x44, 0x00, 0x20, 0x32,
+  0x33, 0x00, 0x11, 0x11, 0x11, 0x00, 0x02, 0x20, 0x00, 0x00, 0x48, 0x44, 0x44, 0x00, 0x02, 0x20,
+  0x33, 0x44, 0x84, 0x08, 0x00, 0x33, 0x23, 0x02, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x02, 0x20,
+  0x00, 0x44, 0x44, 0x84, 0x00, 0x33, 0x02, 0x20, 0x00, 0x00, 0x20, 0x42, 0x44, 0x00, 0x30, 0x33,
+  0x33, 0x00, 0x12, 0x21, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x50, 0x44, 0x00, 0x33, 0x33,
+  0x33, 0x44, 0x24, 0x02, 0x00, 0x33, 0x33, 0x03, 0x00, 0x11, 0x12, 0x21, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x44, 0x05, 0x20, 0x00, 0x33, 0x33, 0x33, 0x00, 0x00, 0x20, 0x42, 0x44, 0x00, 0x20, 0x32,
+  0x33, 0x00, 0x02, 0x20, 0x11, 0x00, 0x02, 0x20, 0x00, 0x00, 0x02, 0x50, 0x44, 0x00, 0x02, 0x20,
+  0x33, 0x44, 0x24, 0x02, 0x00, 0x33, 0x23, 0x02, 0x00, 0x11, 0x02, 0x20, 0x00, 0x00, 0x02, 0x20,
+  0x00, 0x44, 0x05, 0x20, 0x00, 0x33, 0x02, 0x20, 0x00, 0x44, 0x44, 0x44, 0x44, 0x33, 0x23, 0x32,
+  0x33, 0x11, 0x11, 0x11, 0x11, 0x00, 0x02, 0x20, 0x00, 0x44, 0x44, 0x44, 0x44, 0x33, 0x02, 0x20,
+  0x33, 0x44, 0x54, 0x45, 0x44, 0x33, 0x33, 0x33, 0x33, 0x11, 0x12, 0x21, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x44, 0x05, 0x50, 0x44, 0x33, 0x33, 0x33, 0x33, 0x44, 0x54, 0x45, 0x44, 0x33, 0x23, 0x32,
+  0x33, 0x11, 0x02, 0x20, 0x11, 0x00, 0x02, 0x20, 0x00, 0x44, 0x05, 0x50, 0x44, 0x33, 0x02, 0x20,
+  0x33, 0x00, 0x00, 0x00, 0x11, 0x00, 0xb0, 0x3b, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x0b,
+  0x00, 0x11, 0x74, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x47, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x74, 0x41, 0x39, 0x03, 0x00, 0x47, 0x01, 0x00, 0x00, 0x00, 0x30, 0x93,
+  0x14, 0x47, 0x01, 0x10, 0x74, 0x41, 0x39, 0x93, 0x14, 0x11, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x20, 0x02, 0x00, 0x11, 0x11, 0x01, 0x00, 0x33, 0x33, 0x03,
+  0x00, 0x00, 0x20, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x11, 0x11, 0x00, 0x30, 0x33,
+  0x33, 0x00, 0x10, 0x11, 0x00, 0x00, 0x20, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x30, 0x33,
+  0x33, 0x00, 0x20, 0x12, 0x00, 0x00, 0x20, 0x22, 0x00, 0x11, 0x11, 0x11, 0x11, 0x33, 0x33, 0x03,
+  0x00, 0x00, 0x20, 0x22, 0x00, 0x00, 0x20, 0x02, 0x00,
+};
+
+const struct font font_8x16 = {
+    8, 2, 0, 128, font_8x16_data,
+    2, font_8x16_ranges, font_8x16_dict, font_8x16_index, font_8x16_packed
+};
@@ -0,0 +1,43 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#ifndef H_GPIO
+#define H_GPIO
+/* Atomic changes to GPIO outputs.
+ *
+ * The SPI1 interrupt switches chip selects in GPIO_OUTPUT_VAL while the main
+ * program drives other pins in the same register. A plain read-modify-write
+ * from either side can undo a change the other makes between read and
+ * write, so both change output bits with a single atomic memory operation.
+ */
+
+#include <stdint.h>
+#include "platform.h"
+
+#ifdef HOST
+/* The emulator takes interrupts only when a register access begins, so the
+ * read and write of an operator assignment are not split */
+static inline void gpio_set(uint32_t mask)
+{
+    GPIO_REG(GPIO_OUTPUT_VAL) |= mask;
+}
+
+static inline void gpio_clear(uint32_t mask)
+{
+    GPIO_REG(GPIO_OUTPUT_VAL) &= ~mask;
+}
+#else
+/** Drive the outputs in mask high */
+static inline void gpio_set(uint32_t mask)
+{
+    asm volatile ("amoor.w zero, %1, %0" : "+A"(GPIO_REG(GPIO_OUTPUT_VAL)) : "r"(mask) : "memory");
+}
+
+/** Drive the outputs in mask low */
+static inline void gpio_clear(uint32_t mask)
+{
+    asm volatile ("amoand.w zero, %1, %0" : "+A"(GPIO_REG(GPIO_OUTPUT_VAL)) : "r"(~mask) : "memory");
+}
+#endif
+
+#endif
@@ -0,0 +1,134 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#include "gray.h"
+
+#include <stdint.h>
+#include "platform.h"
+
+#include "events.h"
+
+#if GRAY_BITS < 2 || GRAY_BITS > 4
+#error "GRAY_BITS must be 2 to 4"
+#endif
+
+/* The refresh rate of the panel is Fosc / (D * (phase1 + phase2 + 50) * mux)
+ * (SSD1306 datasheet, 0xD5 and 0xD9). While dithering, the oscillator runs at
+ * its highest setting and the precharge phases are cut to two clocks each,
+ * which about doubles the rate and keeps the planes from beating with it.
+ */
+/** Clock divide ratio and oscillator frequency while dithering */
+#define GRAY_CLOCK 0xF0
+/** Precharge periods while dithering */
+#define GRAY_PRECHARGE 0x22
+/** Settings restored by gray_stop(): the reset value and that of pmodoled_init() */
+#define NORMAL_CLOCK 0x80
+#define NORMAL_PRECHARGE 0xF1
+
+static struct {
+    pmodoled_t *disp;
+    const uint8_t (*planes)[DISP_PAGES][DISP_W];
+    /** Plane that is shown */
+    unsigned plane;
+    /** Half of display memory it is shown from */
+    unsigned half;
+    /** Time of the next step */
+    uint64_t due;
+    /** Value of gray_stats.planes at which the last frame has been shown
+     * completely */
+    uint32_t complete;
+} gray;
+
+struct gray_stats gray_stats;
+
+/** Write plane to the half of display memory that is not shown, and send
+ * the columns that changed
+ */
+static void upload(unsigned plane)
+{
+    unsigned base = (gray.half ^ 1) * DISP_PAGES;
+    for (unsigned page=0; page<DISP_PAGES; ++page) {
+        pmodoled_write(gray.disp, base + page, 0, gray.planes[plane][page], DISP_W);
+    }
+    pmodoled_flush(gray.disp);
+}
+
+/** Show the plane uploaded last and upload the one after it */
+static void step(uint64_t now)
+{
+    gray.half ^= 1;
+    gray.plane = (gray.plane + 1) % GRAY_BITS;
+    pmodoled_start_line(gray.disp, gray.half * DISP_H);
+    uint32_t ticks = GRAY_TICKS << gray.plane;
+    if (now >= gray.due + GRAY_TICKS) {
+        /* Too late to keep the cycle, start over from now */
+        gray_stats.late += 1;
+        gray.due = now + ticks;
+    } else {
+        gray.due += ticks;
+    }
+    gray_stats.planes += 1;
+    upload((gray.plane + 1) % GRAY_BITS);
+}
+
+void gray_start(pmodoled_t *disp)
+{
+    static const uint8_t cmd[] = {
+        0xD5, GRAY_CLOCK,
+        0xD9, GRAY_PRECHARGE,
+    };
+    gray.disp = disp;
+    gray.planes = 0;
+    gray.plane = GRAY_BITS - 1;
+    gray.half = 0;
+    pmodoled_command(disp, cmd, sizeof(cmd));
+    pmodoled_start_line(disp, 0);
+    gray_stats.planes = 0;
+    gray_stats.late = 0;
+    gray_stats.start = get_timer_value();
+    gray.due = gray_stats.start;
+}
+
+void gray_stop(void)
+{
+    static const uint8_t cmd[] = {
+        0xD5, NORMAL_CLOCK,
+        0xD9, NORMAL_PRECHARGE,
+    };
+    pmodoled_command(gray.disp, cmd, sizeof(cmd));
+    pmodoled_start_line(gray.disp, 0);
+    gray.disp = 0;
+    gray.planes = 0;
+}
+
+void gray_present(const uint8_t planes[GRAY_BITS][DISP_PAGES][DISP_W])
+{
+    gray.planes = planes;
+    /* Replace the plane that waits in the hidden half, so that every step
+     * from the next one on shows the new frame.
+     */
+    upload((gray.plane + 1) % GRAY_BITS);
+    gray.complete = gray_stats.planes + GRAY_BITS + 1;
+}
+
+void gray_poll(void)
+{
+    if (gray.planes) {
+        uint64_t now = get_timer_value();
+        if (now >= gray.due) {
+            step(now);
+        }
+    }
+}
+
+void gray_sync(void)
+{
+    while (gray.planes && gray_stats.planes < gray.complete) {
+        uint64_t now = get_timer_value();
+        if (now < gray.due) {
+            event_sleep(gray.due - now);
+        } else {
+            step(now);
+        }
+    }
+}
@@ -0,0 +1,61 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#ifndef H_GRAY
+#define H_GRAY
+/* Grayscale by temporal dithering.
+ *
+ * A frame of GRAY_BITS bits per pixel is kept as bitplanes in display page
+ * layout. Plane k is shown for GRAY_TICKS << k ticks out of every cycle, so
+ * that the eye averages the planes into 2^GRAY_BITS levels.
+ *
+ * The two halves of display memory (lines 0-31 and 32-63) take turns: while
+ * one is shown, the next plane is uploaded into the other, and moving the
+ * display start line shows it with a single command byte. Only the columns
+ * that differ from what the half held before are sent, so with two planes,
+ * which each stay in a half of their own, a plane step costs one byte as
+ * long as the frame does not change.
+ *
+ * There is no timer interrupt driving this: gray_poll() takes a step when it
+ * is due, and must be called often, for example every row of a render.
+ */
+#include <stdint.h>
+#include "display.h"
+
+/** Bits per pixel, 2 to 4 */
+#ifndef GRAY_BITS
+#define GRAY_BITS 2
+#endif
+#define GRAY_LEVELS (1 << GRAY_BITS)
+
+/** Time the least significant plane is shown, in 32768 Hz ticks. About one
+ * panel refresh at the clock set by gray_start().
+ */
+#define GRAY_TICKS 210
+
+struct gray_stats {
+    uint32_t planes;     /**< plane steps taken */
+    uint32_t late;       /**< steps taken more than a step after they were due */
+    uint64_t start;      /**< mtime at gray_start() */
+};
+extern struct gray_stats gray_stats;
+
+/** Start showing grayscale frames on disp. Raises the panel clock for a
+ * faster refresh. Nothing is shown until the first gray_present().
+ */
+void gray_start(pmodoled_t *disp);
+/** Stop, restore the panel clock and show display memory from line 0 */
+void gray_stop(void);
+/** Show a new frame from the next plane step on. The planes are read at
+ * every step until the next gray_present() or gray_stop(), so they may only
+ * change between calls to gray_poll().
+ */
+void gray_present(const uint8_t planes[GRAY_BITS][DISP_PAGES][DISP_W]);
+/** Take a plane step if one is due */
+void gray_poll(void);
+/** Sleep and take plane steps until every plane of the last frame passed to
+ * gray_present() has been shown for its full time.
+ */
+void gray_sync(void);
+
+#endif
@@ -0,0 +1,1082 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+/**
+ * Emulated HiFive peripherals and SSD1306 for the Linux host build.
+ *
+ * Time is counted in simulated core cycles. Only register accesses and
+ * busy-waits advance it: computation between accesses is free, so the
+ * figures show how the code drives the bus, not how fast it renders.
+ *
+ * - SPI1: eight-entry transmit FIFO shifted out at the SCKDIV rate, D/C taken
+ *   from CSID (SS0 selected means command) at the end of every byte,
+ *   watermark interrupts. Unless FMT sets the transmit-only direction, every
+ *   byte shifted out puts one in the eight-entry receive FIFO, or is lost
+ *   when it is full. Changing CSID or a chip select while a byte is being
+ *   shifted out counts as a timing violation.
+ * - GPIO: bit-banged SPI is decoded from SCLK rising edges, with a check
+ *   against the minimum SSD1306 clock period.
+ * - UART0: transmit to stdout at the baud rate set in DIV, receive from stdin
+ *   with the receive watermark interrupt. Input fed by a test arrives at the
+ *   baud rate instead, and is lost when the receive FIFO is full; output can
+ *   go to a test as well.
+ * - PLIC: handlers registered through irq.h are called when an enabled
+ *   source is pending, highest priority first.
+ * - Machine timer (mtimecmp) and wfi, which skips ahead to the next event.
+ *   When only UART input can wake the core, wfi blocks until stdin is
+ *   readable, so that the program can be driven interactively.
+ * - PRCI: the core clock follows the PLL settings, the PLL locks at once.
+ * - SSD1306: command interpreter and display memory, for two modules with
+ *   their own chip select and reset pins (see STATUS_PANEL in pmodoled.c).
+ *
+ * A frame is what the program queued for the display up to a flush. It is
+ * reported and dumped once its last byte has been shifted out, while the
+ * program carries on: nothing drains the bus at a flush.
+ *
+ * Environment variables:
+ *   PMODOLED_FRAMES  exit after this many frames
+ *   PMODOLED_PBM     prefix for PBM dumps of the visible display, one per frame.
+ *                    Modules other than the first that have been selected
+ *                    at least once get a file of their own, with the module
+ *                    number after the frame number.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <poll.h>
+#include "platform.h"
+
+#include "irq.h"
+#include "bits.h"
+
+/** Simulated core clock at reset, the crystal with the PLL bypassed */
+#ifndef HOST_CPU_FREQ
+#define HOST_CPU_FREQ 16000000
+#endif
+/** Crystal and internal oscillator frequencies */
+#define HFXOSC_FREQ 16000000
+#define HFROSC_FREQ 13800000
+/** Cost of a register access in cycles. A rough figure for an uncached
+ * load or store on the peripheral bus.
+ */
+#define MMIO_CYCLES 4
+/** Cost of one IDLE when nothing is due sooner */
+#define IDLE_CYCLES 4
+/** Interval between polls of stdin for UART input */
+#define POLL_CYCLES 16000
+/** Longest wfi before giving up, in seconds: nothing can wake the core */
+#define WFI_LIMIT 100
+
+/** Pins shared by the display modules, see display.c */
+#define OLED_SDIN  3
+#define OLED_SCLK  5
+#define OLED_DC    2
+/** Number of display modules */
+#define PANELS 2
+/** Shortest SCLK cycle the SSD1306 accepts, in ns */
+#define SSD1306_TCYCLE_NS 100
+
+#define FIFO_DEPTH 8
+/** Display memory size */
+#define GDDRAM_PAGES 8
+#define GDDRAM_COLS 128
+/** Visible lines of the panel */
+#define PANEL_LINES 32
+
+static uint64_t now;
+static unsigned long cpu_freq = HOST_CPU_FREQ;
+/** Test hooks, see platform.h */
+static int quiet;
+static void (*bus_trace)(unsigned panels, int dc, uint8_t b);
+static void (*uart_output)(uint8_t b);
+/** Real-time clock at the last core clock change */
+static uint64_t rtc_base, rtc_base_cycles;
+
+/********* Register slots **********/
+
+static uint32_t regs[HOST_DEVS][64];
+
+static struct {
+    int valid;
+    enum host_dev dev;
+    unsigned offset;
+    uint32_t value;
+    uint32_t orig;
+} slot;
+
+static void advance(uint64_t cycles);
+static uint32_t reg_read(enum host_dev dev, unsigned offset);
+static void reg_write(enum host_dev dev, unsigned offset, uint32_t value);
+
+/** Apply a write to the pending slot, if any */
+static void commit(void)
+{
+    if (slot.valid) {
+        slot.valid = 0;
+        if (slot.value != slot.orig) {
+            reg_write(slot.dev, slot.offset, slot.value);
+        }
+    }
+}
+
+/********* SSD1306 **********/
+
+struct ssd1306 {
+    /** Chip select and reset pin */
+    unsigned cs, res;
+    /** Has been selected since startup */
+    int used;
+    uint8_t gddram[GDDRAM_PAGES][GDDRAM_COLS];
+    uint8_t mode; /* 0 horizontal, 1 vertical, 2 page addressing */
+    uint8_t col_start, col_end, page_start, page_end;
+    uint8_t col, page;
+    uint8_t start_line;
+    uint8_t on, inverse, entire_on;
+    uint8_t cmd[8];
+    unsigned cmd_len;
+};
+
+/** Modules, wired as in pmodoled.c */
+static struct ssd1306 panels[PANELS] = {
+    {.cs = 23, .res = 0},
+    {.cs = 18, .res = 9},
+};
+
+static void oled_reset(struct ssd1306 *oled)
+{
+    oled->mode = 2;
+    oled->col_start = 0;
+    oled->col_end = GDDRAM_COLS - 1;
+    oled->page_start = 0;
+    oled->page_end = GDDRAM_PAGES - 1;
+    oled->col = oled->page = 0;
+    oled->start_line = 0;
+    oled->on = oled->inverse = oled->entire_on = 0;
+    oled->cmd_len = 0;
+}
+
+/** Total length of command starting with byte c */
+static unsigned oled_cmd_length(uint8_t c)
+{
+    switch (c) {
+    case 0x81: case 0x8D: case 0xA8: case 0xD3: case 0xD5:
+    case 0xD9: case 0xDA: case 0xDB: case 0x20:
+        return 2;
+    case 0x21: case 0x22: case 0xA3:
+        return 3;
+    case 0x29: case 0x2A:
+        return 6;
+    case 0x26: case 0x27:
+        return 7;
+    default:
+        return 1;
+    }
+}
+
+static void oled_command(struct ssd1306 *oled, const uint8_t *cmd)
+{
+    uint8_t c = cmd[0];
+    if (c < 0x10) {
+        oled->col = (oled->col & 0xf0) | c;
+    } else if (c < 0x20) {
+        oled->col = ((oled->col & 0x0f) | (c << 4)) % GDDRAM_COLS;
+    } else if (c >= 0x40 && c < 0x80) {
+        oled->start_line = c & 0x3f;
+    } else if (c >= 0xB0 && c < 0xB8) {
+        oled->page = c & 7;
+    } else {
+        switch (c) {
+        case 0x20:
+            oled->mode = cmd[1] & 3;
+            break;
+        case 0x21:
+            oled->col_start = oled->col = cmd[1] % GDDRAM_COLS;
+            oled->col_end = cmd[2] % GDDRAM_COLS;
+            break;
+        case 0x22:
+            oled->page_start = oled->page = cmd[1] % GDDRAM_PAGES;
+            oled->page_end = cmd[2] % GDDRAM_PAGES;
+            break;
+        case 0xA4: case 0xA5:
+            oled->entire_on = c & 1;
+            break;
+        case 0xA6: case 0xA7:
+            oled->inverse = c & 1;
+            break;
+        case 0xAE: case 0xAF:
+            oled->on = c & 1;
+            break;
+        default:
+            /* Panel configuration that does not change the image */
+            break;
+        }
+    }
+}
+
+static void oled_data(struct ssd1306 *oled, uint8_t b)
+{
+    oled->gddram[oled->page][oled->col] = b;
+    switch (oled->mode) {
+    case 0: /* horizontal */
+        if (oled->col == oled->col_end) {
+            oled->col = oled->col_start;
+            oled->page = oled->page == oled->page_end ? oled->page_start : (oled->page + 1) % GDDRAM_PAGES;
+        } else {
+            oled->col = (oled->col + 1) % GDDRAM_COLS;
+        }
+        break;
+    case 1: /* vertical */
+        if (oled->page == oled->page_end) {
+            oled->page = oled->page_start;
+            oled->col = oled->col == oled->col_end ? oled->col_start : (oled->col + 1) % GDDRAM_COLS;
+        } else {
+            oled->page = (oled->page + 1) % GDDRAM_PAGES;
+        }
+        break;
+    default: /* page */
+        oled->col = (oled->col + 1) % GDDRAM_COLS;
+        break;
+    }
+}
+
+/********* Statistics **********/
+
+struct stats {
+    unsigned long bytes;
+    unsigned long cmd_bytes;
+    /** Writes to a full transmit FIFO (lost) and reads that found it full */
+    unsigned long fifo_full;
+    /** Bit-banged clock cycles shorter than the SSD1306 allows, and chip
+     * select changes while a byte is being shifted out */
+    unsigned long timing;
+    /** Cycles the SPI shifter was busy */
+    uint64_t busy_cycles;
+    /** Cycles spent in IDLE */
+    uint64_t wait_cycles;
+    /** Cycles spent halted in wfi */
+    uint64_t sleep_cycles;
+};
+
+static struct stats frame_stats, total_stats;
+static uint64_t frame_start;
+static unsigned frames;
+static unsigned frame_limit;
+static const char *pbm_prefix;
+
+/** Bytes that have left the display bus since startup: sent, or lost to a
+ * full FIFO
+ */
+static unsigned long bus_done;
+/** Ends of frames that are still being sent, as values of bus_done */
+#define FRAME_MARKS 1024
+static unsigned long frame_marks[FRAME_MARKS];
+static unsigned marks_rd, marks_count;
+
+static void frame_end(void);
+
+/** A byte has left the display bus: end the frames that are complete */
+static void bus_byte_done(void)
+{
+    bus_done += 1;
+    while (marks_count && (long)(bus_done - frame_marks[marks_rd]) >= 0) {
+        marks_rd = (marks_rd + 1) % FRAME_MARKS;
+        marks_count -= 1;
+        frame_end();
+    }
+}
+
+static void count_byte(int dc)
+{
+    frame_stats.bytes += 1;
+    if (!dc) {
+        frame_stats.cmd_bytes += 1;
+    }
+}
+
+/** Byte arriving at the SSD1306 modules with D/C level dc */
+static void oled_byte(int dc, uint8_t b)
+{
+    uint32_t out = regs[HOST_GPIO][GPIO_OUTPUT_VAL/4];
+    unsigned selected = 0;
+    for (unsigned i=0; i<PANELS; ++i) {
+        struct ssd1306 *oled = &panels[i];
+        if (!(out & BIT(oled->cs)) && (out & BIT(oled->res))) {
+            selected |= BIT(i); /* selected and not held in reset */
+        }
+    }
+    if (bus_trace) {
+        bus_trace(selected, dc, b);
+    }
+    if (selected) {
+        count_byte(dc);
+    }
+    for (unsigned i=0; i<PANELS; ++i) {
+        struct ssd1306 *oled = &panels[i];
+        if (!(selected & BIT(i))) {
+            continue;
+        }
+        if (dc) {
+            oled_data(oled, b);
+            continue;
+        }
+        oled->cmd[oled->cmd_len++] = b;
+        if (oled->cmd_len == oled_cmd_length(oled->cmd[0])) {
+            oled_command(oled, oled->cmd);
+            oled->cmd_len = 0;
+        }
+    }
+}
+
+/********* SPI1 **********/
+
+static struct {
+    uint8_t fifo[FIFO_DEPTH];
+    unsigned rd, count;
+    /** Receive FIFO, filled with zeros: nothing drives MISO */
+    unsigned rx_count;
+    /** Byte in the shift register */
+    int busy;
+    uint8_t shift;
+    uint64_t shift_end;
+} spi;
+
+static uint64_t spi_byte_cycles(void)
+{
+    /* Fsck = Fin/(2*(div+1)), eight clocks per byte */
+    return 16 * ((uint64_t)(regs[HOST_SPI1][SPI_REG_SCKDIV/4] & 0xfff) + 1);
+}
+
+static uint32_t spi_ip(void)
+{
+    uint32_t ip = 0;
+    if (spi.count < (regs[HOST_SPI1][SPI_REG_TXCTRL/4] & 7)) {
+        ip |= SPI_IP_TXWM;
+    }
+    if (spi.rx_count > (regs[HOST_SPI1][SPI_REG_RXCTRL/4] & 7)) {
+        ip |= SPI_IP_RXWM;
+    }
+    return ip;
+}
+
+/** Move the next byte from the FIFO to the shift register */
+static void spi_start(void)
+{
+    if (!spi.busy && spi.count) {
+        spi.shift = spi.fifo[spi.rd];
+        spi.rd = (spi.rd + 1) % FIFO_DEPTH;
+        spi.count -= 1;
+        spi.busy = 1;
+        spi.shift_end = now + spi_byte_cycles();
+        frame_stats.busy_cycles += spi_byte_cycles();
+    }
+}
+
+static void spi_step(void)
+{
+    if (spi.busy && spi.shift_end <= now) {
+        spi.busy = 0;
+        if (regs[HOST_GPIO][GPIO_IOF_EN/4] & BIT(OLED_SCLK)) {
+            /* The SSD1306 samples D/C with the last bit. SS0 selected
+             * drives it low: command */
+            oled_byte(regs[HOST_SPI1][SPI_REG_CSID/4] != 0, spi.shift);
+        }
+        if (!(regs[HOST_SPI1][SPI_REG_FMT/4] & SPI_FMT_DIR(SPI_DIR_TX)) && spi.rx_count < FIFO_DEPTH) {
+            spi.rx_count += 1;
+        }
+        bus_byte_done();
+    }
+    spi_start();
+}
+
+static void spi_push(uint8_t b)
+{
+    if (spi.count == FIFO_DEPTH) {
+        frame_stats.fifo_full += 1;
+        bus_byte_done();
+        return;
+    }
+    spi.fifo[(spi.rd + spi.count) % FIFO_DEPTH] = b;
+    spi.count += 1;
+    spi_start();
+}
+
+/********* GPIO bitbang **********/
+
+static struct {
+    uint8_t bits;
+    unsigned nbits;
+    uint64_t last_rise;
+} bb;
+
+static void gpio_output(uint32_t old, uint32_t val)
+{
+    uint32_t gpio_pins = regs[HOST_GPIO][GPIO_OUTPUT_EN/4] & ~regs[HOST_GPIO][GPIO_IOF_EN/4];
+    for (unsigned i=0; i<PANELS; ++i) {
+        struct ssd1306 *oled = &panels[i];
+        if ((old & BIT(oled->res)) && !(val & BIT(oled->res))) {
+            oled_reset(oled);
+        }
+        if ((old ^ val) & BIT(oled->cs)) {
+            if (spi.busy) {
+                frame_stats.timing += 1;
+            }
+            if (!(val & BIT(oled->cs))) {
+                oled->used = 1;
+            }
+        }
+    }
+    if (!(gpio_pins & BIT(OLED_SCLK)) || (old & BIT(OLED_SCLK)) || !(val & BIT(OLED_SCLK))) {
+        return;
+    }
+    /* Rising edge of SCLK: SSD1306 samples SDIN */
+    if (bb.last_rise && (now - bb.last_rise) * 1000000000ULL < (uint64_t)SSD1306_TCYCLE_NS * cpu_freq) {
+        frame_stats.timing += 1;
+    }
+    bb.last_rise = now;
+    bb.bits = (bb.bits << 1) | ((val >> OLED_SDIN) & 1);
+    if (++bb.nbits == 8) {
+        bb.nbits = 0;
+        oled_byte((val >> OLED_DC) & 1, bb.bits);
+        bus_byte_done();
+    }
+}
+
+/********* UART0 **********/
+
+static struct {
+    uint8_t rx[FIFO_DEPTH];
+    unsigned rx_rd, rx_count;
+    unsigned tx_count;
+    uint64_t tx_end;
+    uint64_t next_poll;
+} uart;
+
+/** Input from host_uart_input(), received in place of stdin */
+static struct {
+    uint8_t *data;
+    size_t len, pos;
+    /** Time the next byte has been received */
+    uint64_t next;
+    unsigned long overruns;
+} feed;
+
+static uint64_t uart_byte_cycles(void)
+{
+    /* Start bit, eight data bits, stop bit */
+    return 10 * ((uint64_t)(regs[HOST_UART0][UART_REG_DIV/4] & 0xffff) + 1);
+}
+
+static uint32_t uart_ip(void)
+{
+    uint32_t ip = 0;
+    if (uart.tx_count < ((regs[HOST_UART0][UART_REG_TXCTRL/4] >> 16) & 7)) {
+        ip |= UART_IP_TXWM;
+    }
+    if (uart.rx_count > ((regs[HOST_UART0][UART_REG_RXCTRL/4] >> 16) & 7)) {
+        ip |= UART_IP_RXWM;
+    }
+    return ip;
+}
+
+static void uart_step(void)
+{
+    while (uart.tx_count && uart.tx_end <= now) {
+        uart.tx_count -= 1;
+        uart.tx_end += uart_byte_cycles();
+    }
+    while (feed.pos < feed.len && feed.next <= now) {
+        if (uart.rx_count < FIFO_DEPTH) {
+            uart.rx[(uart.rx_rd + uart.rx_count) % FIFO_DEPTH] = feed.data[feed.pos];
+            uart.rx_count += 1;
+        } else {
+            feed.overruns += 1;
+        }
+        feed.pos += 1;
+        feed.next += uart_byte_cycles();
+    }
+    if (now >= uart.next_poll) {
+        uart.next_poll = now + POLL_CYCLES;
+        while (!feed.data && uart.rx_count < FIFO_DEPTH) {
+            char c;
+            if (read(STDIN_FILENO, &c, 1) != 1) {
+                break;
+            }
+            uart.rx[(uart.rx_rd + uart.rx_count) % FIFO_DEPTH] = c;
+            uart.rx_count += 1;
+        }
+    }
+}
+
+static void uart_push(uint8_t b)
+{
+    if (uart.tx_count == FIFO_DEPTH) {
+        return;
+    }
+    if (uart.tx_count == 0) {
+        uart.tx_end = now + uart_byte_cycles();
+    }
+    uart.tx_count += 1;
+    if (uart_output) {
+        uart_output(b);
+    } else if (!quiet) {
+        putchar(b);
+    }
+}
+
+static uint32_t uart_pop(void)
+{
+    if (!uart.rx_count) {
+        return 0x80000000;
+    }
+    uint8_t b = uart.rx[uart.rx_rd];
+    uart.rx_rd = (uart.rx_rd + 1) % FIFO_DEPTH;
+    uart.rx_count -= 1;
+    return b;
+}
+
+/********* PRCI **********/
+
+static uint64_t rtc_ticks(void)
+{
+    return rtc_base + (now - rtc_base_cycles) * RTC_FREQ / cpu_freq;
+}
+
+/** Derive core clock from clock configuration registers */
+static void prci_update(void)
+{
+    uint32_t cfg = regs[HOST_PRCI][PRCI_PLLCFG/4];
+    uint32_t div = regs[HOST_PRCI][PRCI_PLLDIV/4];
+    unsigned long freq;
+    if (!(cfg & PLL_SEL(1))) {
+        freq = HFROSC_FREQ;
+    } else {
+        uint64_t ref = (cfg & PLL_REFSEL(1)) ? HFXOSC_FREQ : HFROSC_FREQ;
+        if (cfg & PLL_BYPASS(1)) {
+            freq = ref;
+        } else {
+            uint64_t r = (cfg & 7) + 1;
+            uint64_t f = 2 * (((cfg >> 4) & 0x3f) + 1);
+            unsigned q = (cfg >> 10) & 3;
+            if (q == 0) {
+                fprintf(stderr, "emu: invalid PLL output divider\n");
+                exit(1);
+            }
+            freq = ref / r * f >> q;
+        }
+        if (!(div & PLL_FINAL_DIV_BY_1(1))) {
+            freq /= 2 * ((div & 0x3f) + 1);
+        }
+    }
+    if (freq != cpu_freq) {
+        rtc_base = rtc_ticks();
+        rtc_base_cycles = now;
+        cpu_freq = freq;
+        if (!quiet) {
+            fprintf(stderr, "emu: core clock %lu Hz\n", cpu_freq);
+        }
+    }
+}
+
+/********* Register access **********/
+
+static uint32_t reg_read(enum host_dev dev, unsigned offset)
+{
+    /* Transmit FIFO reads return junk in the data bits, so that any byte
+     * written back differs and is seen as a write.
+     */
+    switch (dev) {
+    case HOST_SPI1:
+        switch (offset) {
+        case SPI_REG_TXFIFO:
+            if (spi.count == FIFO_DEPTH) {
+                frame_stats.fifo_full += 1;
+                return SPI_TXFIFO_FULL | 0x7fffff00;
+            }
+            return 0x7fffff00;
+        case SPI_REG_RXFIFO:
+            if (!spi.rx_count) {
+                return SPI_RXFIFO_EMPTY;
+            }
+            spi.rx_count -= 1;
+            return 0;
+        case SPI_REG_IP:
+            return spi_ip();
+        }
+        break;
+    case HOST_UART0:
+        switch (offset) {
+        case UART_REG_TXFIFO:
+            return (uart.tx_count == FIFO_DEPTH ? 0x80000000 : 0) | 0x7fffff00;
+        case UART_REG_RXFIFO:
+            return uart_pop();
+        case UART_REG_IP:
+            return uart_ip();
+        }
+        break;
+    case HOST_PRCI:
+        switch (offset) {
+        case PRCI_HFROSCCFG:
+            return regs[dev][offset/4] | ROSC_RDY(1);
+        case PRCI_HFXOSCCFG:
+            return regs[dev][offset/4] | XOSC_RDY(1);
+        case PRCI_PLLCFG:
+            return regs[dev][offset/4] | PLL_LOCK(1);
+        }
+        break;
+    default:
+        break;
+    }
+    return regs[dev][offset/4];
+}
+
+static void reg_write(enum host_dev dev, unsigned offset, uint32_t value)
+{
+    uint32_t old = regs[dev][offset/4];
+    switch (dev) {
+    case HOST_SPI1:
+        if (offset == SPI_REG_TXFIFO) {
+            spi_push(value);
+            return;
+        }
+        if (offset == SPI_REG_CSID && value != old && spi.busy) {
+            /* D/C changes under the byte being shifted out */
+            frame_stats.timing += 1;
+        }
+        break;
+    case HOST_UART0:
+        if (offset == UART_REG_TXFIFO) {
+            uart_push(value);
+            return;
+        }
+        break;
+    default:
+        break;
+    }
+    if (dev == HOST_PRCI) {
+        /* Status bits are read-only */
+        value &= ~(ROSC_RDY(1) | XOSC_RDY(1) | PLL_LOCK(1));
+    }
+    regs[dev][offset/4] = value;
+    if (dev == HOST_GPIO && offset == GPIO_OUTPUT_VAL) {
+        gpio_output(old, value);
+    }
+    if (dev == HOST_PRCI) {
+        prci_update();
+    }
+}
+
+/********* Interrupts **********/
+
+static struct {
+    irq_handler_t handler;
+    unsigned priority;
+} irqs[PLIC_NUM_INTERRUPTS];
+/** Global interrupt enable (mstatus.MIE) */
+static int irq_enabled;
+static int in_irq;
+/** Machine timer: armed (mie.MTIE), compare value and handler */
+static int timer_armed;
+static uint64_t timer_when;
+static irq_handler_t timer_handler;
+
+void irq_init(void)
+{
+    irq_enabled = 1;
+}
+
+void irq_timer(uint64_t when, irq_handler_t handler)
+{
+    commit();
+    timer_when = when;
+    timer_handler = handler;
+    timer_armed = 1;
+}
+
+void irq_register(unsigned source, irq_handler_t handler, unsigned priority)
+{
+    irqs[source].handler = handler;
+    irqs[source].priority = priority;
+}
+
+static int irq_pending(unsigned source)
+{
+    switch (source) {
+    case INT_SPI1_BASE:
+        return (regs[HOST_SPI1][SPI_REG_IE/4] & spi_ip()) != 0;
+    case INT_UART0_BASE:
+        return (regs[HOST_UART0][UART_REG_IE/4] & uart_ip()) != 0;
+    default:
+        return 0;
+    }
+}
+
+static uint64_t rtc_ticks(void);
+
+static int timer_pending(void)
+{
+    return timer_armed && rtc_ticks() >= timer_when;
+}
+
+/** Highest priority pending PLIC source, or 0 */
+static unsigned plic_pending(void)
+{
+    unsigned best = 0;
+    for (unsigned source=1; source<PLIC_NUM_INTERRUPTS; ++source) {
+        if (irqs[source].handler && irq_pending(source) &&
+                (!best || irqs[source].priority > irqs[best].priority)) {
+            best = source;
+        }
+    }
+    return best;
+}
+
+/** Run the handler of the pending interrupt, external before timer.
+ * Returns 0 if there was none.
+ */
+static int dispatch(void)
+{
+    if (!irq_enabled || in_irq) {
+        return 0;
+    }
+    unsigned source = plic_pending();
+    if (source) {
+        in_irq = 1;
+        irqs[source].handler();
+    } else if (timer_pending()) {
+        in_irq = 1;
+        timer_armed = 0; /* one-shot, see irq.c */
+        timer_handler();
+    } else {
+        return 0;
+    }
+    commit();
+    in_irq = 0;
+    return 1;
+}
+
+/********* Time **********/
+
+/** Cycle at which the real-time clock reaches ticks */
+static uint64_t rtc_cycle(uint64_t ticks)
+{
+    if (ticks <= rtc_base) {
+        return rtc_base_cycles;
+    }
+    return rtc_base_cycles + ((ticks - rtc_base) * cpu_freq + RTC_FREQ - 1) / RTC_FREQ;
+}
+
+/** Time of the next device event */
+static uint64_t next_event(void)
+{
+    uint64_t t = uart.next_poll;
+    if (timer_armed && rtc_cycle(timer_when) < t) {
+        t = rtc_cycle(timer_when);
+    }
+    if (spi.busy && spi.shift_end < t) {
+        t = spi.shift_end;
+    }
+    if (uart.tx_count && uart.tx_end < t) {
+        t = uart.tx_end;
+    }
+    if (feed.pos < feed.len && feed.next < t) {
+        t = feed.next;
+    }
+    return t;
+}
+
+/** Run devices for the given number of cycles, taking interrupts as they
+ * become pending.
+ */
+static void advance(uint64_t cycles)
+{
+    uint64_t target = now + cycles;
+    do {
+        uint64_t t = next_event();
+        now = t < target ? t : target;
+        spi_step();
+        uart_step();
+        while (dispatch())
+            ;
+    } while (now < target);
+}
+
+void irq_disable(void)
+{
+    commit();
+    irq_enabled = 0;
+}
+
+void irq_enable(void)
+{
+    commit();
+    irq_enabled = 1;
+    while (dispatch())
+        ;
+}
+
+void irq_wait(void)
+{
+    commit();
+    uint64_t start = now;
+    /* Run devices with interrupts held off until one is pending */
+    int enabled = irq_enabled;
+    irq_enabled = 0;
+    while (!plic_pending() && !timer_pending()) {
+        if (now - start > (uint64_t)WFI_LIMIT * cpu_freq) {
+            fprintf(stderr, "emu: wfi with nothing to wake up\n");
+            exit(1);
+        }
+        if (!timer_armed && !spi.busy && !uart.tx_count && !feed.data &&
+                (regs[HOST_UART0][UART_REG_IE/4] & UART_IP_RXWM)) {
+            /* Nothing due in simulated time: wait for input in real time */
+            struct pollfd pfd = {.fd = STDIN_FILENO, .events = POLLIN};
+            fflush(stdout);
+            poll(&pfd, 1, -1);
+        }
+        uint64_t t = next_event();
+        advance(t > now ? t - now : 1);
+    }
+    frame_stats.sleep_cycles += now - start;
+    irq_enabled = enabled;
+    while (dispatch())
+        ;
+}
+
+uint64_t get_timer_value(void)
+{
+    commit();
+    advance(MMIO_CYCLES);
+    return rtc_ticks();
+}
+
+unsigned long get_cpu_freq(void)
+{
+    return cpu_freq;
+}
+
+uint32_t host_rdcycle(void)
+{
+    return now;
+}
+
+void host_idle(void)
+{
+    commit();
+    uint64_t t = next_event();
+    uint64_t cycles = t > now && t - now < IDLE_CYCLES ? t - now : IDLE_CYCLES;
+    frame_stats.wait_cycles += cycles;
+    advance(cycles);
+}
+
+/********* Setup **********/
+
+static int stdin_flags;
+
+static void host_exit(void)
+{
+    fcntl(STDIN_FILENO, F_SETFL, stdin_flags);
+    if (quiet) {
+        return;
+    }
+    fprintf(stderr, "total: %u frames, %lu bytes (%lu command), %lu fifo full, %lu timing violations, "
+            "%llu cycles busy, %llu cycles waiting, %llu cycles asleep, %llu cycles (%.3f s)\n",
+            frames, total_stats.bytes, total_stats.cmd_bytes, total_stats.fifo_full, total_stats.timing,
+            (unsigned long long)total_stats.busy_cycles, (unsigned long long)total_stats.wait_cycles,
+            (unsigned long long)total_stats.sleep_cycles, (unsigned long long)now, (double)now / cpu_freq);
+}
+
+static void host_signal(int sig)
+{
+    exit(128 + sig);
+}
+
+static void host_setup(void)
+{
+    static int done;
+    if (done) {
+        return;
+    }
+    done = 1;
+    const char *env = getenv("PMODOLED_FRAMES");
+    if (env) {
+        frame_limit = strtoul(env, NULL, 0);
+    }
+    pbm_prefix = getenv("PMODOLED_PBM");
+    stdin_flags = fcntl(STDIN_FILENO, F_GETFL);
+    fcntl(STDIN_FILENO, F_SETFL, stdin_flags | O_NONBLOCK);
+    atexit(host_exit);
+    signal(SIGINT, host_signal);
+    signal(SIGTERM, host_signal);
+    /* Reset values */
+    for (unsigned i=0; i<PANELS; ++i) {
+        regs[HOST_GPIO][GPIO_OUTPUT_VAL/4] |= BIT(panels[i].cs);
+        oled_reset(&panels[i]);
+    }
+    regs[HOST_SPI1][SPI_REG_SCKDIV/4] = 3;
+    regs[HOST_SPI1][SPI_REG_CSDEF/4] = 0xffff;
+    regs[HOST_UART0][UART_REG_DIV/4] = HOST_CPU_FREQ / 115200 - 1; /* set by the BSP */
+    regs[HOST_PRCI][PRCI_HFROSCCFG/4] = ROSC_EN(1);
+    regs[HOST_PRCI][PRCI_HFXOSCCFG/4] = XOSC_EN(1);
+    regs[HOST_PRCI][PRCI_PLLCFG/4] = PLL_SEL(1) | PLL_REFSEL(1) | PLL_BYPASS(1);
+    regs[HOST_PRCI][PRCI_PLLDIV/4] = PLL_FINAL_DIV_BY_1(1);
+}
+
+volatile uint32_t *host_reg(enum host_dev dev, unsigned offset)
+{
+    host_setup();
+    commit();
+    advance(MMIO_CYCLES);
+    slot.valid = 1;
+    slot.dev = dev;
+    slot.offset = offset;
+    slot.value = slot.orig = reg_read(dev, offset);
+    return &slot.value;
+}
+
+/********* Frames **********/
+
+static void write_pbm(unsigned n, unsigned panel)
+{
+    const struct ssd1306 *oled = &panels[panel];
+    char path[256];
+    if (panel == 0) {
+        snprintf(path, sizeof(path), "%s%05u.pbm", pbm_prefix, n);
+    } else {
+        snprintf(path, sizeof(path), "%s%05u.%u.pbm", pbm_prefix, n, panel);
+    }
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        perror(path);
+        exit(1);
+    }
+    fprintf(f, "P4\n%d %d\n", GDDRAM_COLS, PANEL_LINES);
+    for (unsigned y=0; y<PANEL_LINES; ++y) {
+        unsigned line = (oled->start_line + y) % (GDDRAM_PAGES * 8);
+        uint8_t row[GDDRAM_COLS/8] = {0};
+        for (unsigned x=0; x<GDDRAM_COLS; ++x) {
+            int on = (oled->gddram[line / 8][x] >> (line % 8)) & 1;
+            on = oled->entire_on || (on ^ oled->inverse);
+            if (on && oled->on) {
+                row[x / 8] |= 0x80 >> (x % 8);
+            }
+        }
+        fwrite(row, 1, sizeof(row), f);
+    }
+    fclose(f);
+}
+
+void host_frame(unsigned long bytes)
+{
+    commit();
+    if ((long)(bus_done - bytes) >= 0) {
+        frame_end();
+        return;
+    }
+    if (marks_count == FRAME_MARKS) {
+        /* Too many frames in flight: let the oldest one finish */
+        unsigned long oldest = frame_marks[marks_rd];
+        while ((long)(bus_done - oldest) < 0) {
+            advance(IDLE_CYCLES);
+        }
+    }
+    frame_marks[(marks_rd + marks_count) % FRAME_MARKS] = bytes;
+    marks_count += 1;
+}
+
+/** Report the frame that has just been sent, and dump it */
+static void frame_end(void)
+{
+    if (!quiet) {
+        fprintf(stderr, "frame %u: %lu bytes (%lu command), %lu fifo full, %lu timing violations, "
+                "%llu cycles busy, %llu cycles waiting, %llu cycles asleep, %llu cycles (%.1f us)\n",
+                frames, frame_stats.bytes, frame_stats.cmd_bytes, frame_stats.fifo_full, frame_stats.timing,
+                (unsigned long long)frame_stats.busy_cycles, (unsigned long long)frame_stats.wait_cycles,
+                (unsigned long long)frame_stats.sleep_cycles,
+                (unsigned long long)(now - frame_start), (now - frame_start) * 1e6 / cpu_freq);
+    }
+    if (pbm_prefix) {
+        for (unsigned i=0; i<PANELS; ++i) {
+            if (i == 0 || panels[i].used) {
+                write_pbm(frames, i);
+            }
+        }
+    }
+    total_stats.bytes += frame_stats.bytes;
+    total_stats.cmd_bytes += frame_stats.cmd_bytes;
+    total_stats.fifo_full += frame_stats.fifo_full;
+    total_stats.timing += frame_stats.timing;
+    total_stats.busy_cycles += frame_stats.busy_cycles;
+    total_stats.wait_cycles += frame_stats.wait_cycles;
+    total_stats.sleep_cycles += frame_stats.sleep_cycles;
+    memset(&frame_stats, 0, sizeof(frame_stats));
+    frame_start = now;
+    frames += 1;
+    if (frame_limit && frames >= frame_limit) {
+        fflush(stdout);
+        exit(0);
+    }
+}
+
+/********* Test hooks **********/
+
+void host_quiet(void)
+{
+    quiet = 1;
+}
+
+void host_bus_trace(void (*fn)(unsigned panels, int dc, uint8_t b))
+{
+    commit();
+    bus_trace = fn;
+}
+
+const uint8_t *host_gddram(unsigned panel)
+{
+    commit();
+    return &panels[panel].gddram[0][0];
+}
+
+unsigned host_start_line(unsigned panel)
+{
+    commit();
+    return panels[panel].start_line;
+}
+
+void host_uart_input(const void *data, size_t n)
+{
+    commit();
+    if (feed.pos == feed.len) {
+        /* The line was idle: the first byte starts now */
+        feed.pos = feed.len = 0;
+        feed.next = now + uart_byte_cycles();
+    }
+    feed.data = realloc(feed.data, feed.len + n + 1);
+    if (!feed.data) {
+        perror("emu");
+        exit(1);
+    }
+    memcpy(feed.data + feed.len, data, n);
+    feed.len += n;
+}
+
+unsigned long host_uart_overruns(void)
+{
+    commit();
+    return feed.overruns;
+}
+
+void host_uart_output(void (*fn)(uint8_t b))
+{
+    commit();
+    uart_output = fn;
+}
+
+unsigned long host_timing(void)
+{
+    commit();
+    return total_stats.timing + frame_stats.timing;
+}
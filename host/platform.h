@@ -0,0 +1,177 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#ifndef H_HOST_PLATFORM
+#define H_HOST_PLATFORM
+/* Stand-in for the BSP platform header in the Linux host build.
+ *
+ * Register names and values are those of the freedom-e-sdk headers, but every
+ * register access goes through the emulator in emu.c. An access returns a
+ * pointer to a shadow slot that holds the current register value; a write to
+ * the slot takes effect when the next access (or wait) begins. This keeps
+ * plain assignments and read-modify-write operators working unchanged.
+ */
+#include <stdint.h>
+#include <stddef.h>
+
+/** Emulated devices */
+enum host_dev {
+    HOST_GPIO,
+    HOST_SPI1,
+    HOST_UART0,
+    HOST_PWM1,
+    HOST_PRCI,
+    HOST_DEVS
+};
+
+/** Shadow slot for register at offset of device */
+volatile uint32_t *host_reg(enum host_dev dev, unsigned offset);
+/** Busy-wait step, used for IDLE */
+void host_idle(void);
+/** Called after every display flush: the frame ends once bytes bytes have
+ * been sent on the display bus since startup. The emulator keeps running the
+ * transfer in simulated time and reports and dumps the frame when it is
+ * complete, so drawing the next frame overlaps with it as on the device.
+ */
+void host_frame(unsigned long bytes);
+
+/* Test hooks, for the host tests in test/ */
+/** Do not report frames and totals, and drop UART output */
+void host_quiet(void);
+/** Call fn for every byte shifted out to the display modules, with a mask of
+ * the modules selected (bit n for panels[n] of pmodoled.c) and the D/C level.
+ * NULL stops tracing.
+ */
+void host_bus_trace(void (*fn)(unsigned panels, int dc, uint8_t b));
+/** Display memory of a module: GDDRAM_PAGES pages of 128 columns */
+const uint8_t *host_gddram(unsigned panel);
+/** Display start line of a module */
+unsigned host_start_line(unsigned panel);
+/** Receive the n bytes at data on UART0, one per character time from now
+ * on or from the end of earlier input, instead of reading stdin
+ */
+void host_uart_input(const void *data, size_t n);
+/** Bytes of that input lost because the receive FIFO was full */
+unsigned long host_uart_overruns(void);
+/** Call fn for every byte written to the UART0 transmit FIFO, instead of
+ * writing it to stdout. NULL stops capturing.
+ */
+void host_uart_output(void (*fn)(uint8_t b));
+/** Timing violations on the display bus since startup */
+unsigned long host_timing(void);
+
+#define GPIO_REG(offset)  (*host_reg(HOST_GPIO, (offset)))
+#define SPI1_REG(offset)  (*host_reg(HOST_SPI1, (offset)))
+#define UART0_REG(offset) (*host_reg(HOST_UART0, (offset)))
+#define PWM1_REG(offset)  (*host_reg(HOST_PWM1, (offset)))
+#define PRCI_REG(offset)  (*host_reg(HOST_PRCI, (offset)))
+
+/* GPIO */
+#define GPIO_INPUT_VAL   0x00
+#define GPIO_INPUT_EN    0x04
+#define GPIO_OUTPUT_EN   0x08
+#define GPIO_OUTPUT_VAL  0x0C
+#define GPIO_IOF_EN      0x38
+#define GPIO_IOF_SEL     0x3C
+#define GPIO_OUTPUT_XOR  0x40
+
+#define IOF0_UART0_MASK  0x00030000
+#define GREEN_LED_OFFSET 19
+#define BLUE_LED_OFFSET  21
+#define RED_LED_OFFSET   22
+
+/* SPI */
+#define SPI_REG_SCKDIV   0x00
+#define SPI_REG_SCKMODE  0x04
+#define SPI_REG_CSID     0x10
+#define SPI_REG_CSDEF    0x14
+#define SPI_REG_CSMODE   0x18
+#define SPI_REG_DCSSCK   0x28
+#define SPI_REG_DSCKCS   0x2a
+#define SPI_REG_DINTERCS 0x2c
+#define SPI_REG_DINTERXFR 0x2e
+#define SPI_REG_FMT      0x40
+#define SPI_REG_TXFIFO   0x48
+#define SPI_REG_RXFIFO   0x4c
+#define SPI_REG_TXCTRL   0x50
+#define SPI_REG_RXCTRL   0x54
+#define SPI_REG_IE       0x70
+#define SPI_REG_IP       0x74
+
+#define SPI_CSMODE_AUTO  0
+#define SPI_CSMODE_HOLD  2
+#define SPI_CSMODE_OFF   3
+#define SPI_DIR_RX       0
+#define SPI_DIR_TX       1
+#define SPI_PROTO_S      0
+#define SPI_ENDIAN_MSB   0
+#define SPI_FMT_PROTO(x)  ((x) & 0x3)
+#define SPI_FMT_ENDIAN(x) (((x) & 0x1) << 2)
+#define SPI_FMT_DIR(x)    (((x) & 0x1) << 3)
+#define SPI_FMT_LEN(x)    (((x) & 0xf) << 16)
+#define SPI_TXFIFO_FULL  (1U << 31)
+#define SPI_RXFIFO_EMPTY (1U << 31)
+#define SPI_IP_TXWM      0x1
+#define SPI_IP_RXWM      0x2
+
+/* UART */
+#define UART_REG_TXFIFO  0x00
+#define UART_REG_RXFIFO  0x04
+#define UART_REG_TXCTRL  0x08
+#define UART_REG_RXCTRL  0x0c
+#define UART_REG_IE      0x10
+#define UART_REG_IP      0x14
+#define UART_REG_DIV     0x18
+
+#define UART_TXEN        0x1
+#define UART_RXEN        0x1
+#define UART_TXWM(x)     (((x) & 0x7) << 16)
+#define UART_RXWM(x)     (((x) & 0x7) << 16)
+#define UART_IP_TXWM     0x1
+#define UART_IP_RXWM     0x2
+
+/* PWM */
+#define PWM_CFG          0x00
+#define PWM_COUNT        0x08
+#define PWM_CMP0         0x20
+#define PWM_CMP1         0x24
+#define PWM_CMP2         0x28
+#define PWM_CMP3         0x2C
+#define PWM_CFG_ENALWAYS   0x00001000
+#define PWM_CFG_CMP2CENTER 0x00040000
+
+/* PRCI */
+#define PRCI_HFROSCCFG   0x00
+#define PRCI_HFXOSCCFG   0x04
+#define PRCI_PLLCFG      0x08
+#define PRCI_PLLDIV      0x0C
+
+#define ROSC_DIV(x)      (((x) & 0x2F) << 0)
+#define ROSC_TRIM(x)     (((x) & 0x1F) << 16)
+#define ROSC_EN(x)       (((x) & 0x1) << 30)
+#define ROSC_RDY(x)      (((x) & 0x1) << 31)
+#define XOSC_EN(x)       (((x) & 0x1) << 30)
+#define XOSC_RDY(x)      (((x) & 0x1) << 31)
+#define PLL_R(x)         (((x) & 0x7) << 0)
+#define PLL_F(x)         (((x) & 0x3F) << 4)
+#define PLL_Q(x)         (((x) & 0x3) << 10)
+#define PLL_SEL(x)       (((x) & 0x1) << 16)
+#define PLL_REFSEL(x)    (((x) & 0x1) << 17)
+#define PLL_BYPASS(x)    (((x) & 0x1) << 18)
+#define PLL_LOCK(x)      (((x) & 0x1) << 31)
+#define PLL_FINAL_DIV(x)      (((x) & 0x3F) << 0)
+#define PLL_FINAL_DIV_BY_1(x) (((x) & 0x1) << 8)
+
+/* PLIC interrupt sources */
+#define INT_UART0_BASE   3
+#define INT_SPI1_BASE    6
+#define PLIC_NUM_INTERRUPTS 52
+
+#define RTC_FREQ         32768
+
+/** Real-time clock (mtime), in RTC_FREQ ticks */
+uint64_t get_timer_value(void);
+/** Core clock frequency in Hz */
+unsigned long get_cpu_freq(void);
+
+#endif
@@ -0,0 +1,77 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#include "irq.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "platform.h"
+#include "encoding.h"
+#include "plic/plic_driver.h"
+
+static plic_instance_t plic;
+static irq_handler_t handlers[PLIC_NUM_INTERRUPTS];
+static irq_handler_t timer_handler;
+
+/** Called from the BSP trap handler (USE_PLIC) on a machine external interrupt */
+void handle_m_ext_interrupt(void)
+{
+    plic_source source = PLIC_claim_interrupt(&plic);
+    if (source >= 1 && source < PLIC_NUM_INTERRUPTS && handlers[source]) {
+        handlers[source]();
+    } else {
+        exit(1 + (uintptr_t)source);
+    }
+    PLIC_complete_interrupt(&plic, source);
+}
+
+/** Called from the BSP trap handler (USE_M_TIME) on a machine timer interrupt */
+void handle_m_time_interrupt(void)
+{
+    /* One-shot: mtime stays above mtimecmp */
+    clear_csr(mie, MIP_MTIP);
+    if (timer_handler) {
+        timer_handler();
+    }
+}
+
+void irq_init(void)
+{
+    clear_csr(mie, MIP_MEIP);
+    PLIC_init(&plic, PLIC_CTRL_ADDR, PLIC_NUM_INTERRUPTS, PLIC_NUM_PRIORITIES);
+    set_csr(mie, MIP_MEIP);
+    set_csr(mstatus, MSTATUS_MIE);
+}
+
+void irq_register(unsigned source, irq_handler_t handler, unsigned priority)
+{
+    handlers[source] = handler;
+    PLIC_set_priority(&plic, source, priority);
+    PLIC_enable_interrupt(&plic, source);
+}
+
+void irq_timer(uint64_t when, irq_handler_t handler)
+{
+    clear_csr(mie, MIP_MTIP);
+    timer_handler = handler;
+    // No match while the two halves are written
+    CLINT_REG(CLINT_MTIMECMP + 4) = 0xffffffff;
+    CLINT_REG(CLINT_MTIMECMP) = (uint32_t)when;
+    CLINT_REG(CLINT_MTIMECMP + 4) = (uint32_t)(when >> 32);
+    set_csr(mie, MIP_MTIP);
+}
+
+void irq_disable(void)
+{
+    clear_csr(mstatus, MSTATUS_MIE);
+}
+
+void irq_enable(void)
+{
+    set_csr(mstatus, MSTATUS_MIE);
+}
+
+void irq_wait(void)
+{
+    asm volatile ("wfi");
+}
@@ -0,0 +1,31 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#ifndef H_IRQ
+#define H_IRQ
+
+#include <stdint.h>
+
+/** Handler for an external (PLIC) interrupt source */
+typedef void (*irq_handler_t)(void);
+
+/** Initialize PLIC and enable machine external interrupts */
+void irq_init(void);
+/** Install handler for PLIC interrupt source and enable it */
+void irq_register(unsigned source, irq_handler_t handler, unsigned priority);
+/** Call handler once from the machine timer interrupt when mtime reaches
+ * when. Replaces any earlier request.
+ */
+void irq_timer(uint64_t when, irq_handler_t handler);
+
+/** Disable interrupts globally */
+void irq_disable(void);
+/** Enable interrupts globally. Pending interrupts are taken at once. */
+void irq_enable(void);
+/** Wait for an interrupt (wfi). An interrupt that becomes pending wakes the
+ * core even while interrupts are disabled, so the wake condition can be
+ * checked with interrupts disabled right before waiting without a race.
+ */
+void irq_wait(void);
+
+#endif
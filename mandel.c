@@ -0,0 +1,939 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#include "mandel.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "platform.h"
+
+#include "uart.h"
+#include "bits.h"
+#include "cycles.h"
+#include "display.h"
+#include "mp.h"
+#include "perf.h"
+#include "gray.h"
+
+/**
+ * Define the following to log per-frame timing (in cycles) to the UART.
+ */
+#define MANDEL_TIMING
+
+/**
+ * Define the following to use the Mariani-Silver renderer, which skips the
+ * interior of rectangles that have a uniform iteration count on their border.
+ * This is exact for the true set but not guaranteed for fixed-point
+ * iteration; test/test_mandel_ms.c compares it with the brute-force renderer.
+ */
+//#define MANDEL_MARIANI_SILVER
+
+/**
+ * Define the following to compute frames that are too deep for 64-bit
+ * fixed-point by perturbation against a multi-word precision reference orbit.
+ * Otherwise every pixel of such frames is iterated in multi-word precision.
+ */
+#define MANDEL_PERTURBATION
+
+/**
+ * Define the following to derive frames from the previous frame of the zoom
+ * where possible. Pixels are only iterated where the reprojected iteration
+ * counts are not uniform; every EXACT_INTERVAL frames all pixels are
+ * computed again, so that approximation errors cannot build up. This is not
+ * exact: detail smaller than a pixel can be missed in between.
+ * test/test_mandel_incremental.c compares it with computing every pixel.
+ */
+#define MANDEL_INCREMENTAL
+
+/**
+ * Define the following to print the cycles per frame of every kernel variant
+ * when entering mandelbrot mode.
+ */
+//#define MANDEL_BENCHMARK
+
+/**
+ * Define the following to show iteration counts as GRAY_BITS bit gray levels
+ * by temporal dithering (see gray.h), instead of black and white bands.
+ */
+//#define MANDEL_GRAYSCALE
+
+#ifdef MANDEL_GRAYSCALE
+/** Keep the dithering going during long computations */
+#define MANDEL_POLL() gray_poll()
+#else
+#define MANDEL_POLL() do {} while (0)
+#endif
+
+/* Mandelbrot */
+#define PREC 48  /* number of precision bits */
+#ifndef ITMAX
+#define ITMAX 16 /* number of iterations */
+#endif
+#define I(x) (((int64_t)(x))<<PREC) /* integral value */
+#define FRAC(x,y) (I(x)/(y)) /* fraction */
+/* stupid multiplication of two fp_t */
+#define MUL(x,y)  (((x)>>(PREC/2)) * ((y)>>(PREC/2)))
+#define ZOOM_MUL (256L)
+/* margin for analytic interior tests */
+#define INTERIOR_MARGIN (I(1)>>16)
+typedef int64_t fp_t;
+
+/* Zoom depth is kept as a shift: the radius is radius * 2^-shift, with the
+ * scaled radius between 1 and 2 (in y).
+ */
+/** Restart after zooming in to this shift */
+#define SHIFT_LIMIT 60
+/** Deeper zooms need more iterations to show detail: beyond ITMAX_SHIFT
+ * (radius < 2^-4), IT_PER_SHIFT iterations are added per step of shift.
+ */
+#define ITMAX_SHIFT 5
+#define IT_PER_SHIFT 2
+/** Maximum number of iterations for any frame */
+#define MAX_ITMAX (ITMAX + IT_PER_SHIFT*(SHIFT_LIMIT - ITMAX_SHIFT))
+
+/* Kernel variants. Every frame uses the cheapest number representation that
+ * keeps enough bits below the pixel step (about 2^-(shift+4)):
+ *   shift < Q27_SHIFT_LIMIT: 32-bit Q4.27
+ *   shift < Q57_SHIFT_LIMIT: 64-bit Q6.57
+ *   deeper: multi-word, or perturbation
+ */
+#define Q27_SHIFT_LIMIT 8
+#define Q57_SHIFT_LIMIT 32
+
+#ifdef MANDEL_PERTURBATION
+/** Scaled deltas are kept below this magnitude, so that MUL does not overflow */
+#define DELTA_MAX I(16)
+/** Bits of scale given up when a delta grows too large */
+#define DELTA_RESCALE 4
+/** Pixel is glitched when |Z+delta|^2 < |Z|^2 * 2^-GLITCH_SHIFT */
+#define GLITCH_SHIFT 10
+#endif
+
+/** Current frame: pixel (x,y) is at
+ * center + (-radius + (x,y) * step) * 2^-shift
+ */
+static struct {
+    mp_t centerx, centery;
+    /* scaled by 2^shift */
+    fp_t radiusx, radiusy;
+    fp_t stepx, stepy;
+    int shift;
+    /* iteration limit */
+    int itmax;
+    /* pixel (0,0) and step, for each kernel variant */
+    int32_t q27_basex, q27_basey, q27_stepx, q27_stepy;
+    int64_t q57_basex, q57_basey, q57_stepx, q57_stepy;
+    mp_t mp_basex, mp_basey;
+} view;
+
+/** Iteration count of pixel (x,y) in the current view */
+static int (*pixel_it)(int x, int y);
+
+/** Escape loop iterations run by the kernels for the last frame. Pixels that
+ * are known not to escape without iterating count none.
+ */
+static uint32_t iterations_run;
+
+/** Is c inside the main cardioid or the period-2 bulb? These points never
+ * escape. The tests are shrunk by a small margin so that points close to the
+ * boundary, where rounding could matter, still go through the escape loop.
+ */
+static inline int in_cardioid_or_bulb(fp_t cx, fp_t cy)
+{
+    fp_t cy2 = MUL(cy,cy);
+    /* (x+1)^2 + y^2 < 1/16 */
+    fp_t bx = cx + I(1);
+    if (MUL(bx,bx) + cy2 < I(1)/16 - INTERIOR_MARGIN) {
+        return 1;
+    }
+    /* q*(q + (x-1/4)) < y^2/4 with q = (x-1/4)^2 + y^2 */
+    fp_t qx = cx - I(1)/4;
+    fp_t q = MUL(qx,qx) + cy2;
+    return MUL(q, q + qx) < cy2/4 - INTERIOR_MARGIN;
+}
+
+/* Escape-time kernel template, instantiated once per number representation:
+ *   T      number type
+ *   ZERO   zero value
+ *   ADD, SUB, DBL, MUL  arithmetic, MUL truncates
+ *   BIG(x)      |x| > 2, checked first so that squares cannot overflow
+ *   ESCAPED(x)  x > 4
+ * The generated function returns the number of iterations before c escapes,
+ * or itmax. The iterations actually run are added to iterations_run.
+ *
+ * There is no periodicity check: at the iteration limits used here an exact
+ * repeat of Z is so rare that comparing every iteration costs more than it
+ * saves (test/test_mandel_shortcuts.c has the figures).
+ */
+#define DEFINE_KERNEL(name, T, ZERO, ADD, SUB, DBL, MUL, BIG, ESCAPED) \
+static int name(T cx, T cy, int itmax) \
+{ \
+    /* Z = 0 */ \
+    T zx = ZERO; \
+    T zy = ZERO; \
+    int it; \
+    for (it=0; it<itmax; ++it) { \
+        if (BIG(zx) || BIG(zy)) { \
+            break; \
+        } \
+        T zx2 = MUL(zx,zx); \
+        T zy2 = MUL(zy,zy); \
+        /* |Z| <= 2 */ \
+        if (ESCAPED(ADD(zx2, zy2))) { \
+            break; \
+        } \
+        /* Z = Z^2 + C */ \
+        T twozxy = DBL(MUL(zx,zy)); \
+        zx = ADD(SUB(zx2, zy2), cx); \
+        zy = ADD(twozxy, cy); \
+    } \
+    iterations_run += it; \
+    return it; \
+}
+
+#define ADD_INT(x,y) ((x) + (y))
+#define SUB_INT(x,y) ((x) - (y))
+#define DBL_INT(x) (2 * (x))
+
+/* 32-bit Q4.27: product through a 64-bit intermediate (mul + mulh on RV32) */
+#define Q27(x) ((int32_t)(x) << 27)
+#define MUL_Q27(x,y) ((int32_t)(((int64_t)(x) * (y)) >> 27))
+#define BIG_Q27(x) ((x) > Q27(2) || (x) < -Q27(2))
+#define ESCAPED_Q27(x) ((x) > Q27(4))
+DEFINE_KERNEL(kernel_q27, int32_t, 0, ADD_INT, SUB_INT, DBL_INT, MUL_Q27, BIG_Q27, ESCAPED_Q27)
+
+/* 64-bit Q6.57: full 128-bit product from 32x32 bit partial products, so
+ * that it maps onto mul/mulhu on RV32. Truncates towards zero.
+ */
+#define Q57(x) ((int64_t)(x) << 57)
+static inline int64_t mul_q57(int64_t a, int64_t b)
+{
+    int neg = (a < 0) ^ (b < 0);
+    uint64_t ua = a < 0 ? -(uint64_t)a : (uint64_t)a;
+    uint64_t ub = b < 0 ? -(uint64_t)b : (uint64_t)b;
+    uint64_t al = (uint32_t)ua, ah = ua >> 32;
+    uint64_t bl = (uint32_t)ub, bh = ub >> 32;
+    uint64_t ll = al * bl;
+    uint64_t lh = al * bh;
+    uint64_t hl = ah * bl;
+    uint64_t hh = ah * bh;
+    uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+    uint64_t lo = (mid << 32) | (uint32_t)ll;
+    uint64_t hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    uint64_t r = (hi << (64-57)) | (lo >> 57);
+    return neg ? -(int64_t)r : (int64_t)r;
+}
+#define BIG_Q57(x) ((x) > Q57(2) || (x) < -Q57(2))
+#define ESCAPED_Q57(x) ((x) > Q57(4))
+DEFINE_KERNEL(kernel_q57, int64_t, 0, ADD_INT, SUB_INT, DBL_INT, mul_q57, BIG_Q57, ESCAPED_Q57)
+
+/* Multi-word */
+static const mp_t mp_zero;
+static inline mp_t mpv_add(mp_t a, mp_t b) { mp_t r; mp_add(&r, &a, &b); return r; }
+static inline mp_t mpv_sub(mp_t a, mp_t b) { mp_t r; mp_sub(&r, &a, &b); return r; }
+static inline mp_t mpv_dbl(mp_t a) { mp_t r; mp_add(&r, &a, &a); return r; }
+static inline mp_t mpv_mul(mp_t a, mp_t b) { mp_t r; mp_mul(&r, &a, &b); return r; }
+static inline int mpv_big(mp_t a) { fp_t v = mp_to_fixed(&a, PREC); return v > I(2) || v < -I(2); }
+static inline int mpv_escaped(mp_t a) { return mp_to_fixed(&a, PREC) > I(4); }
+DEFINE_KERNEL(kernel_mp, mp_t, mp_zero, mpv_add, mpv_sub, mpv_dbl, mpv_mul, mpv_big, mpv_escaped)
+
+/** Pixel using 32-bit kernel */
+static int pixel_q27(int x, int y)
+{
+    int32_t cx = view.q27_basex + x * view.q27_stepx;
+    int32_t cy = view.q27_basey + y * view.q27_stepy;
+    if (in_cardioid_or_bulb((fp_t)cx << (PREC-27), (fp_t)cy << (PREC-27))) {
+        return view.itmax;
+    }
+    return kernel_q27(cx, cy, view.itmax);
+}
+
+/** Pixel using 64-bit kernel */
+static int pixel_q57(int x, int y)
+{
+    int64_t cx = view.q57_basex + x * view.q57_stepx;
+    int64_t cy = view.q57_basey + y * view.q57_stepy;
+    if (in_cardioid_or_bulb(cx >> (57-PREC), cy >> (57-PREC))) {
+        return view.itmax;
+    }
+    return kernel_q57(cx, cy, view.itmax);
+}
+
+#if !defined(MANDEL_PERTURBATION) || defined(MANDEL_BENCHMARK)
+/** Pixel using multi-word kernel */
+static int pixel_mp(int x, int y)
+{
+    mp_t cx, cy;
+    mp_from_fixed(&cx, x * view.stepx, PREC, view.shift);
+    mp_add(&cx, &cx, &view.mp_basex);
+    mp_from_fixed(&cy, y * view.stepy, PREC, view.shift);
+    mp_add(&cy, &cy, &view.mp_basey);
+    return kernel_mp(cx, cy, view.itmax);
+}
+#endif
+
+#ifdef MANDEL_PERTURBATION
+/* Perturbation.
+ *
+ * One reference orbit Z_n is computed per frame in multi-word precision. For
+ * every pixel only the difference d_n = z_n - Z_n is iterated:
+ *
+ *   d_{n+1} = 2 Z_n d_n + d_n^2 + dc
+ *
+ * The deltas are tiny, so they are kept in fp_t scaled by 2^s, with s starting
+ * out as the frame's shift and lowered whenever the delta grows too large.
+ * Pixels for which this breaks down (the reference escapes first, or z_n gets
+ * close to zero relative to Z_n) are iterated in full precision.
+ */
+/** Reference point */
+static mp_t ref_cx, ref_cy;
+/** Offset of reference point from the pixel grid origin, scaled like the step */
+static fp_t ref_offx, ref_offy;
+/** Reference orbit including the point where it escaped, and the number of
+ * iterations before it escaped
+ */
+static fp_t refx[MAX_ITMAX+1], refy[MAX_ITMAX+1];
+static int ref_len;
+
+/** v * 2^-s for s >= 0 */
+static inline fp_t unscale(fp_t v, int s)
+{
+    return s < 64 ? v >> s : (v >> 63);
+}
+
+/** Iterate reference point in full precision, storing its orbit in refx/refy.
+ * Returns number of iterations before escape, or itmax.
+ */
+static int ref_orbit(const mp_t *cx, const mp_t *cy)
+{
+    mp_t zx = {{0}};
+    mp_t zy = {{0}};
+    mp_t zx2, zy2, zxy, t;
+    int it;
+    for (it=0; it<view.itmax; ++it) {
+        refx[it] = mp_to_fixed(&zx, PREC);
+        refy[it] = mp_to_fixed(&zy, PREC);
+        mp_mul(&zx2, &zx, &zx);
+        mp_mul(&zy2, &zy, &zy);
+        /* |Z| <= 2 */
+        mp_add(&t, &zx2, &zy2);
+        if (mp_to_fixed(&t, PREC) > I(4)) {
+            break;
+        }
+        /* Z = Z^2 + C */
+        mp_mul(&zxy, &zx, &zy);
+        mp_add(&zxy, &zxy, &zxy);
+        mp_sub(&t, &zx2, &zy2);
+        mp_add(&zx, &t, cx);
+        mp_add(&zy, &zxy, cy);
+    }
+    return it;
+}
+
+/** Point at a scaled offset from the reference */
+static void ref_point(mp_t *cx, mp_t *cy, fp_t dcx, fp_t dcy)
+{
+    mp_t t;
+    mp_from_fixed(&t, dcx, PREC, view.shift);
+    mp_add(cx, &ref_cx, &t);
+    mp_from_fixed(&t, dcy, PREC, view.shift);
+    mp_add(cy, &ref_cy, &t);
+}
+
+/** Pick the reference point with the longest orbit from a few candidates in
+ * the view, and compute its orbit.
+ */
+static void ref_setup(void)
+{
+    static const uint8_t cand[][2] = {
+        {DISP_W/2, DISP_H/2},
+        {DISP_W/4, DISP_H/4}, {3*DISP_W/4, DISP_H/4},
+        {DISP_W/4, 3*DISP_H/4}, {3*DISP_W/4, 3*DISP_H/4},
+    };
+    mp_t cx, cy, t;
+    int best_len = -1;
+    fp_t best_offx = 0, best_offy = 0;
+    for (unsigned i=0; i<ARRAY_SIZE(cand) && best_len < view.itmax; ++i) {
+        fp_t offx = cand[i][0] * view.stepx;
+        fp_t offy = cand[i][1] * view.stepy;
+        mp_from_fixed(&t, offx - view.radiusx, PREC, view.shift);
+        mp_add(&cx, &view.centerx, &t);
+        mp_from_fixed(&t, offy - view.radiusy, PREC, view.shift);
+        mp_add(&cy, &view.centery, &t);
+        int len = kernel_mp(cx, cy, view.itmax);
+        if (len > best_len) {
+            best_len = len;
+            best_offx = offx;
+            best_offy = offy;
+            ref_cx = cx;
+            ref_cy = cy;
+        }
+    }
+    ref_offx = best_offx;
+    ref_offy = best_offy;
+    ref_len = ref_orbit(&ref_cx, &ref_cy);
+}
+
+/** Pixel in a deep frame */
+static int deep_pixel(int x, int y)
+{
+    /* Scaled offset from reference */
+    fp_t dcx = x * view.stepx - ref_offx;
+    fp_t dcy = y * view.stepy - ref_offy;
+    fp_t cx = dcx, cy = dcy;
+    fp_t dx = 0, dy = 0;
+    int s = view.shift;
+    int it;
+    for (it=0; it<view.itmax; ++it) {
+        if (it > ref_len) {
+            /* Reference escaped before this pixel did */
+            goto slow;
+        }
+        fp_t zrx = refx[it];
+        fp_t zry = refy[it];
+        fp_t zx = zrx + unscale(dx, s);
+        fp_t zy = zry + unscale(dy, s);
+        fp_t mag = MUL(zx,zx) + MUL(zy,zy);
+        /* |Z| <= 2 */
+        if (mag > I(4)) {
+            break;
+        }
+        if (mag < ((MUL(zrx,zrx) + MUL(zry,zry)) >> GLITCH_SHIFT)) {
+            goto slow;
+        }
+        /* d = 2 Z d + d^2 + dc */
+        fp_t ndx = 2 * (MUL(zrx,dx) - MUL(zry,dy)) + unscale(MUL(dx,dx) - MUL(dy,dy), s) + cx;
+        fp_t ndy = 2 * (MUL(zrx,dy) + MUL(zry,dx)) + unscale(2 * MUL(dx,dy), s) + cy;
+        dx = ndx;
+        dy = ndy;
+        while (s > 0 && (dx > DELTA_MAX || dx < -DELTA_MAX ||
+                         dy > DELTA_MAX || dy < -DELTA_MAX)) {
+            int r = s < DELTA_RESCALE ? s : DELTA_RESCALE;
+            dx >>= r;
+            dy >>= r;
+            cx >>= r;
+            cy >>= r;
+            s -= r;
+        }
+    }
+    iterations_run += it;
+    return it;
+slow:
+    iterations_run += it;
+    {
+        mp_t px, py;
+        ref_point(&px, &py, dcx, dcy);
+        return kernel_mp(px, py, view.itmax);
+    }
+}
+#endif
+
+/* Center selection.
+ *
+ * A random center almost never lies on the boundary of the set, so the zoom
+ * soon ends in a uniform frame that has to be discarded. Before starting a
+ * zoom, run a coarse escape pass around the candidate at a depth of
+ * SCAN_SHIFT and count neighbouring grid points that would be drawn
+ * differently. If no random candidate scores well enough, fall back to a
+ * known point on the boundary.
+ */
+/** Pre-scan grid size */
+#define SCAN_W 16
+#define SCAN_H 4
+/** Zoom depth of the pre-scan */
+#define SCAN_SHIFT 10
+/** Minimum number of grid neighbours that differ */
+#define SCAN_MIN_SCORE 8
+/** Number of random candidates to try before using a seed */
+#define SCAN_TRIES 32
+
+/** Points on the boundary that stay interesting deep down */
+#define SEED(x) ((fp_t)((x) * I(1)))
+static const struct {
+    fp_t x, y;
+} seeds[] = {
+    {SEED(0.0), SEED(1.0)},                                 /* c = i */
+    {SEED(-0.743643887037151), SEED(0.131825904205330)},    /* seahorse valley */
+    {SEED(0.2549870375144766), SEED(-0.0005679790528465)},  /* elephant valley */
+    {SEED(-0.1010963638456222), SEED(0.9562865108091415)},  /* Misiurewicz point */
+    {SEED(-1.5436890126920764), SEED(0.0)},                 /* Misiurewicz point */
+};
+static unsigned next_seed;
+
+/** Statistics for the timing report */
+static unsigned frames_rendered, frames_discarded;
+static unsigned centers_scanned, centers_seeded;
+
+/** Score a candidate center by the number of neighbouring pre-scan points
+ * that differ in iteration parity, which is what the display shows.
+ */
+static int scan_score(fp_t x, fp_t y)
+{
+    uint8_t par[SCAN_H][SCAN_W];
+    fp_t stepx = (2 * I(3) / SCAN_W) >> SCAN_SHIFT;
+    fp_t stepy = (2 * I(1) / SCAN_H) >> SCAN_SHIFT;
+    int itmax = ITMAX + IT_PER_SHIFT*(SCAN_SHIFT - ITMAX_SHIFT);
+    int score = 0;
+    for (int sy=0; sy<SCAN_H; ++sy) {
+        for (int sx=0; sx<SCAN_W; ++sx) {
+            fp_t cx = x + (2*sx - SCAN_W + 1) * stepx / 2;
+            fp_t cy = y + (2*sy - SCAN_H + 1) * stepy / 2;
+            int it = itmax;
+            if (!in_cardioid_or_bulb(cx, cy)) {
+                it = kernel_q57(cx << (57-PREC), cy << (57-PREC), itmax);
+            }
+            par[sy][sx] = it & 1;
+            if (sx > 0 && par[sy][sx] != par[sy][sx-1]) {
+                score += 1;
+            }
+            if (sy > 0 && par[sy][sx] != par[sy-1][sx]) {
+                score += 1;
+            }
+        }
+    }
+    return score;
+}
+
+/** Is a point on the mandelbrot set interesting to zoom in on? */
+static int interesting(fp_t x, fp_t y)
+{
+    centers_scanned += 1;
+    return scan_score(x, y) >= SCAN_MIN_SCORE;
+}
+
+/** Pick a center for a new zoom */
+static void pick_center(fp_t *x, fp_t *y)
+{
+    for (int i=0; i<SCAN_TRIES; ++i) {
+        *x = ((fp_t)mrand48()<<(PREC-31)) + I(-1)/2;
+        *y = ((fp_t)mrand48()<<(PREC-32));
+        if (interesting(*x, *y)) {
+            return;
+        }
+    }
+    *x = seeds[next_seed].x;
+    *y = seeds[next_seed].y;
+    next_seed = (next_seed + 1) % ARRAY_SIZE(seeds);
+    centers_seeded += 1;
+}
+
+/** Number of pixels for which the escape loop was run in the last frame */
+static unsigned pixels_iterated;
+
+/** Iteration count per pixel of the last rendered frame */
+static uint8_t iters[DISP_H][DISP_W];
+#if MAX_ITMAX >= 0xff
+#error "Iteration counts must fit in a byte"
+#endif
+
+/** Convert iteration counts to a frame in display page layout.
+ * Returns 0 if the frame is not worth showing because it is empty or full.
+ */
+static int iters_to_frame(uint8_t frame[DISP_PAGES][DISP_W])
+{
+    uint8_t none = 0xff;
+    uint8_t all = 0x00;
+    for (int row=0; row<DISP_PAGES; ++row) {
+        for (int x=0; x<DISP_W; ++x) {
+            uint8_t byte = 0;
+            for (int yi=0; yi<8; ++yi) {
+                //int bit = it < itmax;
+                int bit = iters[row*8+yi][x]&1;
+                byte |= (bit << yi);
+            }
+            frame[row][x] = byte;
+            all |= byte;
+            none &= byte;
+        }
+    }
+    return !(all == 0x00 || none == 0xff);
+}
+
+#ifdef MANDEL_GRAYSCALE
+/** Gray level of an iteration count. Escaping points go up and down through
+ * the levels, so that neighbouring bands differ by one level. The interior
+ * is black.
+ */
+static inline unsigned gray_level(int it)
+{
+    const unsigned period = 2 * (GRAY_LEVELS - 1);
+    if (it >= view.itmax) {
+        return 0;
+    }
+    unsigned i = it % period;
+    return i < GRAY_LEVELS ? i : period - i;
+}
+
+/** Convert iteration counts to bitplanes in display page layout */
+static void iters_to_planes(uint8_t planes[GRAY_BITS][DISP_PAGES][DISP_W])
+{
+    for (int row=0; row<DISP_PAGES; ++row) {
+        for (int x=0; x<DISP_W; ++x) {
+            uint8_t bytes[GRAY_BITS] = {0};
+            for (int yi=0; yi<8; ++yi) {
+                unsigned level = gray_level(iters[row*8+yi][x]);
+                for (int b=0; b<GRAY_BITS; ++b) {
+                    bytes[b] |= ((level >> b) & 1) << yi;
+                }
+            }
+            for (int b=0; b<GRAY_BITS; ++b) {
+                planes[b][row][x] = bytes[b];
+            }
+        }
+    }
+}
+#endif
+
+#ifndef MANDEL_MARIANI_SILVER
+/** Render a frame in display page layout.
+ * Returns 0 if the frame is not worth showing because it is empty or full.
+ */
+static int render(uint8_t frame[DISP_PAGES][DISP_W])
+{
+    iterations_run = 0;
+    for (int y=0; y<DISP_H; ++y) {
+        for (int x=0; x<DISP_W; ++x) {
+            iters[y][x] = pixel_it(x, y);
+        }
+        MANDEL_POLL();
+    }
+    pixels_iterated = DISP_W * DISP_H;
+    return iters_to_frame(frame);
+}
+#else
+/* Mariani-Silver subdivision.
+ *
+ * The set of points with at least n iterations is connected and has no
+ * holes, so if the border of a rectangle has the same iteration count
+ * everywhere, so does its interior. Rectangles with a uniform border are
+ * filled, others are split in two along their longest side, sharing the
+ * split line.
+ *
+ * That argument holds for exact arithmetic. The rounded kernels could in
+ * principle give a different count inside a rectangle, though no frame of
+ * the zooms compared in test/test_mandel_ms.c does.
+ *
+ * The comparison is on the iteration count itself and not on its parity:
+ * a border of uniform parity can enclose bands of other counts.
+ */
+/** Iteration count not computed yet */
+#define IT_UNKNOWN 0xff
+/** Rectangles smaller than this in either direction are computed directly */
+#define MS_MIN_SIZE 4
+
+/** Iteration count of pixel, computed on first use */
+static inline int ms_pixel(int x, int y)
+{
+    if (iters[y][x] == IT_UNKNOWN) {
+        iters[y][x] = pixel_it(x, y);
+        ++pixels_iterated;
+    }
+    return iters[y][x];
+}
+
+/** Render rectangle with inclusive corners (x0,y0) and (x1,y1) */
+static void ms_rect(int x0, int y0, int x1, int y1)
+{
+    MANDEL_POLL();
+    int it = ms_pixel(x0, y0);
+    int uniform = 1;
+    for (int x=x0; x<=x1; ++x) {
+        uniform &= (ms_pixel(x, y0) == it) & (ms_pixel(x, y1) == it);
+    }
+    for (int y=y0+1; y<y1; ++y) {
+        uniform &= (ms_pixel(x0, y) == it) & (ms_pixel(x1, y) == it);
+    }
+    if (uniform) {
+        for (int y=y0+1; y<y1; ++y) {
+            for (int x=x0+1; x<x1; ++x) {
+                iters[y][x] = it;
+            }
+        }
+    } else if (x1 - x0 < MS_MIN_SIZE || y1 - y0 < MS_MIN_SIZE) {
+        for (int y=y0+1; y<y1; ++y) {
+            for (int x=x0+1; x<x1; ++x) {
+                ms_pixel(x, y);
+            }
+        }
+    } else if (x1 - x0 >= y1 - y0) {
+        int xm = (x0 + x1) / 2;
+        ms_rect(x0, y0, xm, y1);
+        ms_rect(xm, y0, x1, y1);
+    } else {
+        int ym = (y0 + y1) / 2;
+        ms_rect(x0, y0, x1, ym);
+        ms_rect(x0, ym, x1, y1);
+    }
+}
+
+/** Render a frame in display page layout.
+ * Returns 0 if the frame is not worth showing because it is empty or full.
+ */
+static int render(uint8_t frame[DISP_PAGES][DISP_W])
+{
+    pixels_iterated = 0;
+    iterations_run = 0;
+    for (int y=0; y<DISP_H; ++y) {
+        for (int x=0; x<DISP_W; ++x) {
+            iters[y][x] = IT_UNKNOWN;
+        }
+    }
+    ms_rect(0, 0, DISP_W-1, DISP_H-1);
+    return iters_to_frame(frame);
+}
+#endif
+
+#ifdef MANDEL_INCREMENTAL
+/* Incremental zoom.
+ *
+ * Consecutive frames of a zoom differ by a factor (ZOOM_MUL-1)/ZOOM_MUL
+ * around the center pixel, so every pixel of the new frame lies between
+ * at most 2x2 pixels of the previous one. If those all have the same
+ * iteration count the pixel takes it over, otherwise it is iterated.
+ *
+ * The source pixels are never further from the center than the pixel
+ * itself, so visiting the pixels from the edges inward allows iters to be
+ * updated in place.
+ */
+/** Frames between full renders */
+#define EXACT_INTERVAL 16
+
+/** Position of coordinate x of the new frame in the previous frame,
+ * in units of 1/ZOOM_MUL pixel.
+ */
+static inline int zoom_src(int x, int n)
+{
+    return (x - n/2) * (ZOOM_MUL-1) + (n/2) * ZOOM_MUL;
+}
+
+/** i-th coordinate of n in edges-inward order */
+static inline int outside_in(int i, int n)
+{
+    return i < n/2 ? i : n - 1 - (i - n/2);
+}
+
+/** Render the next frame of a zoom from the previous one.
+ * Returns 0 if the frame is not worth showing because it is empty or full.
+ */
+static int render_incremental(uint8_t frame[DISP_PAGES][DISP_W])
+{
+    pixels_iterated = 0;
+    iterations_run = 0;
+    for (int j=0; j<DISP_H; ++j) {
+        int y = outside_in(j, DISP_H);
+        int v = zoom_src(y, DISP_H);
+        int y0 = v / ZOOM_MUL;
+        int y1 = y0 + (v % ZOOM_MUL != 0);
+        for (int i=0; i<DISP_W; ++i) {
+            int x = outside_in(i, DISP_W);
+            int u = zoom_src(x, DISP_W);
+            int x0 = u / ZOOM_MUL;
+            int x1 = x0 + (u % ZOOM_MUL != 0);
+            int it = iters[y0][x0];
+            if (iters[y0][x1] != it || iters[y1][x0] != it || iters[y1][x1] != it) {
+                it = pixel_it(x, y);
+                ++pixels_iterated;
+            }
+            iters[y][x] = it;
+        }
+        MANDEL_POLL();
+    }
+    return iters_to_frame(frame);
+}
+
+/** Iteration limit of the frame in iters, 0 if there is none */
+static int prev_itmax;
+
+/** Render frame n of a zoom: from the previous frame, unless it is one of
+ * the exact frames or the iteration limit changed.
+ * Returns 0 if the frame is not worth showing because it is empty or full.
+ */
+static int render_zoom(uint8_t frame[DISP_PAGES][DISP_W], int n)
+{
+    int valid;
+    if (n % EXACT_INTERVAL != 0 && view.itmax == prev_itmax) {
+        valid = render_incremental(frame);
+    } else {
+        valid = render(frame);
+    }
+    prev_itmax = view.itmax;
+    return valid;
+}
+#else
+static int render_zoom(uint8_t frame[DISP_PAGES][DISP_W], int n)
+{
+    (void)n;
+    return render(frame);
+}
+#endif
+
+/** Back buffer. The next frame is rendered here while the previous one is
+ * being sent from the transmit queue, and only presented once validated.
+ */
+static uint8_t back[DISP_PAGES][DISP_W];
+#ifdef MANDEL_GRAYSCALE
+/** Bitplanes of the frame being shown. Only replaced between polls, see
+ * gray_present().
+ */
+static uint8_t planes[GRAY_BITS][DISP_PAGES][DISP_W];
+#endif
+
+/** Set up view for the next frame and select the pixel function */
+static void view_setup(void)
+{
+    mp_t t;
+    view.stepx = 2 * view.radiusx / DISP_W;
+    view.stepy = 2 * view.radiusy / DISP_H;
+    view.itmax = ITMAX;
+    if (view.shift > ITMAX_SHIFT) {
+        view.itmax += IT_PER_SHIFT*(view.shift - ITMAX_SHIFT);
+    }
+    /* pixel (0,0) */
+    mp_from_fixed(&t, view.radiusx, PREC, view.shift);
+    mp_sub(&view.mp_basex, &view.centerx, &t);
+    mp_from_fixed(&t, view.radiusy, PREC, view.shift);
+    mp_sub(&view.mp_basey, &view.centery, &t);
+    view.q27_basex = mp_to_fixed(&view.mp_basex, 27);
+    view.q27_basey = mp_to_fixed(&view.mp_basey, 27);
+    view.q27_stepx = view.stepx >> (PREC - 27 + view.shift);
+    view.q27_stepy = view.stepy >> (PREC - 27 + view.shift);
+    view.q57_basex = mp_to_fixed(&view.mp_basex, 57);
+    view.q57_basey = mp_to_fixed(&view.mp_basey, 57);
+    view.q57_stepx = (view.stepx << (57 - PREC)) >> view.shift;
+    view.q57_stepy = (view.stepy << (57 - PREC)) >> view.shift;
+
+    if (view.shift < Q27_SHIFT_LIMIT) {
+        pixel_it = pixel_q27;
+    } else if (view.shift < Q57_SHIFT_LIMIT) {
+        pixel_it = pixel_q57;
+    } else {
+#ifdef MANDEL_PERTURBATION
+        ref_setup();
+        pixel_it = deep_pixel;
+#else
+        pixel_it = pixel_mp;
+#endif
+    }
+}
+
+#ifdef MANDEL_BENCHMARK
+/** Render one frame with every kernel variant and report cycles */
+static void mandel_benchmark(void)
+{
+    static const struct {
+        const char *name;
+        int (*fn)(int x, int y);
+    } variants[] = {
+        {"q27", pixel_q27},
+        {"q57", pixel_q57},
+        {"mp", pixel_mp},
+#ifdef MANDEL_PERTURBATION
+        {"perturbation", deep_pixel},
+#endif
+    };
+    /* A view on the boundary, at a depth that all variants can handle */
+    mp_from_fixed(&view.centerx, -I(3)/4, PREC, 0);
+    mp_from_fixed(&view.centery, I(1)/8, PREC, 0);
+    view.radiusx = I(3);
+    view.radiusy = I(1);
+    view.shift = 4;
+    view_setup();
+#ifdef MANDEL_PERTURBATION
+    ref_setup();
+#endif
+    for (unsigned i=0; i<ARRAY_SIZE(variants); ++i) {
+        pixel_it = variants[i].fn;
+        uint32_t start = rdcycle();
+        render(back);
+        uart_printf(UART_BLOCK, "kernel %s: %lu cycles/frame\r\n", variants[i].name,
+                (unsigned long)(rdcycle() - start));
+    }
+}
+#endif
+
+/** Zoom in by one frame */
+static void zoom_step(void)
+{
+    view.radiusx = (view.radiusx * (ZOOM_MUL-1))/ZOOM_MUL;
+    view.radiusy = (view.radiusy * (ZOOM_MUL-1))/ZOOM_MUL;
+    if (view.radiusy < I(1)) {
+        view.radiusx *= 2;
+        view.radiusy *= 2;
+        view.shift += 1;
+    }
+}
+
+void mandelbrot(pmodoled_t *disp)
+{
+    char c;
+    int frame = 0;
+    fp_t centerx, centery;
+    fp_t start_radiusx = I(3);
+    fp_t start_radiusy = I(1);
+#ifdef MANDEL_BENCHMARK
+    mandel_benchmark();
+#endif
+#ifdef MANDEL_GRAYSCALE
+    gray_start(disp);
+#endif
+    while (!uart_getc(&c)) {
+        if (frame == 0) {
+            pick_center(&centerx, &centery);
+#ifdef MANDEL_TIMING
+            uart_printf(UART_DROP, "new center: %u candidates scanned, %u seeded, %u of %u frames discarded\r\n",
+                    centers_scanned, centers_seeded, frames_discarded, frames_rendered);
+#ifdef MANDEL_GRAYSCALE
+            uint64_t ticks = get_timer_value() - gray_stats.start;
+            uart_printf(UART_DROP, "gray: %lu planes, %lu planes/s, %lu late\r\n",
+                    (unsigned long)gray_stats.planes,
+                    (unsigned long)(ticks ? (uint64_t)gray_stats.planes * RTC_FREQ / ticks : 0),
+                    (unsigned long)gray_stats.late);
+#endif
+#endif
+            mp_from_fixed(&view.centerx, centerx, PREC, 0);
+            mp_from_fixed(&view.centery, centery, PREC, 0);
+            view.radiusx = start_radiusx;
+            view.radiusy = start_radiusy;
+            view.shift = 0;
+        }
+        if (view.shift >= SHIFT_LIMIT) {
+            frame = 0;
+            continue;
+        }
+        uint32_t start = rdcycle();
+        view_setup();
+        frames_rendered += 1;
+        if (!render_zoom(back, frame)) {
+            /* If screen empty or full, restart */
+            frames_discarded += 1;
+            PERF_COUNT(PERF_DISCARDED, 1);
+            frame = 0;
+            continue;
+        }
+        uint32_t rendered = rdcycle();
+#ifdef MANDEL_GRAYSCALE
+        iters_to_planes(planes);
+        gray_present(planes);
+        gray_sync();
+#else
+        pmodoled_present(disp, back);
+#endif
+        uint32_t presented = rdcycle();
+        PERF_COUNT(PERF_RENDER, rendered - start);
+        PERF_COUNT(PERF_PRESENT, presented - rendered);
+        PERF_COUNT(PERF_PIXELS, pixels_iterated);
+        PERF_COUNT(PERF_ITERATIONS, iterations_run);
+        PERF_FRAME(presented - start);
+#ifdef MANDEL_TIMING
+        uart_printf(UART_DROP, "frame %d: shift %d render %lu present %lu cycles, %u pixels iterated, %lu iterations\r\n",
+                frame, view.shift,
+                (unsigned long)(rendered - start), (unsigned long)(presented - rendered),
+                pixels_iterated, (unsigned long)iterations_run);
+#endif
+        frame += 1;
+        zoom_step();
+    }
+#ifdef MANDEL_GRAYSCALE
+    gray_stop();
+#endif
+}
@@ -0,0 +1,11 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#ifndef H_MANDEL
+#define H_MANDEL
+#include "display.h"
+
+/** Show zooming mandelbrot set on disp until a character is received on the UART */
+void mandelbrot(pmodoled_t *disp);
+
+#endif
@@ -0,0 +1,140 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#ifndef H_MP
+#define H_MP
+/* Multi-word fixed-point arithmetic.
+ *
+ * Signed two's complement numbers of MP_WORDS 32-bit words, least significant
+ * word first, with one word of integer part and the rest fraction.
+ * Only what the mandelbrot renderer needs: conversion from and to int64_t
+ * fixed-point, addition, subtraction and multiplication.
+ */
+#include <stdint.h>
+
+/** Number of 32-bit words */
+#define MP_WORDS 4
+/** Number of fraction bits */
+#define MP_FRAC (32*(MP_WORDS-1))
+
+typedef struct {
+    uint32_t w[MP_WORDS];
+} mp_t;
+
+static inline int mp_negative(const mp_t *a)
+{
+    return (int32_t)a->w[MP_WORDS-1] < 0;
+}
+
+/** r = a + b */
+static inline void mp_add(mp_t *r, const mp_t *a, const mp_t *b)
+{
+    uint32_t carry = 0;
+    for (int i=0; i<MP_WORDS; ++i) {
+        uint64_t sum = (uint64_t)a->w[i] + b->w[i] + carry;
+        r->w[i] = (uint32_t)sum;
+        carry = sum >> 32;
+    }
+}
+
+/** r = a - b */
+static inline void mp_sub(mp_t *r, const mp_t *a, const mp_t *b)
+{
+    uint32_t borrow = 0;
+    for (int i=0; i<MP_WORDS; ++i) {
+        uint64_t diff = (uint64_t)a->w[i] - b->w[i] - borrow;
+        r->w[i] = (uint32_t)diff;
+        borrow = (diff >> 32) & 1;
+    }
+}
+
+/** r = -a */
+static inline void mp_neg(mp_t *r, const mp_t *a)
+{
+    uint32_t carry = 1;
+    for (int i=0; i<MP_WORDS; ++i) {
+        uint64_t sum = (uint64_t)(uint32_t)~a->w[i] + carry;
+        r->w[i] = (uint32_t)sum;
+        carry = sum >> 32;
+    }
+}
+
+/** r = a * b, truncated towards zero */
+static inline void mp_mul(mp_t *r, const mp_t *a, const mp_t *b)
+{
+    mp_t ua, ub;
+    int neg = mp_negative(a) ^ mp_negative(b);
+    if (mp_negative(a)) {
+        mp_neg(&ua, a);
+        a = &ua;
+    }
+    if (mp_negative(b)) {
+        mp_neg(&ub, b);
+        b = &ub;
+    }
+    /* Full product has 2*MP_WORDS words and 2*MP_FRAC fraction bits,
+     * keep words MP_WORDS-1 up to 2*MP_WORDS-2.
+     */
+    uint32_t prod[2*MP_WORDS] = {0};
+    for (int i=0; i<MP_WORDS; ++i) {
+        uint32_t carry = 0;
+        for (int j=0; j<MP_WORDS; ++j) {
+            uint64_t t = (uint64_t)a->w[i] * b->w[j] + prod[i+j] + carry;
+            prod[i+j] = (uint32_t)t;
+            carry = t >> 32;
+        }
+        prod[i+MP_WORDS] = carry;
+    }
+    for (int i=0; i<MP_WORDS; ++i) {
+        r->w[i] = prod[i+MP_WORDS-1];
+    }
+    if (neg) {
+        mp_neg(r, r);
+    }
+}
+
+/** r = v * 2^-(prec+shift), for a fixed-point value v with prec fraction bits.
+ * Bits shifted out at the bottom are lost.
+ */
+static inline void mp_from_fixed(mp_t *r, int64_t v, int prec, int shift)
+{
+    int s = MP_FRAC - prec - shift; /* left shift of v */
+    uint32_t fill = v < 0 ? 0xffffffff : 0;
+    for (int i=0; i<MP_WORDS; ++i) {
+        /* bits [32*i, 32*i+32) of v << s */
+        int lo = 32*i - s;
+        uint32_t word;
+        if (lo >= 64) {
+            word = fill;
+        } else if (lo <= -32) {
+            word = 0;
+        } else if (lo >= 0) {
+            word = (uint32_t)(v >> lo); /* arithmetic shift extends sign */
+        } else {
+            word = (uint32_t)((uint64_t)v << -lo);
+        }
+        r->w[i] = word;
+    }
+}
+
+/** Convert to fixed-point value with prec fraction bits, truncating */
+static inline int64_t mp_to_fixed(const mp_t *a, int prec)
+{
+    /* Take the 64 bits starting prec bits below the binary point */
+    int lo = MP_FRAC - prec;
+    int wi = lo / 32;
+    int bi = lo % 32;
+    uint64_t bits = 0;
+    for (int i=0; i<3 && 32*i - bi < 64; ++i) {
+        int idx = wi + i;
+        uint64_t word = idx < MP_WORDS ? a->w[idx] : (mp_negative(a) ? 0xffffffff : 0);
+        if (32*i - bi >= 0) {
+            bits |= word << (32*i - bi);
+        } else {
+            bits |= word >> (bi - 32*i);
+        }
+    }
+    return (int64_t)bits;
+}
+
+#endif
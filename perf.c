@@ -0,0 +1,70 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#include "perf.h"
+
+#ifdef PERF
+#include <string.h>
+
+#include "uart.h"
+
+/** Histogram buckets: powers of two up to 2^31 cycles */
+#define HIST_BUCKETS 32
+
+uint32_t perf_counters[PERF_NUM];
+
+static const char *const perf_names[PERF_NUM] = {
+    "spi_stall", "spi_wait", "spi_isr", "sleep", "render", "present",
+    "queue_full", "poll", "pixels", "iterations", "discarded",
+};
+
+static uint32_t hist[HIST_BUCKETS];
+static unsigned frames;
+static int header_done;
+
+static void perf_report(void)
+{
+    if (!header_done) {
+        uart_printf(UART_BLOCK, "perf,names");
+        for (unsigned i=0; i<PERF_NUM; ++i) {
+            uart_printf(UART_BLOCK, ",%s", perf_names[i]);
+        }
+        uart_printf(UART_BLOCK, "\r\n");
+        header_done = 1;
+    }
+    uart_printf(UART_BLOCK, "perf,%u", frames);
+    for (unsigned i=0; i<PERF_NUM; ++i) {
+        uart_printf(UART_BLOCK, ",%lu", (unsigned long)perf_counters[i]);
+    }
+    uart_printf(UART_BLOCK, "\r\n");
+
+    unsigned lo = 0, hi = HIST_BUCKETS;
+    while (lo < hi && !hist[lo]) {
+        ++lo;
+    }
+    while (hi > lo && !hist[hi - 1]) {
+        --hi;
+    }
+    uart_printf(UART_BLOCK, "hist,%u", lo);
+    for (unsigned i=lo; i<hi; ++i) {
+        uart_printf(UART_BLOCK, ",%lu", (unsigned long)hist[i]);
+    }
+    uart_printf(UART_BLOCK, "\r\n");
+
+    memset(perf_counters, 0, sizeof(perf_counters));
+    memset(hist, 0, sizeof(hist));
+    frames = 0;
+}
+
+void perf_frame(uint32_t cycles)
+{
+    unsigned bucket = 0;
+    while (bucket < HIST_BUCKETS - 1 && (cycles >> (bucket + 1))) {
+        ++bucket;
+    }
+    hist[bucket] += 1;
+    if (++frames == PERF_REPORT_FRAMES) {
+        perf_report();
+    }
+}
+#endif
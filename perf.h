@@ -0,0 +1,68 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#ifndef H_PERF
+#define H_PERF
+/* Performance counters.
+ *
+ * Cycle counters accumulate rdcycle differences for a subsystem, event
+ * counters count occurrences. Every PERF_REPORT_FRAMES frames the counters
+ * and a histogram of frame times are printed to the UART as CSV and reset:
+ *
+ *   perf,<frames>,<counter>,...      counters in perf_names order
+ *   hist,<lo>,<count>,...            frames taking [2^k, 2^(k+1)) cycles,
+ *                                    for k from lo up
+ *
+ * A "perf,names,..." line with the counter names is printed before the
+ * first report. tools/perfplot.py summarizes a captured log.
+ *
+ * Without PERF, the macros expand to nothing.
+ */
+#include <stdint.h>
+
+/** Define this to enable performance counters */
+//#define PERF
+
+/** Number of frames between reports */
+#define PERF_REPORT_FRAMES 64
+
+enum perf_counter {
+    /* Cycles */
+    PERF_SPI_STALL,   /**< waiting for space in the SPI transmit queue */
+    PERF_SPI_WAIT,    /**< waiting for SPI transfers to complete */
+    PERF_SPI_ISR,     /**< in the SPI interrupt handler */
+    PERF_SLEEP,       /**< in sleep_ticks */
+    PERF_RENDER,      /**< rendering mandelbrot frames */
+    PERF_PRESENT,     /**< queueing frames for the display */
+    /* Events */
+    PERF_QUEUE_FULL,  /**< spins on a full SPI transmit queue */
+    PERF_POLL,        /**< terminal main loop iterations */
+    PERF_PIXELS,      /**< mandelbrot pixels computed, not filled in from others */
+    PERF_ITERATIONS,  /**< mandelbrot escape loop iterations */
+    PERF_DISCARDED,   /**< mandelbrot frames discarded */
+    PERF_NUM
+};
+
+#ifdef PERF
+#include "cycles.h"
+
+extern uint32_t perf_counters[PERF_NUM];
+
+/** Start timing, into a new variable t */
+#define PERF_START(t) uint32_t t = rdcycle()
+/** Add cycles since PERF_START(t) to counter */
+#define PERF_STOP(counter, t) (perf_counters[counter] += rdcycle() - (t))
+/** Add n to counter */
+#define PERF_COUNT(counter, n) (perf_counters[counter] += (n))
+/** Add a frame that took the given number of cycles, report if due */
+#define PERF_FRAME(cycles) perf_frame(cycles)
+
+void perf_frame(uint32_t cycles);
+#else
+#define PERF_START(t) do {} while (0)
+#define PERF_STOP(counter, t) do {} while (0)
+#define PERF_COUNT(counter, n) do {} while (0)
+#define PERF_FRAME(cycles) do {} while (0)
+#endif
+
+#endif
@@ -9,17 +9,26 @@
  * See comment in "display.c" under "Wiring" how to wire the PMOD to the GPIO pins.
  */
 #include <stdint.h>
-#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "platform.h"
 
 #include "uartio.h"
+#include "uart.h"
 #include "bits.h"
 #include "sleep.h"
 #include "rgb.h"
 #include "display.h"
-
-#include "font.h"
+#include "mandel.h"
+#include "irq.h"
+#include "cycles.h"
+#include "term.h"
+#include "perf.h"
+#include "clock.h"
+#include "events.h"
+#include "stream.h"
+#include "anim.h"
+#include "gray.h"
 
 /** Startup messages */
 static const char startup_msg[] = "\a\n\r\n\r\
@@ -32,228 +41,382 @@ static const char startup_msg[] = "\a\n\r\n\r\
 
 const char display_msg[]="[esc exits]";
 
-static void set_x(unsigned col)
-{
-    mode_cmd();
-    spi(0x00 | (col & 0xf));
-    spi(0x10 | ((col >> 4)&0xf));
-    mode_data();
-}
-static void set_y(unsigned row)
-{
-    mode_cmd();
-    spi(0xb0 | (row & 0x7));
-    mode_data();
-}
+/** Define this to drive a second PMODoled module that shows the current mode */
+//#define STATUS_PANEL
 
-/** Simple text display */
-#define CHAR_W (FONT_W+1)
-unsigned col = 0;
-unsigned row = 0;
+/** Display modules. The first one is wired as described in display.c. */
+static pmodoled_t panels[] = {
+    PMODOLED_128X32(23, 0, 1, 4),
+#ifdef STATUS_PANEL
+    /* CS on pin 2, RES, Vbatc and Vddc on pins 15 to 17 */
+    PMODOLED_128X32(18, 9, 10, 11),
+#endif
+};
+/** Module that shows the demo */
+static pmodoled_t *const oled = &panels[0];
 
-/** Go to new line */
-static void newline()
-{
-    /* Pad current line to end, if necessary */
-    for (; col < DISP_W; ++col) {
-        spi(0);
-    }
-    col = 0;
-    /* Go to next row */
-    row = (row + 1)%4;
-    /* Clear it */
-    for (unsigned x=0; x<DISP_W; ++x) {
-        spi(0);
-    }
-    /* Go back to row */
-    set_y(row);
-}
+/** Core clock frequency, at most CLOCK_MAX_FREQ */
+#define CPU_FREQ 320000000
 
-/* write a character to OLED screen.
- * must be in data mode.
+/** Font for text mode: font_6x8 or font_8x16 */
+#define TERM_FONT font_6x8
+
+/** Interval between LED fade steps, in 32768 Hz ticks */
+#define FADE_TICKS 300
+/** Half period of cursor blink, in 32768 Hz ticks */
+#define BLINK_TICKS 16384
+/** Time after an escape character without further input after which it is
+ * taken as a request to quit, in 32768 Hz ticks
  */
-static void outch(uint8_t ch)
+#define ESC_TICKS 1638
+
+static struct timer fade_timer, blink_timer, esc_timer;
+static uint16_t led_r, led_g, led_b;
+static int cursor_on;
+/** Terminal has changes that are not on the display yet */
+static int term_dirty;
+/** Quit text mode */
+static int text_quit;
+
+static void fade_step(void)
 {
-    unsigned x;
-    if (col > (DISP_W - CHAR_W)) { /* At end of line */
-      newline();
+    const unsigned led_bright = 3;
+    if(led_r > 0 && led_b == 0){
+        led_r--;
+        led_g++;
     }
-    if (ch >= FONT_N) {
-        ch = 0;
+    if(led_g > 0 && led_r == 0){
+        led_g--;
+        led_b++;
     }
-    for (x=0; x<FONT_W; ++x) {
-        spi(font[ch][x]);
+    if(led_b > 0 && led_g == 0){
+        led_r++;
+        led_b--;
     }
-    for (; x<CHAR_W; ++x) { /* Pad with empty columns if necessary */
-        spi(0);
+    rgb_set(led_r << led_bright, led_g << led_bright, led_b << led_bright);
+}
+
+static void blink(void)
+{
+    cursor_on = !cursor_on;
+    term_cursor(cursor_on);
+    term_dirty = 1;
+}
+
+static void esc_timeout(void)
+{
+    // Escape that does not start an escape sequence: quit
+    if (term_escape_pending()) {
+        text_quit = 1;
     }
-    col += CHAR_W;
 }
 
 void texttest()
 {
     unsigned i;
-    col = row = 0;
+    term_init(oled, &TERM_FONT);
     for (i=0; display_msg[i]; ++i)
-        outch(display_msg[i]);
-    newline();
+        term_putc(display_msg[i]);
+    term_putc('\r');
+    term_dirty = 1;
+    text_quit = 0;
+
+    led_r = 0xFF;
+    led_g = 0;
+    led_b = 0;
+    cursor_on = 0;
+    timer_start(&fade_timer, 0, FADE_TICKS, fade_step);
+    timer_start(&blink_timer, 0, BLINK_TICKS, blink);
 
     char c = 0;
-    uint16_t r=0xFF;
-    uint16_t g=0;
-    uint16_t b=0;
-    unsigned led_bright = 3;
-    while(1) {
-        sleep_ticks(300);
-
-        if(r > 0 && b == 0){
-            r--;
-            g++;
+    while (!text_quit) {
+        // Display updates go out when the previous one has been sent, so
+        // input that arrives meanwhile is coalesced into one update
+        if (term_dirty && spi_queue_empty()) {
+            PERF_START(t);
+            term_update();
+            PERF_FRAME(rdcycle() - t);
+            term_dirty = 0;
         }
-        if(g > 0 && r == 0){
-            g--;
-            b++;
-        }
-        if(b > 0 && g == 0){
-            r++;
-            b--;
+        unsigned events = event_wait(EVENT_UART_RX | EVENT_SPI_IDLE | EVENT_TIMER);
+        PERF_COUNT(PERF_POLL, 1);
+        if (!(events & EVENT_UART_RX)) {
+            continue;
         }
-        rgb_set(r << led_bright, g << led_bright, b << led_bright);
-
-        // Check for user input
-        if (_getc(&c) != 0) {
+        while (uart_getc(&c)) {
+            term_putc(c);
             if (c == 127) { // backspace
-                if (col >= CHAR_W) {
-                    col -= CHAR_W;
-                    set_x(col); // Reset x pos
-                    outch(' '); // Empty current character
-                    col -= CHAR_W;
-                    set_x(col); // Reset x pos
-                }
-                _putc('^');
-            } else if (c== '\r') { // Newline
-                newline();
-                _putc('\r');
-                _putc('\n');
-            } else if (c==27) { // Quit
-                break;
+                uart_write("^", 1, UART_BLOCK);
+            } else if (c == '\r') { // Newline
+                uart_write("\r\n", 2, UART_BLOCK);
             } else {
-                outch(c);
-                _putc(c);
+                uart_write(&c, 1, UART_BLOCK);
             }
         }
+        term_dirty = 1;
+        if (term_escape_pending()) {
+            timer_start(&esc_timer, ESC_TICKS, 0, esc_timeout);
+        } else {
+            timer_stop(&esc_timer);
+        }
     }
+    timer_stop(&fade_timer);
+    timer_stop(&blink_timer);
+    timer_stop(&esc_timer);
 }
 
-/* Mandelbrot */
-#define PREC 48  /* number of precision bits */
-#define ITMAX 16 /* number of iterations */
-#define I(x) (((int64_t)(x))<<PREC) /* integral value */
-#define FRAC(x,y) (I(x)/(y)) /* fraction */
-/* stupid multiplication of two fp_t */
-#define MUL(x,y)  (((x)>>(PREC/2)) * ((y)>>(PREC/2)))
-#define ZOOM_MUL (256L)
-typedef int64_t fp_t;
-
-/* Is a point on the mandelbrot set interesting to zoom in on? */
-int interesting(fp_t x, fp_t y)
+/** Define this to measure SPI throughput at startup */
+//#define SPI_BENCHMARK
+
+#ifdef SPI_BENCHMARK
+/** Number of bytes sent per benchmark */
+#define BENCH_BYTES 4096
+
+static void bench_report(const char *name, uint32_t submit, uint32_t total)
 {
-    return 1; /* TODO */
+    uart_printf(UART_BLOCK, "%s: submit %lu cycles, total %lu cycles, %lu bytes/s\r\n", name,
+            (unsigned long)submit, (unsigned long)total,
+            (unsigned long)((uint64_t)BENCH_BYTES * clock_cpu_freq() / total));
+}
+
+/** Compare per-byte and bulk SPI paths. Sends zeros in data mode, which
+ * leaves the freshly initialized display memory unchanged.
+ */
+static void spi_benchmark()
+{
+    static const uint8_t zeros[256];
+    uint32_t start, submit;
+
+    mode_data();
+    spi_wait();
+    start = rdcycle();
+    for (unsigned i=0; i<BENCH_BYTES; ++i) {
+        spi(0);
+    }
+    submit = rdcycle();
+    spi_wait();
+    bench_report("spi", submit - start, rdcycle() - start);
+
+    start = rdcycle();
+    for (unsigned i=0; i<BENCH_BYTES; i+=sizeof(zeros)) {
+        spi_write(zeros, sizeof(zeros));
+    }
+    submit = rdcycle();
+    spi_wait();
+    bench_report("spi_write", submit - start, rdcycle() - start);
+
+    start = rdcycle();
+    spi_fill(0, BENCH_BYTES);
+    submit = rdcycle();
+    spi_wait();
+    bench_report("spi_fill", submit - start, rdcycle() - start);
 }
+#endif
+
+/** Define this to measure glyph rendering speed of every font at startup */
+//#define FONT_BENCHMARK
 
-void mandelbrot()
+#ifdef FONT_BENCHMARK
+/** Number of glyphs drawn per font */
+#define BENCH_GLYPHS 256
+
+/** Multilingual text, to exercise the compressed glyph store */
+static const char bench_text[] =
+    "\u250c\u2500 Gr\u00fc\u00dfe \u2500\u2510\r"
+    "\u2502 Se\u00f1or, \u00e7a va? \u2502\r"
+    "\u2502 \u00c6r\u00f8, na\u00efve caf\u00e9 \u2502\r"
+    "\u2514\u2500\u2500\u2500\u2500\u2500\u2500\u2500\u2500\u2500\u2500\u2500\u2500\u2518\r";
+
+/** Draw glyphs one by one through the terminal and report cycles per glyph,
+ * both to render into the framebuffer and queue, and until sent. Then do
+ * the same for multilingual text and report glyph cache hits.
+ */
+static void font_benchmark(const char *name, const struct font *font)
 {
-    char c;
-    int frame = 0;
-    fp_t centerx = I(-1)/2;
-    fp_t centery = I(3)/4;
-    fp_t start_radiusx = I(3);
-    fp_t start_radiusy = I(1);
-    fp_t radiusx = start_radiusx;
-    fp_t radiusy = start_radiusy;
-    while (!_getc(&c)) {
-        if (frame == 0) {
-            do {
-                centerx = ((fp_t)mrand48()<<(PREC-31)) + I(-1)/2;
-                centery = ((fp_t)mrand48()<<(PREC-32));
-            } while (!interesting(centerx, centery));
-            radiusx = start_radiusx;
-            radiusy = start_radiusy;
+    uint32_t render = 0, total = 0;
+    pmodoled_clear(oled);
+    term_init(oled, font);
+    for (unsigned i=0; i<BENCH_GLYPHS; ++i) {
+        uint32_t start = rdcycle();
+        term_putc('!' + i % 94);
+        term_update();
+        uint32_t queued = rdcycle();
+        spi_wait();
+        render += queued - start;
+        total += rdcycle() - start;
+    }
+    uart_printf(UART_BLOCK, "font %s: %ux%u, %lu cycles/glyph render, %lu cycles/glyph total\r\n",
+            name, font->width, font->pages * 8,
+            (unsigned long)(render / BENCH_GLYPHS), (unsigned long)(total / BENCH_GLYPHS));
+
+    unsigned hits0, misses0, hits, misses, glyphs = 0;
+    font_cache_stats(&hits0, &misses0);
+    render = total = 0;
+    for (unsigned i=0; i<BENCH_GLYPHS; ) {
+        for (const char *p=bench_text; *p; ++p) {
+            uint32_t start = rdcycle();
+            term_putc(*p);
+            term_update();
+            uint32_t queued = rdcycle();
+            spi_wait();
+            render += queued - start;
+            total += rdcycle() - start;
+            if ((*p & 0xc0) != 0x80 && *p != '\r') {
+                ++glyphs;
+                ++i;
+            }
         }
-        fp_t basex = centerx - radiusx;
-        fp_t basey = centery - radiusy;
-        fp_t stepx = 2 * radiusx / DISP_W;
-        fp_t stepy = 2 * radiusy / DISP_H;
+    }
+    font_cache_stats(&hits, &misses);
+    uart_printf(UART_BLOCK, "font %s multilingual: %lu cycles/glyph render, %lu cycles/glyph total, cache %u hits %u misses\r\n",
+            name, (unsigned long)(render / glyphs), (unsigned long)(total / glyphs),
+            hits - hits0, misses - misses0);
+}
+#endif
 
-        if (radiusx < (I(1)>>4) || radiusy < (I(1)>>4)) {
-            frame = 0;
-            continue;
+/** Define this to measure animation playback at startup */
+//#define ANIM_BENCHMARK
+
+#ifdef ANIM_BENCHMARK
+/** Send every frame of an animation once and report cycles per frame, both
+ * to decode and queue, and until sent.
+ */
+static void anim_benchmark(const char *name, const struct anim *anim)
+{
+    uint32_t decode = 0, total = 0, worst = 0;
+    const uint8_t *frame = anim->data;
+    pmodoled_clear(oled);
+    spi_wait();
+    for (unsigned i=0; i<anim->frames; ++i) {
+        uint32_t start = rdcycle();
+        frame = anim_frame(oled, frame);
+        uint32_t queued = rdcycle();
+        spi_wait();
+        uint32_t sent = rdcycle();
+#ifdef HOST
+        pmodoled_host_frame();
+#endif
+        decode += queued - start;
+        total += sent - start;
+        if (sent - start > worst) {
+            worst = sent - start;
         }
-        uint8_t none = 0xff;
-        uint8_t all = 0x00;
-        for (int row=0; row<4; ++row) {
-            for (int x=0; x<DISP_W; ++x) {
-                uint8_t byte = 0;
-                for (int yi=0; yi<8; ++yi) {
-                    int y = row*8+yi;
-                    fp_t cx = basex + x * stepx;
-                    fp_t cy = basey + y * stepy;
-                    /* Z = 0 */
-                    fp_t zx = I(0);
-                    fp_t zy = I(0);
-                    int it;
-                    for (it=0; it<ITMAX; ++it) {
-                        fp_t zx2 = MUL(zx,zx);
-                        fp_t zy2 = MUL(zy,zy);
-                        /* |Z| <= 2 */
-                        if (zx2 + zy2 > I(4)) {
-                            break;
-                        }
-                        /* Z = Z^2 + C */
-                        fp_t twozxy = 2 * MUL(zx,zy);
-                        zx = zx2 - zy2 + cx;
-                        zy = twozxy + cy;
-                    }
-
-                    //int bit = it < itmax;
-                    int bit = it&1;
-                    byte |= (bit << yi);
-                }
-                spi(byte);
-                all |= byte;
-                none &= byte;
-            }
+    }
+    pmodoled_invalidate(oled);
+    uart_printf(UART_BLOCK, "anim %s: %u frames, %lu cycles/frame decode, %lu cycles/frame total, %lu max\r\n",
+            name, anim->frames, (unsigned long)(decode / anim->frames),
+            (unsigned long)(total / anim->frames), (unsigned long)worst);
+}
+#endif
+
+/** Define this to measure how many bitplanes per second the display path
+ * can show at startup
+ */
+//#define GRAY_BENCHMARK
+
+#ifdef GRAY_BENCHMARK
+/** Number of planes shown per benchmark */
+#define BENCH_PLANES 256
+
+/** Show planes back to back the way gray.c does, by uploading into the
+ * hidden half of display memory and moving the start line. Every upload
+ * differs in all bytes from what the half held, which is the worst case,
+ * with more than two planes. Report planes per second.
+ */
+static void gray_benchmark(void)
+{
+    pmodoled_clear(oled);
+    spi_wait();
+    uint32_t start = rdcycle();
+    for (unsigned i=0; i<BENCH_PLANES; ++i) {
+        unsigned half = i & 1;
+        uint8_t value = (i & 2) ? 0xaa : 0x55;
+        for (unsigned page=0; page<DISP_PAGES; ++page) {
+            pmodoled_fill(oled, half * DISP_PAGES + page, 0, value, DISP_W);
         }
-        if (all == 0x00 || none == 0xff) {
-            /* If screen empty or full, restart */
-            frame = 0;
-            continue;
+        pmodoled_flush(oled);
+        pmodoled_start_line(oled, half * DISP_H);
+    }
+    spi_wait();
+    uint32_t total = rdcycle() - start;
+    uart_printf(UART_BLOCK, "gray: %lu cycles/plane, %lu planes/s with full uploads\r\n",
+            (unsigned long)(total / BENCH_PLANES),
+            (unsigned long)((uint64_t)BENCH_PLANES * clock_cpu_freq() / total));
+}
+#endif
+
+#ifdef STATUS_PANEL
+/** Show text centered on the status module */
+static void show_status(const char *text)
+{
+    pmodoled_t *p = &panels[1];
+    const struct font *font = &font_8x16;
+    unsigned len = strlen(text);
+    unsigned x = (DISP_W - len * font->width) / 2;
+    unsigned top = (p->pages - font->pages) / 2;
+    for (unsigned page=0; page<p->pages; ++page) {
+        pmodoled_fill(p, page, 0, 0, DISP_W);
+    }
+    for (unsigned i=0; i<len; ++i, x+=font->width) {
+        const uint8_t *glyph = font_glyph(font, text[i]);
+        for (unsigned page=0; page<font->pages; ++page) {
+            pmodoled_write(p, top + page, x, glyph + page * font->width, font->width);
         }
-        frame += 1;
-        radiusx = (radiusx * (ZOOM_MUL-1))/ZOOM_MUL;
-        radiusy = (radiusy * (ZOOM_MUL-1))/ZOOM_MUL;
     }
+    pmodoled_flush(p);
 }
+#else
+static inline void show_status(const char *text)
+{
+    (void)text;
+}
+#endif
 
 int main(void)
 {
+    clock_init(CPU_FREQ);
     uart_init();
-    puts(startup_msg);
+    irq_init();
+    uart_irq_init();
+    uart_write(startup_msg, sizeof(startup_msg) - 1, UART_BLOCK);
 
     rgb_init();
 
-    pmodoled_init();
+    pmodoled_init(panels, ARRAY_SIZE(panels));
 
-    // Data mode is assumed the default throughout the program
-    mode_data();
+#ifdef SPI_BENCHMARK
+    spi_benchmark();
+#endif
+#ifdef FONT_BENCHMARK
+    font_benchmark("6x8", &font_6x8);
+    font_benchmark("8x16", &font_8x16);
+#endif
+#ifdef ANIM_BENCHMARK
+    anim_benchmark("zoom", &anim_zoom);
+#endif
+#ifdef GRAY_BENCHMARK
+    gray_benchmark();
+#endif
 
     while (1) {
         // Mode: mandelbrot
-        pmodoled_clear();
-        mandelbrot();
+        show_status("mandelbrot");
+        pmodoled_clear(oled);
+        mandelbrot(oled);
 
         // Mode: text test
-        pmodoled_clear();
+        show_status("terminal");
+        pmodoled_clear(oled);
         texttest();
+
+        // Mode: frame streaming
+        show_status("streaming");
+        pmodoled_clear(oled);
+        stream_frames(oled);
+
+        // Mode: animation
+        show_status("animation");
+        pmodoled_clear(oled);
+        anim_play(oled, &anim_zoom);
     }
 }
@@ -5,14 +5,21 @@
 #define H_SLEEP
 /* Yawn */
 
+#include "perf.h"
+#include "events.h"
+
+#ifdef HOST
+#define IDLE host_idle()
+#else
 #define IDLE asm volatile ("")
+#endif
 
-/* Sleep n 32768 Hz ticks */
-static void sleep_ticks(uint32_t n)
+/* Sleep n 32768 Hz ticks, with the core halted until the timer interrupt */
+static inline void sleep_ticks(uint32_t n)
 {
-    uint64_t now = get_timer_value();
-    while (get_timer_value() - now < n)
-        IDLE;
+    PERF_START(t);
+    event_sleep(n);
+    PERF_STOP(PERF_SLEEP, t);
 }
 
 #endif
@@ -0,0 +1,202 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#include "stream.h"
+
+#include <stdint.h>
+#include <string.h>
+#include "platform.h"
+
+#include "uart.h"
+#include "display.h"
+#include "events.h"
+
+#define FRAME_SIZE (DISP_PAGES*DISP_W)
+/** Bytes taken from the receive buffer at a time */
+#define CHUNK 64
+
+/** Frame on display, and frame being received.
+ * Deltas apply to the frame on display, so a packet that turns out to be bad
+ * leaves it intact.
+ */
+static uint8_t frames[2][DISP_PAGES][DISP_W];
+static unsigned front;
+
+/** Packet parser */
+static enum {
+    PS_SYNC,
+    PS_TYPE,
+    PS_LEN_LO,
+    PS_LEN_HI,
+    PS_TOKEN,   /* expecting token byte */
+    PS_RUN,     /* expecting byte to repeat */
+    PS_LITERAL, /* in literal bytes */
+    PS_CHECK
+} state;
+static uint8_t type;
+static unsigned len;      /* payload bytes left */
+static uint8_t sum;
+static unsigned pos;      /* position in frame */
+static unsigned count;    /* bytes left of token */
+static int bad;
+/** A packet was lost: deltas would apply to the wrong frame until the next
+ * whole frame */
+static int resync;
+static unsigned frames_good, frames_bad;
+
+static inline uint8_t *back_frame(void)
+{
+    return &frames[front ^ 1][0][0];
+}
+
+/** Store n copies (run) or one byte at the current position */
+static void put(uint8_t value, unsigned n)
+{
+    uint8_t *dst = back_frame();
+    if (n > FRAME_SIZE - pos) {
+        bad = 1;
+        return;
+    }
+    if (type == STREAM_DELTA) {
+        for (unsigned i=0; i<n; ++i) {
+            dst[pos + i] ^= value;
+        }
+    } else {
+        memset(&dst[pos], value, n);
+    }
+    pos += n;
+}
+
+static void stream_reply(char c)
+{
+    uart_write(&c, 1, UART_BLOCK);
+}
+
+/** Packet complete: show or reject it. Returns 1 to leave streaming mode. */
+static int packet_done(pmodoled_t *disp)
+{
+    if (sum != 0 || bad || (type != STREAM_DELTA && type != STREAM_END && pos != FRAME_SIZE)) {
+        frames_bad += 1;
+        resync = 1;
+        stream_reply(STREAM_NAK);
+        return 0;
+    }
+    if (type == STREAM_DELTA && resync) {
+        frames_bad += 1;
+        stream_reply(STREAM_NAK);
+        return 0;
+    }
+    stream_reply(STREAM_ACK);
+    if (type == STREAM_END) {
+        return 1;
+    }
+    if (type != STREAM_DELTA) {
+        resync = 0;
+    }
+    frames_good += 1;
+    front ^= 1;
+    pmodoled_present(disp, frames[front]);
+    return 0;
+}
+
+/** Start of payload */
+static void payload_start(void)
+{
+    pos = 0;
+    bad = 0;
+    if (type == STREAM_DELTA) {
+        memcpy(back_frame(), frames[front], FRAME_SIZE);
+    }
+    if (len == 0) {
+        state = PS_CHECK;
+    } else if (type == STREAM_FULL) {
+        count = len;
+        state = PS_LITERAL;
+    } else {
+        state = PS_TOKEN;
+    }
+}
+
+/** Process a received byte. Returns 1 to leave streaming mode. */
+static int stream_byte(pmodoled_t *disp, uint8_t b)
+{
+    switch (state) {
+    case PS_SYNC:
+        if (b == STREAM_MAGIC) {
+            state = PS_TYPE;
+        } else if (b == 27) {
+            return 1;
+        }
+        return 0;
+    case PS_TYPE:
+        type = b;
+        state = (type >= STREAM_FULL && type <= STREAM_END) ? PS_LEN_LO : PS_SYNC;
+        return 0;
+    case PS_LEN_LO:
+        len = b;
+        state = PS_LEN_HI;
+        return 0;
+    case PS_LEN_HI:
+        len |= b << 8;
+        sum = 0;
+        payload_start();
+        return 0;
+    case PS_CHECK:
+        sum += b;
+        state = PS_SYNC;
+        return packet_done(disp);
+    default:
+        break;
+    }
+    /* Payload byte */
+    sum += b;
+    len -= 1;
+    switch (state) {
+    case PS_TOKEN:
+        count = (b & 0x7f) + 1;
+        state = (b & 0x80) ? PS_RUN : PS_LITERAL;
+        break;
+    case PS_RUN:
+        put(b, count);
+        state = PS_TOKEN;
+        break;
+    default: /* PS_LITERAL */
+        put(b, 1);
+        if (--count == 0) {
+            state = PS_TOKEN;
+        }
+        break;
+    }
+    if (len == 0) {
+        if (state != PS_TOKEN && type != STREAM_FULL) {
+            bad = 1; /* token cut short */
+        }
+        state = PS_CHECK;
+    }
+    return 0;
+}
+
+void stream_frames(pmodoled_t *disp)
+{
+    char buf[CHUNK];
+    memset(frames, 0, sizeof(frames));
+    front = 0;
+    state = PS_SYNC;
+    resync = 0;
+    frames_good = frames_bad = 0;
+    uart_printf(UART_BLOCK, "Streaming mode: send frames, see stream.h\r\n");
+    while (1) {
+        size_t n = uart_read(buf, sizeof(buf));
+        if (n == 0) {
+            event_wait(EVENT_UART_RX);
+            continue;
+        }
+        for (size_t i=0; i<n; ++i) {
+            if (stream_byte(disp, buf[i])) {
+                uart_printf(UART_BLOCK, "\r\nStreaming mode: %u frames, %u bad, %u bytes dropped\r\n",
+                        frames_good, frames_bad, uart_rx_dropped());
+                return;
+            }
+        }
+    }
+}
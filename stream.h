@@ -0,0 +1,46 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#ifndef H_STREAM
+#define H_STREAM
+/* Frame streaming over the UART.
+ *
+ * Frames are DISP_PAGES*DISP_W bytes in display page layout: page 0 columns
+ * 0..127, then page 1, and so on, least significant bit at the top.
+ *
+ * Packet:
+ *   STREAM_MAGIC type len_lo len_hi payload[len] check
+ * where check makes the sum of the payload bytes and check 0 (mod 256).
+ *
+ * Types:
+ *   STREAM_FULL   payload is a whole frame
+ *   STREAM_RLE    payload is a run-length coded frame
+ *   STREAM_DELTA  payload is a run-length coded XOR with the previous frame.
+ *                 Bytes past the end of the payload are unchanged.
+ *   STREAM_END    no payload, leave streaming mode
+ *
+ * Run-length coding is a sequence of tokens. A token byte n with the high
+ * bit set is followed by one byte to repeat (n & 0x7f) + 1 times; otherwise
+ * it is followed by n + 1 literal bytes.
+ *
+ * Every good packet is answered with STREAM_ACK, a bad one with STREAM_NAK.
+ * After a STREAM_NAK, deltas are refused until the next whole frame.
+ * A frame is decoded while the previous one is still being sent to the
+ * display, so the host can send one packet ahead of the acknowledgements.
+ * An ESC byte outside a packet also leaves streaming mode.
+ */
+
+#include "display.h"
+
+#define STREAM_MAGIC 0xA5
+#define STREAM_FULL  0x01
+#define STREAM_RLE   0x02
+#define STREAM_DELTA 0x03
+#define STREAM_END   0x04
+#define STREAM_ACK   0x06
+#define STREAM_NAK   0x15
+
+/** Show frames received on the UART on disp until STREAM_END or ESC */
+void stream_frames(pmodoled_t *disp);
+
+#endif
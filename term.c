@@ -0,0 +1,429 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#include "term.h"
+
+#include <stdint.h>
+#include <string.h>
+#include "platform.h"
+
+#include "events.h"
+#include "display.h"
+
+#include "font.h"
+
+/**
+ * Define the following to scroll the text one scanline at a time instead of
+ * one text row at a time. The start line is moved by a timer, so this needs
+ * the event loop to run (see events.h).
+ */
+//#define SMOOTH_SCROLL
+/** Interval between scanlines when scrolling smoothly, in 32768 Hz ticks */
+#define SCROLL_TICKS 100
+
+/** Grid size limits, for the smallest cell size used */
+#define MAX_COLS (DISP_W/6)
+#define MAX_ROWS DISP_PAGES
+/** Maximum number of parameters of an escape sequence */
+#define MAX_PARAMS 4
+
+/** Cell attributes */
+#define ATTR_INVERSE 0x01
+/** Cell is under the visible cursor, only in shown */
+#define ATTR_CURSOR  0x02
+
+struct cell {
+    uint16_t ch;
+    uint8_t attr;
+};
+
+/** Display, font and resulting grid size */
+static pmodoled_t *disp;
+static const struct font *font;
+static unsigned cols, rows;
+/** Cell contents as they should be */
+static struct cell cells[MAX_ROWS][MAX_COLS];
+/** Cell contents as they are in the framebuffer */
+static struct cell shown[MAX_ROWS][MAX_COLS];
+
+/** Cursor. col can be cols, in which case the next character wraps. */
+static unsigned col, row;
+/** Attributes for new characters */
+static uint8_t cur_attr;
+/** Cursor is shown */
+static int cursor_visible;
+/** Display memory page at top of screen.
+ * Display memory is used as a ring of text rows, of which rows are
+ * visible. Scrolling clears the row that comes into view and
+ * moves the display start line, so that the visible rows don't have to be
+ * sent again.
+ */
+static unsigned top;
+
+#ifdef SMOOTH_SCROLL
+/** Start line shown while scrolling smoothly. The timer moves it one
+ * scanline at a time until it reaches top.
+ */
+static unsigned scroll_line;
+static struct timer scroll_timer;
+#endif
+
+/** Escape sequence parser */
+static enum {
+    ST_NORMAL,
+    ST_ESC,  /* after ESC */
+    ST_ESC_INTER, /* after ESC and an intermediate byte, as in ESC ( B */
+    ST_CSI   /* after ESC [ */
+} state;
+static unsigned params[MAX_PARAMS];
+static unsigned nparams;
+/** Sequence has private or intermediate bytes, as in ESC [ ? 25 l, and is
+ * consumed without effect */
+static int csi_private;
+/** Previous byte was \r */
+static int after_cr;
+/** UTF-8 decoder: code point so far, and number of continuation bytes to go */
+static unsigned utf8_cp, utf8_need;
+
+/** Display memory page of page p of screen row r */
+static inline unsigned row_page(unsigned r, unsigned p)
+{
+    return (top + r * font->pages + p) % GDDRAM_PAGES;
+}
+
+static inline int cell_equal(struct cell a, struct cell b)
+{
+    return a.ch == b.ch && a.attr == b.attr;
+}
+
+/** Erase cells [from, to) of row */
+static void erase(unsigned r, unsigned from, unsigned to)
+{
+    for (unsigned c=from; c<to; ++c) {
+        cells[r][c].ch = ' ';
+        cells[r][c].attr = 0;
+    }
+}
+
+#ifdef SMOOTH_SCROLL
+static void scroll_step(void)
+{
+    scroll_line = (scroll_line + 1) % GDDRAM_LINES;
+    pmodoled_start_line(disp, scroll_line);
+    if (scroll_line == top*8) {
+        timer_stop(&scroll_timer);
+    }
+}
+#endif
+
+/** Scroll up by one text row */
+static void scroll(void)
+{
+#ifdef SMOOTH_SCROLL
+    /* Finish a scroll that is still going at once, so that the row cleared
+     * below is out of view
+     */
+    if (scroll_timer.active) {
+        timer_stop(&scroll_timer);
+        scroll_line = top*8;
+        pmodoled_start_line(disp, scroll_line);
+    }
+#endif
+    /* Bring the display up to date, so that only the new row has to be
+     * drawn after the start line moves.
+     */
+    term_update();
+    memmove(cells[0], cells[1], sizeof(cells[0]) * (rows - 1));
+    memmove(shown[0], shown[1], sizeof(shown[0]) * (rows - 1));
+    erase(rows - 1, 0, cols);
+    for (unsigned p=0; p<font->pages; ++p) {
+        pmodoled_fill(disp, row_page(rows, p), 0, 0, DISP_W);
+    }
+    for (unsigned c=0; c<cols; ++c) {
+        shown[rows-1][c] = cells[rows-1][c];
+    }
+    pmodoled_flush(disp);
+    top = (top + font->pages) % GDDRAM_PAGES;
+#ifdef SMOOTH_SCROLL
+    timer_start(&scroll_timer, SCROLL_TICKS, SCROLL_TICKS, scroll_step);
+#else
+    pmodoled_start_line(disp, top*8);
+#endif
+}
+
+/** Move cursor down one row, scrolling at the bottom */
+static void linefeed(void)
+{
+    if (row < rows - 1) {
+        row += 1;
+    } else {
+        scroll();
+    }
+}
+
+/** Put a printable character at the cursor */
+static void put_char(unsigned ch)
+{
+    if (col >= cols) {
+        col = 0;
+        linefeed();
+    }
+    cells[row][col].ch = ch <= 0xffff ? ch : 0xfffd;
+    cells[row][col].attr = cur_attr;
+    col += 1;
+}
+
+/** Parameter i of escape sequence, or def if absent or zero */
+static unsigned param(unsigned i, unsigned def)
+{
+    return (i < nparams && params[i]) ? params[i] : def;
+}
+
+/** Execute escape sequence ESC [ ... final */
+static void csi(char final)
+{
+    switch (final) {
+    case 'H': case 'f': /* CUP */
+        row = param(0, 1) - 1;
+        col = param(1, 1) - 1;
+        if (row >= rows) {
+            row = rows - 1;
+        }
+        if (col >= cols) {
+            col = cols - 1;
+        }
+        break;
+    case 'K': { /* EL */
+        unsigned c = col < cols ? col : cols - 1;
+        switch (param(0, 0)) {
+        case 0: erase(row, c, cols); break;
+        case 1: erase(row, 0, c + 1); break;
+        case 2: erase(row, 0, cols); break;
+        }
+        } break;
+    case 'J': { /* ED */
+        unsigned c = col < cols ? col : cols - 1;
+        switch (param(0, 0)) {
+        case 0:
+            erase(row, c, cols);
+            for (unsigned r=row+1; r<rows; ++r) {
+                erase(r, 0, cols);
+            }
+            break;
+        case 1:
+            for (unsigned r=0; r<row; ++r) {
+                erase(r, 0, cols);
+            }
+            erase(row, 0, c + 1);
+            break;
+        case 2:
+            for (unsigned r=0; r<rows; ++r) {
+                erase(r, 0, cols);
+            }
+            break;
+        }
+        } break;
+    case 'm': /* SGR */
+        if (nparams == 0) {
+            cur_attr = 0;
+        }
+        for (unsigned i=0; i<nparams; ++i) {
+            switch (params[i]) {
+            case 0: cur_attr = 0; break;
+            case 7: cur_attr |= ATTR_INVERSE; break;
+            case 27: cur_attr &= ~ATTR_INVERSE; break;
+            }
+        }
+        break;
+    }
+}
+
+void term_init(pmodoled_t *d, const struct font *f)
+{
+    disp = d;
+    font = f;
+    cols = DISP_W / font->width;
+    rows = disp->pages / font->pages;
+    if (cols > MAX_COLS) {
+        cols = MAX_COLS;
+    }
+    if (rows > MAX_ROWS) {
+        rows = MAX_ROWS;
+    }
+    /* Scrolling draws the new row out of view */
+    if ((rows + 1) * font->pages > GDDRAM_PAGES) {
+        rows = GDDRAM_PAGES / font->pages - 1;
+    }
+    for (unsigned r=0; r<rows; ++r) {
+        erase(r, 0, cols);
+    }
+    /* A cleared display shows spaces without attributes */
+    memcpy(shown, cells, sizeof(shown));
+    col = row = top = 0;
+#ifdef SMOOTH_SCROLL
+    timer_stop(&scroll_timer);
+    scroll_line = 0;
+#endif
+    cur_attr = 0;
+    cursor_visible = 0;
+    state = ST_NORMAL;
+    after_cr = 0;
+    utf8_need = 0;
+}
+
+void term_putc(char c)
+{
+    uint8_t ch = c;
+    int cr = 0;
+    if (ch >= 0x80) {
+        /* UTF-8 sequence: lead byte 11xxxxxx, then continuation bytes
+         * 10xxxxxx. Malformed sequences are dropped.
+         */
+        if (ch < 0xc0) {
+            if (utf8_need) {
+                utf8_cp = (utf8_cp << 6) | (ch & 0x3f);
+                if (--utf8_need == 0) {
+                    put_char(utf8_cp);
+                }
+            }
+        } else if (ch < 0xe0) {
+            utf8_cp = ch & 0x1f;
+            utf8_need = 1;
+        } else if (ch < 0xf0) {
+            utf8_cp = ch & 0x0f;
+            utf8_need = 2;
+        } else {
+            utf8_cp = ch & 0x07;
+            utf8_need = 3;
+        }
+        state = ST_NORMAL;
+        after_cr = 0;
+        return;
+    }
+    utf8_need = 0;
+    switch (state) {
+    case ST_NORMAL:
+        if (ch == 27) {
+            state = ST_ESC;
+        } else if (ch == '\r') {
+            col = 0;
+            linefeed();
+            cr = 1;
+        } else if (ch == '\n') {
+            if (!after_cr) {
+                linefeed();
+            }
+        } else if (ch == '\b' || ch == 127) {
+            if (col > 0) {
+                col -= 1;
+                erase(row, col, col + 1);
+            }
+        } else if (ch >= ' ') {
+            put_char(ch);
+        }
+        break;
+    case ST_ESC:
+        if (ch == '[') {
+            state = ST_CSI;
+            nparams = 0;
+            params[0] = 0;
+            csi_private = 0;
+        } else if (ch >= 0x20 && ch < 0x30) {
+            state = ST_ESC_INTER;
+        } else if (ch != 27) {
+            state = ST_NORMAL;
+        }
+        break;
+    case ST_ESC_INTER:
+        /* Intermediate bytes up to the final byte */
+        if (ch == 27) {
+            state = ST_ESC;
+        } else if (ch >= 0x30) {
+            state = ST_NORMAL;
+        }
+        break;
+    case ST_CSI:
+        if (ch == 27) {
+            /* Cancels the sequence and starts a new one */
+            state = ST_ESC;
+        } else if (ch < 0x20 || ch == 127) {
+            /* Other controls are ignored inside a sequence */
+        } else if (ch >= '0' && ch <= '9') {
+            if (nparams == 0) {
+                nparams = 1;
+            }
+            if (nparams <= MAX_PARAMS) {
+                params[nparams-1] = params[nparams-1] * 10 + (ch - '0');
+            }
+        } else if (ch == ';') {
+            if (nparams == 0) {
+                nparams = 1;
+            }
+            if (++nparams <= MAX_PARAMS) {
+                params[nparams-1] = 0;
+            }
+        } else if (ch < 0x40) {
+            /* Private parameter or intermediate byte */
+            csi_private = 1;
+        } else {
+            if (nparams > MAX_PARAMS) {
+                nparams = MAX_PARAMS;
+            }
+            if (!csi_private) {
+                csi(ch);
+            }
+            state = ST_NORMAL;
+        }
+        break;
+    }
+    after_cr = cr;
+}
+
+/** Render cell as (r,c) to the framebuffer, one run of columns per page */
+static void draw_cell(unsigned r, unsigned c, struct cell cell)
+{
+    const uint8_t *glyph = font_lookup(font, cell.ch);
+    unsigned w = font->width;
+    int inverse = !(cell.attr & ATTR_INVERSE) != !(cell.attr & ATTR_CURSOR);
+    for (unsigned p=0; p<font->pages; ++p) {
+        if (inverse) {
+            uint8_t buf[DISP_W];
+            for (unsigned x=0; x<w; ++x) {
+                buf[x] = ~glyph[x];
+            }
+            pmodoled_write(disp, row_page(r, p), c * w, buf, w);
+        } else {
+            pmodoled_write(disp, row_page(r, p), c * w, glyph, w);
+        }
+        glyph += w;
+    }
+    shown[r][c] = cell;
+}
+
+void term_update(void)
+{
+    /* A cursor waiting to wrap is shown on the last column */
+    unsigned cursor_col = col < cols ? col : cols - 1;
+    for (unsigned r=0; r<rows; ++r) {
+        for (unsigned c=0; c<cols; ++c) {
+            struct cell cell = cells[r][c];
+            if (cursor_visible && r == row && c == cursor_col) {
+                cell.attr |= ATTR_CURSOR;
+            }
+            if (!cell_equal(cell, shown[r][c])) {
+                draw_cell(r, c, cell);
+            }
+        }
+    }
+    pmodoled_flush(disp);
+}
+
+void term_cursor(int visible)
+{
+    cursor_visible = visible;
+}
+
+int term_escape_pending(void)
+{
+    return state == ST_ESC;
+}
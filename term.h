@@ -0,0 +1,46 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#ifndef H_TERM
+#define H_TERM
+/* Text terminal.
+ *
+ * Characters are kept in a grid of cells. Output goes to the grid, and
+ * term_update() renders only the cells that changed since the last update
+ * to the framebuffer, then flushes it.
+ *
+ * Input is UTF-8. Characters that the font does not have are shown as its
+ * first glyph.
+ *
+ * Understood control characters and escape sequences (VT100 subset):
+ *   \r           carriage return and line feed
+ *   \n           line feed, ignored directly after \r
+ *   \b, 127      move back one cell and erase it
+ *   ESC [ r ; c H   (or f) cursor position, 1-based
+ *   ESC [ n K    erase in line: 0 to end, 1 from start, 2 whole line
+ *   ESC [ n J    erase in display: 0 to end, 1 from start, 2 everything
+ *   ESC [ n m    select graphic rendition: 0 normal, 7 inverse, 27 not inverse
+ * Other sequences, including private ones such as ESC [ ? 25 l and ones with
+ * intermediate bytes such as ESC ( B, are consumed up to their final byte and
+ * ignored. ESC inside a sequence starts a new one.
+ * Writing past the last row scrolls the screen up.
+ */
+#include "font.h"
+#include "display.h"
+/** Reset terminal state and set the display and font. Assumes the display
+ * has just been cleared. The grid is as many cells of the font as fit on the
+ * display.
+ */
+void term_init(pmodoled_t *disp, const struct font *font);
+/** Process one byte of output */
+void term_putc(char c);
+/** Render changed cells and send them to the display */
+void term_update(void);
+/** Show or hide the cursor, as an inverted cell. Takes effect on the next
+ * term_update().
+ */
+void term_cursor(int visible);
+/** Is the last byte an ESC that has not been followed by anything yet? */
+int term_escape_pending(void);
+
+#endif
@@ -0,0 +1,42 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#ifndef H_TEST
+#define H_TEST
+/* Minimal checks for the host tests run by `make check`.
+ *
+ * A failed check is reported with its location and the test carries on;
+ * main() returns test_result() so that the run fails if any check did.
+ */
+#include <stdio.h>
+
+static unsigned test_checks, test_failures;
+
+/** Check that cond holds */
+#define CHECK(cond) do { \
+        test_checks += 1; \
+        if (!(cond)) { \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            test_failures += 1; \
+        } \
+    } while (0)
+
+/** Check that two integer values are equal, and print both if not */
+#define CHECK_EQ(a, b) do { \
+        long long a_ = (long long)(a), b_ = (long long)(b); \
+        test_checks += 1; \
+        if (a_ != b_) { \
+            fprintf(stderr, "%s:%d: check failed: %s == %s (%lld != %lld)\n", \
+                    __FILE__, __LINE__, #a, #b, a_, b_); \
+            test_failures += 1; \
+        } \
+    } while (0)
+
+/** Print a summary for the test named name. Returns the exit status. */
+static inline int test_result(const char *name)
+{
+    printf("%s: %u checks, %u failed\n", name, test_checks, test_failures);
+    return test_failures != 0;
+}
+
+#endif
@@ -0,0 +1,112 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+/* Core clock and SPI divider settings, checked against the limits of the
+ * FE310 PLL and the SSD1306 for every core frequency that can be asked for,
+ * and the core clock clock_init() leaves the emulated PRCI running at.
+ */
+#include "clock.h"
+
+#include "platform.h"
+
+#include "test.h"
+
+/** Fastest SCK the SSD1306 takes, as in display.c */
+#define MAX_SPI_FREQ 10000000UL
+/** Largest value of the 12-bit SCKDIV field */
+#define SCKDIV_MAX 0xfff
+
+/** Highest PLL frequency not above freq, by trying every setting */
+static unsigned long pll_best(unsigned long freq)
+{
+    unsigned long best = 0;
+    for (unsigned r=0; r<4; ++r) {
+        for (unsigned f=0; f<64; ++f) {
+            for (unsigned q=1; q<4; ++q) {
+                for (int div=-1; div<64; ++div) {
+                    struct clock_pll pll = {0, r, f, q, div < 0, div < 0 ? 0 : div};
+                    unsigned long ref = CLOCK_XTAL_FREQ / (r + 1);
+                    unsigned long vco = ref * 2 * (f + 1);
+                    unsigned long out = clock_pll_freq(&pll);
+                    if (ref >= 6000000 && ref <= 12000000 && vco >= 384000000 && vco <= 768000000 &&
+                            out <= freq && out > best) {
+                        best = out;
+                    }
+                }
+            }
+        }
+    }
+    return best;
+}
+
+static void check_pll(unsigned long freq)
+{
+    struct clock_pll pll;
+    unsigned long got = clock_pll_solve(freq, &pll);
+    CHECK_EQ(clock_pll_freq(&pll), got);
+    if (pll.bypass) {
+        CHECK_EQ(got, CLOCK_XTAL_FREQ);
+        /* Only at the crystal, or when no PLL setting is low enough */
+        CHECK(pll_best(freq) <= CLOCK_XTAL_FREQ);
+    } else {
+        unsigned long ref = CLOCK_XTAL_FREQ / (pll.r + 1);
+        unsigned long vco = ref * 2 * (pll.f + 1);
+        CHECK(ref >= 6000000 && ref <= 12000000);
+        CHECK(vco >= 384000000 && vco <= 768000000);
+        CHECK(pll.q >= 1 && pll.q <= 3);
+        CHECK(pll.f < 64 && pll.div < 64);
+        CHECK(got <= freq && got <= CLOCK_MAX_FREQ);
+        CHECK_EQ(got, pll_best(freq < CLOCK_MAX_FREQ ? freq : CLOCK_MAX_FREQ));
+    }
+}
+
+static void check_spi(unsigned long fin)
+{
+    unsigned div = clock_spi_div(fin, MAX_SPI_FREQ);
+    CHECK(div <= SCKDIV_MAX);
+    CHECK(fin / (2 * (div + 1)) <= MAX_SPI_FREQ);
+    /* and no faster divider would do */
+    CHECK(div == 0 || (fin + 2 * div - 1) / (2 * div) > MAX_SPI_FREQ);
+}
+
+/** Configure the emulated PRCI for freq, starting from a final divider left
+ * set by an earlier configuration, and check the core clock that results
+ */
+static void check_init(unsigned long freq)
+{
+    PRCI_REG(PRCI_PLLDIV) = PLL_FINAL_DIV_BY_1(0) | PLL_FINAL_DIV(3);
+    unsigned long got = clock_init(freq);
+    CHECK_EQ(get_cpu_freq(), got);
+    CHECK_EQ(clock_cpu_freq(), got);
+}
+
+int main(void)
+{
+    static const unsigned long freqs[] = {
+        1, 375000, 1000000, 13800000, 15999999, 16000000, 16000001,
+        32000000, 48000000, 64000000, 100000000, 128000000, 200000000,
+        256000000, 319999999, 320000000, 384000000, 1000000000,
+    };
+    for (unsigned i=0; i<sizeof(freqs)/sizeof(freqs[0]); ++i) {
+        check_pll(freqs[i]);
+    }
+    /* Every MHz up to the maximum */
+    for (unsigned long freq=1000000; freq<=CLOCK_MAX_FREQ; freq+=1000000) {
+        check_pll(freq);
+    }
+    /* SPI divider at every frequency the PLL can produce */
+    for (unsigned long freq=250000; freq<=CLOCK_MAX_FREQ; freq+=250000) {
+        struct clock_pll pll;
+        check_spi(clock_pll_solve(freq, &pll));
+    }
+    check_spi(13800000); /* internal oscillator */
+    CHECK_EQ(clock_spi_div(16000000, MAX_SPI_FREQ), 0);
+    CHECK_EQ(clock_spi_div(320000000, MAX_SPI_FREQ), 15);
+    /* Through the emulated PRCI: the bypass at the crystal, and the PLL */
+    host_quiet();
+    check_init(CLOCK_XTAL_FREQ);
+    CHECK_EQ(get_cpu_freq(), CLOCK_XTAL_FREQ);
+    check_init(256000000);
+    CHECK_EQ(get_cpu_freq(), 256000000);
+    return test_result("clock");
+}
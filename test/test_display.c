@@ -0,0 +1,182 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+/* Framebuffer flush: the bytes and D/C levels that reach the display for
+ * given changes, and display memory matching the framebuffer afterwards.
+ */
+#include "display.h"
+
+#include <string.h>
+#include "platform.h"
+
+#include "irq.h"
+#include "cycles.h"
+#include "sleep.h"
+#include "test.h"
+
+/** Bytes seen on the display bus */
+#define TRACE_MAX 4096
+static struct {
+    unsigned panels;
+    int dc;
+    uint8_t b;
+} trace[TRACE_MAX];
+static unsigned trace_len;
+
+/** Bytes expected, as D/C level and value */
+static struct {
+    int dc;
+    uint8_t b;
+} expect[TRACE_MAX];
+static unsigned expect_len;
+
+static pmodoled_t panels[] = {
+    PMODOLED_128X32(23, 0, 1, 4),
+};
+static pmodoled_t *const p = &panels[0];
+
+static void record(unsigned panels, int dc, uint8_t b)
+{
+    if (trace_len < TRACE_MAX) {
+        trace[trace_len].panels = panels;
+        trace[trace_len].dc = dc;
+        trace[trace_len].b = b;
+    }
+    trace_len += 1;
+}
+
+static void expect_byte(int dc, uint8_t b)
+{
+    expect[expect_len].dc = dc;
+    expect[expect_len].b = b;
+    expect_len += 1;
+}
+
+/** Expect an address window of columns [lo, end) of pages first to last
+ * with the framebuffer contents
+ */
+static void expect_window(unsigned first, unsigned last, unsigned lo, unsigned end)
+{
+    const uint8_t cmd[] = {0x21, lo, end - 1, 0x22, first, last};
+    for (unsigned i=0; i<sizeof(cmd); ++i) {
+        expect_byte(0, cmd[i]);
+    }
+    for (unsigned page=first; page<=last; ++page) {
+        for (unsigned x=lo; x<end; ++x) {
+            expect_byte(1, p->fb[page][x]);
+        }
+    }
+}
+
+/** Wait until everything queued has been shifted out. spi_wait() returns
+ * when the FIFO is empty, with the last byte possibly still in the shifter.
+ */
+static void drain(void)
+{
+    spi_wait();
+    uint32_t start = rdcycle();
+    while (rdcycle() - start < 1000)
+        IDLE;
+}
+
+/** Compare the bytes sent with the expected ones */
+static void check_sent(const char *what)
+{
+    int same = trace_len == expect_len;
+    for (unsigned i=0; same && i<trace_len; ++i) {
+        same = trace[i].panels == 1 && trace[i].dc == expect[i].dc && trace[i].b == expect[i].b;
+    }
+    if (!same) {
+        fprintf(stderr, "%s: %u bytes sent, %u expected\n", what, trace_len, expect_len);
+    }
+    CHECK(same);
+    /* The display shows what the framebuffer holds */
+    CHECK(memcmp(host_gddram(0), p->fb, sizeof(p->fb)) == 0);
+    expect_len = 0;
+    trace_len = 0;
+}
+
+/** Flush, wait until sent, and compare with the expected bytes */
+static void flush_check(const char *what)
+{
+    pmodoled_flush(p);
+    drain();
+    check_sent(what);
+}
+
+int main(void)
+{
+    uint8_t data[DISP_W];
+    static uint8_t frame[DISP_PAGES][DISP_W];
+
+    host_quiet();
+    irq_init();
+    pmodoled_init(panels, 1);
+    drain();
+    host_bus_trace(record);
+
+    /* Nothing changed, nothing sent */
+    flush_check("clean");
+
+    /* One span */
+    for (unsigned x=0; x<DISP_W; ++x) {
+        data[x] = x * 7 + 1;
+    }
+    pmodoled_write(p, 1, 10, data, 10);
+    expect_window(1, 1, 10, 20);
+    flush_check("span");
+
+    /* Writing the same data again changes nothing */
+    pmodoled_write(p, 1, 10, data, 10);
+    flush_check("unchanged");
+
+    /* Only the changed bytes of a write make up the span */
+    data[3] ^= 0xff;
+    data[6] ^= 0xff;
+    pmodoled_write(p, 1, 10, data, 10);
+    expect_window(1, 1, 13, 17);
+    flush_check("partial");
+
+    /* Far apart on different pages: a window each */
+    pmodoled_fill(p, 0, 0, 0x55, 1);
+    pmodoled_fill(p, 3, 127, 0xaa, 1);
+    expect_window(0, 0, 0, 1);
+    expect_window(3, 3, 127, 128);
+    flush_check("separate");
+
+    /* Overlapping spans on neighbouring pages: one window over both */
+    pmodoled_fill(p, 1, 5, 0x11, 16);
+    pmodoled_fill(p, 2, 8, 0x22, 18);
+    expect_window(1, 2, 5, 26);
+    flush_check("merged");
+
+    /* A full frame is a single window */
+    for (unsigned page=0; page<DISP_PAGES; ++page) {
+        for (unsigned x=0; x<DISP_W; ++x) {
+            frame[page][x] = ~p->fb[page][x];
+        }
+    }
+    pmodoled_present(p, frame);
+    drain();
+    expect_window(0, DISP_PAGES - 1, 0, DISP_W);
+    check_sent("present");
+    CHECK(memcmp(p->fb, frame, sizeof(frame)) == 0);
+
+    /* Pages outside the visible ones are flushed too */
+    pmodoled_fill(p, GDDRAM_PAGES - 1, 64, 0xff, 64);
+    expect_window(GDDRAM_PAGES - 1, GDDRAM_PAGES - 1, 64, 128);
+    flush_check("hidden page");
+
+    /* Clearing sends only what is not already clear */
+    pmodoled_fill(p, 0, 0, 0, DISP_W);
+    pmodoled_fill(p, 1, 0, 0, DISP_W);
+    pmodoled_fill(p, 2, 0, 0, DISP_W);
+    pmodoled_fill(p, 3, 0, 0, DISP_W);
+    expect_window(0, 3, 0, DISP_W);
+    pmodoled_fill(p, GDDRAM_PAGES - 1, 0, 0, DISP_W);
+    expect_window(GDDRAM_PAGES - 1, GDDRAM_PAGES - 1, 64, 128);
+    flush_check("clear");
+
+    CHECK_EQ(host_timing(), 0);
+    return test_result("display");
+}
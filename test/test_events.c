@@ -0,0 +1,308 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+/* Timers and events against a mocked machine timer: the order timers run
+ * in, stopping and restarting them, periodic reloads, and the deadlines the
+ * timer interrupt is programmed with before every wfi.
+ */
+#include "events.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+
+/********* Mocked mtime, mtimecmp and wfi **********/
+
+static uint64_t now = 1000;
+static int irq_on = 1;
+/** Request made through irq_timer() */
+static int armed;
+static uint64_t armed_when;
+static irq_handler_t armed_handler;
+/** Deadlines passed to irq_timer(), in order */
+static uint64_t deadlines[16];
+static unsigned ndeadlines;
+/** Number of irq_wait() calls */
+static unsigned waits;
+/** Interrupt other than the timer that posts post_events at post_at, if not 0 */
+static uint64_t post_at;
+static unsigned post_events;
+
+uint64_t get_timer_value(void)
+{
+    return now;
+}
+
+void irq_timer(uint64_t when, irq_handler_t handler)
+{
+    CHECK(!irq_on);
+    armed = 1;
+    armed_when = when;
+    armed_handler = handler;
+    if (ndeadlines < 16) {
+        deadlines[ndeadlines] = when;
+    }
+    ndeadlines += 1;
+}
+
+void irq_disable(void)
+{
+    irq_on = 0;
+}
+
+void irq_enable(void)
+{
+    irq_on = 1;
+}
+
+/** Skip ahead to the first interrupt and take it */
+void irq_wait(void)
+{
+    CHECK(!irq_on);
+    waits += 1;
+    if (post_at && (!armed || post_at <= armed_when)) {
+        if (now < post_at) {
+            now = post_at;
+        }
+        post_at = 0;
+        event_post(post_events);
+        return;
+    }
+    if (!armed) {
+        fprintf(stderr, "wfi with nothing to wake up\n");
+        exit(1);
+    }
+    if (now < armed_when) {
+        now = armed_when;
+    }
+    armed = 0;
+    armed_handler();
+}
+
+/********* Callbacks **********/
+
+/** Callbacks that ran, as letters, and when */
+static char ran[64];
+static uint64_t ran_at[64];
+static unsigned nran;
+
+static void log_run(char id)
+{
+    if (nran < sizeof(ran) - 1) {
+        ran[nran] = id;
+        ran_at[nran] = now;
+    }
+    nran += 1;
+}
+
+static void fn_a(void) { log_run('a'); }
+static void fn_b(void) { log_run('b'); }
+static void fn_c(void) { log_run('c'); }
+static void fn_d(void) { log_run('d'); }
+static void fn_e(void) { log_run('e'); }
+
+static struct timer ta, tb, tc, td, te;
+
+static void reset_log(void)
+{
+    memset(ran, 0, sizeof(ran));
+    nran = 0;
+    ndeadlines = 0;
+    waits = 0;
+}
+
+/** Number of running timers, checking that the list is sorted */
+static unsigned list_length(void)
+{
+    unsigned n = 0;
+    for (struct timer *t = timers; t; t = t->next) {
+        CHECK(t->active);
+        CHECK(!t->next || t->when <= t->next->when);
+        n += 1;
+    }
+    return n;
+}
+
+/** Run timers until n callbacks have run */
+static void run(unsigned n)
+{
+    while (nran < n) {
+        CHECK_EQ(event_wait(EVENT_TIMER), EVENT_TIMER);
+    }
+}
+
+/********* Tests **********/
+
+/** Timers run by expiry, those with equal expiry in the order they were
+ * started, and the timer interrupt is set for the earliest one each time
+ */
+static void check_order(void)
+{
+    reset_log();
+    uint64_t start = now;
+    timer_start(&ta, 30, 0, fn_a);
+    timer_start(&tb, 10, 0, fn_b);
+    timer_start(&tc, 20, 0, fn_c);
+    timer_start(&td, 10, 0, fn_d);
+    timer_start(&te, 0, 0, fn_e);
+    CHECK_EQ(list_length(), 5);
+    run(5);
+    CHECK(strcmp(ran, "ebdca") == 0);
+    static const uint64_t at[] = {0, 10, 10, 20, 30};
+    for (unsigned i=0; i<5; ++i) {
+        CHECK_EQ(ran_at[i], start + at[i]);
+    }
+    /* e was due at once, b and d woke up together */
+    CHECK_EQ(waits, 3);
+    CHECK_EQ(ndeadlines, 3);
+    CHECK_EQ(deadlines[0], start + 10);
+    CHECK_EQ(deadlines[1], start + 20);
+    CHECK_EQ(deadlines[2], start + 30);
+    CHECK_EQ(list_length(), 0);
+    CHECK(!ta.active && !te.active);
+}
+
+/** Stopping takes a timer out, starting a running timer moves it */
+static void check_restart(void)
+{
+    reset_log();
+    uint64_t start = now;
+    timer_start(&ta, 10, 0, fn_a);
+    timer_start(&tb, 20, 0, fn_b);
+    timer_start(&tc, 30, 0, fn_c);
+    timer_stop(&ta);
+    timer_stop(&ta);
+    CHECK(!ta.active);
+    CHECK_EQ(list_length(), 2);
+    /* Restart c ahead of b, then b behind c again */
+    timer_start(&tc, 5, 0, fn_c);
+    CHECK_EQ(list_length(), 2);
+    CHECK(timers == &tc);
+    timer_start(&tb, 5, 0, fn_b);
+    CHECK_EQ(list_length(), 2);
+    CHECK(timers == &tc && tc.next == &tb);
+    run(2);
+    CHECK(strcmp(ran, "cb") == 0);
+    CHECK_EQ(ran_at[0], start + 5);
+    CHECK_EQ(ran_at[1], start + 5);
+    CHECK_EQ(ndeadlines, 1);
+    CHECK_EQ(deadlines[0], start + 5);
+    /* A stopped timer can be started again */
+    timer_start(&ta, 7, 0, fn_a);
+    run(3);
+    CHECK(strcmp(ran, "cba") == 0);
+    CHECK_EQ(ran_at[2], start + 12);
+    CHECK_EQ(list_length(), 0);
+}
+
+static unsigned p_count;
+
+static void fn_p(void)
+{
+    log_run('p');
+    if (++p_count == 5) {
+        timer_stop(&tc);
+    }
+}
+
+/** Periodic timers keep their phase unless they fall more than a period
+ * behind, and can stop themselves from their callback
+ */
+static void check_periodic(void)
+{
+    reset_log();
+    uint64_t start = now;
+    timer_start(&tc, 10, 100, fn_p);
+    run(2);
+    CHECK_EQ(ran_at[0], start + 10);
+    CHECK_EQ(ran_at[1], start + 110);
+    CHECK(tc.active);
+    CHECK_EQ(tc.when, start + 210);
+    /* Late by less than a period: the next one is on the old phase */
+    now = start + 250;
+    run(3);
+    CHECK_EQ(ran_at[2], start + 250);
+    CHECK_EQ(tc.when, start + 310);
+    /* Late by more than a period: a period from now */
+    now = start + 555;
+    run(4);
+    CHECK_EQ(ran_at[3], start + 555);
+    CHECK_EQ(tc.when, start + 655);
+    run(5);
+    CHECK_EQ(ran_at[4], start + 655);
+    CHECK(!tc.active);
+    CHECK_EQ(list_length(), 0);
+    CHECK(strcmp(ran, "ppppp") == 0);
+}
+
+static void fn_start_a(void)
+{
+    log_run('s');
+    timer_start(&ta, 5, 0, fn_a);
+}
+
+/** The timer interrupt follows the list: an earlier timer started from a
+ * callback, an event that wakes up first, and event_sleep(), which does not
+ * run timers
+ */
+static void check_deadlines(void)
+{
+    reset_log();
+    uint64_t start = now;
+    timer_start(&tb, 50, 0, fn_b);
+    timer_start(&td, 10, 0, fn_start_a);
+    run(3);
+    CHECK(strcmp(ran, "sab") == 0);
+    CHECK_EQ(ran_at[1], start + 15);
+    CHECK_EQ(ndeadlines, 3);
+    CHECK_EQ(deadlines[0], start + 10);
+    CHECK_EQ(deadlines[1], start + 15);
+    CHECK_EQ(deadlines[2], start + 50);
+
+    /* Received bytes wake up before the timer, which stays programmed */
+    reset_log();
+    start = now;
+    timer_start(&tb, 40, 0, fn_b);
+    post_at = start + 8;
+    post_events = EVENT_UART_RX;
+    CHECK_EQ(event_wait(EVENT_UART_RX | EVENT_TIMER), EVENT_UART_RX);
+    CHECK_EQ(now, start + 8);
+    CHECK_EQ(nran, 0);
+    CHECK(tb.active);
+    CHECK_EQ(event_wait(EVENT_UART_RX | EVENT_TIMER), EVENT_TIMER);
+    CHECK_EQ(ran_at[0], start + 40);
+    CHECK_EQ(ndeadlines, 2);
+    CHECK_EQ(deadlines[0], start + 40);
+    CHECK_EQ(deadlines[1], start + 40);
+
+    /* A pending event returns at once */
+    reset_log();
+    event_post(EVENT_SPI_IDLE);
+    CHECK_EQ(event_wait(EVENT_SPI_IDLE), EVENT_SPI_IDLE);
+    CHECK_EQ(waits, 0);
+
+    /* event_sleep() sleeps through timers and leaves them to event_wait() */
+    reset_log();
+    start = now;
+    timer_start(&tb, 10, 0, fn_b);
+    event_sleep(50);
+    CHECK_EQ(now, start + 50);
+    CHECK_EQ(nran, 0);
+    CHECK_EQ(ndeadlines, 1);
+    CHECK_EQ(deadlines[0], start + 50);
+    run(1);
+    CHECK_EQ(ran_at[0], start + 50);
+    CHECK_EQ(waits, 1);
+}
+
+int main(void)
+{
+    check_order();
+    check_restart();
+    check_periodic();
+    check_deadlines();
+    CHECK(irq_on);
+    return test_result("events");
+}
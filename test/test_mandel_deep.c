@@ -0,0 +1,135 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+/* Perturbation against iterating every pixel in multi-word precision, at
+ * the depths where the demo uses it, with the reference chosen as in the
+ * demo and with a reference that escapes early, which sends pixels through
+ * the full precision fallback.
+ */
+#include "mandel.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "test.h"
+
+/** Steps of shift between frames compared */
+#define SHIFT_STEP 2
+/** Centers picked at random, after the seeds */
+#define RANDOM_CENTERS 4
+/** Frames in which the reference is replaced by one that escapes early */
+#define EARLY_INTERVAL 4
+/** Largest share of pixels, in parts per million, and largest difference
+ * allowed between perturbation and full precision */
+#define DIFFER_PPM 200
+#define DIFFER_MAX 4
+
+struct stats {
+    unsigned long frames, pixels, differ, off_by_more;
+    /** Pixels that must have taken the full precision path, and how many
+     * of those differ */
+    unsigned long fallback, fallback_differ;
+    int worst;
+};
+static struct stats normal, early;
+
+/** Pixel in multi-word precision, as pixel_mp() */
+static int exact_pixel(int x, int y)
+{
+    mp_t cx, cy;
+    mp_from_fixed(&cx, x * view.stepx, PREC, view.shift);
+    mp_add(&cx, &cx, &view.mp_basex);
+    mp_from_fixed(&cy, y * view.stepy, PREC, view.shift);
+    mp_add(&cy, &cy, &view.mp_basey);
+    return kernel_mp(cx, cy, view.itmax);
+}
+
+static void compare(struct stats *st)
+{
+    st->frames += 1;
+    for (int y=0; y<DISP_H; ++y) {
+        for (int x=0; x<DISP_W; ++x) {
+            int a = deep_pixel(x, y);
+            int b = exact_pixel(x, y);
+            int d = abs(a - b);
+            st->pixels += 1;
+            if (b > ref_len) {
+                st->fallback += 1;
+                st->fallback_differ += d != 0;
+            }
+            st->differ += d != 0;
+            st->off_by_more += d > 1;
+            if (d > st->worst) {
+                st->worst = d;
+            }
+        }
+    }
+}
+
+/** Replace the reference by the pixel on a coarse grid that escapes first */
+static void early_reference(void)
+{
+    int best = view.itmax + 1;
+    for (int y=0; y<DISP_H; y+=4) {
+        for (int x=0; x<DISP_W; x+=4) {
+            int it = exact_pixel(x, y);
+            if (it < best) {
+                best = it;
+                ref_offx = x * view.stepx;
+                ref_offy = y * view.stepy;
+            }
+        }
+    }
+    mp_t t;
+    mp_from_fixed(&t, ref_offx - view.radiusx, PREC, view.shift);
+    mp_add(&ref_cx, &view.centerx, &t);
+    mp_from_fixed(&t, ref_offy - view.radiusy, PREC, view.shift);
+    mp_add(&ref_cy, &view.centery, &t);
+    ref_len = ref_orbit(&ref_cx, &ref_cy);
+}
+
+static void zoom(fp_t centerx, fp_t centery)
+{
+    mp_from_fixed(&view.centerx, centerx, PREC, 0);
+    mp_from_fixed(&view.centery, centery, PREC, 0);
+    for (view.shift=Q57_SHIFT_LIMIT; view.shift<SHIFT_LIMIT; view.shift+=SHIFT_STEP) {
+        view.radiusy = I(3) / 2;
+        view.radiusx = 3 * view.radiusy;
+        view_setup();
+        compare(&normal);
+        if (view.shift % EARLY_INTERVAL == 0) {
+            early_reference();
+            compare(&early);
+        }
+    }
+}
+
+static void report(const char *name, const struct stats *st)
+{
+    printf("mandel_deep: %s reference: %lu frames, %lu of %lu pixels differ, %lu by more than 1, worst %d; "
+            "%lu pixels past the reference, %lu of them differ\n",
+            name, st->frames, st->differ, st->pixels, st->off_by_more, st->worst,
+            st->fallback, st->fallback_differ);
+    CHECK(st->differ * 1000000 <= st->pixels * DIFFER_PPM);
+    CHECK(st->worst <= DIFFER_MAX);
+    /* The fallback is exact */
+    CHECK_EQ(st->fallback_differ, 0);
+}
+
+int main(void)
+{
+    host_quiet();
+    for (unsigned i=0; i<ARRAY_SIZE(seeds); ++i) {
+        zoom(seeds[i].x, seeds[i].y);
+    }
+    srand48(1);
+    for (unsigned i=0; i<RANDOM_CENTERS; ++i) {
+        fp_t x, y;
+        pick_center(&x, &y);
+        zoom(x, y);
+    }
+    report("demo", &normal);
+    report("early escaping", &early);
+    CHECK(early.fallback > early.pixels / 10);
+    return test_result("mandel_deep");
+}
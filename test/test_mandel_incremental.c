@@ -0,0 +1,130 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+/* Incremental zoom against computing every pixel, frame by frame as the demo
+ * zooms into the seed points and into centers picked as in the demo. Frames
+ * taken over from the previous one may differ a little, but must be exactly
+ * what reprojecting a copy of the previous frame gives; exact frames, and
+ * frames where the iteration limit changes, must not differ at all.
+ */
+#include "mandel.c"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "test.h"
+
+#ifndef MANDEL_INCREMENTAL
+#error "MANDEL_INCREMENTAL is not defined"
+#endif
+
+/** Frames per zoom, taking it from the whole set down to about shift 7 */
+#define FRAMES 1200
+/** Centers picked at random, after the seeds */
+#define RANDOM_CENTERS 8
+/** Largest fraction of pixels that may differ, in parts per million */
+#define MAX_DIFFER_PPM 500
+/** Largest fraction of pixels that may differ in any one frame, in percent */
+#define MAX_FRAME_DIFFER_PCT 2
+
+static uint8_t exact[DISP_H][DISP_W], prev[DISP_H][DISP_W];
+static unsigned long frames, frames_exact, pixels, pixels_differ, pixels_computed;
+static unsigned worst_frame;
+
+/** An incremental frame is what taking over from a copy of the previous
+ * frame gives: updating in place must not read pixels already replaced
+ */
+static void check_in_place(void)
+{
+    unsigned mismatch = 0, computed = 0;
+    for (int y=0; y<DISP_H; ++y) {
+        int v = zoom_src(y, DISP_H);
+        int y0 = v / ZOOM_MUL;
+        int y1 = y0 + (v % ZOOM_MUL != 0);
+        for (int x=0; x<DISP_W; ++x) {
+            int u = zoom_src(x, DISP_W);
+            int x0 = u / ZOOM_MUL;
+            int x1 = x0 + (u % ZOOM_MUL != 0);
+            int it = prev[y0][x0];
+            if (prev[y0][x1] != it || prev[y1][x0] != it || prev[y1][x1] != it) {
+                it = exact[y][x];
+                computed += 1;
+            }
+            mismatch += iters[y][x] != it;
+        }
+    }
+    CHECK_EQ(mismatch, 0);
+    CHECK_EQ(pixels_iterated, computed);
+}
+
+/** Zoom into center the way mandelbrot() does, rendering every frame both
+ * incrementally and exactly. Stops at the first frame the demo would discard.
+ */
+static void zoom(fp_t centerx, fp_t centery)
+{
+    mp_from_fixed(&view.centerx, centerx, PREC, 0);
+    mp_from_fixed(&view.centery, centery, PREC, 0);
+    view.radiusx = I(3);
+    view.radiusy = I(1);
+    view.shift = 0;
+    int itmax = 0;
+    for (int n=0; n<FRAMES; ++n) {
+        view_setup();
+        for (int y=0; y<DISP_H; ++y) {
+            for (int x=0; x<DISP_W; ++x) {
+                exact[y][x] = pixel_it(x, y);
+            }
+        }
+        memcpy(prev, iters, sizeof(prev));
+        int valid = render_zoom(back, n);
+        unsigned differ = 0;
+        for (int y=0; y<DISP_H; ++y) {
+            for (int x=0; x<DISP_W; ++x) {
+                differ += iters[y][x] != exact[y][x];
+            }
+        }
+        if (n % EXACT_INTERVAL == 0 || view.itmax != itmax) {
+            /* Every pixel is computed */
+            CHECK_EQ(pixels_iterated, DISP_W * DISP_H);
+            CHECK_EQ(differ, 0);
+            frames_exact += 1;
+        } else {
+            check_in_place();
+        }
+        itmax = view.itmax;
+        frames += 1;
+        pixels += DISP_W * DISP_H;
+        pixels_differ += differ;
+        pixels_computed += pixels_iterated;
+        if (differ > worst_frame) {
+            worst_frame = differ;
+        }
+        if (!valid) {
+            break;
+        }
+        zoom_step();
+    }
+}
+
+int main(void)
+{
+    host_quiet();
+    for (unsigned i=0; i<ARRAY_SIZE(seeds); ++i) {
+        zoom(seeds[i].x, seeds[i].y);
+    }
+    srand48(1);
+    for (unsigned i=0; i<RANDOM_CENTERS; ++i) {
+        fp_t x, y;
+        pick_center(&x, &y);
+        zoom(x, y);
+    }
+    printf("mandel_incremental: %lu frames (%lu exact), %lu of %lu pixels differ (%.4f%%), "
+            "worst frame %u; %.1fx fewer pixels computed\n",
+            frames, frames_exact, pixels_differ, pixels, pixels_differ * 100.0 / pixels,
+            worst_frame, (double)pixels / pixels_computed);
+    CHECK(pixels_differ * 1000000 / pixels <= MAX_DIFFER_PPM);
+    CHECK(worst_frame * 100 <= MAX_FRAME_DIFFER_PCT * DISP_W * DISP_H);
+    /* and it does save work */
+    CHECK(pixels_computed * 2 < pixels);
+    return test_result("mandel_incremental");
+}
@@ -0,0 +1,85 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+/* Mariani-Silver subdivision against computing every pixel, over zooms
+ * into the seed points and into centers picked as in the demo, down to the
+ * deepest frames drawn.
+ */
+#define MANDEL_MARIANI_SILVER
+#include "mandel.c"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "test.h"
+
+/** Frames per step of shift */
+#define FRAMES_PER_SHIFT 2
+/** Centers picked at random, after the seeds */
+#define RANDOM_CENTERS 8
+
+static uint8_t brute[DISP_H][DISP_W];
+static unsigned long frames, frames_differ, pixels_differ, frames_shown_differ;
+static unsigned long pixels_skipped;
+
+/** Render the current view both ways and compare */
+static void compare(void)
+{
+    view_setup();
+    for (int y=0; y<DISP_H; ++y) {
+        for (int x=0; x<DISP_W; ++x) {
+            brute[y][x] = pixel_it(x, y);
+        }
+    }
+    render(back);
+    pixels_skipped += DISP_W * DISP_H - pixels_iterated;
+    frames += 1;
+    unsigned differ = 0, shown = 0;
+    for (int y=0; y<DISP_H; ++y) {
+        for (int x=0; x<DISP_W; ++x) {
+            differ += iters[y][x] != brute[y][x];
+            shown += (iters[y][x] ^ brute[y][x]) & 1;
+        }
+    }
+    if (differ) {
+        frames_differ += 1;
+        pixels_differ += differ;
+        frames_shown_differ += shown != 0;
+    }
+}
+
+/** Zoom from the whole set into center, as deep as the demo goes */
+static void zoom(fp_t centerx, fp_t centery)
+{
+    mp_from_fixed(&view.centerx, centerx, PREC, 0);
+    mp_from_fixed(&view.centery, centery, PREC, 0);
+    for (view.shift=0; view.shift<SHIFT_LIMIT; ++view.shift) {
+        for (unsigned i=0; i<FRAMES_PER_SHIFT; ++i) {
+            /* radius from 2 down to just above 1, in y */
+            view.radiusy = I(2) - i * I(1) / FRAMES_PER_SHIFT;
+            view.radiusx = 3 * view.radiusy;
+            compare();
+        }
+    }
+}
+
+int main(void)
+{
+    host_quiet();
+    for (unsigned i=0; i<ARRAY_SIZE(seeds); ++i) {
+        zoom(seeds[i].x, seeds[i].y);
+    }
+    srand48(1);
+    for (unsigned i=0; i<RANDOM_CENTERS; ++i) {
+        fp_t x, y;
+        pick_center(&x, &y);
+        zoom(x, y);
+    }
+    printf("mandel_ms: %lu frames, %lu differ in %lu pixels, %lu of them visibly, %lu%% of pixels skipped\n",
+            frames, frames_differ, pixels_differ, frames_shown_differ,
+            pixels_skipped * 100 / (frames * DISP_W * DISP_H));
+    CHECK_EQ(frames_differ, 0);
+    /* and the subdivision does skip work */
+    CHECK(pixels_skipped > frames * DISP_W * DISP_H / 2);
+    return test_result("mandel_ms");
+}
@@ -0,0 +1,183 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+/* The cardioid/bulb test against the plain escape loop: the iteration counts
+ * must be the same, and the report shows how many iterations, and how much
+ * host time, it saves for the fixed-point kernels. The same is reported for
+ * a periodicity check, which the kernels leave out because it does not pay
+ * at these iteration limits.
+ */
+#include "mandel.c"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "test.h"
+
+/** Frames per step of shift */
+#define FRAMES_PER_SHIFT 4
+
+/** Plain escape loops, without the cardioid/bulb test. Set *interior if that
+ * test would have answered for the pixel. With periodic, add the Brent
+ * periodicity check that the kernels leave out: remember Z at powers of two
+ * and stop when it comes back exactly.
+ */
+#define DEFINE_PLAIN(name, T, BASEX, BASEY, STEPX, STEPY, TO_FP, MUL, BIG, ESCAPED) \
+static int name(int x, int y, int *interior, int periodic) \
+{ \
+    T cx = view.BASEX + x * view.STEPX; \
+    T cy = view.BASEY + y * view.STEPY; \
+    *interior = in_cardioid_or_bulb(TO_FP(cx), TO_FP(cy)); \
+    T zx = 0, zy = 0, px = 0, py = 0; \
+    int period = 1, lambda = 0; \
+    int it; \
+    for (it=0; it<view.itmax; ++it) { \
+        if (BIG(zx) || BIG(zy)) { \
+            break; \
+        } \
+        T zx2 = MUL(zx,zx); \
+        T zy2 = MUL(zy,zy); \
+        if (ESCAPED(zx2 + zy2)) { \
+            break; \
+        } \
+        T twozxy = 2 * MUL(zx,zy); \
+        zx = zx2 - zy2 + cx; \
+        zy = twozxy + cy; \
+        if (periodic) { \
+            if (zx == px && zy == py) { \
+                /* counted as run, returned as not escaping */ \
+                periodic_its += it + 1; \
+                return view.itmax; \
+            } \
+            if (++lambda == period) { \
+                px = zx; \
+                py = zy; \
+                period *= 2; \
+                lambda = 0; \
+            } \
+        } \
+    } \
+    if (periodic) { \
+        periodic_its += it; \
+    } \
+    return it; \
+}
+
+/** Iterations run by the plain loops with the periodicity check */
+static unsigned long long periodic_its;
+
+#define Q27_TO_FP(c) ((fp_t)(c) << (PREC-27))
+#define Q57_TO_FP(c) ((c) >> (57-PREC))
+DEFINE_PLAIN(plain_q27, int32_t, q27_basex, q27_basey, q27_stepx, q27_stepy, Q27_TO_FP, MUL_Q27, BIG_Q27, ESCAPED_Q27)
+DEFINE_PLAIN(plain_q57, int64_t, q57_basex, q57_basey, q57_stepx, q57_stepy, Q57_TO_FP, mul_q57, BIG_Q57, ESCAPED_Q57)
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static struct {
+    const char *name;
+    int min_shift, max_shift;
+    int (*plain)(int x, int y, int *interior, int periodic);
+    unsigned long frames;
+    /** Iterations run: by the kernels, by the plain loop, by the plain loop
+     * where the cardioid/bulb test does not answer, and by the plain loop with
+     * the periodicity check there */
+    unsigned long long iterations, plain_iterations, bulb_iterations, periodic_iterations;
+    /** Host time of the kernels, the plain loop, and the plain loop with the
+     * periodicity check */
+    double ns, plain_ns, periodic_ns;
+} kernels[] = {
+    {.name = "q27", .min_shift = 0, .max_shift = Q27_SHIFT_LIMIT, .plain = plain_q27},
+    {.name = "q57", .min_shift = Q27_SHIFT_LIMIT, .max_shift = Q57_SHIFT_LIMIT, .plain = plain_q57},
+};
+
+static uint8_t plain[DISP_H][DISP_W];
+
+static void compare(unsigned k)
+{
+    view_setup();
+    iterations_run = 0;
+    double start = now_ns();
+    for (int y=0; y<DISP_H; ++y) {
+        for (int x=0; x<DISP_W; ++x) {
+            iters[y][x] = pixel_it(x, y);
+        }
+    }
+    double mid = now_ns();
+    unsigned long long plain_its = 0, bulb_its = 0;
+    for (int y=0; y<DISP_H; ++y) {
+        for (int x=0; x<DISP_W; ++x) {
+            int interior;
+            plain[y][x] = kernels[k].plain(x, y, &interior, 0);
+            plain_its += plain[y][x];
+            bulb_its += interior ? 0 : plain[y][x];
+        }
+    }
+    double end = now_ns();
+    periodic_its = 0;
+    unsigned differ = 0;
+    for (int y=0; y<DISP_H; ++y) {
+        for (int x=0; x<DISP_W; ++x) {
+            int interior;
+            differ += kernels[k].plain(x, y, &interior, 1) != plain[y][x];
+        }
+    }
+    double periodic_end = now_ns();
+    CHECK_EQ(differ, 0);
+    CHECK(memcmp(iters, plain, sizeof(iters)) == 0);
+    kernels[k].frames += 1;
+    kernels[k].iterations += iterations_run;
+    kernels[k].plain_iterations += plain_its;
+    kernels[k].bulb_iterations += bulb_its;
+    kernels[k].periodic_iterations += periodic_its;
+    kernels[k].ns += mid - start;
+    kernels[k].plain_ns += end - mid;
+    kernels[k].periodic_ns += periodic_end - end;
+}
+
+/** Zoom from the whole set into center through the depths of every kernel */
+static void zoom(fp_t centerx, fp_t centery)
+{
+    mp_from_fixed(&view.centerx, centerx, PREC, 0);
+    mp_from_fixed(&view.centery, centery, PREC, 0);
+    for (unsigned k=0; k<ARRAY_SIZE(kernels); ++k) {
+        for (view.shift=kernels[k].min_shift; view.shift<kernels[k].max_shift; ++view.shift) {
+            for (unsigned i=0; i<FRAMES_PER_SHIFT; ++i) {
+                view.radiusy = I(2) - i * I(1) / FRAMES_PER_SHIFT;
+                view.radiusx = 3 * view.radiusy;
+                compare(k);
+            }
+        }
+    }
+}
+
+int main(void)
+{
+    host_quiet();
+    for (unsigned i=0; i<ARRAY_SIZE(seeds); ++i) {
+        zoom(seeds[i].x, seeds[i].y);
+    }
+    for (unsigned k=0; k<ARRAY_SIZE(kernels); ++k) {
+        unsigned long frames = kernels[k].frames;
+        printf("mandel_shortcuts: %s, %lu frames: iterations/frame %llu plain, %llu with cardioid/bulb (%.2fx); "
+                "host us/frame %.0f plain, %.0f with cardioid/bulb (%.2fx)\n",
+                kernels[k].name, frames,
+                kernels[k].plain_iterations / frames, kernels[k].iterations / frames,
+                (double)kernels[k].plain_iterations / kernels[k].iterations,
+                kernels[k].plain_ns / frames / 1000, kernels[k].ns / frames / 1000,
+                kernels[k].plain_ns / kernels[k].ns);
+        printf("mandel_shortcuts: %s, periodicity check, not used: iterations/frame %llu (%.4fx), "
+                "host us/frame %.0f (%.2fx)\n",
+                kernels[k].name, kernels[k].periodic_iterations / frames,
+                (double)kernels[k].plain_iterations / kernels[k].periodic_iterations,
+                kernels[k].periodic_ns / frames / 1000, kernels[k].plain_ns / kernels[k].periodic_ns);
+        CHECK(kernels[k].iterations == kernels[k].bulb_iterations);
+        CHECK(kernels[k].bulb_iterations <= kernels[k].plain_iterations);
+    }
+    return test_result("mandel_shortcuts");
+}
@@ -0,0 +1,157 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+/* SPI transmit queue: bytes for two modules, with command/data switches
+ * queued in between, must come out of the emulated SPI controller in order,
+ * to the right module with the right D/C level, without changing D/C or chip
+ * select under a byte. Run at two core clocks, so that the FIFO drains at
+ * different rates relative to the code filling the queue.
+ */
+#include "display.h"
+
+#include <stdlib.h>
+#include "platform.h"
+
+#include "irq.h"
+#include "clock.h"
+#include "cycles.h"
+#include "sleep.h"
+#include "test.h"
+
+/** Bytes per run, several times the queue size */
+#define RUN_BYTES 20000
+
+static struct {
+    unsigned panels;
+    int dc;
+    uint8_t b;
+} trace[RUN_BYTES], expect[RUN_BYTES];
+static unsigned trace_len, expect_len;
+
+static pmodoled_t panels[] = {
+    PMODOLED_128X32(23, 0, 1, 4),
+    PMODOLED_128X32(18, 9, 10, 11),
+};
+
+static void record(unsigned panels, int dc, uint8_t b)
+{
+    if (trace_len < RUN_BYTES) {
+        trace[trace_len].panels = panels;
+        trace[trace_len].dc = dc;
+        trace[trace_len].b = b;
+    }
+    trace_len += 1;
+}
+
+static void expect_bytes(unsigned panel, int dc, const uint8_t *data, size_t step, size_t n)
+{
+    for (size_t i=0; i<n && expect_len<RUN_BYTES; ++i, data+=step) {
+        expect[expect_len].panels = 1 << panel;
+        expect[expect_len].dc = dc;
+        expect[expect_len].b = *data;
+        expect_len += 1;
+    }
+}
+
+/** Wait until everything queued has been shifted out */
+static void drain(void)
+{
+    spi_wait();
+    uint32_t start = rdcycle();
+    while (rdcycle() - start < 4096)
+        IDLE;
+}
+
+static void run(unsigned long freq)
+{
+    uint8_t data[300];
+
+    clock_init(freq);
+    pmodoled_init(panels, 2);
+    drain();
+    unsigned long timing = host_timing();
+    trace_len = expect_len = 0;
+    host_bus_trace(record);
+
+    /* Queueing returns before the bytes are out */
+    pmodoled_window(&panels[0], 0, 3, 0, 128);
+    spi_fill(0x5a, 500);
+    CHECK(trace_len < 500);
+    drain();
+    CHECK_EQ(trace_len, 506);
+    trace_len = 0;
+
+    /* Random mix of commands and data for both modules */
+    unsigned last = 0;
+    srand(freq);
+    while (expect_len < RUN_BYTES - 2 * sizeof(data)) {
+        unsigned panel = rand() % 2;
+        if (rand() % 4 == 3) {
+            /* single bytes, switching mode on every one, to the module
+             * addressed last */
+            for (unsigned i=0; i<16; ++i) {
+                uint8_t b = rand();
+                mode_cmd();
+                spi(0xE3); /* NOP */
+                mode_data();
+                spi(b);
+                expect_bytes(last, 0, (const uint8_t[]){0xE3}, 1, 1);
+                expect_bytes(last, 1, &b, 1, 1);
+            }
+            continue;
+        }
+        unsigned n = 1 + rand() % sizeof(data);
+        for (unsigned i=0; i<n; ++i) {
+            data[i] = rand();
+        }
+        last = panel;
+        switch (rand() % 3) {
+        case 0: /* commands only */
+            pmodoled_command(&panels[panel], data, n);
+            expect_bytes(panel, 0, data, 1, n);
+            break;
+        case 1: /* data copied from a buffer */
+            pmodoled_window(&panels[panel], 0, 3, 0, 128);
+            spi_write(data, n);
+            expect_bytes(panel, 0, (const uint8_t[]){0x21, 0, 127, 0x22, 0, 3}, 1, 6);
+            expect_bytes(panel, 1, data, 1, n);
+            break;
+        default: /* filled data */
+            pmodoled_window(&panels[panel], 0, 3, 0, 128);
+            spi_fill(data[0], n);
+            expect_bytes(panel, 0, (const uint8_t[]){0x21, 0, 127, 0x22, 0, 3}, 1, 6);
+            expect_bytes(panel, 1, data, 0, n);
+            break;
+        }
+        if (rand() % 8 == 0) {
+            drain();
+        }
+    }
+    drain();
+    host_bus_trace(NULL);
+
+    unsigned bad = trace_len == expect_len ? expect_len : 0;
+    for (unsigned i=0; i<expect_len && i<trace_len; ++i) {
+        if (trace[i].panels != expect[i].panels || trace[i].dc != expect[i].dc ||
+                trace[i].b != expect[i].b) {
+            bad = i;
+            break;
+        }
+    }
+    if (bad != expect_len) {
+        fprintf(stderr, "%lu Hz: %u bytes sent, %u expected, first difference at %u\n",
+                freq, trace_len, expect_len, bad);
+    }
+    CHECK_EQ(trace_len, expect_len);
+    CHECK_EQ(bad, expect_len);
+    CHECK_EQ(host_timing(), timing);
+}
+
+int main(void)
+{
+    host_quiet();
+    irq_init();
+    run(16000000);
+    run(320000000);
+    return test_result("spi_queue");
+}
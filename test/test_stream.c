@@ -0,0 +1,195 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+/* Frame streaming end to end: packets fed to the emulated UART, the
+ * acknowledgements sent back, and the frame the panel is left showing.
+ */
+#include "stream.h"
+
+#include <stdint.h>
+#include <string.h>
+#include "platform.h"
+
+#include "irq.h"
+#include "uart.h"
+#include "cycles.h"
+#include "sleep.h"
+#include "test.h"
+
+#define FRAME_SIZE (DISP_PAGES*DISP_W)
+
+static pmodoled_t panels[] = {
+    PMODOLED_128X32(23, 0, 1, 4),
+};
+
+/** Bytes to feed */
+static uint8_t feed[16384];
+static size_t nfeed;
+
+/** Acknowledgements received, and the other bytes sent */
+static char replies[64], text[256];
+static unsigned nreplies, ntext;
+
+static void capture(uint8_t b)
+{
+    if (b == STREAM_ACK || b == STREAM_NAK) {
+        if (nreplies < sizeof(replies) - 1) {
+            replies[nreplies++] = b == STREAM_ACK ? 'A' : 'N';
+        }
+    } else if (ntext < sizeof(text) - 1) {
+        text[ntext++] = b;
+    }
+}
+
+static void emit(const uint8_t *data, size_t n)
+{
+    memcpy(&feed[nfeed], data, n);
+    nfeed += n;
+}
+
+static uint8_t checksum(const uint8_t *data, size_t n)
+{
+    uint8_t sum = 0;
+    for (size_t i=0; i<n; ++i) {
+        sum += data[i];
+    }
+    return -sum;
+}
+
+/** Queue a packet. The length field says len, only sent bytes of the payload
+ * go out (bytes lost on the line), and the check byte is off by check_error.
+ */
+static void packet(uint8_t type, const uint8_t *payload, size_t len, size_t sent, uint8_t check_error)
+{
+    uint8_t head[] = {STREAM_MAGIC, type, len & 0xff, len >> 8};
+    emit(head, sizeof(head));
+    emit(payload, sent);
+    uint8_t check = checksum(payload, len) + check_error;
+    emit(&check, 1);
+}
+
+static void good(uint8_t type, const uint8_t *payload, size_t len)
+{
+    packet(type, payload, len, len, 0);
+}
+
+/** Run-length code data, as tools/oledstream.py does */
+static size_t rle(uint8_t *out, const uint8_t *data, size_t n)
+{
+    size_t o = 0, i = 0;
+    while (i < n) {
+        size_t run = 1;
+        while (i + run < n && run < 128 && data[i + run] == data[i]) {
+            run += 1;
+        }
+        if (run >= 3) {
+            out[o++] = 0x80 | (run - 1);
+            out[o++] = data[i];
+            i += run;
+        } else {
+            /* Literal up to the next run of three */
+            size_t lit = 0;
+            while (i + lit < n && lit < 128 &&
+                    !(i + lit + 2 < n && data[i + lit] == data[i + lit + 1] && data[i + lit] == data[i + lit + 2])) {
+                lit += 1;
+            }
+            out[o++] = lit - 1;
+            memcpy(&out[o], &data[i], lit);
+            o += lit;
+            i += lit;
+        }
+    }
+    return o;
+}
+
+/** A frame with runs of five, and without STREAM_MAGIC or ESC in it, so that
+ * the parser can hunt for the next packet through it
+ */
+static void make_frame(uint8_t *frame, unsigned seed)
+{
+    for (unsigned i=0; i<FRAME_SIZE; ++i) {
+        frame[i] = 28 + (i / 5 * seed) % 137;
+    }
+}
+
+/** A delta that changes a few bytes of the first n */
+static void make_delta(uint8_t *delta, unsigned n, unsigned seed)
+{
+    memset(delta, 0, n);
+    for (unsigned i=seed % 7; i<n; i+=37) {
+        delta[i] = i * seed;
+    }
+    delta[n - 1] = 0xff;
+}
+
+int main(void)
+{
+    static uint8_t a[FRAME_SIZE], b[FRAME_SIZE], d[FRAME_SIZE], e[FRAME_SIZE];
+    static uint8_t delta[3][FRAME_SIZE], payload[2 * FRAME_SIZE];
+    make_frame(a, 3);
+    make_frame(b, 5);
+    make_frame(d, 7);
+    make_frame(e, 11);
+    make_delta(delta[0], FRAME_SIZE, 1);
+    make_delta(delta[1], 300, 2);
+    make_delta(delta[2], 200, 3);
+
+    /* Whole, run-length coded and delta frames */
+    good(STREAM_FULL, a, FRAME_SIZE);
+    good(STREAM_RLE, payload, rle(payload, b, FRAME_SIZE));
+    good(STREAM_DELTA, payload, rle(payload, delta[0], FRAME_SIZE));
+    /* Bad checksum */
+    packet(STREAM_FULL, e, FRAME_SIZE, FRAME_SIZE, 1);
+    good(STREAM_FULL, e, FRAME_SIZE);
+    /* A run cut short by the length, and a frame that is too short */
+    static const uint8_t cut[] = {0x85, 0x30, 0x83};
+    good(STREAM_DELTA, cut, sizeof(cut));
+    static const uint8_t part[] = {0xff, 0x30};
+    good(STREAM_RLE, part, sizeof(part));
+    good(STREAM_FULL, a, FRAME_SIZE);
+    /* Ten bytes lost: the packet eats into the next one, which is lost as
+     * well, and the delta after that would apply to the wrong frame
+     */
+    packet(STREAM_FULL, b, FRAME_SIZE, FRAME_SIZE - 10, 0);
+    good(STREAM_FULL, d, FRAME_SIZE);
+    CHECK(feed[nfeed - 1] != STREAM_MAGIC && feed[nfeed - 1] != 27);
+    good(STREAM_DELTA, payload, rle(payload, delta[1], 300));
+    /* Back in sync with a whole frame */
+    good(STREAM_FULL, e, FRAME_SIZE);
+    good(STREAM_DELTA, payload, rle(payload, delta[2], 200));
+    uint8_t esc = 27;
+    emit(&esc, 1);
+
+    host_quiet();
+    irq_init();
+    uart_irq_init();
+    pmodoled_init(panels, 1);
+    host_uart_output(capture);
+    host_uart_input(feed, nfeed);
+    stream_frames(&panels[0]);
+    uart_flush();
+
+    /* One reply per packet in the order above, none for the packet that was
+     * swallowed
+     */
+    static const char expect_replies[] = "AAANANNANNAA";
+    if (strcmp(replies, expect_replies) != 0) {
+        fprintf(stderr, "replies: %s, expected %s\n", replies, expect_replies);
+    }
+    CHECK(strcmp(replies, expect_replies) == 0);
+    CHECK(strstr(text, "7 frames, 5 bad, 0 bytes dropped") != NULL);
+    CHECK_EQ(host_uart_overruns(), 0);
+
+    /* The panel shows the last whole frame with the last delta applied */
+    spi_wait();
+    uint32_t start = rdcycle();
+    while (rdcycle() - start < 1000)
+        IDLE;
+    uint8_t expect[FRAME_SIZE];
+    for (unsigned i=0; i<FRAME_SIZE; ++i) {
+        expect[i] = e[i] ^ delta[2][i];
+    }
+    CHECK(memcmp(host_gddram(0), expect, FRAME_SIZE) == 0);
+    CHECK_EQ(host_timing(), 0);
+    return test_result("stream");
+}
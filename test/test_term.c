@@ -0,0 +1,410 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+/* Text terminal against the emulated SSD1306: what the panel shows, read
+ * back from display memory from the start line on, after scrolling, and the
+ * cells that control characters and escape sequences leave behind.
+ */
+#include "term.c"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "irq.h"
+#include "cycles.h"
+#include "font.h"
+#include "sleep.h"
+#include "test.h"
+
+#ifndef TEST_NAME
+#define TEST_NAME "term"
+#endif
+
+static pmodoled_t panels[] = {
+    PMODOLED_128X32(23, 0, 1, 4),
+};
+
+/** Bytes sent to the display */
+static unsigned long bus_count;
+
+static void count(unsigned panels, int dc, uint8_t b)
+{
+    (void)panels;
+    (void)dc;
+    (void)b;
+    bus_count += 1;
+}
+
+/** Wait until everything queued has been shifted out */
+static void drain(void)
+{
+    spi_wait();
+    uint32_t start = rdcycle();
+    while (rdcycle() - start < 1000)
+        IDLE;
+}
+
+#ifdef SMOOTH_SCROLL
+/** Run the event loop until a smooth scroll is over, checking that every
+ * timer tick moves the start line down by one scanline
+ */
+static void settle(void)
+{
+    uint64_t last = 0;
+    while (scroll_timer.active) {
+        unsigned line = host_start_line(0);
+        CHECK_EQ(event_wait(EVENT_TIMER), EVENT_TIMER);
+        uint64_t now = get_timer_value();
+        CHECK(!last || now - last >= SCROLL_TICKS);
+        last = now;
+        drain();
+        CHECK_EQ(host_start_line(0), (line + 1) % GDDRAM_LINES);
+    }
+}
+#else
+static void settle(void)
+{
+}
+#endif
+
+static void put(const char *s)
+{
+    while (*s) {
+        term_putc(*s++);
+    }
+}
+
+/** Update the terminal and check that the panel shows the given lines, one
+ * per row, padded with spaces
+ */
+static void check_screen(const char *what, const char *const lines[])
+{
+    term_update();
+    drain();
+    settle();
+    const uint8_t *gddram = host_gddram(0);
+    unsigned first = host_start_line(0) / 8;
+    unsigned w = font->width;
+    int same = host_start_line(0) % 8 == 0;
+    for (unsigned r=0; r<rows; ++r) {
+        size_t len = strlen(lines[r]);
+        for (unsigned c=0; c<cols; ++c) {
+            uint8_t glyph[64];
+            memcpy(glyph, font_lookup(font, c < len ? lines[r][c] : ' '), w * font->pages);
+            for (unsigned p=0; p<font->pages; ++p) {
+                unsigned page = (first + r * font->pages + p) % GDDRAM_PAGES;
+                same &= memcmp(&gddram[page * DISP_W + c * w], &glyph[p * w], w) == 0;
+            }
+        }
+    }
+    if (!same) {
+        fprintf(stderr, "%s: panel does not show the expected text\n", what);
+    }
+    CHECK(same);
+}
+
+/** Scroll through display memory more than once with font f */
+static void check_scroll(const struct font *f)
+{
+    pmodoled_clear(&panels[0]);
+    term_init(&panels[0], f);
+    drain();
+    CHECK_EQ(host_start_line(0), 0);
+
+    /* Fill the screen, then every line scrolls */
+    char lines[8][8];
+    const char *expect[MAX_ROWS];
+    unsigned start_line = 0;
+    for (unsigned i=0; i<2*GDDRAM_PAGES; ++i) {
+        snprintf(lines[i % 8], sizeof(lines[0]), "line %u", i);
+        if (i > 0) {
+            bus_count = 0;
+            put("\r");
+            term_update();
+            drain();
+            if (i >= rows) {
+                /* The start line moves down a text row, wrapping around */
+                start_line = (start_line + f->pages * 8) % GDDRAM_LINES;
+                /* and the scroll costs no more than clearing the new row */
+                CHECK(bus_count <= f->pages * (DISP_W + 6) + 1UL);
+            }
+            settle();
+            CHECK_EQ(host_start_line(0), start_line);
+        }
+        put(lines[i % 8]);
+        unsigned shown = i + 1 < rows ? i + 1 : rows;
+        for (unsigned r=0; r<rows; ++r) {
+            expect[r] = r < shown ? lines[(i + 1 - shown + r) % 8] : "";
+        }
+        check_screen("scroll", expect);
+    }
+    /* A wrapping line scrolls too */
+    put("\r");
+    for (unsigned c=0; c<cols+1; ++c) {
+        term_putc('a' + c % 26);
+    }
+    char wrapped[MAX_COLS + 1] = {0};
+    for (unsigned c=0; c<cols; ++c) {
+        wrapped[c] = 'a' + c % 26;
+    }
+    char last[2] = {'a' + cols % 26, 0};
+    for (unsigned r=0; r+2<rows; ++r) {
+        expect[r] = lines[(2*GDDRAM_PAGES - rows + 2 + r) % 8];
+    }
+    expect[rows-2] = wrapped;
+    expect[rows-1] = last;
+    check_screen("wrap", expect);
+}
+
+/** Start over on a cleared display with the small font */
+static void reset(void)
+{
+    pmodoled_clear(&panels[0]);
+    term_init(&panels[0], &font_6x8);
+    term_update();
+    drain();
+}
+
+/** Check that the cells hold the given lines, padded with spaces */
+static void check_cells(const char *what, const char *const lines[])
+{
+    int same = 1;
+    for (unsigned r=0; r<rows; ++r) {
+        size_t len = strlen(lines[r]);
+        for (unsigned c=0; c<cols; ++c) {
+            same &= cells[r][c].ch == (uint8_t)(c < len ? lines[r][c] : ' ');
+        }
+    }
+    if (!same) {
+        fprintf(stderr, "%s: cells do not hold the expected text\n", what);
+    }
+    CHECK(same);
+}
+
+/** Cursor addressing, clamped to the screen */
+static void check_cup(void)
+{
+    reset();
+    put("\x1b[2;3H");
+    CHECK_EQ(row, 1);
+    CHECK_EQ(col, 2);
+    put("\x1b[99;99H");
+    CHECK_EQ(row, rows - 1);
+    CHECK_EQ(col, cols - 1);
+    put("\x1b[H");
+    CHECK_EQ(row, 0);
+    CHECK_EQ(col, 0);
+    put("\x1b[3;2f");
+    CHECK_EQ(row, 2);
+    CHECK_EQ(col, 1);
+    put("\x1b[0;0H");
+    CHECK_EQ(row, 0);
+    CHECK_EQ(col, 0);
+    put("\x1b[;5H");
+    CHECK_EQ(row, 0);
+    CHECK_EQ(col, 4);
+    /* Parameters past the last one kept are ignored */
+    put("\x1b[2;3;4;5;6;7H");
+    CHECK_EQ(row, 1);
+    CHECK_EQ(col, 2);
+}
+
+/** Fill the screen with rows of digits and put the cursor on row 1, col 3 */
+static void fill_screen(void)
+{
+    reset();
+    for (unsigned r=0; r<rows; ++r) {
+        put("\x1b[");
+        term_putc('1' + r);
+        put("H0123456789");
+    }
+    put("\x1b[2;4H");
+}
+
+static void check_erase(void)
+{
+    static const char *const full[] = {"0123456789", "0123456789", "0123456789", "0123456789"};
+    fill_screen();
+    check_cells("fill", full);
+
+    fill_screen();
+    put("\x1b[K");
+    check_cells("EL 0", (const char *const[]){"0123456789", "012", "0123456789", "0123456789"});
+    fill_screen();
+    put("\x1b[1K");
+    check_cells("EL 1", (const char *const[]){"0123456789", "    456789", "0123456789", "0123456789"});
+    fill_screen();
+    put("\x1b[2K");
+    check_cells("EL 2", (const char *const[]){"0123456789", "", "0123456789", "0123456789"});
+
+    fill_screen();
+    put("\x1b[J");
+    check_cells("ED 0", (const char *const[]){"0123456789", "012", "", ""});
+    fill_screen();
+    put("\x1b[1J");
+    check_cells("ED 1", (const char *const[]){"", "    456789", "0123456789", "0123456789"});
+    fill_screen();
+    put("\x1b[2J");
+    check_cells("ED 2", (const char *const[]){"", "", "", ""});
+    /* Erasing does not move the cursor */
+    CHECK_EQ(row, 1);
+    CHECK_EQ(col, 3);
+}
+
+/** Inverse video, in the cells and on the panel */
+static void check_sgr(void)
+{
+    reset();
+    put("a\x1b[7mb\x1b[27mc\x1b[7md\x1b[0me\x1b[7mf\x1b[mg\x1b[1;7mh\x1b[2;1Hi\x1b[K");
+    static const uint8_t inverse[] = {0, 1, 0, 1, 0, 1, 0, 1};
+    for (unsigned c=0; c<sizeof(inverse); ++c) {
+        CHECK_EQ(cells[0][c].attr & ATTR_INVERSE, inverse[c]);
+    }
+    /* Erased cells are not inverse, new characters still are */
+    CHECK_EQ(cells[1][0].attr & ATTR_INVERSE, 1);
+    CHECK_EQ(cells[1][1].attr, 0);
+
+    term_update();
+    drain();
+    settle();
+    const uint8_t *gddram = host_gddram(0);
+    unsigned w = font->width;
+    int same = 1;
+    for (unsigned c=0; c<sizeof(inverse); ++c) {
+        const uint8_t *glyph = font_lookup(font, 'a' + c);
+        for (unsigned x=0; x<w; ++x) {
+            uint8_t expect = inverse[c] ? ~glyph[x] : glyph[x];
+            same &= gddram[c * w + x] == expect;
+        }
+    }
+    CHECK(same);
+}
+
+/** Backspace and line endings */
+static void check_controls(void)
+{
+    reset();
+    /* A full row leaves the cursor waiting to wrap: backspace erases the
+     * last column and the next character goes there, without wrapping
+     */
+    for (unsigned c=0; c<cols; ++c) {
+        term_putc('x');
+    }
+    CHECK_EQ(col, cols);
+    term_putc('\b');
+    CHECK_EQ(col, cols - 1);
+    CHECK_EQ(cells[0][cols-1].ch, ' ');
+    term_putc('y');
+    CHECK_EQ(row, 0);
+    CHECK_EQ(cells[0][cols-1].ch, 'y');
+    /* Backspace at the first column does nothing */
+    put("\r");
+    term_putc(127);
+    CHECK_EQ(row, 1);
+    CHECK_EQ(col, 0);
+
+    /* \r ends a line and a \n right after it is ignored; \n alone feeds a
+     * line without returning
+     */
+    reset();
+    put("a\r\nb\nc\r\nd");
+    check_cells("line endings", (const char *const[]){"a", "b", " c", "d"});
+    check_screen("line endings", (const char *const[]){"a", "b", " c", "d"});
+    put("\x1b[H\r\r\n");
+    CHECK_EQ(row, 2);
+    put("\n");
+    CHECK_EQ(row, 3);
+    CHECK_EQ(col, 0);
+    CHECK_EQ(host_start_line(0), 0);
+}
+
+/** Sequences that are not understood are consumed whole */
+static void check_ignored(void)
+{
+    reset();
+    put("a\x1b[?25lb\x1b[?25hc\x1b[>0cd\x1b(Be\x1b[1 qf");
+    check_cells("ignored", (const char *const[]){"abcdef", "", "", ""});
+    CHECK_EQ(cells[0][0].attr | cells[0][5].attr, 0);
+    /* ESC restarts a sequence, controls inside one are ignored */
+    put("\x1b[2\x1b[3;\r4H");
+    CHECK_EQ(row, 2);
+    CHECK_EQ(col, 3);
+    /* Only a lone ESC is pending */
+    put("\x1b");
+    CHECK(term_escape_pending());
+    put("(");
+    CHECK(!term_escape_pending());
+    put("B\x1b[");
+    CHECK(!term_escape_pending());
+    put("m\x1b\x1b");
+    CHECK(term_escape_pending());
+    put("x");
+    CHECK(!term_escape_pending());
+    CHECK_EQ(cells[2][3].ch, ' ');
+}
+
+/** Writing what is already shown sends nothing */
+static void check_redraw(void)
+{
+    fill_screen();
+    put("\x1b[7mabc");
+    term_update();
+    drain();
+    bus_count = 0;
+    put("\x1b[2;4Habc\x1b[m\x1b[1;1H0123");
+    term_update();
+    drain();
+    CHECK_EQ(bus_count, 0);
+}
+
+#ifdef SMOOTH_SCROLL
+/** Writing returns while the scroll is still going, and lines written faster
+ * than it goes finish the scroll before at once
+ */
+static void check_smooth(void)
+{
+    pmodoled_clear(&panels[0]);
+    term_init(&panels[0], &font_6x8);
+    drain();
+    put("0\r1\r2\r3\r");
+    CHECK(scroll_timer.active);
+    term_update();
+    drain();
+    CHECK_EQ(host_start_line(0), 0);
+    CHECK_EQ(event_wait(EVENT_TIMER), EVENT_TIMER);
+    drain();
+    CHECK_EQ(host_start_line(0), 1);
+    put("4\r5\r6");
+    CHECK(scroll_timer.active);
+    term_update();
+    drain();
+    /* Two scrolls finished at once, the third one is going */
+    CHECK_EQ(host_start_line(0), 16);
+    check_screen("smooth", (const char *const[]){"3", "4", "5", "6"});
+    CHECK_EQ(host_start_line(0), 24);
+}
+#endif
+
+int main(void)
+{
+    host_quiet();
+    irq_init();
+    pmodoled_init(panels, 1);
+    drain();
+    host_bus_trace(count);
+
+    check_scroll(&font_6x8);
+    check_scroll(&font_8x16);
+    check_cup();
+    check_erase();
+    check_sgr();
+    check_controls();
+    check_ignored();
+    check_redraw();
+#ifdef SMOOTH_SCROLL
+    check_smooth();
+#endif
+
+    CHECK_EQ(host_timing(), 0);
+    return test_result(TEST_NAME);
+}
@@ -0,0 +1,9 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+/* The terminal tests with smooth scrolling, which moves the start line from
+ * a timer in the event loop.
+ */
+#define SMOOTH_SCROLL
+#define TEST_NAME "term_smooth"
+#include "test_term.c"
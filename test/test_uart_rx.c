@@ -0,0 +1,115 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+/* Receiving on UART0, with input fed to the emulated UART at the line rate:
+ * nothing is lost while the main program keeps up, what the ring buffer
+ * cannot hold is counted, and so is what the hardware FIFO cannot hold while
+ * interrupts are off.
+ */
+#include "uart.h"
+
+#include <stdint.h>
+#include <string.h>
+#include "platform.h"
+
+#include "irq.h"
+#include "events.h"
+#include "cycles.h"
+#include "sleep.h"
+#include "test.h"
+
+/** Cycles per character at the reset baud rate, see host/emu.c */
+#define BYTE_CYCLES (10 * (16000000 / 115200))
+
+static uint8_t sent[8192], got[8192];
+
+static void fill(size_t n, unsigned seed)
+{
+    for (size_t i=0; i<n; ++i) {
+        sent[i] = (uint8_t)(i * 7 + (i >> 8) + seed);
+    }
+}
+
+/** Run for the given number of cycles without reading */
+static void spin(uint32_t cycles)
+{
+    uint32_t start = rdcycle();
+    while (rdcycle() - start < cycles)
+        IDLE;
+}
+
+/** Read what has been received so far */
+static size_t drain(void)
+{
+    return uart_read((char *)got, sizeof(got));
+}
+
+/** A long paste, read in bursts with busy stretches of up to 150 character
+ * times in between, which the ring buffer covers
+ */
+static void check_paste(void)
+{
+    size_t n = sizeof(sent);
+    fill(n, 0);
+    host_uart_input(sent, n);
+    size_t count = 0;
+    unsigned k = 0;
+    while (count < n) {
+        event_wait(EVENT_UART_RX);
+        count += uart_read((char *)got + count, n - count);
+        spin((k++ * 37 % 150) * BYTE_CYCLES);
+    }
+    CHECK_EQ(count, n);
+    CHECK(memcmp(got, sent, n) == 0);
+    CHECK_EQ(uart_rx_dropped(), 0);
+    CHECK_EQ(host_uart_overruns(), 0);
+}
+
+/** Input that is not read: the ring buffer keeps the first UART_RX_SIZE
+ * bytes, the rest is dropped and counted, and reception recovers
+ */
+static void check_dropped(void)
+{
+    size_t n = 1000;
+    fill(n, 1);
+    host_uart_input(sent, n);
+    spin((n + 2) * BYTE_CYCLES);
+    CHECK_EQ(drain(), UART_RX_SIZE);
+    CHECK(memcmp(got, sent, UART_RX_SIZE) == 0);
+    CHECK_EQ(uart_rx_dropped(), n - UART_RX_SIZE);
+    CHECK_EQ(host_uart_overruns(), 0);
+
+    fill(10, 2);
+    host_uart_input(sent, 10);
+    spin(12 * BYTE_CYCLES);
+    CHECK_EQ(drain(), 10);
+    CHECK(memcmp(got, sent, 10) == 0);
+    CHECK_EQ(uart_rx_dropped(), n - UART_RX_SIZE);
+}
+
+/** With interrupts off, only the eight bytes of the hardware FIFO survive */
+static void check_overrun(void)
+{
+    unsigned dropped = uart_rx_dropped();
+    size_t n = 20;
+    fill(n, 3);
+    irq_disable();
+    host_uart_input(sent, n);
+    spin((n + 2) * BYTE_CYCLES);
+    irq_enable();
+    CHECK_EQ(drain(), 8);
+    CHECK(memcmp(got, sent, 8) == 0);
+    CHECK_EQ(host_uart_overruns(), n - 8);
+    CHECK_EQ(uart_rx_dropped(), dropped);
+}
+
+int main(void)
+{
+    host_quiet();
+    irq_init();
+    uart_irq_init();
+    check_paste();
+    check_dropped();
+    check_overrun();
+    return test_result("uart_rx");
+}
@@ -0,0 +1,169 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+/* Transmitting on UART0 through the ring buffer, against what the emulated
+ * UART is given to send: polled before uart_irq_init(), then drained by the
+ * interrupt across many wraparounds, blocking when full, and dropping whole
+ * writes with UART_DROP.
+ */
+#include "uart.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "platform.h"
+
+#include "irq.h"
+#include "cycles.h"
+#include "sleep.h"
+#include "test.h"
+
+/** Cycles per character at the reset baud rate, see host/emu.c */
+#define BYTE_CYCLES (10 * (16000000 / 115200))
+
+/** What was sent, and what should have been */
+static char sent[65536], expect[65536];
+static size_t nsent, nexpect;
+
+static void capture(uint8_t b)
+{
+    if (nsent < sizeof(sent)) {
+        sent[nsent] = b;
+    }
+    nsent += 1;
+}
+
+static unsigned rand_state = 1;
+
+static unsigned rand_next(void)
+{
+    rand_state = rand_state * 1103515245 + 12345;
+    return (rand_state >> 16) & 0x7fff;
+}
+
+/** Write n bytes of a pattern with policy, and note them if accepted */
+static size_t write_pattern(size_t n, enum uart_policy policy)
+{
+    char buf[4 * UART_TX_SIZE];
+    for (size_t i=0; i<n; ++i) {
+        buf[i] = (char)(nexpect + i * 3 + (i >> 7));
+    }
+    size_t done = uart_write(buf, n, policy);
+    if (done) {
+        memcpy(&expect[nexpect], buf, done);
+        nexpect += done;
+    }
+    return done;
+}
+
+/** Run for the given number of cycles */
+static void spin(uint32_t cycles)
+{
+    uint32_t start = rdcycle();
+    while (rdcycle() - start < cycles)
+        IDLE;
+}
+
+/** Check that exactly the expected bytes have been sent, in order */
+static void check_sent(void)
+{
+    CHECK_EQ(nsent, nexpect);
+    CHECK(memcmp(sent, expect, nexpect) == 0);
+}
+
+/** Before uart_irq_init(), writes and uart_flush() push bytes out by
+ * polling. What is left in the buffer goes out by interrupt once it is set
+ * up.
+ */
+static void check_polled(void)
+{
+    CHECK_EQ(write_pattern(3000, UART_BLOCK), 3000);
+    /* All but the last buffer full has gone out while waiting for space */
+    CHECK(nsent >= 3000 - UART_TX_SIZE);
+    CHECK(nsent < 3000);
+    uart_flush();
+    CHECK(nsent >= 3000 - 8);
+    spin(10 * BYTE_CYCLES);
+    check_sent();
+
+    write_pattern(500, UART_BLOCK);
+    CHECK(nsent < nexpect);
+    irq_init();
+    uart_irq_init();
+    spin(510 * BYTE_CYCLES);
+    check_sent();
+}
+
+/** Writes of all sizes, with the interrupt draining in between, wrap around
+ * the buffer many times
+ */
+static void check_interleaved(void)
+{
+    size_t start = nexpect;
+    while (nexpect - start < 12 * UART_TX_SIZE) {
+        unsigned n = rand_next() % 300 + 1;
+        if (rand_next() % 8 == 0) {
+            int len = uart_printf(UART_BLOCK, "line %u of %u bytes\r\n", (unsigned)nexpect, n);
+            char buf[UART_PRINTF_MAX];
+            snprintf(buf, sizeof(buf), "line %u of %u bytes\r\n", (unsigned)nexpect, n);
+            CHECK_EQ(len, strlen(buf));
+            memcpy(&expect[nexpect], buf, len);
+            nexpect += len;
+        } else {
+            CHECK_EQ(write_pattern(n, UART_BLOCK), n);
+        }
+        spin(rand_next() % 200 * BYTE_CYCLES);
+    }
+    uart_flush();
+    spin(10 * BYTE_CYCLES);
+    check_sent();
+}
+
+/** A write larger than the buffer blocks until all but the last buffer full
+ * has been sent, one that fits returns at once
+ */
+static void check_blocking(void)
+{
+    uint32_t start = rdcycle();
+    CHECK_EQ(write_pattern(3 * UART_TX_SIZE, UART_BLOCK), 3 * UART_TX_SIZE);
+    uint32_t cycles = rdcycle() - start;
+    CHECK(cycles >= (2 * UART_TX_SIZE - 8) * BYTE_CYCLES);
+    CHECK(cycles <= (2 * UART_TX_SIZE + 8) * BYTE_CYCLES);
+    uart_flush();
+    spin(10 * BYTE_CYCLES);
+    start = rdcycle();
+    CHECK_EQ(write_pattern(UART_TX_SIZE, UART_BLOCK), UART_TX_SIZE);
+    CHECK(rdcycle() - start < BYTE_CYCLES);
+    uart_flush();
+    spin(10 * BYTE_CYCLES);
+    check_sent();
+}
+
+/** UART_DROP writes all or nothing, and counts what it dropped */
+static void check_drop(void)
+{
+    CHECK_EQ(uart_tx_dropped(), 0);
+    CHECK_EQ(write_pattern(UART_TX_SIZE, UART_BLOCK), UART_TX_SIZE);
+    CHECK_EQ(write_pattern(100, UART_DROP), 0);
+    CHECK_EQ(uart_printf(UART_DROP, "%s", "twenty bytes dropped"), 0);
+    CHECK_EQ(uart_tx_dropped(), 120);
+    /* Once there is room, a write that fits the whole buffer goes through */
+    uart_flush();
+    CHECK_EQ(write_pattern(UART_TX_SIZE, UART_DROP), UART_TX_SIZE);
+    CHECK_EQ(write_pattern(UART_TX_SIZE + 1, UART_DROP), 0);
+    CHECK_EQ(uart_tx_dropped(), 120 + UART_TX_SIZE + 1);
+    uart_flush();
+    spin(10 * BYTE_CYCLES);
+    check_sent();
+}
+
+int main(void)
+{
+    host_quiet();
+    host_uart_output(capture);
+    check_polled();
+    check_interleaved();
+    check_blocking();
+    check_drop();
+    return test_result("uart_tx");
+}
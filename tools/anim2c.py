@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+# Copyright (c) 2017 Wladimir J. van der Laan
+# Distributed under the MIT software license, see the accompanying
+# file COPYING or http://www.opensource.org/licenses/mit-license.php.
+'''
+Compress a 1bpp animation into a C table for playback from flash (see anim.h).
+
+Frames are 128x32 PBM images, or a zoom into the mandelbrot set rendered
+here with --mandel N. Every frame is coded as the difference with the frame
+before it, as it stands in display memory: the changed columns of every page
+are merged into address windows in the same way as pmodoled_flush() does,
+and the new contents of each window are run-length coded as in stream.h. A
+last frame takes the display from the final frame back to the first, for
+looping.
+
+Statistics are written to stderr: compression ratio, and the bytes that go
+over SPI per frame with the resulting frame rate limit.
+
+Usage: anim2c.py <name> [--ticks N] (--mandel N [--zoom F] | frames.pbm ...)
+'''
+import argparse
+import math
+import sys
+
+from oledstream import W, PAGES, FRAME_SIZE, read_pbm, to_pages, rle
+
+GDDRAM_PAGES = 8
+H = PAGES * 8
+# Cost of an address window in bytes, as in display.c
+WINDOW_COST = 8
+# SPI clock for the frame rate estimate
+SPI_FREQ = 10000000
+
+# Mandelbrot zoom, matching the look of mandel.c: pixels alternate with the
+# iteration count, and the iteration limit grows with the zoom depth
+CENTER = (-0.743643887037151, 0.131825904205330)
+START_RADIUS = (3.0, 1.0)
+ITMAX = 16
+ITMAX_SHIFT = 5
+IT_PER_SHIFT = 2
+
+def mandel_frames(n, zoom):
+    for i in range(n):
+        scale = zoom ** i
+        rx = START_RADIUS[0] * scale
+        ry = START_RADIUS[1] * scale
+        shift = max(0, int(math.log2(1 / scale)) - ITMAX_SHIFT)
+        itmax = ITMAX + IT_PER_SHIFT * shift
+        pixels = []
+        for y in range(H):
+            ci = CENTER[1] - ry + 2 * ry * y / H
+            row = []
+            for x in range(W):
+                cr = CENTER[0] - rx + 2 * rx * x / W
+                zr = zi = 0.0
+                it = 0
+                while it < itmax and zr * zr + zi * zi < 4.0:
+                    zr, zi = zr * zr - zi * zi + cr, 2 * zr * zi + ci
+                    it += 1
+                row.append(it & 1)
+            pixels.append(row)
+        yield to_pages(pixels)
+
+def dirty_spans(frame, prev):
+    '''Changed column span [lo, end) of every page, end is 0 if none'''
+    spans = []
+    for page in range(PAGES):
+        cols = [x for x in range(W) if frame[page * W + x] != prev[page * W + x]]
+        spans.append((cols[0], cols[-1] + 1) if cols else (0, 0))
+    return spans
+
+def windows(spans):
+    '''Merge spans into (first, last, lo, end) windows, as pmodoled_flush()'''
+    result = []
+    page = 0
+    while page < PAGES:
+        if spans[page][1] == 0:
+            page += 1
+            continue
+        first = page
+        lo, end = spans[page]
+        cost = WINDOW_COST + (end - lo)
+        page += 1
+        while page < PAGES and spans[page][1]:
+            mlo = min(lo, spans[page][0])
+            mend = max(end, spans[page][1])
+            merged = WINDOW_COST + (page - first + 1) * (mend - mlo)
+            separate = cost + WINDOW_COST + (spans[page][1] - spans[page][0])
+            if merged > separate:
+                break
+            lo, end, cost = mlo, mend, merged
+            page += 1
+        result.append((first, page - 1, lo, end))
+    return result
+
+def encode_frame(frame, prev):
+    '''Return coded frame and number of bytes it sends over SPI'''
+    wins = windows(dirty_spans(frame, prev))
+    out = bytearray([len(wins)])
+    spi = 0
+    for first, last, lo, end in wins:
+        data = bytearray()
+        for page in range(first, last + 1):
+            data.extend(frame[page * W + lo:page * W + end])
+        out.extend([first << 4 | last, lo, end])
+        out.extend(rle(data))
+        spi += WINDOW_COST + len(data)
+    return out, spi
+
+def main():
+    parser = argparse.ArgumentParser(description='Compress a 1bpp animation into a C table')
+    parser.add_argument('name', help='C identifier of the animation')
+    parser.add_argument('frames', nargs='*', help='128x32 PBM images')
+    parser.add_argument('--mandel', type=int, metavar='N', default=0, help='render N frames of a mandelbrot zoom')
+    parser.add_argument('--zoom', type=float, default=0.99, help='mandelbrot zoom factor per frame (default: 0.99)')
+    parser.add_argument('--ticks', type=int, default=0, help='32768 Hz ticks per frame, 0 for as fast as SPI allows (default: 0)')
+    args = parser.parse_args()
+
+    frames = [to_pages(read_pbm(name)) for name in args.frames]
+    frames.extend(mandel_frames(args.mandel, args.zoom))
+    if not frames:
+        print('no frames given', file=sys.stderr)
+        exit(1)
+
+    blob = bytearray()
+    spi_total = 0
+    spi_max = 0
+    prev = bytearray(FRAME_SIZE) # display is cleared before playback
+    for frame in frames:
+        coded, spi = encode_frame(frame, prev)
+        blob.extend(coded)
+        spi_total += spi
+        spi_max = max(spi_max, spi)
+        prev = frame
+    loop = len(blob)
+    coded, _ = encode_frame(frames[0], frames[-1])
+    blob.extend(coded)
+
+    raw = len(frames) * FRAME_SIZE
+    spi_avg = spi_total / len(frames)
+    print('%s: %d frames, %d bytes raw, %d bytes coded (%.1f%%, %.1f bytes/frame)' % (
+        args.name, len(frames), raw, len(blob), 100.0 * len(blob) / raw, len(blob) / len(frames)), file=sys.stderr)
+    print('%s: %.1f bytes/frame over SPI (max %d), at most %.0f frames/s at %d MHz' % (
+        args.name, spi_avg, spi_max, SPI_FREQ / 8 / spi_avg, SPI_FREQ // 1000000), file=sys.stderr)
+
+    print('// Generated by tools/anim2c.py from %s, do not edit' % (
+        'a %d frame mandelbrot zoom' % args.mandel if args.mandel else ' '.join(args.frames)))
+    print('#include "anim.h"')
+    print()
+    print('static const uint8_t %s_data[%d] = {' % (args.name, len(blob)))
+    for i in range(0, len(blob), 16):
+        print('    ' + ' '.join('0x%02x,' % b for b in blob[i:i+16]))
+    print('};')
+    print()
+    print('const struct anim %s = {' % args.name)
+    print('    .frames = %d,' % len(frames))
+    print('    .frame_ticks = %d,' % args.ticks)
+    print('    .data = %s_data,' % args.name)
+    print('    .loop = %s_data + %d,' % (args.name, loop))
+    print('};')
+
+if __name__ == '__main__':
+    main()
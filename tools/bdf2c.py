@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+# Copyright (c) 2017 Wladimir J. van der Laan
+# Distributed under the MIT software license, see the accompanying
+# file COPYING or http://www.opensource.org/licenses/mit-license.php.
+'''
+Convert a BDF font to a C font table in SSD1306 page layout.
+
+Every glyph is placed in a cell of the font bounding box, widened by the
+requested number of spacing columns and rounded up to whole display pages
+in height. The table holds, per glyph, one run of cell-width column bytes
+for every page, least significant bit at the top, so that a glyph can be
+sent to the display with one write per page.
+
+Characters outside the table can be put in a compressed glyph store with
+--ext FIRST-LAST (repeatable). Every byte of a glyph in the store is coded as
+a nibble: an index into a dictionary of the DICT_SIZE most common bytes, or
+LITERAL for a byte that follows after the nibbles of the glyph. An index
+holds the offset of every BLOCK-th glyph. This must match font.c.
+
+Usage: bdf2c.py <font.bdf> <name> [--spacing N] [--first N] [--count N] [--ext FIRST-LAST]...
+'''
+import argparse
+from collections import Counter
+import sys
+
+DICT_SIZE = 15
+LITERAL = 15
+BLOCK = 16
+
+def parse_bdf(f):
+    '''Parse a BDF file into (bbox, {encoding: (bbx, rows)})'''
+    bbox = None
+    glyphs = {}
+    default = None
+    lines = iter(f.read().splitlines())
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == 'FONTBOUNDINGBOX':
+            bbox = tuple(int(x) for x in words[1:5])
+        elif words[0] == 'DEFAULT_CHAR':
+            default = int(words[1])
+        elif words[0] == 'STARTCHAR':
+            encoding = None
+            bbx = None
+            for line in lines:
+                words = line.split()
+                if words[0] == 'ENCODING':
+                    encoding = int(words[1])
+                elif words[0] == 'BBX':
+                    bbx = tuple(int(x) for x in words[1:5])
+                elif words[0] == 'BITMAP':
+                    break
+            rows = []
+            for line in lines:
+                if line.strip() == 'ENDCHAR':
+                    break
+                hexrow = line.strip()
+                rows.append((int(hexrow, 16), 4 * len(hexrow)))
+            if encoding is not None and encoding >= 0:
+                glyphs[encoding] = (bbx, rows)
+    if bbox is None:
+        raise ValueError('no FONTBOUNDINGBOX')
+    return bbox, glyphs, default
+
+def render(bbox, glyph, cell_w, pages):
+    '''Render glyph into a cell, return list of pages of column bytes'''
+    fw, fh, fx, fy = bbox
+    out = [[0] * cell_w for _ in range(pages)]
+    if glyph is None:
+        return out
+    (w, h, xoff, yoff), rows = glyph
+    x0 = xoff - fx
+    y0 = (fh + fy) - (h + yoff) # top row of glyph, counted from top of cell
+    for gy, (bits, nbits) in enumerate(rows):
+        y = y0 + gy
+        if y < 0 or y >= 8 * pages:
+            continue
+        for gx in range(w):
+            x = x0 + gx
+            if x < 0 or x >= cell_w:
+                continue
+            if bits & (1 << (nbits - 1 - gx)):
+                out[y // 8][x] |= 1 << (y % 8)
+    return out
+
+def pack(cell, dictionary):
+    '''Compress cell bytes: nibbles, two per byte low first, then literals'''
+    codes = []
+    literals = []
+    for b in cell:
+        if b in dictionary:
+            codes.append(dictionary.index(b))
+        else:
+            codes.append(LITERAL)
+            literals.append(b)
+    if len(codes) % 2:
+        codes.append(0)
+    return [codes[i] | (codes[i + 1] << 4) for i in range(0, len(codes), 2)] + literals
+
+def parse_range(s):
+    first, last = (int(x, 0) for x in s.split('-'))
+    return first, last - first + 1
+
+def c_bytes(data, indent='  ', per_line=16):
+    return ''.join(indent + ' '.join('0x%02x,' % b for b in data[i:i + per_line]) + '\n'
+            for i in range(0, len(data), per_line))
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert BDF font to C table in SSD1306 page layout')
+    parser.add_argument('bdf', help='input BDF file')
+    parser.add_argument('name', help='C name of font')
+    parser.add_argument('--spacing', type=int, default=0, help='empty columns to add at the right of every cell')
+    parser.add_argument('--first', type=int, default=0, help='first character')
+    parser.add_argument('--count', type=int, default=128, help='number of characters')
+    parser.add_argument('--ext', type=parse_range, action='append', default=[],
+            help='range FIRST-LAST of characters for the compressed glyph store')
+    args = parser.parse_args()
+
+    with open(args.bdf) as f:
+        bbox, glyphs, default = parse_bdf(f)
+    cell_w = bbox[0] + args.spacing
+    pages = (bbox[1] + 7) // 8
+    if cell_w > 255 or args.count > 256:
+        raise ValueError('font too large')
+    fallback = glyphs.get(default)
+
+    out = sys.stdout
+    out.write('/* Generated by tools/bdf2c.py from %s, do not edit */\n' % args.bdf)
+    out.write('#include "font.h"\n\n')
+    out.write('static const uint8_t %s_data[] = {\n' % args.name)
+    for ch in range(args.first, args.first + args.count):
+        cell = render(bbox, glyphs.get(ch, fallback), cell_w, pages)
+        out.write('  ')
+        out.write(' '.join(', '.join('0x%02x' % b for b in page) + ',' for page in cell))
+        out.write(' /* %d */\n' % ch)
+    out.write('};\n\n')
+
+    size = args.count * pages * cell_w
+    ext = ''
+    if args.ext:
+        cells = [sum(render(bbox, glyphs.get(ch, fallback), cell_w, pages), [])
+                for first, count in args.ext for ch in range(first, first + count)]
+        counts = Counter(b for cell in cells for b in cell)
+        dictionary = [b for b, _ in counts.most_common(DICT_SIZE)]
+        dictionary += [0] * (DICT_SIZE - len(dictionary))
+        packed = []
+        index = []
+        for i, cell in enumerate(cells):
+            if i % BLOCK == 0:
+                index.append(len(packed))
+            packed += pack(cell, dictionary)
+        if len(packed) > 65535:
+            raise ValueError('glyph store too large')
+        out.write('static const struct font_range %s_ranges[] = {\n' % args.name)
+        for first, count in args.ext:
+            out.write('    {0x%04x, %d},\n' % (first, count))
+        out.write('};\n\n')
+        out.write('static const uint8_t %s_dict[] = {\n' % args.name)
+        out.write(c_bytes(dictionary))
+        out.write('};\n\n')
+        out.write('static const uint16_t %s_index[] = {\n' % args.name)
+        out.write('    ' + ', '.join('%d' % x for x in index) + '\n')
+        out.write('};\n\n')
+        out.write('static const uint8_t %s_packed[] = {\n' % args.name)
+        out.write(c_bytes(packed))
+        out.write('};\n\n')
+        ext = ',\n    %d, %s_ranges, %s_dict, %s_index, %s_packed' % (
+                len(args.ext), args.name, args.name, args.name, args.name)
+        store = len(packed) + 2 * len(index) + DICT_SIZE + 4 * len(args.ext)
+        sys.stderr.write('%s: %d glyphs in store, %d bytes unpacked, %d bytes packed (%.0f%%)\n' % (
+            args.name, len(cells), len(cells) * pages * cell_w, store,
+            100.0 * store / (len(cells) * pages * cell_w)))
+        size += store
+
+    out.write('const struct font %s = {\n' % args.name)
+    out.write('    %d, %d, %d, %d, %s_data%s\n' % (cell_w, pages, args.first, args.count, args.name, ext))
+    out.write('};\n')
+
+    sys.stderr.write('%s: %dx%d cells, %d glyphs, %d bytes flash, 0 bytes RAM\n' % (
+        args.name, cell_w, pages * 8, args.count, size))
+
+if __name__ == '__main__':
+    main()
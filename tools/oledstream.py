@@ -0,0 +1,229 @@
+#!/usr/bin/env python3
+# Copyright (c) 2017 Wladimir J. van der Laan
+# Distributed under the MIT software license, see the accompanying
+# file COPYING or http://www.opensource.org/licenses/mit-license.php.
+'''
+Send frames to the display in streaming mode (see stream.h).
+
+Frames are 128x32 PBM images (P1 or P4), or a generated test pattern with
+--demo. Every frame is sent as the smallest of a full frame, a run-length
+coded frame and a run-length coded difference with the previous frame. The
+device acknowledges every packet; one packet is kept in flight ahead of the
+acknowledgements so that decoding overlaps the transfer.
+
+Usage: oledstream.py --port /dev/ttyUSB1 [--baud 115200] [--fps N] [--loop] [--demo N] [frames.pbm ...]
+'''
+import argparse
+import math
+import os
+import select
+import sys
+import termios
+import time
+
+W = 128
+H = 32
+PAGES = H // 8
+FRAME_SIZE = W * PAGES
+
+MAGIC = 0xA5
+FULL = 0x01
+RLE = 0x02
+DELTA = 0x03
+END = 0x04
+ACK = 0x06
+NAK = 0x15
+
+WINDOW = 2
+ACK_TIMEOUT = 2.0
+
+def read_pbm(name):
+    '''Read a PBM file, return list of rows of 0/1 pixels'''
+    with open(name, 'rb') as f:
+        data = f.read()
+    tokens = []
+    pos = 0
+    # Header: magic, width, height, with comments
+    while len(tokens) < 3:
+        while data[pos:pos+1].isspace():
+            pos += 1
+        if data[pos:pos+1] == b'#':
+            while data[pos:pos+1] not in (b'\n', b''):
+                pos += 1
+            continue
+        start = pos
+        while not data[pos:pos+1].isspace():
+            pos += 1
+        tokens.append(data[start:pos])
+    magic, width, height = tokens[0], int(tokens[1]), int(tokens[2])
+    if (width, height) != (W, H):
+        raise ValueError('%s: image is %dx%d, expected %dx%d' % (name, width, height, W, H))
+    if magic == b'P4':
+        pos += 1
+        stride = (width + 7) // 8
+        return [[(data[pos + y * stride + x // 8] >> (7 - x % 8)) & 1 for x in range(width)] for y in range(height)]
+    elif magic == b'P1':
+        bits = [int(c) for c in data[pos:].decode() if c in '01']
+        return [bits[y * width:(y + 1) * width] for y in range(height)]
+    raise ValueError('%s: not a PBM file' % name)
+
+def to_pages(pixels):
+    '''Convert rows of pixels to display page layout'''
+    frame = bytearray(FRAME_SIZE)
+    for page in range(PAGES):
+        for x in range(W):
+            v = 0
+            for bit in range(8):
+                v |= pixels[page * 8 + bit][x] << bit
+            frame[page * W + x] = v
+    return frame
+
+def demo_frames(n):
+    '''Moving sine wave over a fixed grid'''
+    for i in range(n):
+        pixels = [[1 if (x % 32 == 0 or y == H // 2) else 0 for x in range(W)] for y in range(H)]
+        for x in range(W):
+            y = int(H / 2 + (H / 2 - 1) * math.sin((x + 2 * i) * 2 * math.pi / 64))
+            pixels[y][x] = 1
+        yield to_pages(pixels)
+
+def rle(data):
+    '''Run-length code data; runs of three or more bytes are repeated'''
+    out = bytearray()
+    literal = bytearray()
+    def flush_literal():
+        for i in range(0, len(literal), 128):
+            chunk = literal[i:i+128]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+        literal.clear()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run >= 3:
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            out.append(data[i])
+        else:
+            literal.extend(data[i:i+run])
+        i += run
+    flush_literal()
+    return out
+
+def encode(frame, prev):
+    '''Return (type, payload) for the smallest encoding of frame'''
+    options = [(FULL, bytes(frame)), (RLE, rle(frame))]
+    if prev is not None:
+        delta = bytearray(a ^ b for a, b in zip(frame, prev))
+        # Trailing unchanged bytes need not be sent
+        end = len(delta)
+        while end > 0 and delta[end - 1] == 0:
+            end -= 1
+        options.append((DELTA, rle(delta[:end])))
+    return min(options, key=lambda o: len(o[1]))
+
+def packet(type_, payload):
+    check = -sum(payload) & 0xff
+    return bytes([MAGIC, type_, len(payload) & 0xff, len(payload) >> 8]) + bytes(payload) + bytes([check])
+
+def open_port(name, baud):
+    fd = os.open(name, os.O_RDWR | os.O_NOCTTY)
+    attrs = termios.tcgetattr(fd)
+    attrs[0] = 0 # iflag
+    attrs[1] = 0 # oflag
+    attrs[2] = termios.CS8 | termios.CREAD | termios.CLOCAL # cflag
+    attrs[3] = 0 # lflag
+    speed = getattr(termios, 'B%d' % baud)
+    attrs[4] = attrs[5] = speed
+    attrs[6][termios.VMIN] = 0
+    attrs[6][termios.VTIME] = 0
+    termios.tcsetattr(fd, termios.TCSANOW, attrs)
+    termios.tcflush(fd, termios.TCIFLUSH)
+    return fd
+
+class Link:
+    '''Packet sender with acknowledgement window'''
+    def __init__(self, fd):
+        self.fd = fd
+        self.in_flight = 0
+        self.naks = 0
+
+    def wait_reply(self):
+        '''Wait for one ACK or NAK; other bytes (text output) are skipped'''
+        deadline = time.monotonic() + ACK_TIMEOUT
+        while True:
+            left = deadline - time.monotonic()
+            if left <= 0 or not select.select([self.fd], [], [], left)[0]:
+                raise TimeoutError('no reply from device, is it in streaming mode?')
+            for c in os.read(self.fd, 1):
+                if c in (ACK, NAK):
+                    self.in_flight -= 1
+                    self.naks += c == NAK
+                    return c
+
+    def send(self, data):
+        while self.in_flight >= WINDOW:
+            self.wait_reply()
+        os.write(self.fd, data)
+        self.in_flight += 1
+
+    def drain(self):
+        while self.in_flight:
+            self.wait_reply()
+
+def main():
+    parser = argparse.ArgumentParser(description='Send frames to the display in streaming mode')
+    parser.add_argument('frames', nargs='*', help='128x32 PBM images')
+    parser.add_argument('--port', required=True, help='serial port')
+    parser.add_argument('--baud', type=int, default=115200, help='baud rate (default: 115200)')
+    parser.add_argument('--fps', type=float, default=0, help='frame rate limit (default: as fast as possible)')
+    parser.add_argument('--loop', action='store_true', help='repeat until interrupted')
+    parser.add_argument('--demo', type=int, metavar='N', default=0, help='send N frames of a test pattern')
+    parser.add_argument('--end', action='store_true', help='leave streaming mode when done')
+    args = parser.parse_args()
+
+    frames = [to_pages(read_pbm(name)) for name in args.frames]
+    frames.extend(demo_frames(args.demo))
+    if not frames:
+        print('no frames given', file=sys.stderr)
+        exit(1)
+
+    link = Link(open_port(args.port, args.baud))
+    prev = None
+    sent = [0, 0, 0, 0]
+    count = 0
+    naks = 0
+    start = time.monotonic()
+    try:
+        while True:
+            for frame in frames:
+                if link.naks != naks:
+                    # Device refuses deltas until the next whole frame
+                    naks = link.naks
+                    prev = None
+                type_, payload = encode(frame, prev)
+                if args.fps:
+                    delay = start + count / args.fps - time.monotonic()
+                    if delay > 0:
+                        time.sleep(delay)
+                data = packet(type_, payload)
+                link.send(data)
+                sent[type_ - FULL] += 1
+                sent[3] += len(data)
+                prev = frame
+                count += 1
+            if not args.loop:
+                break
+        if args.end:
+            link.send(packet(END, b''))
+        link.drain()
+    except KeyboardInterrupt:
+        pass
+    elapsed = time.monotonic() - start
+    print('%d frames (%d full, %d rle, %d delta), %d bytes, %.1f bytes/frame, %.1f frames/s, %d rejected' % (
+        count, sent[0], sent[1], sent[2], sent[3], sent[3] / max(count, 1), count / elapsed, link.naks), file=sys.stderr)
+
+if __name__ == '__main__':
+    main()
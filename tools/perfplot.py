@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+# Copyright (c) 2017 Wladimir J. van der Laan
+# Distributed under the MIT software license, see the accompanying
+# file COPYING or http://www.opensource.org/licenses/mit-license.php.
+'''
+Summarize the performance counter reports (see perf.h) in a captured UART log.
+
+Other lines in the log are ignored. Prints, per report, every counter divided
+by the number of frames, then the frame time histogram over all reports as a
+bar chart. With --csv, writes the per-report counters as a CSV table instead,
+for plotting with other tools.
+
+Usage: perfplot.py [log] [--csv]
+'''
+import argparse
+import sys
+
+BAR_WIDTH = 50
+
+def parse_log(f):
+    '''Return counter names, list of (frames, counters) and histogram dict'''
+    names = None
+    reports = []
+    hist = {}
+    for line in f:
+        fields = line.strip().split(',')
+        if fields[0] == 'perf' and len(fields) > 1:
+            if fields[1] == 'names':
+                names = fields[2:]
+            else:
+                reports.append((int(fields[1]), [int(x) for x in fields[2:]]))
+        elif fields[0] == 'hist' and len(fields) > 1:
+            lo = int(fields[1])
+            for i, count in enumerate(fields[2:]):
+                hist[lo + i] = hist.get(lo + i, 0) + int(count)
+    if names is None and reports:
+        names = ['c%d' % i for i in range(len(reports[0][1]))]
+    return names, reports, hist
+
+def main():
+    parser = argparse.ArgumentParser(description='Summarize performance counter reports')
+    parser.add_argument('log', nargs='?', help='UART log (default: stdin)')
+    parser.add_argument('--csv', action='store_true', help='write per-report counters as CSV')
+    args = parser.parse_args()
+
+    f = open(args.log) if args.log else sys.stdin
+    names, reports, hist = parse_log(f)
+    if not reports:
+        print('no perf reports found', file=sys.stderr)
+        exit(1)
+
+    if args.csv:
+        print(','.join(['frames'] + names))
+        for frames, counters in reports:
+            print(','.join(str(x) for x in [frames] + counters))
+        return
+
+    print('per frame:')
+    print(' '.join('%12s' % n for n in ['report'] + names))
+    for i, (frames, counters) in enumerate(reports):
+        print(' '.join(['%12d' % i] + ['%12d' % (c // frames) for c in counters]))
+
+    print()
+    print('frame time histogram (cycles):')
+    total = sum(hist.values())
+    peak = max(hist.values())
+    for k in range(min(hist), max(hist) + 1):
+        count = hist.get(k, 0)
+        bar = '#' * ((count * BAR_WIDTH + peak - 1) // peak)
+        print('%10d..%-10d %6d %5.1f%% %s' % (1 << k, (1 << (k + 1)) - 1, count, 100.0 * count / total, bar))
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,212 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#include "uart.h"
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "platform.h"
+
+#include "irq.h"
+#include "events.h"
+
+/** Interrupt when fewer than this many bytes are left in the transmit FIFO:
+ * two character times to refill it before the line goes idle.
+ */
+#define TX_WATERMARK 2
+
+/** Receive ring buffer. Written by the interrupt handler at rx_head, read
+ * by the main program at rx_tail. Indices run freely and are masked on use.
+ */
+static char rx_buf[UART_RX_SIZE];
+static volatile unsigned rx_head;
+static volatile unsigned rx_tail;
+static volatile unsigned rx_dropped;
+
+/** Transmit ring buffer. Written by the main program at tx_head, read at
+ * tx_tail by the interrupt handler, or by the main program with interrupts
+ * disabled.
+ */
+static char tx_buf[UART_TX_SIZE];
+static volatile unsigned tx_head;
+static volatile unsigned tx_tail;
+static unsigned tx_dropped;
+/** Interrupts are set up */
+static int tx_irq;
+/** TX watermark interrupt is enabled: the handler will drain the buffer */
+static volatile int tx_active;
+
+/** Move everything from the hardware FIFO to the ring buffer */
+static void uart_rx(void)
+{
+    unsigned head = rx_head;
+    int32_t val;
+    while ((val = (int32_t) UART0_REG(UART_REG_RXFIFO)) >= 0) {
+        if (head - rx_tail < UART_RX_SIZE) {
+            rx_buf[head % UART_RX_SIZE] = val & 0xFF;
+            ++head;
+        } else {
+            ++rx_dropped;
+        }
+    }
+    if (head != rx_head) {
+        rx_head = head;
+        event_post(EVENT_UART_RX);
+    }
+}
+
+/** Move bytes from the ring buffer to the hardware FIFO until either is
+ * exhausted. Enable the TX watermark interrupt while bytes are left, disable
+ * it when the buffer is empty. Call from the interrupt handler or with
+ * interrupts disabled.
+ */
+static void uart_tx(void)
+{
+    unsigned tail = tx_tail;
+    while (tail != tx_head && (int32_t) UART0_REG(UART_REG_TXFIFO) >= 0) {
+        UART0_REG(UART_REG_TXFIFO) = tx_buf[tail % UART_TX_SIZE];
+        ++tail;
+    }
+    tx_tail = tail;
+    int active = tx_irq && tail != tx_head;
+    if (active != tx_active) {
+        if (active) {
+            UART0_REG(UART_REG_IE) |= UART_IP_TXWM;
+        } else {
+            UART0_REG(UART_REG_IE) &= ~UART_IP_TXWM;
+        }
+        tx_active = active;
+    }
+}
+
+static void uart_isr(void)
+{
+    uart_rx();
+    if (tx_active) {
+        uart_tx();
+    }
+}
+
+void uart_irq_init(void)
+{
+    // Interrupt as soon as there is a byte in the FIFO
+    UART0_REG(UART_REG_RXCTRL) = UART_RXEN | UART_RXWM(0);
+    UART0_REG(UART_REG_TXCTRL) = UART_TXEN | UART_TXWM(TX_WATERMARK);
+    UART0_REG(UART_REG_IE) = UART_IP_RXWM;
+    irq_register(INT_UART0_BASE, uart_isr, 2);
+    irq_disable();
+    tx_irq = 1;
+    uart_tx();
+    irq_enable();
+}
+
+int uart_getc(char *c)
+{
+    return uart_read(c, 1);
+}
+
+size_t uart_read(char *buf, size_t n)
+{
+    unsigned tail = rx_tail;
+    size_t count = 0;
+    while (count < n && tail != rx_head) {
+        buf[count++] = rx_buf[tail % UART_RX_SIZE];
+        ++tail;
+    }
+    rx_tail = tail;
+    return count;
+}
+
+unsigned uart_rx_dropped(void)
+{
+    return rx_dropped;
+}
+
+/** Start transmission if the interrupt handler is not already busy with it */
+static void tx_kick(void)
+{
+    if (!tx_irq) {
+        uart_tx(); /* polling, before uart_irq_init() */
+        return;
+    }
+    irq_disable();
+    if (!tx_active) {
+        uart_tx();
+    }
+    irq_enable();
+}
+
+/** Wait until the transmit buffer has at least n bytes free */
+static void tx_wait(size_t n)
+{
+    while (UART_TX_SIZE - (tx_head - tx_tail) < n) {
+        if (!tx_irq) {
+            uart_tx();
+            continue;
+        }
+        irq_disable();
+        if (UART_TX_SIZE - (tx_head - tx_tail) < n) {
+            irq_wait();
+        }
+        irq_enable();
+    }
+}
+
+size_t uart_write(const char *buf, size_t n, enum uart_policy policy)
+{
+    if (policy == UART_DROP && n > UART_TX_SIZE - (tx_head - tx_tail)) {
+        tx_dropped += n;
+        return 0;
+    }
+    size_t done = 0;
+    while (done < n) {
+        size_t chunk = n - done;
+        if (chunk > UART_TX_SIZE) {
+            chunk = UART_TX_SIZE;
+        }
+        tx_wait(chunk);
+        /* Copy in up to two pieces, around the end of the buffer */
+        unsigned head = tx_head;
+        size_t pos = head % UART_TX_SIZE;
+        size_t first = UART_TX_SIZE - pos;
+        if (first > chunk) {
+            first = chunk;
+        }
+        memcpy(&tx_buf[pos], buf + done, first);
+        memcpy(&tx_buf[0], buf + done + first, chunk - first);
+        tx_head = head + chunk;
+        done += chunk;
+        if (!tx_active) {
+            tx_kick();
+        }
+    }
+    return n;
+}
+
+int uart_printf(enum uart_policy policy, const char *fmt, ...)
+{
+    char buf[UART_PRINTF_MAX];
+    va_list ap;
+    va_start(ap, fmt);
+    int len = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    if (len < 0) {
+        return len;
+    }
+    if (len > (int)sizeof(buf) - 1) {
+        len = sizeof(buf) - 1;
+    }
+    return uart_write(buf, len, policy);
+}
+
+void uart_flush(void)
+{
+    tx_wait(UART_TX_SIZE);
+}
+
+unsigned uart_tx_dropped(void)
+{
+    return tx_dropped;
+}
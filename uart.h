@@ -0,0 +1,51 @@
+// Copyright (c) 2017 Wladimir J. van der Laan
+// Distributed under the MIT software license, see the accompanying
+// file COPYING or http://www.opensource.org/licenses/mit-license.php.
+#ifndef H_UART
+#define H_UART
+/* Interrupt-driven UART0.
+ * Received bytes are moved from the 8-entry hardware FIFO into a ring buffer
+ * by the RX watermark interrupt, so nothing is lost while the main loop is
+ * busy for longer than eight character times.
+ * Transmitted bytes go through a second ring buffer that is drained by the TX
+ * watermark interrupt, so output costs a copy instead of waiting for the
+ * line.
+ */
+#include <stddef.h>
+
+/** Size of receive ring buffer, must be a power of two */
+#define UART_RX_SIZE 256
+/** Size of transmit ring buffer, must be a power of two */
+#define UART_TX_SIZE 1024
+/** Longest line uart_printf() formats, including terminating zero */
+#define UART_PRINTF_MAX 160
+
+/** What uart_write() does when the transmit buffer is full */
+enum uart_policy {
+    UART_BLOCK, /**< sleep until there is space */
+    UART_DROP   /**< write nothing unless everything fits, count it as dropped */
+};
+
+/** Enable receive and transmit interrupts. Call after uart_init() and
+ * irq_init(). Before this, uart_write() pushes bytes out by polling.
+ */
+void uart_irq_init(void);
+/** Get a received byte. Returns 1 if a byte was available, 0 otherwise. */
+int uart_getc(char *c);
+/** Get up to n received bytes without blocking. Returns number of bytes read. */
+size_t uart_read(char *buf, size_t n);
+/** Number of bytes dropped because the ring buffer was full */
+unsigned uart_rx_dropped(void);
+/** Queue n bytes for transmission. Returns number of bytes queued, which is
+ * n or (with UART_DROP) 0.
+ */
+size_t uart_write(const char *buf, size_t n, enum uart_policy policy);
+/** Format and queue a message, truncated to UART_PRINTF_MAX-1 bytes */
+int uart_printf(enum uart_policy policy, const char *fmt, ...)
+    __attribute__((format(printf, 2, 3)));
+/** Wait until all queued bytes are in the hardware FIFO */
+void uart_flush(void);
+/** Number of bytes dropped by UART_DROP writes */
+unsigned uart_tx_dropped(void);
+
+#endif